@@ -0,0 +1,79 @@
+/**
+ * @file ArenaLib.h
+ * @brief File containing the function definitions of a bump allocator
+ */
+
+#ifndef _ARENA_API_
+#define _ARENA_API_
+
+#include <stddef.h>
+
+/**
+ * A block of memory owned by an arena. Blocks are chained together so the
+ * whole arena can be released by walking the chain.
+ **/
+typedef struct arenaBlock{
+    struct arenaBlock* next;
+    size_t size;
+    size_t used;
+} ArenaBlock;
+
+/**
+ * Arena head. Allocations are carved out of the current block in order and
+ * are never freed on their own, only all at once with deleteArena.
+ **/
+typedef struct arena{
+    ArenaBlock* current;
+    size_t blockSize;
+} Arena;
+
+
+/** Function to create an empty arena.
+*@post Arena has been allocated with one block ready for use
+*@return On success returns a newly allocated Arena. Returns NULL if malloc fails
+*@param initialSize - size in bytes of the first block, later blocks grow from it
+**/
+Arena* createArena(size_t initialSize);
+
+
+/** Releases every block of the arena and the arena itself.
+* Every pointer returned by the arena is invalid afterwards.
+*@param arena - pointer to the Arena, may be NULL
+**/
+void deleteArena(Arena* arena);
+
+
+/** Allocates memory from the arena, suitably aligned for any type.
+*@pre arena must have been created with createArena
+*@return On success returns a pointer to size bytes. Returns NULL if malloc fails
+*@param arena - pointer to the Arena
+*@param size - number of bytes to allocate
+**/
+void* arenaAlloc(Arena* arena, size_t size);
+
+
+/** Copies a string into the arena.
+*@return On success returns the copy. Returns NULL if string is NULL or malloc fails
+*@param arena - pointer to the Arena
+*@param string - NUL terminated string to copy
+**/
+char* arenaStrdup(Arena* arena, const char* string);
+
+
+/** Copies at most length characters of a string into the arena and NUL terminates the copy.
+*@return On success returns the copy. Returns NULL if string is NULL or malloc fails
+*@param arena - pointer to the Arena
+*@param string - string to copy
+*@param length - maximum number of characters to copy
+**/
+char* arenaStrndup(Arena* arena, const char* string, size_t length);
+
+
+/** Formats a string like sprintf into memory taken from the arena.
+*@return On success returns the formatted string. Returns NULL if malloc fails
+*@param arena - pointer to the Arena
+*@param format - printf style format string
+**/
+char* arenaSprintf(Arena* arena, const char* format, ...);
+
+#endif
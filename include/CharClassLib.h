@@ -0,0 +1,65 @@
+/**
+ * @file CharClassLib.h
+ * @brief File containing the function definitions of the Unicode character classes the scanner tells apart
+ */
+
+#ifndef _CHAR_CLASS_API_
+#define _CHAR_CLASS_API_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Classes of character that Cooklang treats differently from plain text.
+ * The table behind them is generated by scripts/CharClassTable.py.
+ **/
+typedef enum charClass{
+    CHAR_CLASS_OTHER,
+    //Tab and the Unicode space separators
+    CHAR_CLASS_SPACE,
+    //Line feed, carriage return, next line, line and paragraph separators
+    CHAR_CLASS_NEW_LINE,
+    //Unicode punctuation other than the marks Cooklang uses itself
+    CHAR_CLASS_PUNCTUATION
+} CharClass;
+
+/**
+ * Symbols a multi-byte character is replaced with in the class stream. The
+ * first byte becomes the symbol of its class and every other byte becomes a
+ * continuation symbol, so offsets in the stream match offsets in the source.
+ * The patterns in Cooklang.l spell out these same values.
+ **/
+#define CHAR_CLASS_SYMBOL(characterClass) (0x80 + (characterClass))
+#define CHAR_CLASS_CONTINUATION 0x84
+
+
+/** Function to look up the class of a code point.
+*@return The class, CHAR_CLASS_OTHER for anything outside of Unicode
+*@param codepoint - the code point to look up
+**/
+CharClass charClass(uint32_t codepoint);
+
+
+/** Function to decode the UTF-8 character at the start of some text. Only the
+* shortest encoding of a code point is accepted, so every character has
+* exactly one spelling.
+*@return The number of bytes in the character, or 0 if the text does not start
+* with a whole, valid character
+*@param text - the text to decode from
+*@param limit - the end of the text, nothing at or after it is read
+*@param codepoint - set to the decoded code point when the character is valid
+**/
+size_t decodeCharacter(const char* text, const char* limit, uint32_t* codepoint);
+
+
+/** Function to build the class stream the scanner matches instead of the source.
+* ASCII is kept as it is and bytes that are not part of a valid character count as other.
+*@return The class stream, which has the same size as the source and must be freed by
+* the caller. If the source is all ASCII there is nothing to replace and the source itself
+* is returned. Returns NULL if the allocation fails
+*@param source - the source text
+*@param size - the number of bytes of source
+**/
+char* classifySource(char* source, size_t size);
+
+#endif
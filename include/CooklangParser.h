@@ -4,17 +4,35 @@
 #include "LinkedListLib.h"
 #include "CooklangRecipe.h"
 
+// a view into the source the scanner is running over - it is not NUL
+// terminated, and a NULL start means there is no text at all
+typedef struct {
+  const char * start;
+  size_t length;
+} Span;
+
 #endif
 
 
 
 // wrappers
 Recipe * parseRecipe( char * fileName );
+Recipe * parseRecipeStream( FILE * file );
 Recipe * parseRecipeString( char * inputRecipeString );
+Recipe * parseRecipeBuffer( const char * buffer, size_t length );
+
+
+// accessors
+Step * getStep( Recipe * recipe, size_t index );
+Direction * getDirection( Step * step, size_t index );
+size_t getStepCount( Recipe * recipe );
+size_t getDirectionCount( Step * step );
 
 
 // others
-char * addTwoStrings(char * first, char * second);
-char * addThreeStrings(char * first, char * second, char * third);
-void addDirection( Recipe * recipe, char * type, char * value, char * amountString );
-void addMetaData( Recipe * recipe, char * metaDataString );
+Span stringToSpan( char * string );
+Span joinSpans( Arena * arena, Span first, Span second );
+char * spanToString( Arena * arena, Span span );
+void addDirection( Recipe * recipe, DirectionKind kind, Span value, Span amount );
+void addStep( Recipe * recipe );
+void addMetaData( Recipe * recipe, Span metaData );
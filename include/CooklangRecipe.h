@@ -2,8 +2,8 @@
 #define INCLUDED_REC
 
 #include "LinkedListLib.h"
-
-#endif
+#include "VectorLib.h"
+#include "ArenaLib.h"
 
 
 // data structure definitions
@@ -13,7 +13,11 @@ typedef struct {
   // all datatypes in Recipe are required to be initialized, although not required to have any content
   List * metaData;
 
-  List * stepList;
+  // the steps in order, stored by value - use getStep to index them
+  Vector steps;
+
+  // owns the recipe and everything in it - freed all at once by deleteRecipe
+  Arena * arena;
 
 } Recipe;
 
@@ -33,13 +37,22 @@ typedef struct {
 
 
 
+// the kinds of direction a step can be made of
+typedef enum {
+  DIRECTION_TEXT,
+  DIRECTION_INGREDIENT,
+  DIRECTION_COOKWARE,
+  DIRECTION_TIMER
+} DirectionKind;
+
+
 typedef struct {
   // a NULL value means that there is none of the given argument in the direction
   // except for double, where -1 means none given
 
-  // the type of direction, either textitem, ingredient, cookware, timer
-  // required
-  char * type;
+  // the kind of direction, either textitem, ingredient, cookware, timer
+  // required - directionKindName gives the name used in output
+  DirectionKind kind;
 
   // the readable text value to be displayed on request - usually just the name
   // for text items it is just the text item string
@@ -65,12 +78,13 @@ typedef struct {
 // A step
 typedef struct {
 
-  // just a list of directions
-  List * directions;
+  // the directions in order, stored by value
+  Vector directions;
 
-  List * ingredientList;
+  // indices into directions of the ingredients and cookware, as size_t
+  Vector ingredients;
 
-  List * equipmentList;
+  Vector equipment;
 
 } Step;
 
@@ -93,31 +107,37 @@ Recipe * createRecipe();
 void deleteRecipe( void * data );
 char * recipeToString( void * data );
 
+size_t serializedRecipeSize( Recipe * recipe );
+void serializeRecipe( Recipe * recipe, char * out );
+Recipe * deserializeRecipe( const char * data, size_t length );
+
+void appendRecipeJson( StringBuilder * builder, Recipe * recipe );
+
 
-Metadata * createMetadata( char * metaString );
+Metadata * createMetadata( Arena * arena, char * metaString );
 
 void deleteMetadata( void * data );
 char * metadataToString( void * data );
 int compareMetadata( const void * first, const void * second );
 
 
-Direction * createDirection( char * type, char * value, char * amountString );
+bool initializeDirection( Direction * direction, Arena * arena, DirectionKind kind, char * value, char * amountString );
+const char * directionKindName( DirectionKind kind );
+double directionQuantity( Direction * direction );
 
-void deleteDirection( void * data );
-void dummyDeleteDirection( void * data);
+void appendDirection( StringBuilder * builder, void * data );
 char * directionToString( void * data );
-int compareDirections( const void * first, const void * second );
 
 
-Step * createStep();
+void initializeStep( Step * step, Arena * arena );
 
-void deleteStep( void * data );
+void appendStep( StringBuilder * builder, void * data );
 char * stepToString( void * data );
-int compareSteps( const void * first, const void * second );
 
 
 
 
+void appendIngredient( StringBuilder * builder, void * data );
 char * ingredientToString( void * data );
 
 char ** parseAmountString( char * amountString );
@@ -126,3 +146,5 @@ char ** parseMetaString( char * metaString );
 char * trimWhiteSpace(char * input);
 
 int checkIsNumber( char * input );
+
+#endif
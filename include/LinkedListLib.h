@@ -14,6 +14,8 @@
 #include <stdbool.h>
 #include <assert.h>
 
+#include "ArenaLib.h"
+
 /**
  * Node of a linked list. This list is doubly linked, meaning that it has points to both the node immediately in front
  * of it, as well as the node immediately behind it.
@@ -37,6 +39,8 @@ typedef struct listHead{
     void (*deleteData)(void* toBeDeleted);
     int (*compare)(const void* first,const void* second);
     char* (*printData)(void* toBePrinted);
+    // when not NULL the list, its nodes and its data all live in this arena
+    Arena* arena;
 } List;
 
 
@@ -64,6 +68,21 @@ List* initializeList(char* (*printFunction)(void* toBePrinted),void (*deleteFunc
 
 
 
+/** Function to initialize a list whose List struct and nodes are allocated from an arena.
+* The data stored in the list is assumed to be owned by the same arena, so clearing or freeing the list
+* never calls the delete function or frees anything - the memory is released with the arena.
+*@pre arena must have been created with createArena, function pointer arguments must not be NULL
+*@post List structure has been allocated from the arena and initialized
+*@return On success returns newly allocated List struct. Returns NULL if the arena allocation fails
+*@param arena - the arena that owns the list
+*@param printFunction - function pointer to print a single node of the list
+*@param deleteFunction - function pointer to delete a single piece of data from the list
+*@param compareFunction - function pointer to compare two nodes of the list in order to test for equality or order
+**/
+List* initializeListInArena(Arena* arena, char* (*printFunction)(void* toBePrinted),void (*deleteFunction)(void* toBeDeleted),int (*compareFunction)(const void* first,const void* second));
+
+
+
 /**Function for creating a node for the linked list.
 * This node contains abstracted (void *) data as well as previous and next
 * pointers to connect to other nodes in the list
@@ -11,19 +11,54 @@ typedef struct {
 
 } ShoppingList;
 
+// the name, the synonyms and their text are allocated in one block with the
+// item, deleteShoppingItem frees them all at once
 typedef struct {
 
   // required, the first name
   char * name;
 
-  // any other synonyms
+  // any other synonyms, NULL terminated - NULL when there are none
   char ** synonyms;
 
 } ShoppingItem;
 
+// a name or synonym in a shopping index, with the list and item it belongs to
+typedef struct {
+
+  // points into the item's own strings, NULL for an empty slot
+  const char * key;
+  size_t keyLength;
+
+  ShoppingList * list;
+  ShoppingItem * item;
+
+  // where the list is in the file, counting from 0
+  size_t listPosition;
+
+} ShoppingIndexEntry;
+
+// open addressing hash table over every name and synonym of some shopping
+// lists, it only points into them so they have to outlive it
+typedef struct {
+
+  ShoppingIndexEntry * entries;
+
+  // always a power of two, at least twice the count
+  size_t capacity;
+  size_t count;
+
+} ShoppingIndex;
+
 
 
 List * parseShoppingLists( char * fileName );
+List * parseShoppingListsBuffer( const char * buffer, size_t length );
+
+
+ShoppingIndex * createShoppingIndex( List * shoppingLists );
+void deleteShoppingIndex( ShoppingIndex * index );
+ShoppingIndexEntry * findShoppingItem( ShoppingIndex * index, const char * name, size_t length );
 
 
 ShoppingList * createShoppingList( char * category );
@@ -0,0 +1,59 @@
+#ifndef INCLUDED_PLAN
+#define INCLUDED_PLAN
+
+#include "CooklangRecipe.h"
+#include "ShoppingListParser.h"
+
+
+// one line of a shopping plan, every ingredient of the recipes with the same
+// name, unit and kind of quantity merged together
+typedef struct {
+
+  // the shopping list the item is on, NULL when no list has it
+  ShoppingList * list;
+
+  // where the list is in the file, used to group the plan
+  size_t listPosition;
+
+  // the name of the shopping item, or the first name it was written with
+  char * name;
+
+  // empty when there is no unit
+  char * unit;
+
+  // the sum of the quantities - NAN when the quantity is text
+  double quantity;
+
+  // the text of a quantity that is not a number, NULL when it is one
+  char * quantityText;
+
+  // the position of the first ingredient merged into the line
+  size_t order;
+
+} ShoppingPlanItem;
+
+
+// the merged ingredients of some recipes
+typedef struct {
+
+  // the lines, stored by value - grouped by list in file order, lines that are
+  // on no list come last, and in order of first use within a group
+  Vector items;
+
+  // owns the plan and everything in it
+  Arena * arena;
+
+} ShoppingPlan;
+
+
+
+
+// * * * * * * * * * * * * * * * * * * * *
+// ******** Function Definitions *********
+// * * * * * * * * * * * * * * * * * * * *
+
+
+ShoppingPlan * createShoppingPlan( Recipe ** recipes, size_t count, ShoppingIndex * index );
+void deleteShoppingPlan( ShoppingPlan * plan );
+
+#endif
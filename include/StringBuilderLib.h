@@ -0,0 +1,63 @@
+/**
+ * @file StringBuilderLib.h
+ * @brief File containing the function definitions of a growable string
+ */
+
+#ifndef _STRING_BUILDER_API_
+#define _STRING_BUILDER_API_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * String builder. Text is appended to the end of one buffer that grows by
+ * doubling, so building a string of n characters takes O(n) time no matter
+ * how many pieces it is made of.
+ **/
+typedef struct stringBuilder{
+    char* buffer;
+    size_t length;
+    size_t capacity;
+
+    //Set once an allocation fails, every append after that does nothing
+    bool failed;
+} StringBuilder;
+
+
+/** Function to set up an empty string builder.
+*@post StringBuilder is empty, nothing is allocated until the first append
+*@param builder - pointer to the StringBuilder to set up
+**/
+void initializeStringBuilder(StringBuilder* builder);
+
+
+/** Appends a string to the end of the builder.
+*@param builder - pointer to the StringBuilder
+*@param string - NUL terminated string to append
+**/
+void appendString(StringBuilder* builder, const char* string);
+
+
+/** Appends length bytes to the end of the builder, they may include NULs.
+*@param builder - pointer to the StringBuilder
+*@param data - bytes to append
+*@param length - number of bytes to append
+**/
+void appendBytes(StringBuilder* builder, const char* data, size_t length);
+
+
+/** Appends text formatted like printf to the end of the builder.
+*@param builder - pointer to the StringBuilder
+*@param format - printf style format string
+**/
+void appendFormat(StringBuilder* builder, const char* format, ...);
+
+
+/** Hands the built string over to the caller and empties the builder.
+*@return On success returns the NUL terminated string, which must be freed by the caller.
+* Returns NULL if any allocation failed while building it
+*@param builder - pointer to the StringBuilder
+**/
+char* finishStringBuilder(StringBuilder* builder);
+
+#endif
@@ -0,0 +1,109 @@
+/**
+ * @file VectorLib.h
+ * @brief File containing the function definitions of a growable array
+ */
+
+#ifndef _VECTOR_API_
+#define _VECTOR_API_
+
+#include <stddef.h>
+
+#include "ArenaLib.h"
+#include "StringBuilderLib.h"
+
+/**
+ * Vector head. Elements are stored by value back to back, so the i-th one is
+ * found without walking the others. Growing the vector moves the elements,
+ * pointers to them are only valid until the next push.
+ **/
+typedef struct vector{
+    void* elements;
+    size_t length;
+    size_t capacity;
+    size_t elementSize;
+
+    //Function pointer to append the string form of an element to a builder
+    void (*appendData)(StringBuilder* builder, void* toBePrinted);
+
+    //Arena holding the elements, NULL when they live on the heap
+    Arena* arena;
+} Vector;
+
+
+/** Function to set up an empty vector.
+*@post Vector is empty, nothing is allocated until the first push
+*@param vector - pointer to the Vector to set up
+*@param arena - arena to allocate the elements from, NULL to use the heap
+*@param elementSize - size in bytes of one element
+*@param appendFunction - function pointer to print a single element into a builder, may be NULL
+**/
+void initializeVector(Vector* vector, Arena* arena, size_t elementSize, void (*appendFunction)(StringBuilder* builder, void* toBePrinted));
+
+
+/** Releases the elements of a heap vector and empties it. Arena vectors are
+* only emptied, their elements are released with the arena.
+*@param vector - pointer to the Vector
+**/
+void clearVector(Vector* vector);
+
+
+/** Adds a zeroed element to the back of the vector, growing it if needed.
+*@return On success returns a pointer to the new element. Returns NULL if malloc fails
+*@param vector - pointer to the Vector
+**/
+void* vectorPush(Vector* vector);
+
+
+/** Returns a pointer to the element at the given index.
+*@return pointer to the element, NULL if the index is out of range
+*@param vector - pointer to the Vector
+*@param index - position of the element, starting at 0
+**/
+void* vectorGet(Vector* vector, size_t index);
+
+
+/** Returns a pointer to the last element of the vector.
+*@return pointer to the element, NULL if the vector is empty
+*@param vector - pointer to the Vector
+**/
+void* vectorBack(Vector* vector);
+
+
+/** Returns the number of elements in the vector.
+*@param vector - pointer to the Vector
+**/
+size_t vectorLength(Vector* vector);
+
+
+/** Appends every element to the builder, each one on a new line, using the
+* vector's appendData function.
+*@param builder - pointer to the StringBuilder to append to
+*@param vector - pointer to the Vector
+**/
+void appendVector(StringBuilder* builder, Vector* vector);
+
+
+/** Like appendVector, but every element is preceded by a "<delim> <n>:" line
+* where n counts from 1.
+*@param builder - pointer to the StringBuilder to append to
+*@param vector - pointer to the Vector
+*@param delim - label written before each element
+**/
+void appendVectorDelim(StringBuilder* builder, Vector* vector, char* delim);
+
+
+/** Returns a string made with appendVector. The string must be freed by the caller.
+*@return On success returns the string. Returns NULL if malloc fails
+*@param vector - pointer to the Vector
+**/
+char* vectorToString(Vector* vector);
+
+
+/** Returns a string made with appendVectorDelim. The string must be freed by the caller.
+*@return On success returns the string. Returns NULL if malloc fails
+*@param vector - pointer to the Vector
+*@param delim - label written before each element
+**/
+char* vectorToStringDelim(Vector* vector, char* delim);
+
+#endif
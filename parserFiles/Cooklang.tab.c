@@ -55,7 +55,7 @@
 #define YYSKELETON_NAME "yacc.c"
 
 /* Pure parsers.  */
-#define YYPURE 0
+#define YYPURE 2
 
 /* Push parsers.  */
 #define YYPUSH 0
@@ -78,20 +78,12 @@
 
 #define YYDEBUG 1
 
-int yylex();
+// a direction part that is not there at all, and one that is there but empty
+#define NO_SPAN ((Span){NULL, 0})
+#define EMPTY_SPAN ((Span){"", 0})
 
 
-int yyerror ( Recipe * recipe, const char * s);
-
-extern void yyrestart( FILE * input_file );
-
-
-
-
-
-
-
-#line 95 "parserFiles/Cooklang.tab.c"
+#line 87 "parserFiles/Cooklang.tab.c"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -152,6 +144,14 @@ typedef enum yysymbol_kind_t yysymbol_kind_t;
 
 
 
+/* Unqualified %code blocks.  */
+#line 26 "src/Cooklang.y"
+
+  int yylex ( YYSTYPE * yylval_param, yyscan_t scanner );
+
+  int yyerror ( yyscan_t scanner, Recipe * recipe, const char * s );
+
+#line 155 "parserFiles/Cooklang.tab.c"
 
 #ifdef short
 # undef short
@@ -532,13 +532,13 @@ static const yytype_int8 yytranslate[] =
 
 #if YYDEBUG
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_int16 yyrline[] =
+static const yytype_uint8 yyrline[] =
 {
-       0,    55,    55,    56,    61,    62,    70,    79,    83,    89,
-     102,   107,   108,   109,   110,   117,   124,   135,   136,   137,
-     141,   142,   148,   154,   160,   170,   174,   179,   185,   191,
-     195,   201,   205,   214,   219,   224,   229,   233,   239,   245,
-     252,   262,   276,   282,   289,   299,   312,   317,   322,   329
+       0,    67,    67,    68,    73,    74,    79,    87,    88,    89,
+      96,    99,   100,   101,   102,   106,   110,   117,   118,   119,
+     122,   123,   127,   131,   136,   144,   147,   151,   156,   161,
+     165,   169,   173,   180,   184,   188,   192,   196,   202,   206,
+     210,   215,   224,   228,   232,   237,   245,   248,   251,   255
 };
 #endif
 
@@ -710,7 +710,7 @@ enum { YYENOMEM = -2 };
       }                                                           \
     else                                                          \
       {                                                           \
-        yyerror (recipe, YY_("syntax error: cannot back up")); \
+        yyerror (scanner, recipe, YY_("syntax error: cannot back up")); \
         YYERROR;                                                  \
       }                                                           \
   while (0)
@@ -743,7 +743,7 @@ do {                                                                      \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Kind, Value, recipe); \
+                  Kind, Value, scanner, recipe); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
@@ -755,10 +755,11 @@ do {                                                                      \
 
 static void
 yy_symbol_value_print (FILE *yyo,
-                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, Recipe * recipe)
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, yyscan_t scanner, Recipe * recipe)
 {
   FILE *yyoutput = yyo;
   YY_USE (yyoutput);
+  YY_USE (scanner);
   YY_USE (recipe);
   if (!yyvaluep)
     return;
@@ -774,12 +775,12 @@ yy_symbol_value_print (FILE *yyo,
 
 static void
 yy_symbol_print (FILE *yyo,
-                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, Recipe * recipe)
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, yyscan_t scanner, Recipe * recipe)
 {
   YYFPRINTF (yyo, "%s %s (",
              yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyo, yykind, yyvaluep, recipe);
+  yy_symbol_value_print (yyo, yykind, yyvaluep, scanner, recipe);
   YYFPRINTF (yyo, ")");
 }
 
@@ -813,7 +814,7 @@ do {                                                            \
 
 static void
 yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
-                 int yyrule, Recipe * recipe)
+                 int yyrule, yyscan_t scanner, Recipe * recipe)
 {
   int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
@@ -826,7 +827,7 @@ yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
                        YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
-                       &yyvsp[(yyi + 1) - (yynrhs)], recipe);
+                       &yyvsp[(yyi + 1) - (yynrhs)], scanner, recipe);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -834,7 +835,7 @@ yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
 # define YY_REDUCE_PRINT(Rule)          \
 do {                                    \
   if (yydebug)                          \
-    yy_reduce_print (yyssp, yyvsp, Rule, recipe); \
+    yy_reduce_print (yyssp, yyvsp, Rule, scanner, recipe); \
 } while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
@@ -1142,9 +1143,10 @@ yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
 
 static void
 yydestruct (const char *yymsg,
-            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, Recipe * recipe)
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, yyscan_t scanner, Recipe * recipe)
 {
   YY_USE (yyvaluep);
+  YY_USE (scanner);
   YY_USE (recipe);
   if (!yymsg)
     yymsg = "Deleting";
@@ -1156,13 +1158,6 @@ yydestruct (const char *yymsg,
 }
 
 
-/* Lookahead token kind.  */
-int yychar;
-
-/* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval;
-/* Number of syntax errors so far.  */
-int yynerrs;
 
 
 
@@ -1172,8 +1167,21 @@ int yynerrs;
 `----------*/
 
 int
-yyparse (Recipe * recipe)
+yyparse (yyscan_t scanner, Recipe * recipe)
 {
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
     yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
     int yyerrstatus = 0;
@@ -1329,7 +1337,7 @@ yybackup:
   if (yychar == YYEMPTY)
     {
       YYDPRINTF ((stderr, "Reading a token\n"));
-      yychar = yylex ();
+      yychar = yylex (&yylval, scanner);
     }
 
   if (yychar <= YYEOF)
@@ -1417,423 +1425,322 @@ yyreduce:
   switch (yyn)
     {
   case 4: /* line: NL  */
-#line 61 "src/Cooklang.y"
+#line 73 "src/Cooklang.y"
             {}
-#line 1423 "parserFiles/Cooklang.tab.c"
+#line 1431 "parserFiles/Cooklang.tab.c"
     break;
 
   case 5: /* line: step NL  */
-#line 62 "src/Cooklang.y"
+#line 74 "src/Cooklang.y"
             {
-      // after a step has been finished by a new line, have to add the step to the steplist
-      // and make a new step to accept directions
-      Step * newStep = createStep();
-
-      insertBack(recipe->stepList, newStep);
-      free((yyvsp[-1].string));
+      // after a step has been finished by a new line, make a new step at the
+      // back of the recipe to accept directions
+      addStep(recipe);
     }
-#line 1436 "parserFiles/Cooklang.tab.c"
+#line 1441 "parserFiles/Cooklang.tab.c"
     break;
 
   case 6: /* line: METADATA NL  */
-#line 70 "src/Cooklang.y"
+#line 79 "src/Cooklang.y"
                 {
       // add metadata to the recipe
-      addMetaData(recipe, (yyvsp[-1].string));
-      free((yyvsp[-1].string));
+      addMetaData(recipe, (yyvsp[-1].span));
     }
-#line 1446 "parserFiles/Cooklang.tab.c"
-    break;
-
-  case 7: /* step: direction  */
-#line 79 "src/Cooklang.y"
-              {
-        (yyval.string) = strdup((yyvsp[0].string));
-        free((yyvsp[0].string));
-      }
-#line 1455 "parserFiles/Cooklang.tab.c"
-    break;
-
-  case 8: /* step: step direction  */
-#line 83 "src/Cooklang.y"
-                   {
-      (yyval.string) = malloc(strlen((yyvsp[-1].string)) + strlen((yyvsp[0].string)) + 5);
-      sprintf((yyval.string), "%s %s", (yyvsp[-1].string), (yyvsp[0].string));
-      free((yyvsp[-1].string));
-      free((yyvsp[0].string));
-    }
-#line 1466 "parserFiles/Cooklang.tab.c"
+#line 1450 "parserFiles/Cooklang.tab.c"
     break;
 
   case 9: /* step: step WHTS  */
 #line 89 "src/Cooklang.y"
               {
-      (yyval.string) = malloc(strlen((yyvsp[-1].string)) + strlen((yyvsp[0].string)) + 5);
-      sprintf((yyval.string), "%s %s", (yyvsp[-1].string), (yyvsp[0].string));
-
-      addDirection(recipe, "text", (yyvsp[0].string), NULL);
-
-      free((yyvsp[-1].string));
-      free((yyvsp[0].string));
+      addDirection(recipe, DIRECTION_TEXT, (yyvsp[0].span), NO_SPAN);
     }
-#line 1480 "parserFiles/Cooklang.tab.c"
+#line 1458 "parserFiles/Cooklang.tab.c"
     break;
 
   case 10: /* direction: text_item  */
-#line 102 "src/Cooklang.y"
+#line 96 "src/Cooklang.y"
               {
-      (yyval.string) = strdup((yyvsp[0].string));
-      addDirection(recipe, "text", (yyvsp[0].string), NULL);
-      free((yyvsp[0].string));
+      addDirection(recipe, DIRECTION_TEXT, (yyvsp[0].span), NO_SPAN);
     }
-#line 1490 "parserFiles/Cooklang.tab.c"
+#line 1466 "parserFiles/Cooklang.tab.c"
     break;
 
   case 14: /* direction: HWORD text_item  */
-#line 110 "src/Cooklang.y"
+#line 102 "src/Cooklang.y"
                       {
-      (yyval.string) = addTwoStrings((yyvsp[-1].string), (yyvsp[0].string));
-      addDirection(recipe, "cookware", (yyvsp[-1].string), NULL);
-      addDirection(recipe, "text", (yyvsp[0].string), NULL);
-      free((yyvsp[-1].string));
-      free((yyvsp[0].string));
+      addDirection(recipe, DIRECTION_COOKWARE, (yyvsp[-1].span), NO_SPAN);
+      addDirection(recipe, DIRECTION_TEXT, (yyvsp[0].span), NO_SPAN);
     }
-#line 1502 "parserFiles/Cooklang.tab.c"
+#line 1475 "parserFiles/Cooklang.tab.c"
     break;
 
   case 15: /* direction: ATWORD text_item  */
-#line 117 "src/Cooklang.y"
+#line 106 "src/Cooklang.y"
                       {
-      (yyval.string) = addTwoStrings((yyvsp[-1].string), (yyvsp[0].string));
-      addDirection(recipe, "ingredient", (yyvsp[-1].string), NULL);
-      addDirection(recipe, "text", (yyvsp[0].string), NULL);
-      free((yyvsp[-1].string));
-      free((yyvsp[0].string));
+      addDirection(recipe, DIRECTION_INGREDIENT, (yyvsp[-1].span), NO_SPAN);
+      addDirection(recipe, DIRECTION_TEXT, (yyvsp[0].span), NO_SPAN);
     }
-#line 1514 "parserFiles/Cooklang.tab.c"
+#line 1484 "parserFiles/Cooklang.tab.c"
     break;
 
   case 16: /* direction: text_item WHTS  */
-#line 124 "src/Cooklang.y"
+#line 110 "src/Cooklang.y"
                    {
-    (yyval.string) = addTwoStrings((yyvsp[-1].string), (yyvsp[0].string));
-    char * tempString = addTwoStrings((yyvsp[-1].string), (yyvsp[0].string));
-    addDirection(recipe, "text", tempString, NULL);
-    free(tempString);
-    free((yyvsp[-1].string));
-    free((yyvsp[0].string));
+    Span tempSpan = joinSpans(recipe->arena, (yyvsp[-1].span), (yyvsp[0].span));
+    addDirection(recipe, DIRECTION_TEXT, tempSpan, NO_SPAN);
   }
-#line 1527 "parserFiles/Cooklang.tab.c"
+#line 1493 "parserFiles/Cooklang.tab.c"
     break;
 
   case 19: /* text_item: NUMBER  */
-#line 137 "src/Cooklang.y"
+#line 119 "src/Cooklang.y"
             {
-      (yyval.string) = malloc(10);
-      sprintf((yyval.string), "%.3f", (yyvsp[0].number));
+      (yyval.span) = stringToSpan(arenaSprintf(recipe->arena, "%.3f", (yyvsp[0].number)));
     }
-#line 1536 "parserFiles/Cooklang.tab.c"
+#line 1501 "parserFiles/Cooklang.tab.c"
     break;
 
   case 21: /* text_item: text_item WORD  */
-#line 142 "src/Cooklang.y"
+#line 123 "src/Cooklang.y"
                     {
-      (yyval.string) = addTwoStrings((yyvsp[-1].string), (yyvsp[0].string));
-      free((yyvsp[-1].string));
-      free((yyvsp[0].string));
+      (yyval.span) = joinSpans(recipe->arena, (yyvsp[-1].span), (yyvsp[0].span));
     }
-#line 1546 "parserFiles/Cooklang.tab.c"
+#line 1509 "parserFiles/Cooklang.tab.c"
     break;
 
   case 22: /* text_item: text_item MULTIWORD  */
-#line 148 "src/Cooklang.y"
+#line 127 "src/Cooklang.y"
                          {
-      (yyval.string) = addTwoStrings((yyvsp[-1].string), (yyvsp[0].string));
-      free((yyvsp[-1].string));
-      free((yyvsp[0].string));
+      (yyval.span) = joinSpans(recipe->arena, (yyvsp[-1].span), (yyvsp[0].span));
     }
-#line 1556 "parserFiles/Cooklang.tab.c"
+#line 1517 "parserFiles/Cooklang.tab.c"
     break;
 
   case 23: /* text_item: text_item NUMBER  */
-#line 154 "src/Cooklang.y"
+#line 131 "src/Cooklang.y"
                       {
-      (yyval.string) = malloc(strlen((yyvsp[-1].string)) + 15);
-      sprintf((yyval.string), "%s %.3f", (yyvsp[-1].string), (yyvsp[0].number));
-      free((yyvsp[-1].string));
+      (yyval.span) = stringToSpan(arenaSprintf(recipe->arena, "%.*s %.3f",
+                                     (int)(yyvsp[-1].span).length, (yyvsp[-1].span).start, (yyvsp[0].number)));
     }
-#line 1566 "parserFiles/Cooklang.tab.c"
+#line 1526 "parserFiles/Cooklang.tab.c"
     break;
 
   case 24: /* text_item: text_item METADATA  */
-#line 160 "src/Cooklang.y"
+#line 136 "src/Cooklang.y"
                        {
-      (yyval.string) = addTwoStrings((yyvsp[-1].string), (yyvsp[0].string));
-      free((yyvsp[-1].string));
-      free((yyvsp[0].string));
+      (yyval.span) = joinSpans(recipe->arena, (yyvsp[-1].span), (yyvsp[0].span));
     }
-#line 1576 "parserFiles/Cooklang.tab.c"
+#line 1534 "parserFiles/Cooklang.tab.c"
     break;
 
   case 25: /* amount: LCURL RCURL  */
-#line 170 "src/Cooklang.y"
+#line 144 "src/Cooklang.y"
                 {
-      (yyval.string) = malloc(5);
-      strcpy((yyval.string), "\0");
+      (yyval.span) = EMPTY_SPAN;
     }
-#line 1585 "parserFiles/Cooklang.tab.c"
+#line 1542 "parserFiles/Cooklang.tab.c"
     break;
 
   case 26: /* amount: LCURL WHTS RCURL  */
-#line 174 "src/Cooklang.y"
+#line 147 "src/Cooklang.y"
                      {
-    (yyval.string) = malloc(5);
-    strcpy((yyval.string), "\0");
+    (yyval.span) = EMPTY_SPAN;
   }
-#line 1594 "parserFiles/Cooklang.tab.c"
+#line 1550 "parserFiles/Cooklang.tab.c"
     break;
 
   case 27: /* amount: LCURL NUMBER RCURL  */
-#line 179 "src/Cooklang.y"
+#line 151 "src/Cooklang.y"
                         {
       // get string for amount
-      (yyval.string) = malloc(100);
-      sprintf((yyval.string), "%.3lf", (yyvsp[-1].number));
+      (yyval.span) = stringToSpan(arenaSprintf(recipe->arena, "%.3lf", (yyvsp[-1].number)));
     }
-#line 1604 "parserFiles/Cooklang.tab.c"
+#line 1559 "parserFiles/Cooklang.tab.c"
     break;
 
   case 28: /* amount: LCURL NUMBER UNIT RCURL  */
-#line 185 "src/Cooklang.y"
+#line 156 "src/Cooklang.y"
                             {
-      (yyval.string) = malloc(strlen((yyvsp[-1].string)) + 20);
-      sprintf((yyval.string), "%.3f %s", (yyvsp[-2].number), (yyvsp[-1].string));
-      free((yyvsp[-1].string));
+      (yyval.span) = stringToSpan(arenaSprintf(recipe->arena, "%.3f %.*s", (yyvsp[-2].number),
+                                     (int)(yyvsp[-1].span).length, (yyvsp[-1].span).start));
     }
-#line 1614 "parserFiles/Cooklang.tab.c"
+#line 1568 "parserFiles/Cooklang.tab.c"
     break;
 
   case 29: /* amount: LCURL WORD RCURL  */
-#line 191 "src/Cooklang.y"
+#line 161 "src/Cooklang.y"
                       {
-      (yyval.string) = (yyvsp[-1].string);
+      (yyval.span) = (yyvsp[-1].span);
     }
-#line 1622 "parserFiles/Cooklang.tab.c"
+#line 1576 "parserFiles/Cooklang.tab.c"
     break;
 
   case 30: /* amount: LCURL WORD UNIT RCURL  */
-#line 195 "src/Cooklang.y"
+#line 165 "src/Cooklang.y"
                           {
-      (yyval.string) = addTwoStrings((yyvsp[-2].string), (yyvsp[-1].string));
-      free((yyvsp[-2].string));
-      free((yyvsp[-1].string));
+      (yyval.span) = joinSpans(recipe->arena, (yyvsp[-2].span), (yyvsp[-1].span));
     }
-#line 1632 "parserFiles/Cooklang.tab.c"
+#line 1584 "parserFiles/Cooklang.tab.c"
     break;
 
   case 31: /* amount: LCURL MULTIWORD RCURL  */
-#line 201 "src/Cooklang.y"
+#line 169 "src/Cooklang.y"
                           {
-      (yyval.string) = (yyvsp[-1].string);
+      (yyval.span) = (yyvsp[-1].span);
     }
-#line 1640 "parserFiles/Cooklang.tab.c"
+#line 1592 "parserFiles/Cooklang.tab.c"
     break;
 
   case 32: /* amount: LCURL MULTIWORD UNIT RCURL  */
-#line 205 "src/Cooklang.y"
+#line 173 "src/Cooklang.y"
                                {
-      (yyval.string) = addTwoStrings((yyvsp[-2].string), (yyvsp[-1].string));
-      free((yyvsp[-2].string));
-      free((yyvsp[-1].string));
+      (yyval.span) = joinSpans(recipe->arena, (yyvsp[-2].span), (yyvsp[-1].span));
     }
-#line 1650 "parserFiles/Cooklang.tab.c"
+#line 1600 "parserFiles/Cooklang.tab.c"
     break;
 
   case 33: /* cookware_amount: LCURL RCURL  */
-#line 214 "src/Cooklang.y"
+#line 180 "src/Cooklang.y"
                 {
-        (yyval.string) = malloc(5);
-        strcpy((yyval.string), "\0");
+        (yyval.span) = EMPTY_SPAN;
       }
-#line 1659 "parserFiles/Cooklang.tab.c"
+#line 1608 "parserFiles/Cooklang.tab.c"
     break;
 
   case 34: /* cookware_amount: LCURL WHTS RCURL  */
-#line 219 "src/Cooklang.y"
+#line 184 "src/Cooklang.y"
                      {
-        (yyval.string) = malloc(5);
-        strcpy((yyval.string), "\0");
+        (yyval.span) = EMPTY_SPAN;
       }
-#line 1668 "parserFiles/Cooklang.tab.c"
+#line 1616 "parserFiles/Cooklang.tab.c"
     break;
 
   case 35: /* cookware_amount: LCURL NUMBER RCURL  */
-#line 224 "src/Cooklang.y"
+#line 188 "src/Cooklang.y"
                         {
-        (yyval.string) = malloc(100);
-        sprintf((yyval.string), "%.3f", (yyvsp[-1].number));
+        (yyval.span) = stringToSpan(arenaSprintf(recipe->arena, "%.3f", (yyvsp[-1].number)));
       }
-#line 1677 "parserFiles/Cooklang.tab.c"
+#line 1624 "parserFiles/Cooklang.tab.c"
     break;
 
   case 36: /* cookware_amount: LCURL WORD RCURL  */
-#line 229 "src/Cooklang.y"
+#line 192 "src/Cooklang.y"
                       {
-        (yyval.string) = (yyvsp[-1].string);
+        (yyval.span) = (yyvsp[-1].span);
       }
-#line 1685 "parserFiles/Cooklang.tab.c"
+#line 1632 "parserFiles/Cooklang.tab.c"
     break;
 
   case 37: /* cookware_amount: LCURL MULTIWORD RCURL  */
-#line 233 "src/Cooklang.y"
+#line 196 "src/Cooklang.y"
                           {
-        (yyval.string) = (yyvsp[-1].string);
+        (yyval.span) = (yyvsp[-1].span);
       }
-#line 1693 "parserFiles/Cooklang.tab.c"
+#line 1640 "parserFiles/Cooklang.tab.c"
     break;
 
   case 38: /* cookware: HWORD  */
-#line 239 "src/Cooklang.y"
+#line 202 "src/Cooklang.y"
         {
-      (yyval.string) = strdup((yyvsp[0].string));
-      addDirection(recipe, "cookware", (yyvsp[0].string), NULL);
-      free((yyvsp[0].string));
+      addDirection(recipe, DIRECTION_COOKWARE, (yyvsp[0].span), NO_SPAN);
     }
-#line 1703 "parserFiles/Cooklang.tab.c"
+#line 1648 "parserFiles/Cooklang.tab.c"
     break;
 
   case 39: /* cookware: HWORD cookware_amount  */
-#line 245 "src/Cooklang.y"
+#line 206 "src/Cooklang.y"
                            {
-      (yyval.string) = addTwoStrings((yyvsp[-1].string), (yyvsp[0].string));
-      addDirection(recipe, "cookware", (yyvsp[-1].string), (yyvsp[0].string));
-      free((yyvsp[-1].string));
-      free((yyvsp[0].string));
+      addDirection(recipe, DIRECTION_COOKWARE, (yyvsp[-1].span), (yyvsp[0].span));
     }
-#line 1714 "parserFiles/Cooklang.tab.c"
+#line 1656 "parserFiles/Cooklang.tab.c"
     break;
 
   case 40: /* cookware: HWORD WORD cookware_amount  */
-#line 252 "src/Cooklang.y"
+#line 210 "src/Cooklang.y"
                                {
-      (yyval.string) = addThreeStrings((yyvsp[-2].string), (yyvsp[-1].string), (yyvsp[0].string));
-      char * valueString = addTwoStrings((yyvsp[-2].string), (yyvsp[-1].string));
-      addDirection(recipe, "cookware", valueString, (yyvsp[0].string));
-      free(valueString);
-      free((yyvsp[-2].string));
-      free((yyvsp[-1].string));
-      free((yyvsp[0].string));
+      Span valueSpan = joinSpans(recipe->arena, (yyvsp[-2].span), (yyvsp[-1].span));
+      addDirection(recipe, DIRECTION_COOKWARE, valueSpan, (yyvsp[0].span));
     }
-#line 1728 "parserFiles/Cooklang.tab.c"
+#line 1665 "parserFiles/Cooklang.tab.c"
     break;
 
   case 41: /* cookware: HWORD MULTIWORD cookware_amount  */
-#line 262 "src/Cooklang.y"
+#line 215 "src/Cooklang.y"
                                     {
-      (yyval.string) = addThreeStrings((yyvsp[-2].string), (yyvsp[-1].string), (yyvsp[0].string));
-      char * valueString = addTwoStrings((yyvsp[-2].string), (yyvsp[-1].string));
-      addDirection(recipe, "cookware", valueString, (yyvsp[0].string));
-      free(valueString);
-      free((yyvsp[-2].string));
-      free((yyvsp[-1].string));
-      free((yyvsp[0].string));
+      Span valueSpan = joinSpans(recipe->arena, (yyvsp[-2].span), (yyvsp[-1].span));
+      addDirection(recipe, DIRECTION_COOKWARE, valueSpan, (yyvsp[0].span));
     }
-#line 1742 "parserFiles/Cooklang.tab.c"
+#line 1674 "parserFiles/Cooklang.tab.c"
     break;
 
   case 42: /* ingredient: ATWORD  */
-#line 276 "src/Cooklang.y"
+#line 224 "src/Cooklang.y"
             {
-      (yyval.string) = strdup((yyvsp[0].string));
-      addDirection(recipe, "ingredient", (yyvsp[0].string), NULL);
-      free((yyvsp[0].string));
+      addDirection(recipe, DIRECTION_INGREDIENT, (yyvsp[0].span), NO_SPAN);
     }
-#line 1752 "parserFiles/Cooklang.tab.c"
+#line 1682 "parserFiles/Cooklang.tab.c"
     break;
 
   case 43: /* ingredient: ATWORD amount  */
-#line 282 "src/Cooklang.y"
+#line 228 "src/Cooklang.y"
                   {
-      (yyval.string) = addTwoStrings((yyvsp[-1].string), (yyvsp[0].string));
-      addDirection(recipe, "ingredient", (yyvsp[-1].string), (yyvsp[0].string));
-      free((yyvsp[-1].string));
-      free((yyvsp[0].string));
+      addDirection(recipe, DIRECTION_INGREDIENT, (yyvsp[-1].span), (yyvsp[0].span));
     }
-#line 1763 "parserFiles/Cooklang.tab.c"
+#line 1690 "parserFiles/Cooklang.tab.c"
     break;
 
   case 44: /* ingredient: ATWORD WORD amount  */
-#line 289 "src/Cooklang.y"
+#line 232 "src/Cooklang.y"
                         {
-      (yyval.string) = addThreeStrings((yyvsp[-2].string), (yyvsp[-1].string), (yyvsp[0].string));
-      char * valueString = addTwoStrings((yyvsp[-2].string), (yyvsp[-1].string));
-      addDirection(recipe, "ingredient", valueString, (yyvsp[0].string));
-      free(valueString);
-      free((yyvsp[-2].string));
-      free((yyvsp[-1].string));
-      free((yyvsp[0].string));
+      Span valueSpan = joinSpans(recipe->arena, (yyvsp[-2].span), (yyvsp[-1].span));
+      addDirection(recipe, DIRECTION_INGREDIENT, valueSpan, (yyvsp[0].span));
     }
-#line 1777 "parserFiles/Cooklang.tab.c"
+#line 1699 "parserFiles/Cooklang.tab.c"
     break;
 
   case 45: /* ingredient: ATWORD MULTIWORD amount  */
-#line 299 "src/Cooklang.y"
+#line 237 "src/Cooklang.y"
                              {
-      (yyval.string) = addThreeStrings((yyvsp[-2].string), (yyvsp[-1].string), (yyvsp[0].string));
-      char * valueString = addTwoStrings((yyvsp[-2].string), (yyvsp[-1].string));
-      addDirection(recipe, "ingredient", valueString, (yyvsp[0].string));
-      free(valueString);
-      free((yyvsp[-2].string));
-      free((yyvsp[-1].string));
-      free((yyvsp[0].string));
+      Span valueSpan = joinSpans(recipe->arena, (yyvsp[-2].span), (yyvsp[-1].span));
+      addDirection(recipe, DIRECTION_INGREDIENT, valueSpan, (yyvsp[0].span));
     }
-#line 1791 "parserFiles/Cooklang.tab.c"
+#line 1708 "parserFiles/Cooklang.tab.c"
     break;
 
   case 46: /* timer: TILDE amount  */
-#line 312 "src/Cooklang.y"
+#line 245 "src/Cooklang.y"
                   {
-        (yyval.string) = strdup((yyvsp[0].string));
-        addDirection(recipe, "timer", NULL, (yyvsp[0].string));
-        free((yyvsp[0].string));
+        addDirection(recipe, DIRECTION_TIMER, NO_SPAN, (yyvsp[0].span));
       }
-#line 1801 "parserFiles/Cooklang.tab.c"
+#line 1716 "parserFiles/Cooklang.tab.c"
     break;
 
   case 47: /* timer: TILDE WORD  */
-#line 317 "src/Cooklang.y"
+#line 248 "src/Cooklang.y"
                {
-        (yyval.string) = strdup((yyvsp[0].string));
-        addDirection(recipe, "timer", (yyvsp[0].string), NULL);
-        free((yyvsp[0].string));
+        addDirection(recipe, DIRECTION_TIMER, (yyvsp[0].span), NO_SPAN);
       }
-#line 1811 "parserFiles/Cooklang.tab.c"
+#line 1724 "parserFiles/Cooklang.tab.c"
     break;
 
   case 48: /* timer: TILDE WORD amount  */
-#line 322 "src/Cooklang.y"
+#line 251 "src/Cooklang.y"
                       {
-        (yyval.string) = addTwoStrings((yyvsp[-1].string), (yyvsp[0].string));
-        addDirection(recipe, "timer", (yyvsp[-1].string), (yyvsp[0].string));
-        free((yyvsp[-1].string));
-        free((yyvsp[0].string));
+        addDirection(recipe, DIRECTION_TIMER, (yyvsp[-1].span), (yyvsp[0].span));
       }
-#line 1822 "parserFiles/Cooklang.tab.c"
+#line 1732 "parserFiles/Cooklang.tab.c"
     break;
 
   case 49: /* timer: TILDE MULTIWORD amount  */
-#line 329 "src/Cooklang.y"
+#line 255 "src/Cooklang.y"
                             {
-        (yyval.string) = addTwoStrings((yyvsp[-1].string), (yyvsp[0].string));
-        addDirection(recipe, "timer", (yyvsp[-1].string), (yyvsp[0].string));
-        free((yyvsp[-1].string));
-        free((yyvsp[0].string));
+        addDirection(recipe, DIRECTION_TIMER, (yyvsp[-1].span), (yyvsp[0].span));
       }
-#line 1833 "parserFiles/Cooklang.tab.c"
+#line 1740 "parserFiles/Cooklang.tab.c"
     break;
 
 
-#line 1837 "parserFiles/Cooklang.tab.c"
+#line 1744 "parserFiles/Cooklang.tab.c"
 
       default: break;
     }
@@ -1907,7 +1814,7 @@ yyerrlab:
                 yysyntax_error_status = YYENOMEM;
               }
           }
-        yyerror (recipe, yymsgp);
+        yyerror (scanner, recipe, yymsgp);
         if (yysyntax_error_status == YYENOMEM)
           YYNOMEM;
       }
@@ -1927,7 +1834,7 @@ yyerrlab:
       else
         {
           yydestruct ("Error: discarding",
-                      yytoken, &yylval, recipe);
+                      yytoken, &yylval, scanner, recipe);
           yychar = YYEMPTY;
         }
     }
@@ -1983,7 +1890,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  YY_ACCESSING_SYMBOL (yystate), yyvsp, recipe);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, scanner, recipe);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -2021,7 +1928,7 @@ yyabortlab:
 | yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
 `-----------------------------------------------------------*/
 yyexhaustedlab:
-  yyerror (recipe, YY_("memory exhausted"));
+  yyerror (scanner, recipe, YY_("memory exhausted"));
   yyresult = 2;
   goto yyreturnlab;
 
@@ -2036,7 +1943,7 @@ yyreturnlab:
          user semantic actions for why this is necessary.  */
       yytoken = YYTRANSLATE (yychar);
       yydestruct ("Cleanup: discarding lookahead",
-                  yytoken, &yylval, recipe);
+                  yytoken, &yylval, scanner, recipe);
     }
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
@@ -2045,7 +1952,7 @@ yyreturnlab:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, recipe);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, scanner, recipe);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
@@ -2057,7 +1964,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 338 "src/Cooklang.y"
+#line 261 "src/Cooklang.y"
 
 
 
@@ -2067,7 +1974,7 @@ yyreturnlab:
 
 
 
-int yyerror( Recipe * recipe, const char * s){
+int yyerror( yyscan_t scanner, Recipe * recipe, const char * s){
   printf("\nError\n%s", s);
   return 1;
 }
@@ -44,6 +44,16 @@
 #if YYDEBUG
 extern int yydebug;
 #endif
+/* "%code requires" blocks.  */
+#line 18 "src/Cooklang.y"
+
+  // the scanner state, every parse gets its own so recipes can be parsed from many threads
+  #ifndef YY_TYPEDEF_YY_SCANNER_T
+  #define YY_TYPEDEF_YY_SCANNER_T
+  typedef void * yyscan_t;
+  #endif
+
+#line 57 "parserFiles/Cooklang.tab.h"
 
 /* Token kinds.  */
 #ifndef YYTOKENTYPE
@@ -76,13 +86,13 @@ extern int yydebug;
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 34 "src/Cooklang.y"
+#line 43 "src/Cooklang.y"
 
-  char * string;
+  Span span;
   char character;
   double number;
 
-#line 86 "parserFiles/Cooklang.tab.h"
+#line 96 "parserFiles/Cooklang.tab.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -91,10 +101,9 @@ typedef union YYSTYPE YYSTYPE;
 #endif
 
 
-extern YYSTYPE yylval;
 
 
-int yyparse (Recipe * recipe);
+int yyparse (yyscan_t scanner, Recipe * recipe);
 
 
 #endif /* !YY_YY_PARSERFILES_COOKLANG_TAB_H_INCLUDED  */
@@ -111,21 +111,38 @@ typedef unsigned int flex_uint32_t;
  */
 #define YY_SC_TO_UI(c) ((YY_CHAR) (c))
 
+/* An opaque pointer. */
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void* yyscan_t;
+#endif
+
+/* For convenience, these vars (plus the bison vars far below)
+   are macros in the reentrant scanner. */
+#define yyin yyg->yyin_r
+#define yyout yyg->yyout_r
+#define yyextra yyg->yyextra_r
+#define yyleng yyg->yyleng_r
+#define yytext yyg->yytext_r
+#define yylineno (YY_CURRENT_BUFFER_LVALUE->yy_bs_lineno)
+#define yycolumn (YY_CURRENT_BUFFER_LVALUE->yy_bs_column)
+#define yy_flex_debug yyg->yy_flex_debug_r
+
 /* Enter a start condition.  This macro really ought to take a parameter,
  * but we do it the disgusting crufty way forced on us by the ()-less
  * definition of BEGIN.
  */
-#define BEGIN (yy_start) = 1 + 2 *
+#define BEGIN yyg->yy_start = 1 + 2 *
 /* Translate the current start state into a value that can be later handed
  * to BEGIN to return to the state.  The YYSTATE alias is for lex
  * compatibility.
  */
-#define YY_START (((yy_start) - 1) / 2)
+#define YY_START ((yyg->yy_start - 1) / 2)
 #define YYSTATE YY_START
 /* Action number for EOF rule of a given start state. */
 #define YY_STATE_EOF(state) (YY_END_OF_BUFFER + state + 1)
 /* Special action meaning "start processing a new file". */
-#define YY_NEW_FILE yyrestart( yyin  )
+#define YY_NEW_FILE yyrestart( yyin , yyscanner )
 #define YY_END_OF_BUFFER_CHAR 0
 
 /* Size of default input buffer. */
@@ -155,10 +172,6 @@ typedef struct yy_buffer_state *YY_BUFFER_STATE;
 typedef size_t yy_size_t;
 #endif
 
-extern int yyleng;
-
-extern FILE *yyin, *yyout;
-
 #define EOB_ACT_CONTINUE_SCAN 0
 #define EOB_ACT_END_OF_FILE 1
 #define EOB_ACT_LAST_MATCH 2
@@ -173,13 +186,13 @@ extern FILE *yyin, *yyout;
 		/* Undo effects of setting up yytext. */ \
         int yyless_macro_arg = (n); \
         YY_LESS_LINENO(yyless_macro_arg);\
-		*yy_cp = (yy_hold_char); \
+		*yy_cp = yyg->yy_hold_char; \
 		YY_RESTORE_YY_MORE_OFFSET \
-		(yy_c_buf_p) = yy_cp = yy_bp + yyless_macro_arg - YY_MORE_ADJ; \
+		yyg->yy_c_buf_p = yy_cp = yy_bp + yyless_macro_arg - YY_MORE_ADJ; \
 		YY_DO_BEFORE_ACTION; /* set up yytext again */ \
 		} \
 	while ( 0 )
-#define unput(c) yyunput( c, (yytext_ptr)  )
+#define unput(c) yyunput( c, yyg->yytext_ptr , yyscanner )
 
 #ifndef YY_STRUCT_YY_BUFFER_STATE
 #define YY_STRUCT_YY_BUFFER_STATE
@@ -246,77 +259,57 @@ struct yy_buffer_state
 	};
 #endif /* !YY_STRUCT_YY_BUFFER_STATE */
 
-/* Stack of input buffers. */
-static size_t yy_buffer_stack_top = 0; /**< index of top of stack. */
-static size_t yy_buffer_stack_max = 0; /**< capacity of stack. */
-static YY_BUFFER_STATE * yy_buffer_stack = NULL; /**< Stack as an array. */
-
 /* We provide macros for accessing buffer states in case in the
  * future we want to put the buffer states in a more general
  * "scanner state".
  *
  * Returns the top of the stack, or NULL.
  */
-#define YY_CURRENT_BUFFER ( (yy_buffer_stack) \
-                          ? (yy_buffer_stack)[(yy_buffer_stack_top)] \
+#define YY_CURRENT_BUFFER ( yyg->yy_buffer_stack \
+                          ? yyg->yy_buffer_stack[yyg->yy_buffer_stack_top] \
                           : NULL)
 /* Same as previous macro, but useful when we know that the buffer stack is not
  * NULL or when we need an lvalue. For internal use only.
  */
-#define YY_CURRENT_BUFFER_LVALUE (yy_buffer_stack)[(yy_buffer_stack_top)]
+#define YY_CURRENT_BUFFER_LVALUE yyg->yy_buffer_stack[yyg->yy_buffer_stack_top]
 
-/* yy_hold_char holds the character lost when yytext is formed. */
-static char yy_hold_char;
-static int yy_n_chars;		/* number of characters read into yy_ch_buf */
-int yyleng;
+void yyrestart ( FILE *input_file , yyscan_t yyscanner );
+void yy_switch_to_buffer ( YY_BUFFER_STATE new_buffer , yyscan_t yyscanner );
+YY_BUFFER_STATE yy_create_buffer ( FILE *file, int size , yyscan_t yyscanner );
+void yy_delete_buffer ( YY_BUFFER_STATE b , yyscan_t yyscanner );
+void yy_flush_buffer ( YY_BUFFER_STATE b , yyscan_t yyscanner );
+void yypush_buffer_state ( YY_BUFFER_STATE new_buffer , yyscan_t yyscanner );
+void yypop_buffer_state ( yyscan_t yyscanner );
 
-/* Points to current character in buffer. */
-static char *yy_c_buf_p = NULL;
-static int yy_init = 0;		/* whether we need to initialize */
-static int yy_start = 0;	/* start state number */
+static void yyensure_buffer_stack ( yyscan_t yyscanner );
+static void yy_load_buffer_state ( yyscan_t yyscanner );
+static void yy_init_buffer ( YY_BUFFER_STATE b, FILE *file , yyscan_t yyscanner );
+#define YY_FLUSH_BUFFER yy_flush_buffer( YY_CURRENT_BUFFER , yyscanner)
 
-/* Flag which is used to allow yywrap()'s to do buffer switches
- * instead of setting up a fresh yyin.  A bit of a hack ...
- */
-static int yy_did_buffer_switch_on_eof;
-
-void yyrestart ( FILE *input_file  );
-void yy_switch_to_buffer ( YY_BUFFER_STATE new_buffer  );
-YY_BUFFER_STATE yy_create_buffer ( FILE *file, int size  );
-void yy_delete_buffer ( YY_BUFFER_STATE b  );
-void yy_flush_buffer ( YY_BUFFER_STATE b  );
-void yypush_buffer_state ( YY_BUFFER_STATE new_buffer  );
-void yypop_buffer_state ( void );
-
-static void yyensure_buffer_stack ( void );
-static void yy_load_buffer_state ( void );
-static void yy_init_buffer ( YY_BUFFER_STATE b, FILE *file  );
-#define YY_FLUSH_BUFFER yy_flush_buffer( YY_CURRENT_BUFFER )
+YY_BUFFER_STATE yy_scan_buffer ( char *base, yy_size_t size , yyscan_t yyscanner );
+YY_BUFFER_STATE yy_scan_string ( const char *yy_str , yyscan_t yyscanner );
+YY_BUFFER_STATE yy_scan_bytes ( const char *bytes, int len , yyscan_t yyscanner );
 
-YY_BUFFER_STATE yy_scan_buffer ( char *base, yy_size_t size  );
-YY_BUFFER_STATE yy_scan_string ( const char *yy_str  );
-YY_BUFFER_STATE yy_scan_bytes ( const char *bytes, int len  );
-
-void *yyalloc ( yy_size_t  );
-void *yyrealloc ( void *, yy_size_t  );
-void yyfree ( void *  );
+void *yyalloc ( yy_size_t , yyscan_t yyscanner );
+void *yyrealloc ( void *, yy_size_t , yyscan_t yyscanner );
+void yyfree ( void * , yyscan_t yyscanner );
 
 #define yy_new_buffer yy_create_buffer
 #define yy_set_interactive(is_interactive) \
 	{ \
 	if ( ! YY_CURRENT_BUFFER ){ \
-        yyensure_buffer_stack (); \
+        yyensure_buffer_stack (yyscanner); \
 		YY_CURRENT_BUFFER_LVALUE =    \
-            yy_create_buffer( yyin, YY_BUF_SIZE ); \
+            yy_create_buffer( yyin, YY_BUF_SIZE , yyscanner); \
 	} \
 	YY_CURRENT_BUFFER_LVALUE->yy_is_interactive = is_interactive; \
 	}
 #define yy_set_bol(at_bol) \
 	{ \
 	if ( ! YY_CURRENT_BUFFER ){\
-        yyensure_buffer_stack (); \
+        yyensure_buffer_stack (yyscanner); \
 		YY_CURRENT_BUFFER_LVALUE =    \
-            yy_create_buffer( yyin, YY_BUF_SIZE ); \
+            yy_create_buffer( yyin, YY_BUF_SIZE , yyscanner); \
 	} \
 	YY_CURRENT_BUFFER_LVALUE->yy_at_bol = at_bol; \
 	}
@@ -324,37 +317,28 @@ void yyfree ( void *  );
 
 /* Begin user sect3 */
 
-#define yywrap() (/*CONSTCOND*/1)
+#define yywrap(yyscanner) (/*CONSTCOND*/1)
 #define YY_SKIP_YYWRAP
 typedef flex_uint8_t YY_CHAR;
 
-FILE *yyin = NULL, *yyout = NULL;
-
 typedef int yy_state_type;
 
-extern int yylineno;
-int yylineno = 1;
+#define yytext_ptr yytext_r
 
-extern char *yytext;
-#ifdef yytext_ptr
-#undef yytext_ptr
-#endif
-#define yytext_ptr yytext
-
-static yy_state_type yy_get_previous_state ( void );
-static yy_state_type yy_try_NUL_trans ( yy_state_type current_state  );
-static int yy_get_next_buffer ( void );
-static void yynoreturn yy_fatal_error ( const char* msg  );
+static yy_state_type yy_get_previous_state ( yyscan_t yyscanner );
+static yy_state_type yy_try_NUL_trans ( yy_state_type current_state  , yyscan_t yyscanner);
+static int yy_get_next_buffer ( yyscan_t yyscanner );
+static void yynoreturn yy_fatal_error ( const char* msg , yyscan_t yyscanner );
 
 /* Done after the current pattern has been matched and before the
  * corresponding action - sets up yytext.
  */
 #define YY_DO_BEFORE_ACTION \
-	(yytext_ptr) = yy_bp; \
+	yyg->yytext_ptr = yy_bp; \
 	yyleng = (int) (yy_cp - yy_bp); \
-	(yy_hold_char) = *yy_cp; \
+	yyg->yy_hold_char = *yy_cp; \
 	*yy_cp = '\0'; \
-	(yy_c_buf_p) = yy_cp;
+	yyg->yy_c_buf_p = yy_cp;
 #define YY_NUM_RULES 19
 #define YY_END_OF_BUFFER 20
 /* This struct is not used in this scanner,
@@ -364,4214 +348,676 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int32_t yy_accept[1411] =
+static const flex_int32_t yy_accept[146] =
     {   0,
-        0,    0,   20,   13,   18,   16,   13,   19,    7,   15,
-        8,    8,   13,   19,   15,    1,    2,    3,   13,   13,
-       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
-       13,   13,   13,   13,   13,   13,   13,    0,    0,    0,
-       13,   13,   13,   13,   13,   18,    0,    0,    2,   13,
-       13,   13,   13,    6,    0,    0,    0,    6,    6,    6,
-        6,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    4,    8,   13,   13,   13,   13,
-       13,   13,    9,   13,    5,    0,    0,    0,    5,    5,
+        0,    0,   20,   13,   18,   16,   19,    7,   15,    8,
+        8,   13,   19,   15,    1,    2,    3,   13,   13,    0,
+        0,    0,    0,    0,    6,    0,    0,    0,    6,    7,
+        7,    7,    7,    7,    7,    4,    8,   13,   13,   13,
+        9,   13,    5,    0,    0,    0,    5,   13,    0,   13,
+       14,    0,    0,   13,    6,    6,    7,    0,    0,    0,
+        7,    7,    7,    7,    7,    7,    7,    7,   17,   14,
+       14,   14,   10,   10,   11,   11,   13,    8,    9,   13,
+       13,   14,    0,    0,    0,    5,    5,    1,   14,   13,
+       14,    7,    7,    0,    7,    7,   10,   10,   11,   11,
+
+       14,    8,   13,   10,   13,   11,   13,   14,    9,   13,
+        0,   14,    0,    0,   13,    7,   14,   10,   14,   11,
+       14,   10,   13,   11,   13,    9,   12,   12,   12,   12,
+       12,   12,   12,   14,   10,   14,   11,   14,   10,   11,
+       12,   12,   10,   11,    0
+    } ;
 
-        5,    5,   13,    1,    0,    0,    0,    0,   13,   13,
-       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
-       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
-       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
-       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
-       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
-       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
-       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
-       13,   13,   14,    0,    0,   13,   13,   13,   13,   14,
-        0,    0,   14,   14,   14,   14,   13,   13,   13,   13,
+static const flex_int32_t yy_base[146] =
+    {   0,
+        1,    1,    0,  257,  503, 4852,  616,  871, 1118, 1120,
+      469,  205, 1249,  470, 1130, 4852, 4852,  138,  505, 1504,
+     1751,  201,  249,    1, 1133,    1, 1757,  230,  248, 1883,
+     1765, 2130,  291,  251,  395, 2259, 1155,  520, 2506,  396,
+     1184, 2577, 1791,    1, 2824,  438,  398, 2830,  607, 2832,
+      530, 2837,  440,  487,  488,  402,  532,    1, 2841,  444,
+      534, 2850,  445,  410, 2944, 2890, 2836,  412,    1,  530,
+     2970,  413, 1818,  547, 2140, 1120,  414,  415, 2996,  417,
+      492, 3090, 3345, 3592,  472,  543,  457,  458,  459,  460,
+      548,  560,  561,  476,  477,  478, 2843, 1169, 2864, 1179,
+
+      479,  480,  481, 2870,  482, 2872,  483,  484,  519, 3718,
+     3964, 4090,  562, 4345,  635,  609,  610, 2875,  749, 2880,
+      752,  774,  776,  803,  862,  864,    1,    1,    1, 4592,
+      906, 4596, 1041, 1088, 1002, 1003, 1004, 1005, 1006, 1008,
+     1096, 1098, 1012, 1013, 4852
+    } ;
 
-       13,   13,   13,   13,   13,   13,    6,    6,    6,    6,
-        6,    6,    7,    0,    0,    0,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+static const flex_int32_t yy_def[146] =
+    {   0,
+      145,    1,  145,  145,    1,  145,    4,    4,    5,    4,
+       10,    4,    4,    9,  145,  145,  145,    4,    4,    4,
+        4,   21,    9,   14,    7,    7,   25,   27,   25,    4,
+       30,    8,   32,   30,   30,    4,   20,   19,    4,   19,
+       11,    4,   13,   13,   43,   45,   43,    4,  145,   18,
+       20,   51,   52,   22,   28,    7,   30,   30,   57,   59,
+       31,   61,   62,   57,  145,   31,   31,   61,   36,   51,
+       20,   51,    4,   73,    4,   75,   19,   10,   37,   19,
+       42,   42,   42,   81,   84,   46,   13,   15,   50,   19,
+       53,   60,   63,   49,   67,   57,   20,   97,   20,   99,
+
+       51,   37,   19,   74,   19,   76,   39,   51,   41,    4,
+       82,  110,  111,  110,   85,   65,   51,   98,   51,  100,
+       71,   73,   19,   75,   19,   79,  110,  112,  114,  110,
+      130,  112,  132,  113,   97,   51,   99,   51,  104,  106,
+      131,  133,  118,  120,  145
+    } ;
 
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,   17,   14,
-       14,   14,   14,   14,   14,   10,   10,   14,   11,   11,
-       13,   13,   13,   13,    8,   13,   13,   13,   13,    9,
-       13,   13,    9,   13,   13,   13,   13,   13,   14,    0,
-        0,    0,   13,   13,   13,   13,    5,    5,    5,    5,
-        5,    5,   13,   13,   13,   13,   13,   13,   13,    0,
-        0,    0,    0,   14,   13,   13,   13,   13,   13,   13,
-       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
-       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+static const flex_int32_t yy_nxt[5109] =
+    {   0,
+        3,    4,    4,    4,    4,    4,    4,    4,    4,    5,
+        6,    4,    4,    6,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    5,    4,    4,    7,    4,    8,    4,    4,
+        4,    4,    4,    4,    4,    9,    4,    4,   10,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,    4,    4,
+        4,    4,   12,    4,   13,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,   14,    4,    4,    4,    4,    4,    4,    4,    4,
 
-       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
-       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
-       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
-       13,   14,    0,    0,   14,   14,   14,   14,   13,   13,
-       13,   13,   13,   13,   14,   14,   14,   14,   14,   14,
-       14,   14,   14,   14,   14,   13,   13,   13,   13,   13,
-       13,   13,    6,    7,    7,    0,    0,    7,    7,    7,
-        7,    7,    0,    0,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,   15,    4,   16,   17,    4,    4,   18,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
 
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    3,   19,   19,   19,
+       19,   19,   19,   19,   19,   20,   42,   19,   19,   50,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   20,   19,
+       19,   54,   19,  145,   19,   19,   19,   19,   19,   19,
+
+       19,   21,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       55,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   22,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   56,
+       19,   66,   67,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,  145,   51,  145,  145,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   68,   78,   86,   87,
+       91,   21,   27,   56,   92,   93,   51,  145,   51,  145,
+       57,   68,   57,   68,  102,  107,   78,   23,  109,  110,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+       48,   51,  115,   57,    4,   57,  145,   73,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   97,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   45,   87,   88,
+       19,   50,   52,   24,  104,  104,  104,  104,  104,  104,
+
+      104,  104,  104,  104,   59,   62,    3,  116,   57,   67,
+      121,  102,  122,  124,  107,  126,   25,   25,   25,   25,
+       25,   25,   25,   25,   26,  145,   25,   25,  145,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   26,   25,   25,
+      109,   25,  134,   25,   25,   25,   25,   25,   25,   25,
+       27,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   84,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+
+       25,   25,   25,   25,   25,   25,   28,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   88,   25,
+      116,  135,   25,   25,   29,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   30,   30,   30,   30,   30,   30,   30,   30,    8,
+      137,   30,   30,  121,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+
+       30,   30,    8,   31,   31,  122,   30,  139,   31,   31,
+       31,   31,   31,   30,   31,   32,   31,   31,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   31,
+       30,   30,   30,   31,  124,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   33,   31,   31,   30,   31,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,  140,   30,  126,  141,   30,   30,   34,
+
+       30,   35,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,    4,    4,   37,    3,
+        4,  142,  111,  135,  143,  137,  144,  139,   15,  140,
+      130,  145,  132,  143,  144,    0,    0,    0,    0,    4,
+        0,   37,    4,    0,    4,    0,    0,    0,    0,    0,
+        0,   15,   36,   37,  145,   38,   39,  106,  106,  106,
+      106,  106,  106,  106,  106,  106,  106,    0,    0,    0,
+        0,    4,    0,    0,    0,    0,   37,    0,    0,    0,
+        0,    0,   79,    0,    0,    0,    0,    0,    0,    0,
+
+       70,   71,    0,    0,    0,    0,    0,    0,    4,    0,
+        0,    0,    0,    0,    0,   79,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  120,  120,  120,  120,
+      120,  120,  120,  120,  120,  120,    0,    0,    0,    0,
+        4,    0,    4,    4,    0,    0,    4,    0,   40,   43,
+       43,   43,   43,   43,   43,   43,   43,   44,   49,   43,
+       43,   25,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       44,   43,   43,   72,   43,    0,   43,   43,   43,   43,
+       43,   43,   43,   45,   43,   43,   43,   43,   43,   43,
+
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   80,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   46,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,    0,   43,    0,    0,   43,   43,   47,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+
+       43,   43,   43,   43,   51,   51,   51,   51,   51,   51,
+       51,   51,    0,    0,   51,   51,    0,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,    0,   51,   51,    0,   51,
+        0,   51,   51,   51,   51,   51,   51,   51,   52,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,    0,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   53,   51,   51,   51,   51,   51,
+
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,    0,   51,    0,    0,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   19,
+       19,    0,    0,   19,    0,   25,   25,    0,    0,   25,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    7,    7,
+        0,    0,   19,    0,    0,   19,    0,   19,   25,    0,
+        0,   25,    0,   25,    0,  145,    0,   61,   61,  145,
 
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-       10,   10,   14,   11,   11,   14,   14,   14,   14,    8,
-       14,   14,   14,   14,   10,   13,   13,   13,   13,   10,
-
-       14,   14,   14,   14,   11,   13,   13,   13,   13,   11,
-       13,   13,   13,   13,   13,    8,   13,   13,   13,   13,
-       14,   14,    9,   14,   14,   14,   14,    9,   13,   13,
-       13,   13,   13,   14,    0,   14,    0,   14,   14,   14,
-       14,    0,   13,   13,   13,   13,   13,   13,    5,   13,
-       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
-       13,   14,   14,   14,   14,   14,   14,   13,   13,   13,
-       13,   13,   14,    0,    0,   14,   14,   14,   14,   14,
-       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
-       14,    7,    0,    0,    7,    7,    7,    7,    7,    7,
+        0,  145,   61,   61,   61,   61,   61,    0,   61,   62,
+       61,   61,    0,    0,   19,    0,    0,    0,    0,    0,
+       25,    0,  145,   61,    0,    0,   97,   61,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   19,    0,    0,    0,    0,    0,   25,    0,   97,
+        0,    0,    0,    0,    0,   63,   61,   61,    0,   61,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   19,    0,   19,   19,    0,    0,   25,
+        0,   25,   25,   57,   57,   57,   57,   57,   57,   57,
+       57,   58,    0,   57,   57,   64,   57,   57,   57,   57,
+
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   58,   57,   57,    0,   57,   43,
+       57,   57,   57,   57,   57,   57,   57,   59,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,  103,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   60,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+
+       57,   57,   57,   57,   57,    0,   57,    0,    0,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   30,   30,
+        0,    0,   30,    0,    0,    0,    0,    0,   99,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   30,    0,    0,   30,    0,   30,    0,    0,    0,
+        0,   99,    0,    0,   65,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   30,    0,    0,    0,    0,    0,    0,
 
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       31,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   30,    0,   30,   30,    0,    0,   30,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,  105,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   71,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   71,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   75,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   81,   81,   81,
+       81,   81,   81,   81,   81,   82,   83,   81,   81,   83,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+
+       81,   81,   81,   81,   81,   81,   81,   81,   82,   81,
+       81,   83,   81,   83,   81,   81,   81,   81,   81,   81,
+       81,   84,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   77,   81,   81,   81,   81,   81,
+       83,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   85,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   83,
+
+       81,   83,   83,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   43,   43,    0,    0,   43,    0,    4,    4,
+       89,    0,    4,    0,   95,    0,   51,    0,    0,   51,
+       57,   97,    0,   57,    0,   43,    0,    0,   43,   57,
+       43,    4,   57,   89,    4,    0,    4,   95,  145,    0,
+        0,   51,   99,   51,   97,   57,    0,   57,  118,    0,
+      120,  145,    0,  118,   57,  145,   57,   43,  120,    0,
+        0,    0,    0,    4,   65,   99,    0,    0,   30,   30,
+
+       51,  118,   30,  120,   57,    0,  118,    0,    0,    0,
+        0,  120,    0,   57,   43,    0,    0,    0,    0,    0,
+       54,   30,    0,    0,   30,    0,   30,   51,    0,    0,
+        0,   57,    0,    0,    0,    0,    0,    0,    0,    0,
+       61,    0,    0,    3,    0,    0,   43,    0,   43,   43,
+        0,    0,    4,   30,    4,    4,   16,    0,    0,   51,
+       90,   51,   51,   57,   96,   57,   57,   67,    0,    0,
+        0,  117,   57,    0,   57,   57,   65,   65,   71,    0,
+       93,   65,   65,   65,   65,   65,    0,   65,   65,   65,
+       65,    0,  119,    0,    0,    0,    0,    0,  123,    0,
+
+      125,   71,   65,  136,   79,    0,   65,    0,  138,    0,
+        0,    0,   30,    0,   30,   30,    0,   99,  100,  100,
+      100,  100,  100,  100,  100,  100,  100,   79,    0,    0,
+        0,    0,    0,    0,   65,   65,   65,    0,   65,    0,
+        0,    0,    0,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   94,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       82,   82,   82,   82,   82,   82,   82,   82,  101,    0,
+
+       82,   82,    0,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,    0,   82,   82,  108,   82,    0,   82,   82,   82,
+       82,   82,   82,   82,  111,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,  112,   82,   82,
+       82,   82,   82,    0,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+      113,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,    0,   82,    0,    0,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,    0,   83,   83,    0,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,    0,
+       83,    0,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+
+       83,   83,  114,   83,   83,   83,   83,   83,    0,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,    0,   83,    0,
+        0,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+
+       81,   81,    0,    0,   81,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   81,    0,    0,   81,    0,   81,    0,
+        0,    0,    0,    0,    0,    0,   83,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   81,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   81,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   81,    0,   81,   81,  127,  127,
+      127,  127,  127,  127,  127,  127,  128,    0,  127,  127,
+      129,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  128,
+      127,  127,  129,  127,  129,  127,  127,  127,  127,  127,
+      127,  127,  130,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  129,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+
+      127,  127,  127,  127,  127,  127,  127,  127,  131,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      129,  127,  129,  129,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,   82,    0,    0,   82,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,   10,   14,   14,   14,   14,   10,   11,   11,
-       14,   14,   14,   14,   11,   14,   14,   14,   14,   11,
-       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
-       14,   14,   14,   10,   13,   13,   13,   13,   10,   13,
-       13,   13,   13,   14,   14,   14,   14,   14,   14,   14,
-
-       14,   14,   11,   13,   13,   13,   13,   11,   13,   13,
-       13,   13,    8,   13,   13,   13,   13,    9,   14,   14,
-       14,   14,    9,   14,   14,   14,   14,   12,   12,   12,
-       12,   12,   12,   12,   12,   12,   14,   14,   14,   14,
-       14,   12,   12,   12,   12,   12,   12,   12,   12,   14,
-       14,   14,   14,   14,   14,   13,   13,   13,   13,   13,
-       13,   14,   14,   14,   14,   14,   14,   14,   14,   14,
-       14,   14,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    0,    0,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        0,    0,    0,    0,    0,    0,    0,    0,   82,    0,
 
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    0,    0,    0,    0,    0,
+       82,    0,    0,    0,    0,    0,    0,    0,   83,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   82,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   82,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   82,    0,   82,   82,
+      128,  128,  128,  128,  128,  128,  128,  128,    0,    0,
+
+      128,  128,    0,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,    0,  128,  128,    0,  128,    0,  128,  128,  128,
+      128,  128,  128,  128,  132,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,    0,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      133,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,    0,  128,    0,    0,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,    0,  129,  129,    0,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,    0,
+      129,    0,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+
+      129,  129,  129,  129,  129,  129,  129,  129,    0,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,    0,  129,    0,
+        0,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+
+      127,   19,    0,    0,  127,   51,    0,    0,  128,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  127,    0,    0,  127,    0,  127,    0,
+      128,    0,  128,    0,    0,    0,  129,    0,    0,    0,
+      129,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  127,    0,    0,    0,  128,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  127,    0,    0,    0,  128,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   14,   14,   14,   14,   10,   14,   14,   14,   14,
-       10,   14,   14,   14,   14,   14,   14,   14,   14,   11,
-       14,   14,   14,   14,   14,   11,   14,   14,   14,   14,
-
-       11,   14,   14,   14,   14,    8,   14,   14,   14,   14,
-       10,   14,   14,   14,   14,   14,   14,   14,   14,   10,
-       13,   13,   13,   13,   11,   14,   14,   14,   14,   14,
-       14,   14,   14,   11,   13,   13,   13,   13,   14,   14,
-        9,   14,   14,   14,   14,    9,   14,   14,   14,   14,
-       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
-       14,    0,   14,    0,   14,   14,   14,   14,   14,   14,
-       14,   14,   14,   12,   12,   12,   12,   12,   12,   12,
-       12,   12,   12,   12,   12,   12,   14,   14,   14,   14,
-       14,   14,   14,   14,   14,   14,   14,    7,    7,    7,
-
-        7,    7,    7,    7,    7,    7,    7,    7,   10,   14,
-       14,   14,   14,   10,   14,   14,   14,   14,   10,   14,
-       14,   14,   14,   11,   14,   14,   14,   14,   14,   14,
-       14,   14,   11,   14,   14,   14,   14,   10,   14,   14,
-       14,   14,   11,   14,   14,   14,   14,   10,   10,    9,
-       14,   14,   14,   14,   12,   12,   12,   12,   12,   12,
-       12,   12,   12,   12,   14,   14,   14,   14,   14,   14,
-       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
-       12,    7,    7,    7,    7,    7,    7,    7,   10,   14,
-       14,   14,   14,   11,   14,   14,   14,   14,   14,   14,
-
-       14,   14,   14,   14,   12,   12,   12,   12,   12,    0
-    } ;
 
-static const flex_int32_t yy_base[1514] =
-    {   0,
-        0,  232,  634,   74,  104,59859,  108,  111,  307,   63,
-      165,  362,  281,  341,   64,   34,59859,59859,  445,  396,
-      459,  493,  464,  483,  588,  471,  508,  636,  528,  660,
-      748,  753,  815,  864,  774,  826,  919,  924,  124, 1011,
-      973,  958, 1025, 1028, 1034, 1050,   77, 1064,59859, 1072,
-     1075, 1078, 1097,   71, 1126, 1095, 1167,   73,  101,   79,
-      333, 1165, 1302, 1341, 1572, 1803, 1264, 1217, 1236, 1432,
-     1285, 1369, 1492, 1630, 1634, 1748, 1718, 1888, 1967, 2001,
-     1723, 1922, 1730, 2093,    0, 1713, 2155, 2204, 2072, 1679,
-     2143, 2231, 2256, 2319,   13, 1989, 2232, 2352,   16,   24,
-
-       39,   30, 2382,  355,  471,  464,    3,  487, 2285, 2341,
-     2358, 2439, 2362, 2482, 2370, 2376, 2456, 2486, 2508, 2491,
-     2546, 2645, 2629, 2603, 2710, 2713, 2720, 2729, 2767, 2815,
-     2829, 2833, 2858, 2933, 2884, 2941, 2953, 3041, 2981, 3096,
-     2912, 3111, 3330, 3549, 2988, 3141, 3179, 3578, 3583, 3224,
-     3229, 3099, 3683, 3731, 3897, 3379, 3567, 3337, 3916, 3919,
-     3922, 3352, 3941, 3976, 3938, 4083, 4108, 4067, 3571, 4061,
-     4200, 4419, 4280, 4438, 4575, 4643, 4250, 4500, 3563, 3543,
-     4148, 4266, 4269, 1203, 2425, 4272, 4495, 4410, 4398, 4622,
-        0,  522, 4625, 4650, 4700, 4647, 4822, 4726, 4773, 4846,
-
-     4851, 4873, 4898, 4926, 4923, 4901, 4146, 4912,  351, 5042,
-      352,  650, 4940, 4961,    0,  517, 4998, 4988, 5071, 5077,
-     5188, 5267, 5304, 5374, 5098, 5229, 5417, 5241, 5408, 5468,
-     5425, 5537, 5572, 5545, 5623, 5687, 5742, 5728, 5777, 5793,
-     5866, 5950, 6020, 6095, 6221, 6266, 6485, 6411, 6187, 5842,
-     5724, 5870, 5953, 6016, 6376, 6067, 6106, 6445, 6597, 6395,
-     6623, 6455, 6467, 6632, 6524, 6712, 6528, 6756, 6770, 6807,
-     6780, 6798, 6810, 6887, 6917, 6875, 6931, 6939, 7058, 7277,
-     7496, 7078, 7106, 7166, 7525, 7530, 7127, 7171, 7123, 7630,
-     7678, 7844, 6773, 7176, 7282, 7355, 7522, 7861, 7865, 7868,
-
-     7513, 7871, 7981, 8057, 8018, 7932, 8096, 8118, 8337, 8411,
-     8228, 8418, 8523, 8133, 8549, 8136, 8091, 8190,    0, 8571,
-     8732, 8633, 8637, 8147, 8640, 7508, 8758, 8823, 7516, 8837,
-     8710, 8747, 8728, 8816, 8807, 8874, 8947, 8900, 8918, 9101,
-     9130, 9156, 9182, 9086, 9208, 9211, 9216, 9261, 9273,  549,
-       20,   44, 9333, 9412, 9459, 9470, 5231, 8140,  669, 5546,
-      395,  777, 9326, 9383, 9509, 9418, 9421, 9523, 9531,  472,
-     1571,  439,  465, 9538, 9430, 9585, 9609, 9588, 9481, 9649,
-     9633, 9660, 9678, 9735, 9738, 9753, 9757, 9746, 9762, 9772,
-     9800, 9857, 9852, 9879, 9861, 9864, 9945,10009,10012,10029,
-
-    10067,10083,10092,10152,10076,10133,10155,10259,10338,10233,
-    10251,10239,10221,10320,10404,10425,10429,10481,10443,10447,
-    10485,10503,10530,10541,10608,10650,10657,10668,10687,10728,
-    10694,10706, 3139, 3939,10731,10745,10780,10795,10928,10756,
-    10870,10943,10805,10917,10934,10969,10958,10978,10995,11165,
-    11007,11058,11179,11100,11126,11183,11204,11232,11228,11248,
-    11254,11244,   51,11273,11289, 3952, 5654,11324,11333,11375,
-    11354,11402,    0,  494,11405,11419,11456,11440,11498,11431,
-    11480,11603,11525,11573,11747,11978,12209,11654,11630,11577,
-    11717,11802,11904,11893,11885,11664,12096,11923,12285,12328,
-
-    12130,12154,12362,12350,12457,12399,12559,12564,12433,12783,
-    12585,11888,12696,12124,12625,12607,12611,12768,12834,12826,
-    12901,12854,12910,12927,12884,12981,13041,12939,13067,13085,
-    13093,13147,13194,13151,13185,13189,13245,13272,13289,13200,
-    13361,13580,13799,13377,13414,13475,13828,13833,13441,13337,
-    13494,13933,13981,14147,13588,13591,13814,14166,14169,14172,
-    14188,14191,13817,14249,14355,14311,14358,14235,13823,14380,
-    14599,14673,14432,14680,14785,14410,14811,14421,13793,14611,
-      620,  389,  442,   25,    1,  183, 1312,   65,  413, 1852,
-       47, 3453, 7435, 6706,   17, 2882,  245,  480,14392, 2959,
-
-    15030,14915,14427,14899,15167,15399,14925,15052,15101,15195,
-    15229,15271,15415,15255,15104,15517,15476,15506,15654,15706,
-    15501,15741,15536,15793,15931,15850,15914,16033,15727,16192,
-    16231,16270,16309,16512,15869,15703,15274,16016,16021,16166,
-    16473,16027,16568,16144,16343,16617,16546,16551,16421,16620,
-    16669,16698,16688,16771,16777,15904,16876,16944,16774,16852,
-    16857,16861,16896,16901,17027,17044,17048,17053,16938,17121,
-    17140,17164,17143,17198,17181,17201,17218,17258,17295,17311,
-    17287,17405,17478,17355,17507,17384,17433,17462,17534,17454,
-    17556,17562,17576,17583,17591,17631,17625,17676,17693,17781,
-
-    17704,17720,17731,17831,17835,17845,17859,17852,17896,17940,
-    18050,17923,18023,18003,18079,18084,18087,17989,18131,18136,
-    18237,18286,18335,18209,18179,18226,18320,18436,18369,18485,
-    18363,18410,18519,18637,   23,18594,  105,18657,18720,18764,
-    18803,    0,18843,18890,18928,18967,19076,19114,   84,18510,
-    18560,18632,18643,18815,18758,18989,19029,19130,19018,19120,
-    19126,19187,19134,19181,19287,19243,19201,19272,19291,19298,
-    19345,19339,19353, 3956, 7164,19359,19356,19365,19400,19439,
-    19445,19512,19463,19506,19497,19517,19649,19523,19587,19591,
-    19584,19606, 4050, 8903,19660,19670,19664,19676,19793,19738,
-
-    19744,19814,19817,19789,19833,19836,19883,19862,19889,20036,
-    19930,19947,20048,20058,20020,20073,20097,20187,20108,20122,
-    20159,20162,20212,20287,20359,20345,20578,20330,20810,21029,
-    20708,20335, 3166,21248,21362,21045,21581,20485,20306,20460,
-    20536,20560,20502,20887,20699,21002,21221,20691,21520,21404,
-    21683,21011,21718,21098,21633, 4335,  394,   87,  350,  347,
-      338,  327,  368,  317,   17,14528,  345,  841, 1053,  289,
-     1320,  346,  295,   66,  135,   62,  227, 3301,   19,   95,
-     3230, 1129,  130,  294,   67, 1830,21802,21866,  151,  406,
-     7309, 4231,21782,  310, 1230,  291,21929,21897,21992,  300,
-
-      263,  113,  226,   14, 1391,  240,  564,  135,  285, 6880,
-      413,  433,  260,  198,21278,22054, 8270, 2179, 7743,22097,
-      183,  684,  225,  231,  230,20845,21008,22259,22211,21020,
-    21630,21748,22262,22301,22364,22336,21101,22409,21116,22488,
-    22563,22597,22130,22689,22371,22425,22770,22715, 3749,23002,
-    22887,23139,21541,22572,22399,22567,22655,22901,22652,23155,
-    22661,22740,22775,22880,22890,23076,23079,23181,23190,23205,
-    23234,23283,23305,23231,23298,23302,23359,23377,23420,23446,
-    23442,23470,23489,23509,23527,23611,23530,23533,23719,23603,
-    23596,23675,23753,23800,23756,23826,23782,23861,23851,23834,
-
-    23876,23886,23599,23895,23906,23940,23921,24105,23984,23879,
-    24047,24098,24037,24132,24174,24154,24159,24357,24203,24193,
-    24243,24237,24426,24305,24406,24330,24475,24481,24554,    0,
-       15,  460,24592,24603,24612,24633,24710,24740,24757,24832,
-    24862,24880,24959,   26,  538,24999,25006,25066,25082,25132,
-    25204,25287,25328,25435,25465,25474,25483,25605,25531,25684,
-    25714,24198,24841,24954,25091,25156,25670,25195,25345,25723,
-    25593,25407,25757,25352,25694,25834,25642,25779,25355,25732,
-    25840,25884,25890,25929,    0,  294,25944,25947,25971,25991,
-    25982,25998,26098,26043,26049,26060,26088,26246,26103,26113,
-
-    26174,26263,26311,26287,26169,26154,26352,26404,26430,26511,
-    26396,26401,26548,26389,26556,26658,26663,26666,26763,26687,
-    26806,26932,26971,27008,27049,  365,  223,  212,  169,  181,
-        7, 2134, 1421, 1483,  520,  149,  587,  763, 1865,  762,
-      307, 1364, 1487, 1496,  146, 1594,  178,27161,14717,   90,
-      369,   61,  431,   84,   27, 2089, 1208, 1401,  305,   18,
-     1057,  341,  421,   20, 1129,   53, 1275,   15,   14, 1517,
-      445,26410,26832,26908,26937,26850,27052,27194,27304,27307,
-    27310,27325,27345,27359,27362,27365,27370,27380,27400,27425,
-    27584,27419,27531,27513,27566,27509,27638,27668,27517,27646,
-
-    27732,27664,27672,27688,27717,27676,27805,27843,27762,27809,
-    27816,27872,27916,27900,27878,27907,27921,27983,27988,28104,
-    27993,28099,28153,28074,28031,28159,28230,28214,28162,28251,
-    28300,28304,28307,28414,28325,28429,28345,28451,28536,28612,
-    28638,28588,28626,28508,28664,28719,28699,28803,28749,28776,
-    28791,28865,28949,29002,29023,29044,29086,29128,29149,29107,
-    29272,   27,29286,  348,29335,29349,29392,29409,29514,29532,
-    29637,29619,29657,29779,  252,  670,29785,29797,29864,29903,
-    29917,29924,30032,30043,30150,30175,30187,30247,30295,30352,
-    30422,30472,28779,28875,28963,29459,29282,29016,29570,29582,
-
-    29493,29633,30492,29912,30095,30070,30122,30528,29745,30197,
-    30499,30235,30510,30658,30567,30562,30630,30577,30763,30637,
-    30647,30741,30789,30021,30797,30867,30814,30849,30857,30878,
-    30883,30902,31069,30918,31004,30861,30962,31121,31020,31148,
-    31024,31175,31279,31210,31228,31225,31216,31305,31376,31429,
-    31367,31478,31425,31373,31504,31513,31631,31651,31688,31738,
-    31783,31795,31853,31860,31981,31992,32031,32103,32088,32235,
-    32160,32255,32275,32360,32380,32499,32505,32511,32520,32584,
-    32631,31483,31625,32651,31902,31746,32214,32387,32735,32606,
-    32761,31916,32707,32814,32726,32840,32795,32874,32972,32981,
-
-    33019,33077,33114,33219,33156,33261,33279,33324,33366,59859,
-    33593,33848,34103,34358,34613,34868,35123,35378,35633,35888,
-    36143,36398,36653,36908,37163,37418,37673,37928,38183,38438,
-    38693,38948,39203,39458,39713,39968,40223,40478,40733,40988,
-    41243,41498,41753,42008,42263,42518,42773,43028,43283,43538,
-    43793,44048,44303,44558,44813,45068,45323,45578,45833,46088,
-    46343,46598,46853,47108,47363,47618,47873,48128,48383,48638,
-    48893,49148,49403,49658,49913,50168,50423,50678,50933,51188,
-    51443,51698,51953,52208,52463,52718,52973,53228,53483,53738,
-    53993,54248,54503,54758,55013,55268,55523,55778,56033,56288,
-
-    56543,56798,57053,57308,57563,57818,58073,58328,58583,58838,
-    59093,59348,59603
-    } ;
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  127,    0,  127,  127,  128,    0,
+      128,  128,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-static const flex_int32_t yy_def[1514] =
-    {   0,
-     1411, 1411, 1410, 1412, 1413, 1410, 1412, 1414, 1415, 1413,
-     1412, 1412, 1412, 1416, 1413, 1410, 1410, 1410, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1417, 1418, 1412, 1412,
-     1417, 1417, 1417, 1417, 1412, 1413, 1413, 1413, 1410, 1412,
-     1412, 1412, 1412, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1419, 1420, 1419, 1420, 1420, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1421, 1422, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1424, 1425, 1425, 1425, 1425, 1425, 1425,
-
-     1425, 1425, 1426, 1410, 1410, 1410, 1410, 1410, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423,  143,  153, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1427, 1423, 1423, 1423, 1423, 1423, 1423, 1427,
-     1428, 1428, 1427, 1427, 1427, 1427, 1429, 1423, 1423, 1423,
-
-     1423, 1423, 1423, 1423, 1423, 1423, 1430, 1431, 1431, 1431,
-     1431, 1431, 1432, 1433, 1434, 1434, 1432, 1432, 1432, 1432,
-     1432, 1434, 1434, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1410, 1434, 1434, 1434, 1434, 1435, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,  280,
-      290, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1436, 1437,
-     1437, 1437, 1437, 1437, 1437, 1438, 1438, 1437, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1437,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1439, 1440, 1441,
-     1439, 1439, 1439, 1439, 1439, 1439, 1442, 1443, 1443, 1443,
-     1443, 1443, 1438, 1444, 1445, 1438, 1438, 1438, 1438, 1410,
-     1410, 1410, 1410, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1447, 1438,
-     1438, 1438, 1438, 1438, 1448, 1446, 1446, 1446, 1446, 1449,
-     1446, 1446, 1446, 1446, 1446, 1438, 1438, 1447, 1438, 1438,
-     1438, 1438, 1450, 1451, 1452, 1451, 1451, 1451, 1451, 1451,
-     1451, 1452, 1453, 1453, 1452, 1452, 1452, 1452, 1454, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1454,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451,  542,  552, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1451,  542,
-
-     1451, 1451, 1451, 1455, 1451, 1456, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1457, 1457, 1458, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1459, 1459, 1459, 1459, 1459,
-
-     1457, 1457, 1457, 1457, 1457, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1457, 1459, 1459, 1459, 1459,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1459, 1459, 1459,
-     1459, 1459, 1460, 1461, 1461, 1462, 1461, 1461, 1461, 1461,
-     1461, 1463, 1464, 1465, 1465, 1465, 1465, 1465, 1466, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1468, 1469, 1469, 1469, 1469, 1469, 1467, 1467, 1467,
-     1467, 1467, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1468, 1469, 1469, 1469,
-     1469, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1472, 1473,
-
-     1473, 1473, 1473, 1473, 1474, 1471, 1471, 1471, 1471, 1475,
-     1471, 1471, 1471, 1471, 1471, 1473, 1473, 1472, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1472, 1473, 1473, 1473,
-     1473, 1473,  829, 1473, 1473, 1473, 1472, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,  829, 1473,
-     1473, 1473, 1476, 1477, 1477, 1477, 1477, 1477, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1478, 1478, 1478, 1478, 1478, 1477, 1478,
-     1478, 1478, 1478, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-
-     1477, 1477, 1478, 1478, 1478, 1478, 1478, 1477, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1476, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1479, 1480, 1481,
-     1479, 1479, 1479, 1479, 1479, 1479, 1482, 1483, 1483, 1483,
-     1483, 1480, 1484, 1480, 1480, 1480, 1480, 1480, 1480, 1485,
-     1483, 1483, 1483, 1483, 1483, 1486, 1479, 1486, 1486, 1486,
-     1486, 1487, 1487, 1487, 1487, 1487, 1488, 1489, 1489, 1489,
-     1489, 1489, 1490, 1491, 1491, 1491, 1491, 1491, 1492, 1492,
-     1492, 1492, 1492, 1491, 1493, 1493, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1490, 1491, 1491,
-
-     1491, 1491, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1489, 1489, 1489, 1489, 1487, 1487, 1487, 1487, 1487,
-     1489, 1487, 1487, 1487, 1487, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1487, 1487, 1487, 1487, 1487,
-
-     1489, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1494,
-     1494, 1494, 1494, 1494, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1494, 1494, 1494, 1494, 1494, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1487, 1487, 1487, 1487, 1487,
-     1495, 1495, 1495, 1495, 1496, 1497, 1497, 1497, 1497, 1497,
-     1498, 1498, 1499, 1498, 1498, 1498, 1498, 1498, 1500, 1500,
-     1500, 1500, 1500, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1501, 1495, 1495, 1495, 1495, 1495, 1500, 1495, 1500, 1500,
-     1500, 1500, 1502, 1502, 1502, 1502, 1502, 1503, 1503, 1503,
-
-     1503, 1503, 1504, 1503, 1503, 1503, 1503, 1410, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1505, 1505,
-     1505, 1505, 1505, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1495, 1495, 1495, 1495, 1495, 1506,
-     1506, 1506, 1506, 1506, 1507, 1508, 1508, 1508, 1508, 1508,
-     1509, 1510, 1510, 1510, 1510, 1510, 1495, 1495, 1495, 1495,
-     1495, 1511, 1511, 1512, 1511, 1511, 1511, 1511, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1508, 1510,
-
-     1508, 1508, 1508, 1508, 1510, 1510, 1510, 1510, 1510,    0,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+
+      145,  145,  145,  145,  145,  145,  145,    0
     } ;
 
-static const flex_int32_t yy_nxt[60116] =
+static const flex_int32_t yy_chk[5109] =
     {   0,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,    5,    6,
-     1410, 1410,    6, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410,  182, 1410, 1410, 1410, 1410, 1410,
-     1410,    5,    7,    7,    8,  432,    9,    7,    7,    7,
-        7,    7,  104,    7,   10,    7,    7,   11,   12,   12,
-       12,   12,   12,   12,   12,   12,   12,   97,    7, 1030,
-       97,   13,    7,   14,  350,  104, 1410,  350,   97, 1410,
-     1030,  350,   45,   45,   97,   45,   45,  733, 1410, 1410,
-      736, 1410,   38,   97, 1263, 1410,   45, 1410,  350,   45,
-       15,    7,    7, 1410,    7,   56, 1410,   45,   45,   45,
-
-       45,  733, 1410,   98, 1410,   38,   98,   85, 1410, 1410,
-     1410,   45,   46,   45,   98,   56,   38,   56,   39,   55,
-       98, 1410,   16,   56,   17,   18,   45,   45,   97,   98,
-      371,  372, 1410,   37,  743,   46,   37,  242,  242,   38,
-       45,   57,   55, 1410,  899,   56,  900,  901,   47,  350,
-      242,  242,   39, 1410,  103,   56, 1410,  362,   37,  242,
-       37,   57,  736,   57,   40, 1125,  360,  361, 1410,   57,
-      242,  242, 1308,   86,   98,  358, 1308,  359,  242,  242,
-      242,  242,  242,  242, 1308,   45,   45,   37,   45,   45,
-      242,   57, 1124,   19,   48, 1050,   86, 1125,   40,   45,
-
-     1308,   57,   45, 1124,   20,   21,  210,  211, 1308,   39,
-       87,   88,   22,   23,   24,   25,   26, 1308,   27,   28,
-      242,  242,   29,   30,   31,   32,   33,  105,   49,  242,
-      242,  242,  208,   34,  242,  242,  242,  242,   35,   36,
-        5,    6,  242,  242,    6, 1308,   37, 1308,   37,   37,
-      242,  242, 1122, 1122,  209,   40, 1122, 1122,  106,  107,
-      108,  773,  242,    5,    7,    7,    8,   41,    9,    7,
-        7,    7,    7,    7, 1308,    7,   10,    7,    7,   11,
-       12,   12,   12,   12,   12,   12,   12,   12,   12,   38,
-        7, 1122, 1122,   13,    7,   14, 1030,   50,   42,   43,
-
-       44,   41, 1124, 1124,   58,  242,  242,  242, 1124, 1124,
-      242, 1125,   38,  242, 1125,   63,  242, 1122, 1122, 1122,
-     1122, 1125,   15,    7,    7,   39,    7, 1161,   51,   52,
-       53, 1125,   42,   43,   44,   59,   60,   61,   63,   64,
-       64, 1410,   94, 1125,   64,   64,   64,   64,   64,   96,
-       64,   65,   64,   64,   16, 1125,   17,   18,   89, 1410,
-     1410,  242,  242,  104, 1410,   64, 1124, 1124, 1124,   64,
-       86,   40,   96, 1162,  242,  242,  242,   56,  242,  242,
-      242, 1125, 1410, 1410, 1303,   97,  104, 1124, 1124,   90,
-       91,   92,  350,   86, 1171,   56,   56,   66,   64,   64,
-
-     1170,   64, 1169, 1410,   38, 1263,   39,   87,   88,   93,
-       93,   93,   93,   93,   93,   93,   93,   93,   93, 1124,
-     1124, 1124, 1124,   57,  914,   19, 1410,   38,  915,  916,
-     1124,   98,  917,  918, 1125, 1125,   20,   21, 1365,   97,
-       39,   57,   57, 1124,   22,   23,   24,   25,   26, 1124,
-       27,   28,   40,   38,   29,   30,   31,   32,   33, 1124,
-      212, 1123, 1123, 1123, 1123,   34, 1123,   38,  242,  182,
-       35,   36,   38,  242,   41,  242,   38,  242,  208,   38,
-     1122, 1122, 1122, 1122, 1122,   98,   40, 1308, 1308,   39,
-       38,   38, 1125, 1125, 1125,   38,  242, 1123, 1123,  242,
-
-       67,   38,   38,   39, 1030,   42,   43,   44,   39,  242,
-      208,   68,   69,  242,   38,   39,   38, 1308, 1308,   70,
-       71,   72,   73,   74,   38,   75,   76,   39,  242,   77,
-       78,   79,   80,   81,   99,   40,   38,   39,  242,   38,
-       82, 1122, 1122, 1122, 1122,   83,   84,  432,  105,   40,
-     1255,  242,   39,  358,   40,   89, 1308, 1308, 1308,   38,
-      242,   40, 1308, 1308, 1308,  100,  101,  102, 1124, 1124,
-     1124, 1124,   39,   40, 1122, 1122,  242,  109,  242,  106,
-      107,  108, 1030,   40,  810,  111,   90,   91,   92,   41,
-     1124, 1124,  104,  111, 1308, 1308,   38,  104,   40,  104,
-
-      111,  111, 1308, 1308,  110,  111,  742,  479, 1124, 1124,
-      111,  111,  450,  111,  373,  111,  111,  370,   40,   38,
-       42,   43,   44,  919,  920,  921,  111,  111, 1281,  922,
-      104,  111,   39, 1410,  923,  111,  924,  925,   41, 1410,
-      111,  111,  111,  111,   38, 1410,  111,  111,  111,  111,
-      111,  111,   41,  111, 1410,  111, 1410,   41, 1410, 1410,
-     1410,  111,  111, 1410,   41, 1410, 1410,   38,   38,   42,
-       43,   44, 1125, 1125, 1125, 1125,   41, 1410,   40,  773,
-       39, 1410, 1410,   42,   43,   44,   41, 1410,   42,   43,
-       44,   38, 1410, 1410,   56,   42,   43,   44, 1410, 1410,
-
-     1410,   41, 1410, 1410,   39, 1124, 1124,   42,   43,   44,
-      111,  111,  111,   97, 1030, 1410, 1410,   42,   43,   44,
-     1410,   41, 1410, 1410,  111,  111,   40,  111,  111, 1410,
-     1410, 1410,   42,   43,   44, 1125, 1125, 1125, 1125, 1125,
-       57, 1410,  111, 1410,  111,  111,  111, 1124, 1124, 1124,
-       40, 1124,   42,   43,   44, 1410,   38, 1410, 1410,   98,
-     1371,   38, 1410,  111,  111,  111,  111,  111,  111,  111,
-      111,  111,  111,  111,  111,  111,  111,  208, 1410,   38,
-      242,   41,   38, 1410,   38, 1410,  242, 1410, 1410, 1410,
-      242, 1410,   39, 1410, 1410, 1410,  358,   39, 1410, 1410,
-
-     1410,  242,  242, 1410, 1410,   38,  242, 1410, 1410, 1410,
-      242, 1410,   42,   43,   44, 1410, 1410, 1410,   39,  112,
-      113,   97, 1410,   38,  114, 1410,  115, 1410,  116,   41,
-      117, 1410, 1410, 1410,   38, 1410,  118,  119,   40, 1410,
-     1410, 1410,  120,   40,  121, 1410,   38,  122, 1410,  123,
-      124, 1410, 1163,   41, 1164, 1165, 1166,   38, 1410,   39,
-       42,   43,   44, 1410,   40, 1410, 1410,   98, 1410, 1167,
-       39, 1410,   38, 1410, 1168, 1410,  125, 1410,  126, 1410,
-      143,  144,  145, 1410,   42,   43,   44, 1410,  127, 1410,
-     1410,  128,  146, 1410, 1410,   38, 1125, 1125, 1125, 1125,
-
-      129,  130,  131,  132,  358,   40,  133,  134,   39,  147,
-     1410,  148,  135, 1410, 1410,  136,   40,  137,  149,  150,
-      138, 1410,  139,  140,  141, 1410,  142,  183, 1410, 1410,
-     1410,  151,   38,  152, 1410, 1410,  153,  154, 1410, 1410,
-     1410,   41,  155, 1410,  156,  157,   41, 1410, 1125, 1125,
-      183, 1125, 1125,  170,   40,   38, 1410,  171,  172, 1410,
-     1410,  173,  174,  184, 1410, 1410,  183,   41,  191,  175,
-      176,  177,   42,   43,   44,  178, 1410,   42,   43,   44,
-      179,  183,  180,  181,  242,  242,  242,  242,  242,  183,
-     1410, 1410, 1410,  242,  242, 1410, 1410, 1410,   42,   43,
-
-       44, 1410,  184, 1410,  183, 1410, 1410, 1410,   41,  185,
-      158, 1410, 1410, 1410,  192,  159,  160,  184,  161,   41,
-       37, 1410, 1410,   37,  162, 1410,  163,  164,  165, 1410,
-      166, 1410,  167,  183,  168, 1410,  183, 1410,  169,   42,
-       43,   44,   38, 1410, 1410,   37, 1410,   37,  185, 1410,
-       42,   43,   44, 1410, 1410, 1410,  183,   41,   46,  183,
-     1410, 1410, 1410,  185, 1410,   38, 1410, 1410, 1410,  184,
-     1410, 1410,  184,   45,   37, 1410,   45, 1410,   39, 1410,
-       38,   46, 1410,   38, 1410, 1410,   38, 1410,   42,   43,
-       44, 1410, 1410, 1410,   47, 1410, 1410, 1410,   45, 1410,
-
-       45,  197, 1410,   38,   54,   38,   38,   54, 1410,   38,
-     1410,  199,  186, 1410, 1410,  185,   39,  193,  185,   39,
-     1410, 1410,   39, 1410,   40, 1410, 1410,   45,   38,   54,
-     1410,   54,  198,   37,   55,   37,   37, 1410, 1410, 1410,
-       48,   39, 1410,  187,  188,  189, 1410, 1410,  194,  195,
-      196,  186,  200,  201,  103,  202, 1410,   55,   54, 1410,
-     1410, 1410,   40, 1410, 1410,   40,  186, 1410,   40, 1410,
-       56, 1410, 1410,  214,   49, 1410,   54, 1410, 1410,   54,
-     1410, 1410,  187,  188,  189, 1410,   45,   40, 1410,   45,
-      242,  242,  242,  242,  242,  242,  214,  187,  188,  189,
-
-     1410,   54, 1410,   54, 1410,  204,  205, 1410, 1410,  215,
-     1410, 1410,  182, 1410, 1410,  182,   57,   54,  186,   54,
-       54,  186, 1410, 1410,  206,  214, 1410,   41,  203, 1410,
-       54,  110, 1308, 1308, 1308, 1308, 1308,  182, 1410,  182,
-     1410, 1410, 1410,   50,  214, 1410, 1410, 1410,  214,  187,
-      188,  189,  187,  188,  189,  216, 1410,  207,   42,   43,
-       44,  215, 1410, 1410, 1410,   41,  182,  214,   41, 1410,
-     1410,   41,  214, 1410,   51,   52,   53, 1410, 1410, 1410,
-      215, 1410, 1122, 1122, 1122, 1122, 1122, 1122, 1122,   54,
-       41,   54,   54,  214, 1410,  214,   42,   43,   44,   42,
-
-       43,   44,   42,   43,   44, 1410, 1410,  216,  215, 1410,
-       63, 1308, 1308, 1308, 1308, 1308,  214, 1122, 1122,   58,
-     1410,   42,   43,   44, 1410,  182,  216,  182,  182,  215,
-     1410, 1410, 1410,   63,   64,   64, 1410, 1410, 1410,   64,
-       64,   64,   64,   64, 1410,   64,   65,   64,   64,  214,
-       59,   60,   61, 1410,  216, 1410, 1410, 1410,  217, 1410,
-       64, 1308, 1308, 1308,   64, 1308, 1308, 1308, 1308, 1308,
-      221, 1410,  214,  221,  221,  216, 1410,  214,  221,  221,
-      221,  221,  221, 1410,  221,  222,  221,  221, 1410,  218,
-      219,  220,   66,   64,   64, 1410,   64, 1410, 1410,  221,
-
-      214, 1410, 1410,  221, 1410, 1410,  221, 1410, 1410, 1410,
-      217, 1410, 1410,  215, 1123, 1123, 1123, 1123, 1410, 1123,
-     1123,  221,  221,  248,  221, 1308, 1308, 1308, 1308,  217,
-      221,  223,  221,  221,  221,  221, 1410, 1410, 1410, 1410,
-      214,  218,  219,  220, 1410,  221,  221, 1410,  242,  242,
-      221,  242,  242, 1410,  221, 1410, 1410,  217, 1410,  216,
-      218,  219,  220,  214, 1410, 1410,  242, 1410,  242,  242,
-      242, 1410, 1410, 1410,  221, 1410,  215, 1410,  217,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  218,  219,
-      220, 1125, 1125, 1125, 1125,   67,  221, 1410, 1410,  221,
-
-      214, 1410,  221, 1410, 1410, 1410,   68,   69, 1410,  218,
-      219,  220, 1410, 1410,   70,   71,   72,   73,   74, 1410,
-       75,   76,  216,  214,   77,   78,   79,   80,   81, 1308,
-     1308, 1308, 1308, 1308,  224,   82,  215, 1410, 1410, 1410,
-       83,   84, 1410, 1125, 1125,  225,  226,  221,  221, 1410,
-     1410, 1410, 1410,  227,  228,  229,  230,  231, 1410,  232,
-      233, 1410,  217,  234,  235,  236,  237,  238, 1124, 1124,
-     1124, 1124, 1124, 1124,  239, 1410, 1308, 1308, 1410,  240,
-      241,   62,  216, 1410,   62,  221,  221,  221,  221,  221,
-      221, 1410, 1410,  218,  219,  220, 1125, 1125, 1125, 1125,
-
-     1125, 1125, 1125, 1410,   64,   64,   62, 1410,   62,   64,
-       64,   64,   64,   64, 1410,   64,  242,   64,   64, 1125,
-     1125, 1125, 1125, 1410, 1410,  217, 1410, 1125,  221,  221,
-       64,  221,  221, 1410,   64,   62, 1410, 1410,  214, 1410,
-     1410, 1125,  214, 1125, 1125, 1125,  221, 1410,  221,  221,
-      221, 1308, 1308, 1308, 1308, 1308,  218,  219,  220, 1410,
-     1410,  214,   64,   64,   64,  214,   64, 1125, 1125, 1125,
-     1125, 1125, 1125, 1125,  215, 1410, 1410, 1410,  215, 1125,
-     1125, 1125, 1125, 1125, 1125,  217, 1410,  183, 1410, 1410,
-     1410, 1410, 1410, 1410,   62, 1410,   62,   62,  104,  104,
-
-      104,  104,  104,  104,  104,  104,  104,  104,  104, 1410,
-      183, 1410, 1410, 1410, 1410, 1410,  218,  219,  220, 1410,
-      216,   86, 1410,  184,  216, 1410,  214, 1410, 1410, 1410,
-     1410,  214, 1125, 1125, 1125, 1125, 1125, 1410,  214, 1410,
-     1410, 1410, 1410, 1410,   86,  104, 1410, 1125, 1125,  214,
-     1125, 1410, 1410, 1410,  214, 1410,  214,  191,  320,  321,
-     1410,  214,  215, 1410, 1410,  243, 1410,  215, 1410,  185,
-     1410, 1410, 1410, 1410,  215, 1410,   68,   69, 1410,  214,
-     1410,  221, 1410, 1410,   70,   71,   72,   73,   74, 1410,
-       75,   76,  215, 1410,   77,   78,  244,  245,  246,  221,
-
-      221,  221,  221,  192, 1410,   82, 1410, 1410,  216, 1410,
-       83,   84,   62,  216, 1410,   62, 1410, 1410, 1410, 1410,
-      216, 1410, 1410,  217, 1410, 1410, 1410,  217, 1410, 1410,
-     1410, 1410,  336, 1410, 1410,   64,   64,   62,  216,   62,
-       64,   64,   64,   64,   64, 1410,   64,  242,   64,   64,
-      292, 1410,  293,  294,  218,  219,  220, 1410,  218,  219,
-      220,   64, 1410, 1410, 1410,   64,   62, 1410, 1410, 1410,
-     1410, 1410,  186, 1410, 1410,  221,  221,  221,  221,  221,
-      221,  221,  221,  221,  221,  221,  221,  221,  221, 1410,
-     1410, 1410, 1410,  247,   64,   64,  214,   64, 1410, 1410,
-
-      221,  221,  221,  187,  188,  189,  322, 1410, 1410,  307,
-     1410,  217, 1410,  308,  309, 1410,  217,  310,  311,  214,
-     1410, 1410, 1410,  217, 1410,   62, 1410,   62,   62, 1410,
-      214, 1410,  215, 1410, 1410, 1410, 1410,  323,  324,  325,
-     1410,  217,  218,  219,  220, 1410, 1410,  218,  219,  220,
-     1410, 1410, 1410,  214,  218,  219,  220, 1122, 1122, 1122,
-     1122, 1122, 1122, 1122, 1122, 1410,  215, 1410, 1410, 1410,
-     1410, 1410,  218,  219,  220,  214, 1122, 1410,  216,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242, 1410, 1410, 1410,  243,   96,  214, 1125,
-
-     1125, 1125, 1125, 1125, 1125, 1125, 1410,   68,   69,  214,
-     1410,  215,  216, 1410, 1410,   70,   71,   72,   73,   74,
-       96,   75,   76, 1410, 1410,   77,   78,  244,  245,  246,
-     1410, 1410,  214,   97, 1410, 1410,   82, 1410, 1410, 1410,
-     1410,   83,   84, 1410, 1410,  215, 1410,  249,  250, 1410,
-     1410, 1410,  251, 1410,  252, 1410,  253,  216,  254, 1410,
-     1410, 1410, 1410, 1410,  255,  256, 1410, 1410,  295, 1410,
-      257, 1410,  258,  296,  297,  259,  298,  260,  261,   98,
-      183,  217,  299, 1410,  300,  301,  302, 1410,  303, 1410,
-      304,  216,  305, 1410, 1410,  262,  306,  263, 1410, 1410,
-
-     1410,  214, 1410,  183, 1410, 1410, 1410,  264, 1410, 1410,
-      265, 1410,  218,  219,  220,  217,  184, 1410, 1410,  266,
-      267,  268,  269, 1410,  214,  270,  271, 1410,  280,  281,
-      282,  272, 1410, 1410,  273, 1410,  274,  215, 1410,  275,
-      283,  276,  277,  278, 1410,  279,  218,  219,  220, 1410,
-     1410,  183, 1410, 1410, 1410, 1410, 1410,  284, 1410,  285,
-      217, 1410,  185,  183, 1410, 1410,  286,  287, 1410, 1410,
-     1410, 1410, 1410, 1410,  183, 1410, 1410, 1410, 1410,  288,
-     1410,  289,   99,  216,  290,  291,  183,  184, 1410, 1410,
-     1410,  218,  219,  220,  217, 1410, 1410, 1410, 1410,  184,
-
-     1410, 1410,  326,  327,  327,  327,  327,  327,  327,  327,
-      327,  327,  328,  100,  101,  102, 1308, 1308, 1308, 1308,
-     1308, 1308, 1308, 1410, 1410,  218,  219,  220, 1410, 1410,
-     1410,  335, 1410,  185, 1410,  328,  312,  313,  314,  183,
-       95,   95,  315, 1410,   95,  185, 1410,  316,  184,  317,
-      318,  329,  330,  330,  330,  330,  330,  330,  330,  330,
-      330, 1410,  183,   95,  340,  186,   95, 1410,   95, 1410,
-      337,  338, 1410, 1410, 1410,  184, 1410, 1125, 1125, 1125,
-     1125, 1125, 1125, 1125, 1125, 1125,  217,  340, 1410, 1410,
-     1410, 1410, 1410,  183,  185,   95,  187,  188,  189, 1410,
-
-      184,  341,  342,  343,  343,  343,  343,  343,  343,  343,
-      343,  343,  343, 1410, 1410, 1410,  183,  218,  219,  220,
-     1410,  185, 1410, 1410, 1125, 1410, 1410,  349,  350,  184,
-     1410,  350, 1410, 1125, 1410, 1125,  186, 1125, 1125, 1125,
-     1125, 1125, 1125, 1125, 1410, 1410,  185, 1410,  186,  374,
-      349, 1410, 1410,  350,   95,  350,   95,   95,  339, 1410,
-       95,   95, 1410,  351,   95, 1410,  183,  187,  188,  189,
-      183, 1410,  374, 1410, 1410,  185,  182, 1410,  183,  187,
-      188,  189,  350,   95,  183,  184,   95, 1410,   95,  183,
-      364,   45, 1410,  183,   45, 1410, 1410,  331, 1410, 1410,
-
-     1410,  183,  184, 1410, 1410, 1410,  184,  183, 1410,  352,
-     1410, 1410, 1410,  364,  184,   95,   45, 1410,   45, 1410,
-      184, 1410, 1410, 1410,  186, 1410,   39, 1410,  332,  333,
-      334,  185, 1410, 1410,  182, 1410, 1410,  182, 1410, 1410,
-     1410,  350,  357,  350,  350,   45, 1410,  183,  185,  344,
-     1410, 1410,  185, 1410, 1410,  187,  188,  189, 1410,  182,
-      185,  182, 1410, 1410,  183,   49,  185, 1410, 1410, 1410,
-      183, 1410,  365, 1410,   95, 1410,   95,   95,  186, 1410,
-      345,  346,  347,  184, 1410, 1410, 1410,  183,  182, 1410,
-      183, 1410, 1410, 1410,  183, 1410, 1410, 1410, 1410,  183,
-
-      184, 1410, 1410, 1410,   45, 1410,   45,   45, 1410,  187,
-      188,  189,  353,  183, 1410,  439,  183,  183, 1410,  379,
-     1410, 1410,  183, 1410, 1410, 1410,  184, 1410, 1410,  185,
-      184, 1410, 1410, 1410,  375,  184, 1410, 1410, 1410,  183,
-     1410, 1410, 1410,  354,  355,  356,  185,  182, 1410,  182,
-      182,  186,  184, 1410,  183,  186, 1410,  379,  379, 1410,
-     1410, 1410, 1410,  186, 1410,  376,  377,  378, 1410,  186,
-     1410, 1410,  185, 1410, 1410,  366,  185,  183, 1410, 1410,
-     1410,  185,  187,  188,  189, 1410,  187,  188,  189, 1410,
-      184, 1410, 1410, 1410,  187,  188,  189, 1410,  185, 1410,
-
-      187,  188,  189, 1410, 1410, 1410,  367,  368,  369, 1410,
-     1410,  183, 1410, 1410,  379,  379,  379,  379,  379,  379,
-      379,  379,  379,  379,  379,  379,  379,  379,  379, 1410,
-     1410,  379,  186, 1410,  183, 1410,  185,  183, 1410,  379,
-     1410, 1410, 1410, 1410, 1410,  379,  379,  184, 1410,  186,
-     1410, 1410, 1410,  183, 1410, 1410, 1410,  379, 1410, 1410,
-      183, 1410, 1410,  187,  188,  189, 1410, 1410,  379, 1410,
-      379, 1410, 1410,  184, 1410,  186,  183, 1410, 1410,  186,
-      187,  188,  189, 1410,  186, 1410, 1410, 1410,  379,  184,
-     1410, 1410, 1410,  185, 1410, 1410, 1410, 1410, 1410,  379,
-
-      379,  186, 1410, 1410, 1410, 1410,  187,  188,  189, 1410,
-      187,  188,  189, 1410, 1410,  187,  188,  189,  183,  185,
-     1410,  183, 1410, 1410, 1410, 1410, 1410, 1410,  183, 1410,
-     1410, 1410,  187,  188,  189,  185, 1410,  183, 1410,  186,
-     1410,  183, 1410, 1410,  183, 1410,  379,  379,  379,  379,
-      379,  183, 1410, 1410,  184,  379,  379,  184, 1410, 1410,
-      183,  379, 1410, 1410,  184, 1410, 1410, 1410, 1410, 1410,
-      187,  188,  189,  184, 1410,  183,  379,  379,  379,  379,
-      379,  379,  379,  379,  379,  379,  379,  379,  379,  379,
-      379, 1410,  379, 1410, 1410, 1410,  186, 1410,  183, 1410,
-
-      185, 1410, 1410,  185, 1410, 1410, 1410, 1410, 1410, 1410,
-      185,  184, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  185,
-     1410, 1410,  186,  183, 1410, 1410, 1410,  187,  188,  189,
-      379,  379,  379,  379, 1410, 1410, 1410,  183,  186, 1410,
-     1410,  183, 1410, 1410, 1410, 1410,  183,  379,  379,  379,
-      379,  379,  379,  187,  188,  189,  379,  185, 1410,  184,
-      183, 1410, 1410, 1410,  183, 1410,  183, 1410, 1410,  187,
-      188,  189, 1410,  184, 1410, 1410, 1410,  184, 1410,  379,
-      379,  379,  379,  379,  379,  379,  379,  379, 1410,  183,
-     1410, 1410,  183, 1410, 1410, 1410, 1410, 1410, 1410,  379,
-
-     1410, 1410,  184,  186, 1410,  185,  186, 1410, 1410, 1410,
-     1410, 1410, 1410,  186, 1410,  183, 1410, 1410, 1410,  185,
-      183, 1410,  186,  185, 1410, 1410, 1410, 1410,  184, 1410,
-     1410, 1410, 1410, 1410,  187,  188,  189,  187,  188,  189,
-      379,  183,  380,  183,  187,  188,  189, 1410,  185,  183,
-     1410, 1410, 1410,  187,  188,  189,  184, 1410, 1410, 1410,
-      186,  183, 1410, 1410,  183, 1410, 1410, 1410, 1410,  379,
-      379, 1410,  183, 1410,  185, 1410, 1410,  184, 1410, 1410,
-     1410, 1410, 1410, 1410,  183,  184, 1410, 1410, 1410,  183,
-     1410,  187,  188,  189, 1410, 1410,  183,  184, 1410,  379,
-
-      379,  379,  185, 1410, 1410,  379,  379,  379,  186,  379,
-      379,  379,  183,  379,  379,  379,  379, 1410, 1410,  183,
-     1410, 1410,  186,  185, 1410,  184,  186, 1410,  902, 1410,
-     1410,  185,  184,  903,  904, 1410,  905, 1410, 1410,  187,
-      188,  189,  906,  185,  907,  908,  909, 1410,  910,  183,
-      911,  186,  912,  187,  188,  189,  913,  187,  188,  189,
-      379,  379,  379,  379,  379,  379,  379,  379,  379,  379,
-      379,  185,  183, 1410, 1410, 1410, 1410,  186,  185, 1410,
-     1410, 1410,  187,  188,  189,  184,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464, 1410,  381,  381,
-
-     1410,  381,  381, 1410,  183,  186, 1410,  183,  187,  188,
-      189, 1410,  381,  381,  381,  381,  381,  381,  381,  183,
-      381,  381,  381,  381,  381,  381,  186,  183,  381,  381,
-      183,  185, 1410,  464,  186, 1410,  187,  188,  189, 1410,
-      184, 1410,  183,  184, 1410, 1410,  186, 1410,  432,  183,
-     1410,  432, 1410, 1410, 1410,  184, 1410,  187,  188,  189,
-     1410, 1410, 1410, 1410, 1410,  187,  188,  189,  381,  381,
-      381,  381,  183,  432,  186,  432, 1410,  187,  188,  189,
-     1410,  186, 1410, 1410, 1410,  184,  185,  183, 1410,  185,
-     1410, 1410, 1410, 1410,  381,  381,  381,  381,  381,  381,
-
-      381,  185,  432, 1410, 1410,  187,  188,  189, 1410, 1410,
-      183, 1410,  187,  188,  189, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  184, 1410, 1410, 1410, 1410, 1410,  381,
-      381,  185,  183, 1410,  186, 1410, 1410,  183,  381,  381,
-      381,  381,  381,  381,  381,  381, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  183, 1410,  381, 1410, 1410,
-      183,  432, 1410,  432,  432,  187,  188,  189,  184,  185,
-     1410, 1410, 1410,  184,  383, 1410,  381,  381,  381,  381,
-     1410, 1410,  381,  381,  381,  381,  381, 1410, 1410,  186,
-     1410, 1410,  186,  464,  464,  464,  464,  464,  464,  464,
-
-      464,  464,  464,  464,  186, 1410, 1410, 1410, 1410,  381,
-      381, 1410, 1410, 1410,  185, 1410, 1410, 1410, 1410,  185,
-      187,  188,  189,  187,  188,  189, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410,  186,  187,  188,  189,  183, 1410,
-      464, 1410, 1410, 1410, 1410,  183,  381,  381,  381,  381,
-      381,  381,  381,  381,  381,  381,  381,  381,  381,  381,
-      183,  183, 1410, 1410, 1410,  187,  188,  189,  183, 1410,
-     1410, 1410,  186, 1410,  184,  383,  383,  383,  383, 1410,
-     1410,  184, 1410,  183, 1410, 1410, 1410,  183, 1410, 1122,
-     1122, 1122, 1122, 1122, 1122, 1122,  184, 1122, 1122, 1122,
-
-     1122, 1122, 1122,  187,  188,  189, 1410, 1410, 1410, 1410,
-      183,  383,  383,  383,  383,  383,  383,  186,  383,  383,
-      185, 1410,  186,  184, 1410, 1410, 1410,  185,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242, 1410,
-     1410, 1410,  185, 1410, 1410, 1410, 1410, 1410,  187,  188,
-      189, 1410, 1410,  187,  188,  189, 1410,  380,  380,  380,
-      380,  380,  380,  380,  380,  380,  380,  380, 1410,  185,
-     1410, 1410, 1410,  381,  381,  381,  381,  381,  381,  381,
-      381,  381,  381,  381,  381,  381,  381,  381,  381,  381,
-      381,  381,  381,  381,  381,  381,  381,  382,  382, 1410,
-
-     1410, 1410, 1410, 1410,  380,  381,  381,  381,  381,  381,
-      381,  381,  381,  381,  381,  381,  381,  381,  381,  381,
-      381, 1410, 1410,  186, 1410, 1410,  384,  384, 1410, 1410,
-      186,  384,  384,  384,  384, 1410, 1410, 1410,  384, 1410,
-     1410, 1410, 1410, 1410, 1410,  186, 1410, 1410, 1410, 1410,
-     1410,  183, 1410, 1410,  187,  188,  189,  183, 1410, 1410,
-     1410,  187,  188,  189, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  183,  186, 1410,  183,  183,  187,  188,  189,  183,
-      183, 1410, 1410, 1410, 1410, 1410,  183,  184, 1410, 1410,
-     1410,  183, 1410,  184,  183, 1410, 1410, 1410,  183, 1410,
-
-     1410, 1410,  183,  187,  188,  189, 1410,  184, 1410,  183,
-     1410,  184,  856,  857,  183,  184, 1410,  858, 1410,  859,
-     1410,  860,  184,  861, 1410, 1410, 1410,  184, 1410,  862,
-      863, 1410, 1410,  185, 1410,  864, 1410,  865, 1410,  185,
-      866, 1410,  867,  868, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  185, 1410, 1410, 1410,  185, 1410, 1410,
-     1410,  185, 1410, 1410, 1410, 1410, 1410, 1410,  185, 1410,
-     1410, 1410, 1410,  185, 1410, 1410,  381,  381,  381,  381,
-     1410,  381,  381,  381,  381,  381,  381,  381,  381,  381,
-      381,  381,  381,  381, 1410,  381,  381,  381,  381,  381,
-
-      381,  381,  381,  381,  381,  381,  381,  380, 1410, 1410,
-      381,  381,  430,  383,  383,  383,  383,  383,  383,  383,
-      383,  383,  383,  383,  383,  383,  383,  383,  383,  383,
-      383,  383,  383,  383,  383, 1410,  186,  381,  381, 1410,
-      429,  384,  186,  381,  381,  381,  381,  381,  381,  381,
-      383,  383,  383,  384, 1410, 1410,  186, 1410, 1410, 1410,
-      186, 1410, 1410, 1410,  186, 1410, 1410,  187,  188,  189,
-     1410,  186, 1410,  187,  188,  189,  186, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  187,  188,  189,
-     1410,  187,  188,  189, 1410,  187,  188,  189, 1410, 1410,
-
-     1410, 1410,  187,  188,  189, 1410, 1410,  187,  188,  189,
-      383,  383,  383,  383,  383,  383,  383,  383,  383,  383,
-      383,  383,  383,  383,  383,  383,  383,  383,  383,  383,
-      383,  383,  383,  383,  383,  383,  383,  383,  383,  383,
-      383,  383,  383,  383,  383,  383,  383,  383,  383,  383,
-      383,  383,  383,  383,  383,  383,  383,  182,  383,  383,
-      383,  383,  383,  383,  383,  383,  383,  383,  383,  383,
-      383,  383,  383,  383,  182,  182,  947,  947,  947,  947,
-      947,  947,  947,  947,  947,  947,  947, 1410,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  183,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182, 1410,  947,  183, 1410, 1410,  183,  183, 1410,
-      183, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  184, 1410, 1410, 1410, 1410,  183,  183,  432,  183,
-      183,  432, 1410,  183, 1410, 1410, 1410, 1410, 1410, 1410,
-      184,  464, 1410,  184,  464,  773,  184, 1410,  773,  183,
-     1410, 1410,  183,  432, 1410,  432, 1410, 1410, 1410, 1410,
-     1410, 1410,  184, 1410,  183,  184,  464,  185,  464, 1410,
-      773, 1410,  773, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1410, 1410,  432, 1410, 1410, 1410,  185,  183, 1410,  185,
-     1410, 1410,  185, 1410, 1410,  464, 1410, 1410, 1410,  773,
-      184, 1410, 1410, 1410,  380,  383,  383,  383,  185,  762,
-     1410,  185,  383,  383,  383,  383,  383,  383,  383,  383,
-      383,  383, 1410, 1410,  383,  383,  383,  383,  384,  384,
-      384,  384,  384,  384,  384,  384,  384,  384,  384,  792,
-     1410,  432,  792,  432,  432, 1410,  185, 1410, 1410,  183,
-     1410, 1410,  384, 1410,  464,  183,  464,  464,  773, 1410,
-      773,  773,  384,  384,  792,  384,  792, 1410, 1410, 1410,
-      186,  183,  183, 1410, 1410, 1410,  384,  384,  183,  384,
-
-      384,  384,  384,  384,  384,  184, 1410, 1410,  384,  186,
-     1410,  184,  186,  792,  183,  186,  183, 1410, 1410, 1410,
-     1410,  187,  188,  189,  384,  384,  384,  184,  384, 1410,
-     1410,  186, 1410, 1410,  186, 1410, 1410, 1410, 1410,  183,
-      187,  188,  189,  187,  188,  189,  187,  188,  189,  384,
-      384,  185,  184, 1410,   54,   54,  183,  185,   54, 1410,
-     1410, 1410,  187,  188,  189,  187,  188,  189, 1410,  186,
-     1410, 1410,  792,  185,  792,  792, 1410,   54, 1410,  183,
-       54, 1410,   54, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-       56, 1410,  184, 1410, 1410, 1410, 1410, 1410,  185, 1410,
-
-      187,  188,  189, 1410, 1410, 1410, 1410, 1410,  183,   54,
-     1410,  384,  384,  384,  384,  384,  384,  384,  384,  384,
-      384,  384,  384,  384,  384,  384, 1410, 1410, 1410, 1410,
-     1410,  183, 1410, 1410, 1410, 1410,  207, 1410,  185, 1410,
-      384,  384,  384,  384,  184, 1410, 1410, 1410, 1410, 1410,
-      384,  384, 1410, 1410,  186, 1410, 1410, 1410,  183, 1410,
-      186, 1410, 1410,  384,  384,  384,  384, 1410,   54, 1410,
-       54,   54, 1410, 1410,  183, 1410,  186,  183, 1410, 1410,
-      183,  183, 1410, 1410, 1410,  187,  188,  189,  183, 1410,
-      185,  187,  188,  189,  184, 1410, 1410,  183, 1410, 1410,
-
-      183,  186, 1410,  183, 1410, 1410, 1410,  187,  188,  189,
-      184,  183,  431,  433, 1410, 1410,  184, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410,  184, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  187,  188,  189, 1410, 1410, 1410, 1410, 1410,
-      185,  186, 1410,  384,  384,  384,  384,  384,  384,  384,
-      384,  384,  384, 1410, 1410, 1410,  185, 1410, 1410,  434,
-     1410, 1410,  185, 1122, 1122, 1410, 1410, 1410, 1410, 1410,
-      185, 1410,  187,  188,  189,  384,  384,  384,  384,  384,
-      384,  384,  384,  384,  384,  384,  384,  384,  384,  384,
-      384, 1410, 1410,  186,  421, 1410, 1122, 1122, 1122, 1122,
-
-     1122, 1122, 1122, 1123, 1123, 1123,  183, 1410,  384,  384,
-      384, 1410,  384,  384,  384,  384,  384,  384,  183,  384,
-      384,  384,  384, 1410,  187,  188,  189,  183, 1410,  183,
-     1410,  440, 1410,  384,  384, 1410, 1410, 1410,  384,  384,
-      422,  183,  184,  186, 1410, 1410,  183, 1410, 1410, 1410,
-      183, 1410, 1410, 1410,  184, 1410, 1410, 1410, 1410,  186,
-     1410, 1410,  435,  184, 1410,  186,  384,  384,  385,  183,
-      385, 1410, 1410,  186,  187,  188,  189, 1410, 1410, 1410,
-     1410, 1410,  184, 1410, 1410, 1410, 1410, 1410,  185, 1410,
-      187,  188,  189,  436,  437,  438,  187,  188,  189, 1410,
-
-      185, 1410, 1410,  183,  187,  188,  189, 1410,  183,  185,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  444,  183, 1410,  185, 1410,
-     1410,  183, 1410, 1410, 1410, 1410, 1410,  442,  443,  184,
-     1410, 1410, 1410, 1410,  184, 1410,  384,  384,  384,  384,
-      384,  384,  384,  384,  384,  384,  384,  384,  384,  384,
-      384,  384,  384,  384,  384, 1410,  384,  384,  384,  384,
-      384,  384,  384,  384,  384,  384,  384,  384,  384,  384,
-     1410,  384, 1410,  183, 1410,  185,  384, 1410,  384,  384,
-      185,  186,  385, 1410,  385, 1410,  385,  385,  385,  385,
-
-      385,  385,  385,  186, 1410, 1410,  183, 1410, 1410, 1410,
-     1410, 1410,  186, 1410, 1410, 1410, 1410, 1410, 1410,  184,
-     1410, 1410,  187,  188,  189, 1410, 1410, 1410, 1410, 1410,
-      445,  186, 1410,  445,  187,  188,  189, 1410, 1410, 1410,
-     1410, 1410, 1410,  187,  188,  189, 1410, 1410,  441, 1410,
-     1410,  183, 1410,  445, 1410,  445,  445, 1410,  445, 1410,
-     1410, 1410,  187,  188,  189,  185,  433, 1410,  423,  433,
-      424,  425,  426, 1410,  183, 1410, 1410, 1410,  445, 1410,
-     1410,  445, 1410, 1410, 1410,  427, 1410,  184,  186, 1410,
-      428,  433, 1410,  186,  433, 1410, 1410, 1410, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410,  386, 1410,  445, 1410,
-     1410, 1410,  434, 1410, 1410,  434,  387,  388, 1410,  187,
-      188,  189, 1410,  389,  187,  188,  189, 1410, 1410, 1410,
-     1410,  445, 1410,  185,  183,  390, 1410,  434,  391, 1410,
-      434, 1410, 1410,  392,  433,  393,  394, 1410,  395, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  183, 1410, 1410,
-      396, 1410, 1410,  397,  398, 1410, 1410, 1410,  186, 1410,
-      184,  399,  400,  401,  455,  402, 1410,  403,  404, 1410,
-      405,  183, 1410, 1410,  451, 1410, 1410,  406, 1410,  407,
-      434, 1410, 1410,  408, 1410,  409,  410, 1410,  411,  187,
-
-      188,  189,  412,  452,  183, 1410, 1410,  413, 1410,  414,
-      415,  416,  417, 1410, 1410,  446,  185,  184,  446,  418,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  453,  454,  419,
-      457,   37, 1410,  420,   37, 1410,  186, 1410, 1410, 1410,
-      446, 1410, 1410,  446, 1410, 1410,  447,  448,  449,  447,
-      448,  449, 1410,  457,  183, 1410,   37, 1410,   37,  183,
-     1410, 1410, 1410,  185, 1410, 1410,  184,  187,  188,  189,
-     1410,  447,  448,  449,  447,  448,  449,  183, 1410, 1410,
-     1410,  183,  183, 1410, 1410,   37, 1410, 1410, 1410, 1410,
-      184, 1410, 1410,  446, 1410,  184, 1410, 1410, 1410, 1410,
-
-      198, 1410, 1410, 1410,  183, 1410,  183, 1410, 1410,  183,
-     1410, 1410,  458, 1410, 1410, 1410, 1410,  184, 1410,  186,
-       55, 1410, 1410, 1410,  447,  448,  449, 1410, 1410,  183,
-     1410,  183,  183, 1410,  183, 1410,  185, 1410, 1410, 1410,
-     1410,  185,  184,   55,   37,  184,   37,   37,  465, 1410,
-      187,  188,  189, 1410,  183, 1410,   56,  183, 1410, 1410,
-     1410, 1410, 1410,  185, 1410, 1410,  186,  184, 1410,  214,
-      184,  465, 1410,  198,  198,  198,  198,  198,  198,  198,
-      198,  198,  198,  198,  466, 1410, 1410, 1410,  185, 1410,
-     1410,  185,  214, 1410, 1410, 1410,  465,  187,  188,  189,
-
-      198, 1410,   57, 1410, 1410,  473,  465, 1410, 1410,  198,
-     1410, 1410, 1410,  185, 1410,  459,  185, 1410, 1410,  465,
-      198, 1410, 1410, 1410, 1410,  380, 1410, 1410,  380,  465,
-      467, 1410,  466, 1410, 1410, 1410, 1410, 1410, 1410,  186,
-     1410, 1410,  466, 1410,  186, 1410,  460,  461,  462, 1410,
-     1410,  474, 1410,  380,  380,  380,  380,  380,  380,  380,
-      380,  380,  380,  380, 1410, 1410,  186, 1410, 1410, 1410,
-      187,  188,  189, 1410, 1410,  187,  188,  189,  467,  465,
-     1410,  380, 1410, 1410, 1410,  465,   56, 1410,  467, 1410,
-     1410,  186, 1410, 1410,  186, 1410, 1410,  187,  188,  189,
-
-      380, 1410,  465, 1410, 1410,   58,  465, 1410,  465, 1410,
-     1410, 1410, 1410, 1410, 1410,  466,  186, 1410, 1410,  186,
-     1410,  466,  187,  188,  189,  187,  188,  189, 1410,  465,
-     1410, 1410,   57,  468, 1410, 1410,   59,   60,   61, 1410,
-     1410,  481,  466, 1410, 1410, 1410, 1410,  187,  188,  189,
-      187,  188,  189, 1410,  475, 1410, 1410,  480, 1410, 1410,
-     1410,  467, 1410, 1410,  469,  470,  471,  467, 1410,  208,
-      208,  208,  208,  208,  208,  208,  208,  208,  208,  208,
-     1410,  468, 1410, 1410, 1410,  476,  477,  478,  467, 1410,
-     1410,  468, 1410, 1410, 1410, 1410,  465, 1410,  482,  483,
-
-     1410, 1410, 1410, 1410,  484, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  469,  470,  471, 1410,  208, 1410, 1410,  465,
-      485,  485,  469,  470,  471,  485,  485,  485,  485,  485,
-     1410,  485,  486,  485,  485, 1410, 1410,  465, 1410,   95,
-       95, 1410, 1410,   95, 1410, 1410,  485, 1410, 1410,  465,
-      485, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      465, 1410,   95, 1410,  468,   95, 1410,   95, 1410, 1410,
-      468, 1410,  465,  466, 1410,   97, 1410, 1410,  487,  485,
-      485, 1410,  485, 1410, 1410,  466, 1410,  485, 1410, 1410,
-     1410,  468, 1410, 1410,   95,  469,  470,  471, 1410,  221,
-
-      221,  469,  470,  471,  221,  221,  221,  221,  221, 1410,
-      221,  242,  221,  221, 1410, 1410, 1410, 1410, 1410,  467,
-     1410,  357,  469,  470,  471,  221, 1410, 1410, 1410,  221,
-     1410,  467, 1410, 1410, 1410, 1410,  221,  221, 1410, 1410,
-     1410,  221,  221,  221,  221,  221, 1410,  221,  242,  221,
-      221, 1410, 1410,   95, 1410,   95,   95,  221,  221,  221,
-     1410,  221,  221,  485, 1410, 1410,  221, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  485,  485, 1410,
-     1410,  488,  465, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  489,  490,  510,  221,  221, 1410,  221, 1410,
-
-      491,  492,  493,  494,  495,  465,  496,  497, 1410, 1410,
-      498,  499,  500,  501,  502, 1410,  465, 1410,  466, 1410,
-     1410,  503,  468, 1410, 1410,  465,  504,  505, 1410, 1410,
-      485, 1410, 1410,  465,  468, 1410, 1410, 1410, 1410,  465,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  465, 1410,
-     1410, 1410,  466,  469,  470,  471,  465, 1410, 1410, 1410,
-      506,  466, 1410, 1410,  467,  469,  470,  471, 1410,  466,
-     1410,  225,  226, 1410, 1410, 1410,  465, 1410, 1410,  227,
-      228,  229,  230,  231, 1410,  232,  233, 1410, 1410,  234,
-      235,  507,  508,  509, 1410, 1410, 1410,  506,  467,  465,
-
-      239, 1410, 1410, 1410, 1410,  240,  241,  467,  225,  226,
-     1410, 1410,  466, 1410, 1410,  467,  227,  228,  229,  230,
-      231, 1410,  232,  233, 1410, 1410,  234,  235,  507,  508,
-      509, 1410, 1410,  480,  485,  485, 1410,  239,  485, 1410,
-      485,  485,  240,  241,  485,  465, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  465, 1410,  485,  485, 1410,  467, 1410,
-      485, 1410, 1410, 1410,  485, 1410, 1410,  468,  465, 1410,
-      485,  485,  485,  485,  485,  485,  465, 1410, 1410, 1410,
-      465,  466, 1410, 1410, 1410, 1410,  485,  485, 1410,  466,
-       97, 1410, 1410, 1410,  485,  485,  485,  485,  469,  470,
-
-      471,  468, 1410,  465,  485,  485, 1410,  485,  485, 1410,
-      468, 1410, 1410, 1410, 1410, 1410,  466, 1410,  468, 1410,
-     1410, 1410,  485, 1410,  485,  485,  485,  467, 1410, 1410,
-     1410,  465,  469,  470,  471,  467,   98, 1410, 1410, 1410,
-     1410,  469,  470,  471, 1410, 1410, 1410, 1410, 1410,  469,
-      470,  471, 1410, 1410,  465, 1410, 1410, 1410, 1410, 1410,
-     1410,  468,  467,  464, 1410, 1410,  464,  466, 1410, 1410,
-     1410, 1410, 1410,  358,  358,  358,  358,  358,  358,  358,
-      358,  358,  358,  358,  485, 1410, 1410, 1410,  464, 1410,
-      464, 1410,  469,  470,  471,  465, 1410, 1410, 1410,  485,
-
-      485,  485,  485,  485,  485,  485,  485,  485,  485,  485,
-      485,  485,  485,  467, 1410, 1410, 1410,  464,  465, 1410,
-      358, 1410, 1410, 1410, 1410, 1410, 1410,  485,  485,  485,
-      468,  466,  465, 1410, 1410, 1410,  465, 1410,  468, 1410,
-     1410, 1410, 1410, 1410,  799, 1410, 1410, 1410, 1410, 1410,
-      465, 1410, 1410, 1410, 1410,  465, 1410, 1410, 1410,  465,
-     1410,  469,  470,  471, 1410,  468, 1410, 1410,  466,  469,
-      470,  471,  466,  465, 1410, 1410,  464,  467,  464,  464,
-     1410, 1410,  511,  512, 1410,  465,  466,  513, 1410,  514,
-     1410,  515, 1410,  516, 1410, 1410,  469,  470,  471,  517,
-
-      518,  465, 1410, 1410, 1410,  519, 1410,  520,  465, 1410,
-      521, 1410,  522,  523,  467,  524,  468,  525,  467, 1410,
-     1410,  466, 1410, 1410,  465, 1410, 1410,  526, 1410, 1410,
-      527, 1410,  467, 1410, 1410, 1410, 1410,  466, 1410,  528,
-      529,  530,  531, 1410, 1410,  532,  533,  469,  470,  471,
-      465,  534, 1410, 1410,  535,  554,  536,  555,  556,  537,
-     1410,  538,  539,  540, 1410,  541, 1410,  467, 1410,  542,
-      543,  544, 1410,  465,  465, 1410, 1410, 1410,  465, 1410,
-      468,  545, 1410,  467, 1410, 1410,  466,  485,  485, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  465,  546,  485,
-
-      547,  465, 1410, 1410, 1410, 1410, 1410,  548,  549, 1410,
-      466,  469,  470,  471,  466, 1410, 1410,  468, 1410, 1410,
-      550,  468,  551,  557, 1410,  552,  553, 1410,  558,  559,
-     1410,  560,  467, 1410, 1410,  468, 1410,  561, 1410,  562,
-      563,  564, 1410,  565, 1410,  566, 1410,  567,  469,  470,
-      471,  568,  469,  470,  471, 1410,  467, 1410, 1410, 1410,
-      467,  465, 1410, 1410, 1410, 1410,  469,  470,  471, 1410,
-      468, 1410,  569, 1410, 1410, 1410,  570,  571, 1410, 1410,
-      572,  573,  242,  242,  465, 1410,  468,  242,  242,  242,
-      242,  242, 1410,  242,  242,  242,  242,  466, 1410,  485,
-
-     1410,  469,  470,  471, 1410, 1410, 1410, 1410,  242,  574,
-      575,  576,  242, 1410, 1410,  577, 1410,  469,  470,  471,
-      578, 1410,  579,  580,  465, 1410, 1410, 1410,  214, 1410,
-     1410, 1410, 1410, 1410, 1410,  468, 1410, 1410, 1410, 1410,
-      242,  242,  242,  467,  242, 1410, 1410,  465, 1410, 1410,
-     1410,  214, 1410, 1410, 1410, 1410, 1410, 1410,  485,  468,
-      466, 1410, 1410,  468,  215, 1410,  469,  470,  471, 1410,
-     1410, 1410, 1410, 1410, 1410,  465, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      469,  470,  471, 1410,  469,  470,  471, 1410,  465, 1410,
-
-     1410, 1410, 1410,  214, 1410, 1410,  467, 1410, 1410, 1410,
-      216,  466, 1410, 1410,  465, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410,  214, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410,  485, 1410, 1410,  465, 1410,  215,
-     1410, 1410, 1410,  581, 1410, 1410,  468, 1410, 1410, 1410,
-      466, 1410, 1410, 1410,  582,  583, 1410,  467, 1410, 1410,
-     1410, 1410,  584,  585,  586,  587,  588, 1410,  589,  590,
-     1410, 1410,  591,  592,  593,  594,  595,  469,  470,  471,
-      221, 1410, 1410,  596, 1410,  216,  221, 1410,  597,  598,
-      221,  485, 1410, 1410, 1410,  465,  467, 1410,  485, 1410,
-
-     1410,  221,  221, 1410, 1410, 1410,  221, 1410, 1410,  468,
-      221, 1410, 1410,  217, 1410, 1410, 1410, 1410,  465, 1410,
-     1410, 1410, 1410,  262, 1410,  263, 1410, 1410, 1410,  214,
-     1410,  466, 1410, 1410, 1410,  264, 1410, 1410,  265, 1410,
-      469,  470,  471, 1410,  218,  219,  220,  266,  599,  268,
-      269, 1410,  214,  270,  271, 1410, 1410, 1410, 1410,  272,
-      468, 1410,  273, 1410,  274,  215, 1410,  275, 1410,  276,
-      277,  278, 1410,  279,  214, 1410, 1410,  467, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  485, 1410, 1410,  217, 1410,
-     1410,  469,  470,  471, 1410, 1410, 1410,  214, 1410,  468,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      215,  216, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  218,
-      219,  220, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      469,  470,  471, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  600,  601,
-      282, 1410, 1410, 1410, 1410, 1410,  216, 1410, 1410, 1410,
-      283, 1410,  485,  485,  485,  485,  485,  485,  485,  485,
-      485,  485,  485,  485,  485,  485,  485,  284, 1410,  285,
-      468, 1410, 1410, 1410,  465, 1410,  286,  287, 1410, 1410,
-     1410, 1410, 1410,  602, 1410,  293,  294, 1410, 1410,  288,
-
-     1410,  289, 1410,  465,  290,  291, 1410,  465, 1410, 1410,
-     1410,  469,  470,  471,  217, 1410, 1410, 1410, 1410,  625,
-      466, 1410, 1410, 1410, 1410, 1410,  465, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  466,
-     1410, 1410,  625,  485,  485,  218,  219,  220,  485,  485,
-      485,  485,  485,  465,  485,  486,  485,  485, 1410,  217,
-     1410, 1410, 1410,  465, 1410, 1410,  467, 1410, 1410,  485,
-     1410, 1410, 1410,  485, 1410,  465,  465, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  467,  465, 1410, 1410,  466,
-      218,  219,  220,  604,   62, 1410, 1410,   62,  465,  466,
-
-     1410,  487,  485,  485, 1410,  485, 1410, 1410, 1410, 1410,
-     1410,  466, 1410, 1410, 1410, 1410,  604,  605,  605,   62,
-     1410,   62,  605,  605,  605,  605,  605,  485,  605,  222,
-      605,  605,  465, 1410, 1410,  467,  465, 1410, 1410, 1410,
-     1410, 1410, 1410,  605, 1410,  467, 1410,  605,   62, 1410,
-     1410, 1410, 1410, 1410, 1410,  465, 1410,  467,  485,  465,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  466,  468,
-     1410, 1410,  466, 1410, 1410,  606,  605,  605, 1410,  605,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  485,  468, 1410,
-     1410, 1410,  485,  485,  485,  485,  485,  485,  485,  485,
-
-      469,  470,  471, 1410,  626,  465, 1410,   62, 1410,   62,
-       62, 1410, 1410, 1410,  467,  489,  490, 1410,  467,  469,
-      470,  471, 1410,  491,  492,  493,  494,  495,  465,  496,
-      497,  465, 1410,  498,  499,  627,  628,  629,  468, 1410,
-      465,  466, 1410, 1410,  503, 1410, 1410, 1410,  468,  504,
-      505,  485, 1410,  485,  465,  630, 1410, 1410, 1410, 1410,
-      468, 1410, 1410,  465, 1410, 1410, 1410,  466, 1410,  469,
-      470,  471, 1410, 1410, 1410, 1410,  466, 1410,  607,  469,
-      470,  471,  485,  485, 1410, 1410, 1410,  467, 1410,  608,
-      609,  469,  470,  471, 1410, 1410, 1410,  610,  611,  612,
-
-      613,  614, 1410,  615,  616, 1410, 1410,  617,  618,  619,
-      620,  621, 1410,  467, 1410, 1410, 1410,  468,  622, 1410,
-      465,  468,  467,  623,  624, 1410, 1410, 1410,  485,  485,
-      485,  485,  485,  485,  485,  485,  485,  485,  485,  485,
-      485,  485,  485,  465,  485, 1410, 1410, 1410,  469,  470,
-      471, 1410,  469,  470,  471, 1410,  466, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410,  465, 1410,  485,  485,  485,  485,
-      485, 1410, 1410, 1410, 1410,  485,  485, 1410,  465, 1410,
-     1410,  465,  485,  485,  485,  485, 1410,  465,  465, 1410,
-      468,  485,  485,  485,  485,  485,  485,  485,  485,  485,
-
-      466,  465,  467, 1410,  465, 1410,  465, 1410, 1410, 1410,
-     1410,  465, 1410, 1410,  466,  465,  468,  466,  465, 1410,
-     1410,  469,  470,  471,  466,  468, 1410, 1410, 1410,  465,
-     1410, 1410, 1410,  887,  888,  889, 1410, 1410,  465, 1410,
-     1410,  465,  466, 1410, 1410,  890,  467,  469,  470,  471,
-     1410,  466, 1410, 1410,  466, 1410,  469,  470,  471, 1410,
-      467, 1410,  891,  467,  892, 1410, 1410, 1410, 1410, 1410,
-      467,  893,  894, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  465,  895,  485,  896, 1410,  467,  897,
-      898, 1410, 1410, 1410, 1410,  465, 1410,  467, 1410, 1410,
-
-      467, 1410, 1410, 1410, 1410,  468,  465,  485,  485,  485,
-      485,  485,  485,  485,  485,  485,  485,  485,  465,  466,
-     1410, 1410, 1410, 1410, 1410,  465,  485,  485,  485,  485,
-      485,  466,  633, 1410, 1410, 1410,  469,  470,  471,  465,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  465,  465,  468,
-      485,  485, 1410, 1410,  485,  485,  485, 1410,  485,  485,
-      485,  466,  465,  468, 1410,  467,  468,  631,  631, 1410,
-      465, 1410, 1410,  468, 1410,  466, 1410,  467, 1410, 1410,
-      469,  470,  471,  466, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  468, 1410, 1410,  469,  470,  471,  469,  470,  471,
-
-      468, 1410, 1410,  468,  469,  470,  471,  467, 1124, 1124,
-     1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
-     1124,  467,  469,  470,  471, 1410, 1410, 1410, 1410,  467,
-     1410,  469,  470,  471,  469,  470,  471, 1124, 1124, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410,  631,  631,  631,  631,
-      631,  631,  631, 1410,  631,  631,  631,  631,  631,  631,
-     1410, 1410,  631,  631,  631,  631,  465, 1410,  468, 1410,
-      631,  631,  631,  631,  631,  631,  631, 1410, 1410, 1410,
-      468, 1410, 1410, 1410, 1410, 1410,  465, 1410, 1410,  465,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  469,
-
-      470,  471,  466, 1410, 1410,  631,  631, 1410, 1410,  465,
-      468,  469,  470,  471,  465, 1410, 1410,  631,  631,  631,
-      631,  631,  466, 1410,  468, 1410, 1410, 1410,  631,  631,
-     1410,  465,  468, 1410, 1410,  465, 1410,  465, 1410, 1410,
-     1410,  469,  470,  471, 1410, 1410, 1410, 1410,  467, 1410,
-      466, 1410, 1410, 1410,  465,  469,  470,  471,  465, 1410,
-     1410, 1410, 1410,  469,  470,  471, 1410,  466,  467, 1410,
-     1410,  466, 1410,  773,  465, 1410,  773, 1410, 1410,  465,
-     1410, 1410, 1410, 1410,  465,  631,  631,  631,  631,  631,
-      631,  631,  631, 1410, 1410, 1410,  467,  465,  773, 1410,
-
-      773, 1410,  465, 1410,  631, 1410, 1410,  465, 1410, 1410,
-      466, 1410, 1410,  467, 1410,  466, 1410,  467,  631,  631,
-      466, 1410, 1410, 1410, 1410, 1410, 1410,  773, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  631,  631,  631,  631, 1410, 1410, 1410, 1410, 1410,
-     1410,  468, 1410, 1410, 1067, 1410,  467, 1410, 1410, 1410,
-     1410,  467, 1410, 1410, 1410, 1410,  467, 1410, 1410, 1410,
-     1410,  468, 1410, 1410,  631,  631, 1410, 1410,  632,  632,
-      632,  632,  469,  470,  471,  465,  773, 1410,  773,  773,
-      465, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  632,  468,
-
-     1410, 1410,  469,  470,  471, 1410, 1410, 1410,  465, 1410,
-     1410, 1410, 1410,  465,  632,  632,  468, 1410, 1410, 1410,
-      468,  466, 1410, 1410, 1410, 1410,  466, 1410, 1410, 1410,
-      469,  470,  471,  631,  631,  631,  631,  631,  631,  631,
-      631,  631,  631,  631,  631,  631,  631,  469,  470,  471,
-     1410,  469,  470,  471, 1410,  632,  632,  632,  632,  468,
-      632,  632,  633,  465,  468, 1410, 1410,  467, 1410,  468,
-     1410, 1410,  467, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410,  465, 1410, 1410, 1410,
-      469,  470,  471, 1410, 1410,  469,  470,  471, 1410,  466,
-
-      469,  470,  471, 1410,  630,  630,  630,  630,  630,  630,
-      630,  630,  630,  630,  630, 1410, 1410, 1410, 1410, 1410,
-      631,  631,  631,  631,  631,  631,  631,  631,  631,  631,
-      631,  631,  631,  631,  631,  631,  631,  631,  631,  631,
-      631,  631,  631,  631, 1410,  467, 1410, 1410, 1410, 1410,
-     1410,  630,  631,  631,  631,  631,  631,  631,  631,  631,
-      631,  631,  631,  631,  631,  631,  631,  631, 1410, 1410,
-      468,  633,  633, 1410, 1410,  468, 1122, 1122, 1122, 1122,
-     1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
-     1410, 1410, 1410, 1410, 1410,  633,  633,  633, 1410, 1410,
-
-     1410,  469,  470,  471,  465, 1410,  469,  470,  471, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410,  695, 1410, 1410, 1410,
-     1410,  465, 1410, 1410,  705, 1410, 1410,  465, 1410, 1410,
-      465, 1410, 1410,  465, 1410, 1410, 1410, 1410,  465,  695,
-      466, 1410, 1410, 1410,  465, 1410, 1410,  705,  468, 1410,
-     1410, 1410,  184,  465, 1410, 1410,  465,  466, 1410, 1410,
-      184,  465, 1410,  869, 1410,  870,  466, 1410, 1410,  466,
-     1410, 1410, 1410, 1410,  466,  871, 1410, 1410,  872,  469,
-      470,  471, 1410, 1410, 1410, 1410,  467,  873,  874,  875,
-      876, 1410, 1410,  877,  878, 1410, 1410, 1410,  185,  879,
-
-     1410, 1410,  880,  467,  881, 1410,  185,  882, 1410,  883,
-      884,  885,  467,  886, 1410,  467, 1410, 1410, 1410, 1410,
-      467, 1410, 1410,  631,  631,  631,  631, 1410,  631,  631,
-      631,  631,  631,  631,  631,  631,  631,  631,  631,  631,
-      631, 1410,  631,  631,  631,  631,  631,  631,  631,  631,
-      631,  631,  631,  631,  630, 1410, 1410,  631,  631, 1410,
-      632,  632,  632,  632,  632,  632,  632,  632,  632,  632,
-      632,  632,  632,  632,  632,  632,  632,  632,  632,  632,
-      632,  632, 1410, 1410,  631,  631,  633,  633, 1410,  468,
-      631,  631,  631,  631,  631,  631,  631,  632,  632,  632,
-
-      633,  696, 1410, 1410, 1410, 1410,  468, 1410, 1410,  706,
-     1410,  633, 1410, 1410, 1410,  468, 1410, 1410,  468, 1410,
-      469,  470,  471,  468, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  697,  698,  699, 1410, 1410,  469,  470,  471,
-      707,  708,  709, 1410, 1410, 1410,  469,  470,  471,  469,
-      470,  471, 1410, 1410,  469,  470,  471,  632,  632,  632,
-      632,  632,  632,  632,  632,  632,  632,  632,  632,  632,
-      632,  632,  632,  632,  632,  632,  632,  632,  632,  632,
-      632,  632,  632,  632,  632,  632,  632,  632,  632,  632,
-      632,  632,  632,  632,  632,  632,  632,  632,  632,  632,
-
-      632,  632,  632,  632,  464,  632,  632,  632,  632,  632,
-      632,  632,  632,  632,  632,  632,  632,  632,  632,  632,
-      632,  464,  464, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  465,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  465,
-     1410, 1410, 1410,  465, 1126,  465,  465, 1410, 1410,  465,
-     1410, 1410, 1410, 1410, 1127, 1128, 1410, 1410,  466, 1410,
-     1410, 1129,  465, 1410, 1410, 1410,  465, 1410, 1410,  465,
-
-     1410, 1410,  465, 1130, 1410,  466, 1131, 1410, 1410,  466,
-     1410, 1132,  466, 1133, 1134,  466, 1135, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1136, 1410,
-     1410, 1137, 1138, 1410,  467, 1410, 1410, 1410, 1410, 1410,
-      465, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  467, 1410, 1410, 1410,  467, 1410, 1410,  467, 1410,
-     1410,  467, 1410,  465, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  630,  632,  632,  632, 1410,  466, 1410, 1410,  632,
-      632,  632,  632,  632,  632,  632,  632,  632,  632,  465,
-     1410,  632,  632,  632,  632,  633,  633,  633,  633,  633,
-
-      633,  633,  633, 1410, 1410, 1410, 1410, 1410, 1410,  633,
-      633, 1410,  465, 1410, 1410, 1410, 1410, 1410, 1410,  633,
-     1410, 1410,  467, 1410, 1410,  466,  465, 1410, 1410,  633,
-     1410, 1410,  633, 1410, 1410, 1410, 1410,  468,  633,  633,
-      633,  633,  633,  633,  633,  633,  633,  633, 1410,  465,
-     1410,  633,  633,  633,  468,  633, 1410, 1410,  468, 1410,
-     1410,  468,  466, 1410,  468,  465, 1410, 1410,  469,  470,
-      471,  467, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  469,  470,  471,  465,  469,
-      470,  471,  469,  470,  471,  469,  470,  471, 1410,  465,
-
-     1410,  466,  633, 1410,  465, 1410, 1410, 1410,  467,  633,
-      633,  633,  633,  633,  633,  633,  633,  633,  633,  633,
-      633,  633,  465, 1410, 1410,  468,  465,  465, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  466, 1410, 1410,  633,  633,
-      466,  465, 1410, 1410,  465, 1410, 1410,  467,   96,  465,
-     1410, 1410, 1410, 1410, 1410,  445,  469,  470,  471, 1410,
-     1410, 1410,  466, 1410,  465, 1410, 1410,  465, 1410, 1410,
-     1410,   96, 1410, 1410,  468,  633,  633,  466,  445, 1410,
-      466,  467, 1410, 1410,   97, 1410,  467, 1410, 1410, 1410,
-     1410,  433, 1410,  633,  633, 1410, 1410, 1410,  465, 1410,
-
-     1410, 1410, 1410, 1410, 1410,  469,  470,  471,  467, 1410,
-     1410,  468,  633,  633,  633,  633, 1410, 1410, 1410, 1410,
-     1410,  465, 1410,  467, 1410, 1410,  467, 1410, 1410, 1410,
-       98, 1410, 1410, 1410,  466, 1410,  465,  434, 1410, 1410,
-     1410, 1410,  469,  470,  471, 1410, 1410, 1410, 1410, 1410,
-      468, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  465,
-      679,  633,  633,  633,  633,  633,  633,  633,  633,  633,
-      633, 1410,  466, 1410,  692,  693, 1410,  670, 1410, 1410,
-      467,  469,  470,  471,  468,  633,  633, 1410, 1410,  468,
-     1410, 1410, 1410,  633,  633,  633,  633,  633,  633,  633,
-
-      633,  633,  633,  633,  633,  633,  633,  633,  633, 1410,
-     1410,  468, 1410,  678, 1410,  469,  470,  471,  467, 1410,
-      469,  470,  471,  671, 1410, 1410,  468, 1410, 1410,  468,
-     1410, 1410, 1410,   99, 1410, 1410, 1410, 1410, 1410, 1410,
-      446, 1410,  469,  470,  471,  465, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410,  680, 1410, 1410,  469,  470,  471,
-      469,  470,  471, 1410,  100,  101,  102, 1410,  465, 1410,
-     1410,  447,  448,  449, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  466,  634,  468,  634, 1410,  634,  634,  634,  634,
-      634,  634,  634, 1410, 1410, 1410, 1410, 1410, 1124, 1124,
-
-     1124, 1410, 1124, 1124, 1124, 1124, 1124, 1124, 1410, 1124,
-     1124, 1124, 1124, 1410,  469,  470,  471, 1410, 1410,  465,
-     1410,  468, 1410, 1124, 1124, 1410,  465,  467, 1124, 1124,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  465, 1410, 1410, 1410, 1410, 1410, 1410,  465,
-     1410, 1410,  469,  470,  471,  466, 1124, 1124, 1125, 1410,
-     1125, 1410,  466, 1410,  633,  633,  633,  633,  633,  633,
-      633,  633,  633,  633,  633,  633,  633,  633,  633,  633,
-      633,  633,  633, 1410,  633,  633,  633,  633,  633,  633,
-      633,  633,  633,  633,  633,  633,  633,  633, 1410,  633,
-
-     1410,  467, 1410, 1410,  633, 1410,  633,  633,  467, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      468,  465, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  633,
-      633,  633, 1410,  633,  633,  633,  633,  633,  633,  635,
-      633,  633,  633,  633,  465, 1410, 1410,  465, 1410,  636,
-      637,  469,  470,  471,  633,  633,  638,  466, 1410,  633,
-      633, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  639,  445,
-      465,  640, 1410, 1410, 1410, 1410,  641, 1410,  642,  643,
-     1410,  644, 1410,  466, 1410, 1410, 1410,  633,  633,  634,
-
-     1410,  634,  445,  645,  468, 1410,  646,  647, 1410, 1410,
-     1410,  468, 1410,  467, 1410,  433, 1410, 1410,  681,  682,
-      682,  682,  682,  682,  682,  682,  682,  682, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  469,  470,  471, 1410,  467,
-     1410,  445,  469,  470,  471,  445, 1410, 1410,  445, 1410,
-     1410,  648,  649,  650, 1410,  651, 1410,  652,  653, 1410,
-      654,  434, 1410, 1410,  445, 1410, 1410,  655,  445,  656,
-     1410,  445, 1410,  657, 1410,  658,  659,  433,  660, 1410,
-     1410,  433,  661, 1410,  433, 1410, 1410,  662, 1410,  663,
-      664,  665,  666, 1410, 1410, 1410, 1410, 1410, 1410,  667,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  668,
-     1410, 1410, 1410,  669, 1410, 1410,  468,  672,  183,  673,
-      674,  675, 1410,  434, 1410, 1410, 1410,  434, 1410, 1410,
-      434, 1410, 1410, 1410,  676, 1410,  183, 1410, 1410,  677,
-      683,  183,  468, 1410, 1410, 1410, 1410,  469,  470,  471,
-     1410, 1410, 1410, 1410,  184,  183, 1410, 1410, 1410,  183,
-     1410, 1410, 1410,  683,  446, 1410,  695,  694, 1410, 1410,
-     1410, 1410,  184,  469,  470,  471,  433, 1410,  183,  684,
-      685,  685,  685,  685,  685,  685,  685,  685,  685,  695,
-      691,  184,  690, 1410, 1410,  447,  448,  449, 1410, 1410,
-
-      185, 1410,  184, 1410, 1410,  700,  700,  700,  700,  700,
-      700,  700,  700,  700,  700,  716, 1410, 1410,  185, 1410,
-     1410, 1410,  434, 1410,  183, 1410,  446, 1410, 1410, 1410,
-      446,  328, 1410,  446, 1410, 1410, 1410,  185,  716, 1410,
-     1410, 1410, 1410, 1410, 1410,  705, 1410,  183,  185, 1410,
-     1410,  184,  341,  342,  328,  713,  714,  447,  448,  449,
-      184,  447,  448,  449,  447,  448,  449,  433,  705,  711,
-      684,  685,  685,  685,  685,  685,  685,  685,  685,  685,
-     1410,  184,  183, 1410,  710,  710,  710,  710,  710,  710,
-      710,  710,  710,  710, 1410, 1410, 1410,  185, 1410, 1410,
-
-      712, 1410, 1410,  186, 1410,  183,  185, 1410,  183, 1410,
-     1410, 1410,  792,  434, 1410,  792, 1410, 1410,  184, 1410,
-     1410,  186, 1410, 1410, 1410,  686,  183,  185, 1410, 1410,
-     1410,  183, 1410, 1410,  187,  188,  189,  792, 1410,  792,
-      186, 1410, 1410,  715,  184, 1410, 1410, 1410, 1410,  183,
-     1410,  696,  187,  188,  189,  183,  687,  688,  689, 1410,
-     1410, 1410,  184, 1410,  185, 1410,  792, 1410, 1410, 1410,
-     1410,  187,  188,  189, 1410, 1410, 1410, 1410,  183, 1410,
-     1410, 1410,  697,  698,  699, 1410, 1410, 1410, 1410, 1410,
-      185,  184, 1410, 1073, 1410, 1410, 1410, 1410, 1410, 1410,
-
-      717,  335, 1410, 1410, 1410, 1410, 1410, 1410,  185,  186,
-     1410, 1410, 1410, 1410, 1410, 1410,  701, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  792, 1410,  792,  792, 1410,
-      706,  718,  719,  720, 1410, 1410, 1410,  185, 1410, 1410,
-      187,  188,  189, 1410, 1410,  335, 1410,  702,  703,  704,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  335, 1410,
-     1410,  707,  708,  709, 1410, 1410, 1410,  186, 1410, 1410,
-     1410, 1410, 1410, 1410,  335,  335,  335,  335,  335,  335,
-      335,  335,  335,  335,  335, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  186,  183, 1410, 1410, 1410,  187,  188,
-
-      189, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  340,
-     1410,  186, 1410, 1410, 1410, 1410, 1410,  183, 1410, 1410,
-     1410,  335, 1410, 1410,  187,  188,  189, 1410, 1410, 1410,
-      184, 1410,  340, 1410, 1410, 1410, 1410, 1410,  183, 1410,
-      186, 1410,  187,  188,  189,  433,  721,  722,  723,  723,
-      723,  723,  723,  723,  723,  723,  723,  723, 1410, 1410,
-     1410,  183, 1410, 1410,  328, 1410, 1410, 1410, 1410, 1410,
-     1410,  187,  188,  189,  184, 1410,  185,  326,  327,  327,
-      327,  327,  327,  327,  327,  327,  327,  328, 1410, 1410,
-      340,  434, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-
-      184, 1410, 1410,  329,  330,  330,  330,  330,  330,  330,
-      330,  330,  330,  340, 1410, 1410,  183, 1410, 1410,  183,
-      185, 1410, 1410, 1410,  183, 1410,  184,  341,  342,  343,
-      343,  343,  343,  343,  343,  343,  343,  343,  343,  183,
-     1410, 1410,  183, 1410, 1410,  728,  185,  183, 1410, 1410,
-     1410, 1410,  184, 1410, 1410,  184, 1410, 1410, 1410, 1410,
-      184, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  349,
-      350, 1410,  185,  350, 1410, 1410, 1410, 1410, 1410,  186,
-     1410,  349,  350, 1410, 1410,  350, 1410, 1410, 1410, 1410,
-     1410, 1410,  349, 1410,  724,  350, 1410,  350,  185, 1410,
-
-     1410,  185, 1410, 1410,  349,  351,  185,  350, 1410,  350,
-      187,  188,  189, 1410, 1410, 1410, 1410,  735,  733, 1410,
-     1410, 1410, 1410,  186,  350,  725,  726,  727, 1410, 1410,
-      736, 1410, 1410, 1410,  183, 1410,  350, 1410,  730,  731,
-     1410,  349,  350,  732, 1410,  350, 1410, 1410, 1410,  331,
-     1410,  352, 1410, 1410,  187,  188,  189,  183, 1410, 1410,
-     1410,  729, 1410,  737,  349, 1410, 1410,  350, 1410,  350,
-      184, 1410, 1410, 1410, 1410,  344, 1410,  351, 1410, 1410,
-      332,  333,  334,  350, 1410,  350,  350, 1410, 1410, 1410,
-      733,   38, 1410, 1410, 1410,  350,  350,  350,  350, 1410,
-
-     1410,  186, 1410, 1410,  186, 1410,  345,  346,  347,  186,
-     1410, 1410, 1410, 1410,   38, 1410,  185, 1410, 1410, 1410,
-      349,  350, 1410,  352,  350, 1410,  183,   39, 1410,  183,
-     1410, 1410,  187,  188,  189,  187,  188,  189,  183, 1410,
-      187,  188,  189,  349, 1410, 1410,  350, 1410,  350,  183,
-     1410, 1410,  183, 1410,  353,  350,  351,  350,  350, 1410,
-     1410,  183,  184, 1410, 1410,  184,  738,  349,  350,  733,
-     1410,  350, 1410,   40,  184,  350, 1410, 1410,  349,  350,
-     1410, 1410,  350, 1410, 1410,  354,  355,  356, 1410,  183,
-      349, 1410,  744,  350, 1410,  350, 1410,  739,  740,  741,
-
-     1410,  349,  352,  351,  350, 1410,  350, 1410,  185, 1410,
-     1410,  185,  183, 1410,  351, 1410,  733,  751,   37,  186,
-      185,   37,  350, 1410, 1410,  184,  353,  733, 1410, 1410,
-     1410,  183, 1410,  350,  350, 1410,  350,  350, 1410,  183,
-      751, 1410, 1410,   37, 1410,   37,  374, 1410, 1410,  352,
-      187,  188,  189,   39,  183, 1410, 1410,  354,  355,  356,
-      352, 1410,  183, 1410, 1410,  745, 1410,  184, 1410,  374,
-     1410,  185,   37, 1410,  199,  184,   41,  198, 1410, 1410,
-     1410,  350,  184,  350,  350, 1410,  746,  747, 1410,  756,
-     1410, 1410,  350,  183,  350,  350,  183,  748, 1410,  197,
-
-     1410, 1410, 1410, 1410, 1410,  353, 1410,   42,   43,   44,
-     1410,  186, 1410,  185,  186, 1410,  183,  183, 1410,  183,
-     1410,  185, 1410,  186, 1410, 1410, 1410, 1410,  185,  184,
-     1410,   37,  184,   37,   37, 1410,  354,  355,  356, 1410,
-      183,  183,  187,  188,  189,  187,  188,  189, 1410, 1410,
-      200,  201,  353,  184,  187,  188,  189,  374,  202, 1410,
-     1410, 1410,   49,  353,  183, 1410, 1410, 1410,  183, 1410,
-     1410, 1410, 1410, 1410,  186,  185, 1410,  184,  185, 1410,
-      374, 1410, 1410,  354,  355,  356,  183, 1410, 1410, 1410,
-     1410,  183, 1410,  184,  354,  355,  356, 1410, 1410,  185,
-
-     1410, 1410,  752, 1410,  184,  187,  188,  189, 1410,  183,
-     1410, 1410, 1410, 1410, 1410,  760,  186, 1410, 1410, 1410,
-     1410, 1410,  184,  185,  186, 1410, 1410, 1410, 1410, 1410,
-     1410,  375, 1410,  753,  754,  755,  758,  759,  757,  185,
-     1410, 1410, 1410,  183, 1410, 1410,  183,  187,  188,  189,
-      185, 1410, 1410, 1410,  183,  187,  188,  189, 1410, 1410,
-     1410,  183,  376,  377,  378,  183,  183, 1410,  185,  183,
-      183, 1410, 1410,   49, 1410, 1410, 1410,  183,  186,  184,
-      183,  186,  184, 1410,  183, 1410, 1410, 1410,  183, 1410,
-      184, 1410, 1410,  183, 1410, 1410, 1410,  184, 1410, 1410,
-
-     1410,  184,  186,  183, 1410, 1410,  184, 1410,  183,  187,
-      188,  189,  187,  188,  189, 1410,  184, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  185,  186, 1410,  185, 1410,
-     1410,  183, 1410,  187,  188,  189,  185, 1410, 1410, 1410,
-     1410, 1410,  375,  185,  184, 1410, 1410,  185, 1410, 1410,
-     1410, 1410,  185,  186, 1410, 1410, 1410,  187,  188,  189,
-      183, 1410,  185, 1410, 1410,  183, 1410, 1410, 1410,  183,
-     1410,  186,  183,  376,  377,  378, 1410, 1410, 1410, 1410,
-      385,  385,  385,  183,  187,  188,  189,  183,  183,  385,
-      185, 1410,  183, 1410, 1410,  183,  184, 1410, 1410, 1410,
-
-     1410,  184,  187,  188,  189,  184, 1410, 1410,  184, 1410,
-      183, 1410, 1410, 1410, 1410,  385, 1410, 1410, 1410, 1410,
-     1410, 1410,  385,  184, 1410, 1410, 1410, 1410,  186, 1410,
-     1410,  186, 1410, 1410, 1410, 1410,  385, 1410, 1410,  186,
-     1410, 1410,  185, 1410, 1410, 1410,  186,  185, 1410, 1410,
-      186,  185, 1410,  183,  185,  186, 1410, 1410,  385,  187,
-      188,  189,  187,  188,  189,  186, 1410, 1410, 1410,  185,
-      187,  188,  189, 1410, 1410, 1410,  183,  187,  188,  189,
-     1410,  187,  188,  189, 1410, 1410,  187,  188,  189,  184,
-      385, 1410, 1410,  186, 1410, 1410,  187,  188,  189, 1410,
-
-      385,  385,  385,  385,  385,  385,  385,  385,  385, 1410,
-     1410, 1410, 1410,  385,  385,  385,  385,  183, 1410, 1410,
-      183, 1410, 1410, 1410,  187,  188,  189,  385,  385,  385,
-      385,  385,  385,  385, 1410,  185,  385,  183, 1410, 1410,
-      183, 1410, 1410,  183, 1410,  186, 1410,  385, 1410, 1410,
-      186, 1410, 1410,  184,  186, 1410,  184,  186, 1410, 1410,
-      183, 1410, 1410,  385,  385,  385,  385,  385,  385,  385,
-     1410, 1410,  186,  184, 1410,  183,  187,  188,  189, 1410,
-     1410,  187,  188,  189,  183,  187,  188,  189,  187,  188,
-      189,  183, 1410,  385,  385,  385,  385,  385,  183,  185,
-
-      183, 1410,  185,  187,  188,  189, 1410,  183, 1410, 1410,
-     1410,  184, 1410, 1410,  183, 1410, 1410, 1410, 1410,  185,
-      184, 1410, 1410,  183, 1410, 1410, 1410,  184, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410,  184, 1410,  186, 1410,
-     1410,  183,  385,  385,  385,  385,  385,  385,  385,  385,
-      385,  385,  385, 1410, 1410, 1410, 1410,  185, 1410, 1410,
-      183, 1410, 1410,  183,  183, 1410,  185, 1410, 1410,  187,
-      188,  189, 1410,  185, 1410, 1410, 1410,  184, 1410, 1410,
-     1410, 1410,  185,  183, 1410, 1410,  183, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410,  385,  385,  184, 1410, 1410,  184,
-
-     1410, 1410,  186, 1410, 1410,  186, 1410, 1410, 1410, 1410,
-      385,  385,  385,  385, 1410,  385,  385, 1410,  385,  385,
-     1410, 1410,  186,  185,  385,  385,  385,  385, 1410,  183,
-     1410, 1410,  385,  187,  188,  189,  187,  188,  189, 1410,
-     1410,  183,  185, 1410,  385,  185,  385,  183,  385,  385,
-      385, 1410,  183,  187,  188,  189, 1410, 1410, 1410,  183,
-      186, 1410,  385,  385,  183,  184, 1410,  183, 1410,  186,
-      183,  385,  385,  385,  385,  385,  186,  184, 1410, 1410,
-     1410, 1410,  183,  184, 1410,  186,  385,  385,  385,  385,
-      183,  187,  188,  189, 1410,  184, 1410, 1410, 1410, 1410,
-
-      187,  188,  189,  184, 1410, 1410, 1410,  187,  188,  189,
-     1410,  185, 1410, 1410, 1410, 1410,  187,  188,  189, 1410,
-     1410, 1410, 1410,  185, 1410, 1410,  186, 1410,  183,  185,
-     1410, 1410, 1410, 1410, 1410,  385,  385,  385,  385,  385,
-      385,  185, 1410, 1410, 1410,  186,  183, 1410,  186,  185,
-     1410,  183,  761,  761,  761, 1410, 1410,  187,  188,  189,
-     1410, 1410, 1410, 1410,  184, 1410, 1410, 1410, 1410,  183,
-     1410, 1410, 1410, 1410, 1410, 1410,  187,  188,  189,  187,
-      188,  189,  184, 1410, 1410, 1410, 1410,  385,  385,  385,
-      385,  385,  385,  385,  385,  385,  385,  385,  385,  761,
-
-      761,  761,  761,  761,  761,  761,  761,  761,  761,  761,
-      185, 1410,  183, 1410,  186, 1410, 1410,  761, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  761,  186, 1410,  185, 1410,
-     1410, 1410,  186,  183, 1410,  183, 1410,  183,  761,  761,
-      761, 1410, 1410, 1410,  186,  187,  188,  189,  184, 1410,
-     1410,  183,  186, 1410, 1410,  183,  183,  187,  188,  189,
-      183, 1410, 1410,  187,  188,  189,  761,  761,  761,  184,
-     1410, 1410, 1410,  184,  183,  187,  188,  189,  183, 1410,
-     1410,  761, 1410,  187,  188,  189, 1410,  184, 1410,  183,
-     1410,  184, 1410,  183,  185, 1410, 1410,  761,  761,  761,
-
-      761,  761,  761,  761,  761,  761,  761,  761,  761,  761,
-     1410,  183,  183,  186, 1410,  185,  183, 1410, 1410,  185,
-     1410, 1410, 1410, 1410, 1410,  184, 1410, 1410, 1410,  184,
-     1410,  186, 1410,  185,  183, 1410, 1410,  185,  183, 1410,
-     1410, 1410, 1410, 1410,  187,  188,  189,  184, 1410,  183,
-     1410, 1410,  761,  761,  761,  761,  761,  761,  761, 1410,
-     1410,  183,  187,  188,  189, 1410, 1410, 1410, 1410, 1410,
-     1410,  185,  183, 1410,  184,  185, 1410, 1410, 1410, 1410,
-     1410, 1410,  761,  761,  761,  184,  761,  761,  761,  761,
-      761, 1410, 1410,  185,  761, 1410, 1410,  186, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  761,
-      761,  761,  761,  761, 1410, 1410,  183, 1410,  186, 1410,
-      185, 1410,  186, 1410, 1410,  761,  761, 1410,  187,  188,
-      189,  185, 1410, 1410, 1410, 1410,  186,  761, 1410,  183,
-      186, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  187,
-      188,  189,  184,  187,  188,  189,  761,  761,  183, 1410,
-      761,  761,  761,  761,  761,  183, 1410,  187,  188,  189,
-     1410,  187,  188,  189,  186, 1410,  183, 1410,  186,  761,
-      761,  183, 1410, 1410, 1410, 1410, 1410, 1410,  183, 1410,
-     1410, 1410, 1410, 1410,  184,  183,  186, 1410,  185,  183,
-
-     1410,  184,  183,  761,  761,  187,  188,  189, 1410,  187,
-      188,  189,  184, 1410,  445, 1410, 1410, 1410,  183, 1410,
-     1410,  761, 1410,  186, 1410,  183, 1410,  187,  188,  189,
-     1410,  184, 1410, 1410,  186, 1410,  183,  445,  184,  445,
-      185, 1410, 1410, 1410, 1410, 1410, 1410,  185, 1410, 1410,
-      433, 1410, 1410,  445,  187,  188,  189, 1410,  185,  183,
-     1410, 1410,  445, 1410,  183,  187,  188,  189, 1410, 1410,
-     1410, 1410,  184, 1410, 1410,  433,  445,  185, 1410, 1410,
-     1410,  761, 1410, 1410,  185, 1410, 1410,  183,  445,  433,
-      761,  761,  761,  761,  761, 1410,  434, 1410, 1410, 1410,
-
-      184,  186, 1410,  445, 1410, 1410, 1410,  761,  761,  761,
-      761,  445, 1410,  183, 1410, 1410, 1410, 1410,  185, 1410,
-     1410,  434, 1410, 1410,  433, 1410,  445, 1410, 1410,  761,
-     1410, 1410,  187,  188,  189,  434,  183, 1410, 1410,  433,
-     1410, 1410, 1410,  186, 1410,  761,  185, 1410, 1410,  184,
-      186,  761,  761, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  186,  761,  761,  761,  761,  761, 1410, 1410, 1410,
-      434, 1410, 1410, 1410,  187,  188,  189, 1410,  183, 1410,
-      186,  187,  188,  189, 1410,  434, 1410,  186, 1410, 1410,
-      763, 1410,  187,  188,  189,  185, 1410, 1410,  764,  446,
-
-     1410,  183, 1410, 1410, 1410, 1410, 1410,  765,  766, 1410,
-     1410,  187,  188,  189,  184, 1410, 1410, 1410,  187,  188,
-      189,  186,  767, 1410,  446,  183, 1410, 1410, 1410, 1410,
-      447,  448,  449, 1410, 1410, 1410,  440,  182,  446, 1410,
-      182, 1410,  445, 1410, 1410, 1410, 1410, 1410,  183,  186,
-     1410,  183,  187,  188,  189,  447,  448,  449, 1410,  440,
-      185,  184,  182,  440,  182,  445,  445, 1410, 1410,  447,
-      448,  449,  184,  446,  183, 1410, 1410,  445,  774, 1410,
-      187,  188,  189, 1410, 1410, 1410,  445,  184,  446,  445,
-     1410,  182, 1410, 1410, 1410, 1410, 1410,  440,  186, 1410,
-
-      445, 1410,  433,  445,  447,  448,  449,  185, 1410,  445,
-     1410, 1410, 1410,  433, 1410,  183, 1410, 1410,  439,  447,
-      448,  449,  433, 1410,  775, 1410,  445, 1410, 1410,  187,
-      188,  189, 1410,  185, 1410, 1410, 1410, 1410,  183,  433,
-     1410, 1410, 1410, 1410,  440, 1410, 1410, 1410,  434, 1410,
-      182,  433,  182,  182, 1410, 1410, 1410, 1410, 1410,  434,
-     1410, 1410, 1410,  186, 1410, 1410,  445, 1410,  434, 1410,
-      440,  440,  440,  440,  440,  440,  440,  440,  440,  440,
-      440, 1410, 1410, 1410, 1410,  434, 1410, 1410, 1410,  445,
-     1410, 1410, 1410, 1410,  187,  188,  189,  434, 1410, 1410,
-
-     1410, 1410,  433, 1410, 1410,  782,  783, 1410,  445, 1410,
-      186,  781, 1410, 1410, 1410, 1410, 1410,  440, 1410, 1410,
-     1410,  769,  784, 1410, 1410, 1410, 1410,  776,  780, 1410,
-     1410,  445, 1410, 1410,  445, 1410,  186, 1410, 1410, 1410,
-     1410,  187,  188,  189,  433, 1410, 1410, 1410,  434, 1410,
-     1410,  446,  770,  771,  772, 1410, 1410,  445,  777,  778,
-      779, 1410,  446, 1410, 1410, 1410, 1410,  187,  188,  189,
-      433,  446, 1410,  786,  190, 1410, 1410,  190, 1410, 1410,
-     1410, 1410,  447,  448,  449,  451, 1410,  445,  446, 1410,
-      434,  183, 1410,  447,  448,  449,  786, 1410, 1410,  190,
-
-      435,  190,  447,  448,  449, 1410, 1410, 1410, 1410,  433,
-      445, 1410,  183, 1410,  183, 1410,  434, 1410, 1410,  447,
-      448,  449, 1410,  433, 1410, 1410, 1410,  184,  190, 1410,
-     1410,  436,  437,  438, 1410,  183,  183, 1410, 1410, 1410,
-      440,  182, 1410, 1410,  182, 1410, 1410, 1410,  184, 1410,
-     1410,  446,  183,  451, 1410,  787,  183, 1410,  451,  183,
-     1410, 1410,  183,  440, 1410, 1410,  182, 1410,  182,  434,
-     1410, 1410,  184,  185, 1410,  183,  184, 1410, 1410,  183,
-     1410,  465,  447,  448,  449,  183, 1410,  190,  184,  190,
-      190, 1410,  184,  446,  185,  182, 1410,  465,  184, 1410,
-
-     1410, 1410, 1410, 1410,  465, 1410,  451,  451,  451,  451,
-      451,  451,  451,  451,  451,  451,  451,  466,  185,  446,
-      465, 1410,  439, 1410,  447,  448,  449, 1410, 1410, 1410,
-     1410, 1410,  465,  793,  185, 1410, 1410, 1410,  185, 1410,
-     1410,  465, 1410, 1410,  185, 1410, 1410, 1410, 1410, 1410,
-      447,  448,  449,  451,  182,  465,  182,  182,  788, 1410,
-     1410, 1410,  465,  467,  465, 1410, 1410, 1410,  466, 1410,
-     1410,  444,  446, 1410, 1410, 1410,  186,  466, 1410,  794,
-     1410,  442,  443,  465, 1410,  465, 1410,  440, 1410,  789,
-      790,  791, 1410, 1410, 1410, 1410, 1410,  186,  466, 1410,
-
-     1410,  441, 1410,  447,  448,  449,  465,  187,  188,  189,
-      805, 1410, 1410,  805,  467, 1410, 1410, 1410, 1410,  466,
-     1410,  186, 1410,  467, 1410,  769, 1410,  805,  187,  188,
-      189, 1410, 1410,  805, 1410, 1410,  805,  186, 1410,  465,
-     1410,  186, 1410, 1410,  467, 1410,  793,  186,  805,  793,
-      805, 1410,  187,  188,  189, 1410,  770,  771,  772, 1410,
-     1410, 1410,  465,  793,  805,  467,  468, 1410,  187,  188,
-      189,  805,  187,  188,  189,  466, 1410, 1410,  187,  188,
-      189,  804,  795,  800,  793, 1410,  801,  805,  465, 1410,
-     1410, 1410,  794, 1410, 1410,  794, 1410,  469,  470,  471,
-
-      793, 1410,  802,  803, 1410, 1410,  817,  213, 1410,  794,
-      213,  465, 1410,  796,  797,  798, 1410,  468, 1410, 1410,
-     1410,  467, 1410, 1410,  466, 1410,  468, 1410, 1410,  817,
-      794, 1410,  213,  465,  213, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  466, 1410, 1410, 1410,  794,  468,  469,  470,
-      471, 1410, 1410, 1410, 1410, 1410,  465,  469,  470,  471,
-     1410,  213, 1410, 1410,  811, 1410, 1410,  815,  468,  466,
-      467, 1410,  812, 1410, 1410, 1410, 1410, 1410,  469,  470,
-      471,  465, 1410,  813,  814,  465, 1410, 1410,  818, 1410,
-     1410, 1410, 1410, 1410, 1410,  806, 1410, 1410,  806,  469,
-
-      470,  471, 1410, 1410,  465, 1410, 1410,  480,  465, 1410,
-     1410,  465,  806, 1410, 1410,  467, 1410,  466, 1410, 1410,
-      213,  466,  213,  213,  468, 1410,  807,  808,  809,  807,
-      808,  809, 1410,  806,  465, 1410, 1410, 1410,  465, 1410,
-     1410, 1410, 1410,  807,  808,  809, 1410,  466, 1410,  806,
-     1410, 1410, 1410, 1410, 1410,  469,  470,  471, 1410, 1410,
-     1410,  465,  465,  467,  807,  808,  809,  467, 1410, 1410,
-     1410, 1410,  465,  468,  466, 1410, 1410, 1410, 1410, 1410,
-      807,  808,  809,  480, 1410,  465, 1410, 1410, 1410, 1410,
-     1410,  819, 1410,  467, 1410,  465, 1410, 1410,  466, 1410,
-
-      480, 1410, 1410, 1410,  469,  470,  471, 1410,  466, 1410,
-     1410,  485, 1410, 1410, 1410, 1410, 1410, 1410,  468, 1410,
-      467, 1410,  820,  821,  822,  465, 1410, 1410, 1410, 1410,
-      480,  480,  480,  480,  480,  480,  480,  480,  480,  480,
-      480, 1410, 1410, 1410,  467, 1410, 1410, 1410,  465,  469,
-      470,  471, 1410, 1410,  467,  465, 1410, 1410, 1410, 1410,
-     1410,  466, 1410, 1410, 1410, 1410,  468, 1410, 1410, 1410,
-      468, 1410, 1410, 1410, 1410, 1410, 1410,  480,  465,  485,
-      485, 1410, 1410, 1410,  485,  485,  485,  485,  485, 1410,
-      485,  486,  485,  485, 1410, 1410,  468,  469,  470,  471,
-
-     1410,  469,  470,  471, 1410,  485, 1410,  467, 1410,  485,
-      465,  485, 1410,  800,  485, 1410, 1410, 1410, 1410,  485,
-      485, 1410, 1410,  468,  485, 1410, 1410,  469,  470,  471,
-     1410, 1410, 1410,  465, 1410,  485,  485,  487,  485,  485,
-      485,  485, 1410, 1410,  485, 1410,  466,  468, 1410, 1410,
-     1410, 1410, 1410, 1410,  469,  470,  471,  468, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      485,  485,  485,  485,  485,  485, 1410, 1410,  469,  470,
-      471, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  469,  470,
-      471, 1410,  467,  465, 1410, 1410,  465, 1410, 1410, 1410,
-
-     1410,  465, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      468, 1410,  465, 1410, 1410, 1410,  465, 1410, 1410,  465,
-     1410, 1410, 1410, 1410,  465, 1410, 1410, 1410, 1410,  466,
-     1410,  465,  466, 1410, 1410,  465, 1410,  466,  485,  485,
-      488,  469,  470,  471, 1410, 1410, 1410, 1410,  466, 1410,
-     1410,  489,  490, 1410,  465, 1410, 1410, 1410, 1410,  491,
-      492,  493,  494,  495, 1410,  496,  497,  466, 1410,  498,
-      499,  500,  501,  502, 1410,  467, 1410, 1410,  467, 1410,
-      503, 1410, 1410,  467, 1410,  504,  505,  464, 1410, 1410,
-      464,  485, 1410, 1410,  467,  468, 1410, 1410, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      485,  485,  464,  467,  464,  485,  485,  485,  485,  485,
-     1410,  485,  242,  485,  485, 1410,  469,  470,  471,  485,
-      485,  485,  485,  485,  485, 1410,  485,  485, 1410, 1410,
-      485,  464, 1410, 1410, 1410,  485, 1410,  485, 1410,  485,
-      485,  485, 1410, 1410,  485,  485,  485,  485, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  485,  485,
-      485, 1410,  485, 1410, 1410, 1410, 1410, 1410,  468, 1410,
-     1410,  468,  485,  485, 1410, 1410,  468, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  468, 1410, 1410,
-
-      464, 1410,  464,  464,  465,  485,  485,  485, 1410,  469,
-      470,  471,  469,  470,  471, 1410,  468,  469,  470,  471,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  465,  469,  470,
-      471, 1410,  465, 1410, 1410, 1410, 1410, 1410,  465, 1410,
-      466, 1410, 1410, 1410, 1410, 1410, 1410,  469,  470,  471,
-     1410, 1410, 1410, 1410, 1410,  465, 1410, 1410, 1410, 1410,
-     1410,  465,  465, 1410, 1410, 1410, 1410, 1410,  466, 1410,
-     1410,  823, 1410, 1410,  466, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  489,  490, 1410,  465,  467, 1410, 1410, 1410,
-      491,  492,  493,  494,  495, 1410,  496,  497,  466, 1410,
-
-      498,  499,  824,  825,  826, 1410, 1410, 1410, 1410, 1410,
-     1410,  503, 1410, 1410,  467, 1410,  504,  505,  464, 1410,
-      467,  464, 1410,  485,  485,  485,  485,  485,  485,  485,
-      485,  485,  485,  485,  485,  485,  485, 1410, 1410, 1410,
-     1410,  485,  485,  464,  467,  464,  485,  485,  485,  485,
-      485, 1410,  485,  242,  485,  485, 1410,  829,  830,  544,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  485, 1410,  545,
-     1410,  485,  464, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  831, 1410,  555,  556, 1410,  546, 1410,  547,  468,
-     1410, 1410, 1410,  465, 1410,  548,  549, 1410, 1410,  827,
-
-      485,  485, 1410,  485, 1410, 1410, 1410, 1410,  550, 1410,
-      551, 1410,  485,  552,  553, 1410,  465,  468, 1410, 1410,
-      469,  470,  471,  468, 1410, 1410, 1410, 1410, 1410,  466,
-     1410,  464, 1410,  464,  464, 1410,  465, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  468,  469,  470,
-      471, 1410, 1410, 1410,  469,  470,  471, 1410,  465,  465,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      465, 1410,  466, 1410, 1410,  467, 1410, 1410,  469,  470,
-      471,  465, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  465,  466, 1410, 1410, 1410, 1410, 1410,
-
-     1410, 1410,  823, 1410, 1410, 1410,  466,  465, 1410, 1410,
-     1410, 1410, 1410,  489,  490, 1410, 1410, 1410,  467, 1410,
-     1410,  491,  492,  493,  494,  495, 1410,  496,  497, 1410,
-      465,  498,  499,  824,  825,  826, 1410, 1410, 1410, 1410,
-      467,  465,  503,  466,  511,  512, 1410,  504,  505,  513,
-     1410,  514,  467,  515, 1410,  516,  524, 1410,  525, 1410,
-     1410,  517,  518, 1410,  465,  465, 1410,  519,  526,  520,
-     1410,  527,  521, 1410,  522,  523, 1410,  466,  468, 1410,
-      528,  828,  530,  531, 1410, 1410,  532,  533,  465,  467,
-     1410, 1410,  534, 1410, 1410,  535, 1410,  536, 1410, 1410,
-
-      537,  466,  538,  539,  540, 1410,  541, 1410,  557,  469,
-      470,  471, 1410,  558,  559, 1410,  560, 1410, 1410, 1410,
-     1410,  468,  561,  467,  562,  563,  564, 1410,  565,  569,
-      566, 1410,  567,  570,  571, 1410,  568,  572,  573, 1410,
-     1410, 1410, 1410,  468, 1410, 1410, 1410,  467, 1410, 1410,
-     1410, 1410,  469,  470,  471,  468, 1410, 1410, 1410,  485,
-      835, 1410,  555,  556, 1410,  485, 1410,  465, 1410,  485,
-     1410, 1410,  465, 1410,  469,  470,  471, 1410, 1410, 1410,
-      485,  485, 1410, 1410, 1410,  485,  469,  470,  471,  485,
-      465, 1410,  468,  465, 1410,  465, 1410, 1410, 1410, 1410,
-
-      574,  575,  576,  466, 1410, 1410,  577, 1410,  466, 1410,
-     1410,  578, 1410,  579,  580,  465,  465, 1410, 1410,  465,
-     1410, 1410, 1410,  469,  470,  471,  468, 1410, 1410,  466,
-     1410, 1410, 1410,  465, 1410, 1410, 1410, 1410,  465, 1410,
-     1410, 1410,  465, 1410, 1410, 1410, 1410, 1410, 1410,  467,
-      468,  466, 1410, 1410,  467,  466,  465,  469,  470,  471,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  466,
-     1410, 1410, 1410, 1410, 1410,  467, 1410, 1410, 1410, 1410,
-     1410,  469,  470,  471, 1410, 1410, 1410,  524, 1410,  525,
-     1410,  833,  834,  544, 1410, 1410, 1410,  467, 1410,  526,
-
-     1410,  467,  527,  545,  465, 1410, 1410, 1410, 1410, 1410,
-     1410,  528,  832,  530,  531,  467, 1410,  532,  533, 1410,
-      546, 1410,  547,  534, 1410, 1410,  535,  465,  536,  548,
-      549,  537, 1410,  538,  539,  540, 1410,  541, 1410, 1410,
-      466, 1410,  550, 1410,  551, 1410, 1410,  552,  553, 1410,
-     1410, 1410,  468, 1410, 1410, 1410, 1410,  468, 1410, 1410,
-      485,  485,  485,  485,  485,  485,  485,  485,  485,  485,
-      485,  485,  485,  485,  485, 1410,  465, 1410,  468, 1410,
-     1410, 1410,  485,  469,  470,  471,  467, 1410,  469,  470,
-      471,  817,  213,  485, 1410,  213, 1410, 1410, 1410,  465,
-
-      468, 1410, 1410, 1410,  468, 1410,  485, 1410, 1410,  469,
-      470,  471,  466, 1410,  817,  836,  836,  213,  468,  213,
-      836,  836,  836,  836,  836, 1410,  836,  486,  836,  836,
-     1410,  469,  470,  471,  465,  469,  470,  471, 1410, 1410,
-     1410,  836,  465, 1410, 1410,  836,  213, 1410, 1410,  469,
-      470,  471, 1410, 1410, 1410, 1410, 1410,  465,  467,  485,
-      485, 1410,  465, 1410, 1410,  465, 1410, 1410, 1410, 1410,
-      466,  485, 1410,  837,  836,  836, 1410,  836,  466, 1410,
-     1410, 1410, 1410, 1410, 1410,  465, 1410, 1410, 1410,  468,
-     1410, 1410,  465, 1410, 1410, 1410, 1410, 1410,  466,  485,
-
-     1410, 1410, 1410, 1410, 1410,  213, 1410,  213,  213,  465,
-     1410, 1410, 1410, 1410, 1410,  465,  467, 1410,  465, 1410,
-      469,  470,  471, 1410,  467, 1410, 1410, 1410,  466, 1410,
-     1410, 1410,  465, 1410, 1410,  465, 1410, 1410, 1410, 1410,
-     1410,  465, 1410, 1410,  467,  466, 1410,  465, 1410, 1410,
-     1410, 1410, 1410, 1410,  466, 1410, 1410, 1410,  465, 1410,
-     1410,  468, 1410, 1410, 1410, 1410, 1410, 1410,  485, 1410,
-      465,  466, 1410, 1410,  467, 1410,  838, 1410, 1410,  485,
-      485, 1410, 1410,  466, 1410, 1410,  485,  839,  840,  465,
-     1410,  467,  469,  470,  471,  841,  842,  843,  844,  845,
-
-      467,  846,  847, 1410, 1410,  848,  849,  850,  851,  852,
-     1410, 1410,  465,  485, 1410, 1410,  853,  467, 1410,  468,
-     1410,  854,  855, 1410, 1410,  466, 1410,  468, 1410,  467,
-     1410, 1410,  485,  485,  485,  485,  485,  485,  485,  485,
-      485,  485,  485,  485,  485,  485,  485,  468,  485,  465,
-      469,  470,  471,  485,  485,  485,  485,  485,  469,  470,
-      471, 1410,  485,  485,  485,  485,  485,  485,  485,  485,
-      485,  467,  465, 1410, 1410,  465, 1410,  468,  469,  470,
-      471, 1410, 1410, 1410, 1410,  466,  485,  485,  485,  485,
-     1410, 1410, 1410,  465,  468, 1410, 1410, 1410,  465, 1410,
-
-     1410,  465, 1410,  468, 1410, 1410, 1410, 1410,  469,  470,
-      471,  466,  485, 1410, 1410, 1410,  465, 1410, 1410, 1410,
-      468, 1410, 1410, 1410,  465,  469,  470,  471, 1410,  466,
-     1410,  467,  468, 1410,  469,  470,  471,  466, 1410, 1410,
-      485,  485,  485,  485,  485,  485,  485,  485,  485, 1410,
-     1410,  469,  470,  471, 1410,  465, 1410,  467, 1410,  465,
-     1410, 1410, 1410,  469,  470,  471, 1410, 1410,  485, 1410,
-     1410, 1410, 1410, 1410,  468,  467, 1410, 1410,  465, 1410,
-     1410, 1410,  465,  467, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  466, 1410,  465,  480,  466, 1410,  465, 1410, 1410,
-
-     1410, 1410,  465, 1410, 1410,  469,  470,  471,  465, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410,  465, 1410, 1410, 1410,
-      465,  485,  485, 1410, 1410,  465, 1410, 1410, 1410,  466,
-     1410,  465, 1410,  466,  468, 1410, 1410,  467,  466, 1410,
-     1410,  467, 1410, 1410,  466, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  465, 1410,  485,  485,  485, 1410, 1410,
-      468, 1410, 1410, 1410, 1410,  469,  470,  471, 1410, 1410,
-     1410, 1410, 1410,  485,  485,  467,  465, 1410,  468,  467,
-      465, 1410,  485,  485,  467, 1410,  468, 1410, 1410,  466,
-      467,  469,  470,  471,  485,  485,  485,  465,  485,  485,
-
-      485, 1410, 1410,  465, 1410, 1410, 1410, 1410, 1410,  469,
-      470,  471, 1410, 1410, 1410, 1410,  466,  469,  470,  471,
-      465,  485,  485,  485,  485,  485,  485,  485,  485,  485,
-      485,  485, 1410,  466, 1410,  467, 1410, 1410, 1410, 1410,
-      468, 1410,  631,  631,  468,  465, 1410, 1410,  631,  631,
-      631,  631,  631,  631,  631, 1410,  631,  631,  631,  631,
-      631,  631,  467, 1410, 1410, 1410, 1410, 1410,  465,  465,
-     1410,  469,  470,  471, 1410,  469,  470,  471,  468,  467,
-     1410,  466,  468, 1410, 1410,  465, 1410,  468, 1410,  631,
-      631, 1410,  465,  468, 1410, 1410, 1410, 1410,  631,  631,
-
-      631,  631,  631,  631,  631,  466, 1410, 1410,  465,  469,
-      470,  471, 1410,  469,  470,  471, 1410, 1410,  469,  470,
-      471,  466,  465, 1410,  469,  470,  471,  467, 1410, 1410,
-     1410, 1410, 1410,  631,  631, 1410, 1410, 1410,  468, 1410,
-     1410, 1410, 1410, 1410, 1410,  465, 1410, 1410, 1410,  465,
-     1410,  467, 1410, 1410, 1410, 1410, 1410, 1410,  466,  631,
-      631,  631,  631, 1410, 1410,  468, 1410,  467, 1410,  469,
-      470,  471,  465, 1410, 1410,  631,  631,  631,  631,  631,
-     1410, 1410,  468,  465, 1410,  466, 1410, 1410,  631,  631,
-      631,  631,  631,  631,  631,  631,  469,  470,  471, 1410,
-
-     1410, 1410,  465, 1410,  467, 1410,  465,  631, 1410, 1410,
-     1410, 1410, 1410,  469,  470,  471, 1410,  631,  631,  466,
-     1410,  632,  632,  632,  632,  465,  632,  632, 1410, 1410,
-      468,  467, 1410, 1410, 1410, 1410, 1410, 1410,  466, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  631,
-      631,  631,  631, 1410,  468, 1410, 1410, 1410, 1410, 1410,
-     1410,  469,  470,  471, 1410,  467, 1410, 1410, 1410, 1410,
-      468, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  631,  631,  467,  469,  470,  471,  465, 1410,
-     1410, 1410,  632,  632,  632,  632,  465, 1410, 1410,  465,
-
-     1410,  469,  470,  471, 1410, 1410, 1410,  468, 1410, 1410,
-     1410,  465, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  465,
-     1410, 1410,  465, 1410,  466, 1410, 1410, 1410,  632,  632,
-     1410, 1410,  466, 1410,  468,  466, 1410, 1410,  469,  470,
-      471, 1410,  631,  631,  631,  631,  631,  631,  631,  631,
-      631,  631,  631,  631,  631,  631, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  469,  470,  471,  468,  632,
-      467, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  467, 1410,
-     1410,  467, 1410, 1410, 1410, 1410, 1410,  468, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  469,
-
-      470,  471, 1410, 1410, 1410, 1410, 1410,  480,  480,  480,
-      480,  480,  480,  480,  480,  480,  480,  480,  469,  470,
-      471, 1410, 1410,  631,  631,  631,  631,  631,  631,  631,
-      631,  631,  631,  631,  631,  631,  631,  631,  631,  631,
-      631,  631,  631,  631,  631,  631,  631,  633, 1410, 1410,
-     1410, 1410, 1410, 1410,  480,  631,  631,  631,  631,  631,
-      631,  631,  631,  631,  631,  631,  631,  631,  631,  631,
-      631, 1410, 1410,  468, 1410, 1410, 1410,  633, 1410, 1410,
-     1410,  468, 1410, 1410,  468, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1410,  465, 1410, 1410,  469,  470,  471,  465, 1410, 1410,
-     1410, 1410,  469,  470,  471,  469,  470,  471, 1410, 1410,
-     1410, 1410,  465, 1410,  465,  465, 1410, 1410, 1410, 1410,
-      465,  465, 1410, 1410, 1410, 1410,  465,  466, 1410, 1410,
-     1410,  465, 1410,  466, 1410,  465, 1410, 1410,  465, 1410,
-     1410, 1410, 1410, 1410,  465, 1410, 1410, 1410,  466,  465,
-     1410,  466, 1410, 1410,  465, 1410, 1410,  466, 1410, 1410,
-     1410, 1410,  466, 1410, 1410, 1410, 1410,  466, 1410, 1410,
-     1410, 1410, 1410,  467, 1410, 1410, 1410, 1410, 1410,  467,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1410, 1410, 1410, 1410,  467, 1410, 1410,  467, 1410, 1410,
-     1410, 1410, 1410,  467, 1410, 1410, 1410, 1410,  467, 1410,
-     1410, 1410, 1410,  467, 1410, 1410,  631,  631,  631,  631,
-     1410,  631,  631,  631,  631,  631,  631,  631,  631,  631,
-      631,  631,  631,  631, 1410,  631,  631,  631,  631,  631,
-      631,  631,  631,  631,  631,  631,  631,  480, 1410, 1410,
-      631,  631,  679,  632,  632,  632,  632,  632,  632,  632,
-      632,  632,  632,  632,  632,  632,  632,  632,  632,  632,
-      632,  632,  632,  632,  632, 1410,  468,  631,  631, 1410,
-      633,  633,  468,  631,  631,  631,  631,  631,  631,  631,
-
-      632,  632,  632,  633,  633, 1410, 1410,  468, 1410, 1410,
-      468, 1410,  633,  633, 1410, 1410,  468,  469,  470,  471,
-     1410,  468, 1410,  469,  470,  471,  468, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  469,  470,
-      471,  469,  470,  471, 1410, 1410, 1410,  469,  470,  471,
-     1410, 1410,  469,  470,  471, 1410, 1410,  469,  470,  471,
-      632,  632,  632,  632,  632,  632,  632,  632,  632,  632,
-      632,  632,  632,  632,  632,  632,  632,  632,  632,  632,
-      632,  632,  632,  632,  632,  632,  632,  632,  632,  632,
-      632,  632,  632,  632,  632,  632,  632,  632,  632,  632,
-
-      632,  632,  632,  632,  632,  632,  632,  464,  632,  632,
-      632,  632,  632,  632,  632,  632,  632,  632,  632,  632,
-      632,  632,  632,  632,  464,  464, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  465,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464, 1410, 1410,  465, 1410, 1410,  465,  465, 1410,
-      465, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  466, 1410, 1410, 1410, 1410,  465,  465, 1410,  465,
-
-      465, 1410, 1410,  465, 1410, 1410, 1410, 1410, 1410, 1410,
-      466, 1410, 1410,  466, 1410, 1410,  466, 1410, 1410,  465,
-     1410, 1410,  465, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  466, 1410, 1410,  466, 1410,  467, 1410, 1410,
-     1410, 1410, 1410,  465, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410,  467,  465, 1410,  467,
-     1410, 1410,  467, 1410, 1410, 1410,  465, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410,  480,  632,  632,  632,  467,  466,
-      465,  467,  632,  632,  632,  632,  632,  632,  632,  632,
-      632,  632, 1410,  466,  632,  632,  632,  632,  633,  633,
-
-      633,  633,  633,  633,  633,  633,  633,  633,  633, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  465,
-     1410, 1410,  633, 1410, 1410,  467, 1410, 1410, 1410, 1410,
-     1410, 1410,  633,  633, 1410,  633, 1410, 1410, 1410,  467,
-      468, 1410,  465, 1410, 1410, 1410, 1410,  633, 1410,  633,
-      633,  633,  633,  633,  633,  466, 1410, 1410,  633,  468,
-     1410, 1410,  468,  465, 1410,  468,  465,  633,  633,  633,
-      633,  469,  470,  471,  633,  633,  633, 1410,  633, 1410,
-     1410,  468, 1410, 1410,  468, 1410,  465, 1410,  465,  465,
-      469,  470,  471,  469,  470,  471,  469,  470,  471,  466,
-
-      465,  467,  466, 1410, 1410,  633, 1410,  633, 1410, 1410,
-     1410,  465,  469,  470,  471,  469,  470,  471,  465, 1410,
-     1410, 1410, 1410,  465,  466, 1410, 1410, 1410,  468,  465,
-     1410, 1410, 1410, 1410, 1410,  465,  466, 1410, 1410, 1410,
-      465,  465,  468, 1410, 1410,  467, 1410, 1410,  467, 1410,
-     1410, 1410,  465, 1410,  466, 1410, 1410, 1410,  465,  469,
-      470,  471, 1410,  465, 1410,  466,  633,  633,  633,  633,
-      467,  466, 1410,  469,  470,  471,  466, 1410, 1410, 1410,
-     1410, 1410,  467,  633,  633,  633,  633,  633,  633,  633,
-      633,  633,  633,  633,  633,  633, 1410, 1410, 1410, 1410,
-
-      467, 1410, 1410, 1410,  468, 1410, 1410, 1410, 1410, 1410,
-     1410,  467,  633,  633, 1410,  633,  633,  467, 1410, 1410,
-     1410, 1410,  467,  633,  633,  633,  633,  633,  633,  633,
-      633,  633,  633,  633,  633,  469,  470,  471, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410,  485,  485,  468, 1410,
-     1410,  468, 1410, 1410,  670,  633,  633,  633,  633,  633,
-      633,  633,  633,  633,  633,  633,  633,  633,  633,  633,
-      633, 1410, 1410,  468, 1410, 1410, 1410, 1410, 1410,  469,
-      470,  471,  469,  470,  471,  468,  634, 1410,  634, 1410,
-      634,  634,  634,  634,  634,  634,  634, 1410,  678, 1410,
-
-      671, 1410, 1410,  468,  469,  470,  471,  465, 1410, 1410,
-     1410, 1410, 1410, 1410,  468, 1410,  469,  470,  471,  465,
-      468, 1410, 1410, 1410, 1410,  468, 1410, 1410, 1410, 1410,
-      465, 1410, 1410, 1410,  469,  470,  471, 1410, 1410, 1410,
-     1410, 1410,  465,  466, 1410,  469,  470,  471, 1410, 1410,
-     1410,  469,  470,  471, 1410,  466,  469,  470,  471,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242, 1410,  242, 1410, 1410, 1410, 1410,
-     1410,  465, 1410, 1410, 1410, 1410, 1410, 1410,  465,  467,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1410,  467, 1410, 1410,  465, 1410, 1410, 1410, 1410, 1410,
-     1410,  465, 1410,  242,  242,  242,  242,  466, 1410, 1410,
-     1410, 1410, 1410, 1410,  466, 1410,  633,  633,  633,  633,
-      633,  633,  633,  633,  633,  633,  633,  633,  633,  633,
-      633,  633,  633,  633,  633, 1410,  633,  633,  633,  633,
-      633,  633,  633,  633,  633,  633,  633,  633,  633,  633,
-     1410,  633, 1410,  467, 1410, 1410,  633, 1410,  633,  633,
-      467, 1410, 1410, 1410, 1410,  680, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  468,  465, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1410,  633,  633,  633,  468,  633,  633,  633,  633,  633,
-      633,  635,  633,  633,  633,  633,  465, 1410, 1410,  465,
-     1410,  636,  637,  469,  470,  471,  633,  633,  638,  466,
-     1410,  633,  633, 1410, 1410,  469,  470,  471, 1410, 1410,
-      639, 1410,  465,  640, 1410, 1308, 1308, 1308,  641, 1410,
-      642,  643, 1410,  644, 1410,  466, 1410, 1410, 1410,  633,
-      633,  634, 1410,  634, 1410,  645,  468, 1410,  646,  647,
-     1410, 1410, 1410,  468, 1410,  467, 1308, 1308, 1308, 1308,
-     1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  469,  470,  471,
-
-     1410,  467, 1410, 1410,  469,  470,  471,  214, 1410, 1410,
-     1410, 1410, 1410,  648,  649,  650, 1410,  651, 1410,  652,
-      653, 1410,  654,  465, 1410, 1410, 1410, 1410, 1410,  655,
-      214,  656, 1410,  465, 1410,  657, 1410,  658,  659, 1410,
-      660, 1410, 1410,  215,  661, 1410,  465, 1410, 1410,  662,
-     1410,  663,  664,  665,  666, 1410,  465, 1410, 1410,  466,
-     1410,  667, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  466,
-     1410,  668, 1410, 1410, 1410,  669, 1410, 1410,  468,  672,
-     1410,  673,  674,  675, 1410, 1410, 1410, 1410, 1410,  216,
-     1410, 1410, 1410, 1410, 1410, 1410,  676, 1410, 1410, 1410,
-
-     1410,  677, 1410, 1410,  468,  467, 1410, 1410, 1410,  469,
-      470,  471, 1410, 1410, 1410,  467, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  469,  470,  471,  465, 1410,
-     1410, 1410, 1410,  632,  632,  632, 1410, 1410, 1410, 1410,
-      632,  632,  632,  632,  632,  632,  632,  632,  632,  632,
-      465,  465,  632,  632,  632,  632,  633,  633,  633,  633,
-      633,  633,  633,  633,  466, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  465,  480,  485, 1410, 1410, 1410, 1410,
-      633,  485,  217, 1410, 1410,  485,  466, 1410, 1410, 1410,
-
-     1410, 1410, 1410,  633, 1410, 1410,  485,  485,  468,  465,
-     1410,  485,  465, 1410, 1410,  485, 1410, 1410,  468, 1410,
-      467, 1410, 1410,  218,  219,  220, 1410, 1410, 1410, 1410,
-     1410, 1410,  465, 1410, 1410,  465, 1410, 1410, 1410,  469,
-      470,  471,  467, 1410, 1410,  466, 1410, 1410,  466,  469,
-      470,  471, 1410, 1410, 1410, 1410, 1410,  631,  631,  631,
-      631, 1410,  631,  631,  631,  631,  631,  631,  631,  631,
-      631,  631,  631,  631,  631,  465,  631,  631,  631,  631,
-      631,  631,  631,  631,  631,  631,  631,  631, 1410, 1410,
-     1410,  467, 1410, 1410,  467, 1410, 1410, 1410,  465,  485,
-
-      485, 1410, 1410,  465,  485,  485,  485,  485,  485, 1410,
-      485,  486,  485,  485, 1410, 1410, 1410, 1410,  631,  631,
-     1410, 1410, 1410,  468, 1410,  485,  465, 1410, 1410,  485,
-     1410, 1410, 1410, 1410, 1410,  485, 1410,  465, 1410,  466,
-     1410,  485, 1410, 1410, 1410,  468, 1410, 1410, 1410, 1410,
-     1410,  485, 1410, 1410,  469,  470,  471,  487,  485,  485,
-      465,  485, 1410,  465, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  466, 1410, 1410,  469,  470,  471,  465,
-     1410, 1410,  465, 1410, 1410,  467,  465, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410,  468, 1410, 1410,  468, 1410,  466,
-
-     1410, 1410,  465, 1410, 1410,  465, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  466, 1410, 1410,  466,  467,
-     1410, 1410, 1410, 1410, 1410,  469,  470,  471,  469,  470,
-      471, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  467, 1410, 1410,  485,  485,
-      485,  485,  485,  485, 1410, 1410, 1410, 1410, 1410, 1410,
-      488,  467, 1410, 1410,  467,  485,  485, 1410, 1410, 1410,
-     1410,  489,  490, 1410, 1410, 1410, 1410, 1410, 1410,  491,
-      492,  493,  494,  495, 1410,  496,  497, 1410,  468,  498,
-      499,  500,  501,  502, 1410, 1410, 1410, 1410,  485, 1410,
-
-      503,  485, 1410, 1410,  485,  504,  505,  927,  213, 1410,
-     1410,  213, 1410, 1410, 1410, 1410, 1410,  634,  485,  469,
-      470,  471,  468,  465,  485,  485,  485,  485, 1410, 1410,
-      927,  928,  928,  213, 1410,  213,  928,  928,  928,  928,
-      928, 1410,  928,  222,  928,  928,  465, 1410,  468,  485,
-      485, 1410, 1410,  469,  470,  471, 1410,  928, 1410,  466,
-     1410,  928,  213, 1410,  468, 1410, 1410,  468, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  469,
-      470,  471, 1410, 1410,  465, 1410, 1410, 1410, 1410,  510,
-      928,  928, 1410,  928, 1410,  469,  470,  471,  469,  470,
-
-      471, 1410, 1410, 1410, 1410,  467, 1410,  465, 1410,  465,
-     1410, 1410, 1410, 1410,  465, 1410, 1410, 1410, 1410, 1410,
-      466,  213, 1410,  213,  213,  465, 1410, 1410, 1410, 1410,
-     1410, 1410,  465, 1410, 1410, 1410, 1410,  465, 1410, 1410,
-     1410, 1410, 1410, 1410,  465,  466, 1410, 1410,  465, 1410,
-      466,  485,  485, 1410,  485,  485, 1410, 1410, 1410, 1410,
-     1410,  466, 1410, 1410, 1410, 1410,  467,  465, 1410,  485,
-     1410,  485,  485,  485, 1410, 1410, 1410, 1410, 1410, 1410,
-      466, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  467,  929, 1410, 1410, 1410,  467, 1410, 1410, 1410,
-
-     1410, 1410, 1410,  930,  931, 1410, 1410,  467,  468, 1410,
-     1410,  932,  933,  934,  935,  936, 1410,  937,  938, 1410,
-     1410,  939,  940,  941,  942,  943,  467, 1410,  554, 1410,
-      555,  556,  944, 1410, 1410, 1410, 1410,  945,  946,  469,
-      470,  471, 1410, 1410,  485,  485,  485,  485,  485,  485,
-      485,  485,  485,  485,  485,  485,  485,  485,  485,  485,
-      485, 1410,  465, 1410, 1410,  511,  512, 1410, 1410,  468,
-      513, 1410,  514, 1410,  515, 1410,  516, 1410, 1410, 1410,
-     1410, 1410,  517,  518, 1410,  465, 1410, 1410,  519, 1410,
-      520, 1410, 1410,  521,  468,  522,  523, 1410,  466,  468,
-
-      469,  470,  471, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      468,  465, 1410, 1410,  465,  569, 1410, 1410, 1410,  570,
-      571, 1410, 1410,  572,  573,  469,  470,  471, 1410,  468,
-      469,  470,  471, 1410,  465,  465, 1410,  465, 1410, 1410,
-     1410,  469,  470,  471,  467, 1410, 1410,  466, 1410,  465,
-      466, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  465, 1410,
-      469,  470,  471, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  466,  465, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  524, 1410,  525,  466, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  467,  526, 1410,  467,  527, 1410, 1410,
-
-     1410,  465, 1410, 1410, 1410, 1410,  528,  529,  530,  531,
-     1410, 1410,  532,  533, 1410, 1410, 1410,  467,  534, 1410,
-     1410,  535, 1410,  536,  465, 1410,  537, 1410,  538,  539,
-      540,  467,  541,  542,  543,  544, 1410,  466, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  545, 1410,  468, 1410, 1410,
-     1410, 1410, 1410, 1410,  951, 1410,  555,  556,  465, 1410,
-     1410,  634,  546, 1410,  547, 1410, 1410, 1410, 1410, 1410,
-     1410,  548,  549, 1410, 1410, 1410, 1410,  465,  469,  470,
-      471,  465, 1410,  467,  550, 1410,  551,  557, 1410,  552,
-      553, 1410,  558,  559,  466,  560,  468, 1410, 1410,  468,
-
-      465,  561, 1410,  562,  563,  564, 1410,  565, 1410,  566,
-     1410,  567,  465,  466, 1410,  568, 1410, 1410, 1410, 1410,
-      468, 1410,  465, 1410, 1410, 1410, 1410,  469,  470,  471,
-      469,  470,  471, 1410,  468,  465,  574,  575,  576,  625,
-      467, 1410,  577, 1410, 1410,  465, 1410,  578,  466,  579,
-      580,  469,  470,  471, 1410, 1410, 1410, 1410,  466,  467,
-     1410, 1410,  625,  485,  485,  469,  470,  471,  485,  485,
-      485,  485,  485, 1410,  485,  486,  485,  485, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410,  468, 1410, 1410,  485,
-     1410, 1410, 1410,  485,  467, 1410,  634,  634,  634, 1410,
-
-     1410, 1410, 1410, 1410,  467, 1410, 1410, 1410, 1410,  947,
-      485, 1410, 1410, 1410, 1410, 1410,  485,  469,  470,  471,
-      485,  487,  485,  485,  465,  485, 1410, 1410, 1410,  465,
-     1410,  485,  485, 1410, 1410,  465,  485,  634, 1410, 1410,
-      485,  465,  524,  468,  525, 1410, 1410,  465, 1410, 1410,
-     1410, 1410,  465, 1410,  526, 1410, 1410,  527,  465, 1410,
-      466, 1410,  468, 1410,  465,  466,  528,  948,  530,  531,
-     1410,  466,  532,  533,  469,  470,  471,  466,  534, 1410,
-     1410,  535, 1410,  536, 1410, 1410,  537, 1410,  538,  539,
-      540, 1410,  541,  469,  470,  471, 1410,  468, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410,  467,  468, 1410, 1410,
-     1410,  467, 1410, 1410, 1410, 1410, 1410,  467, 1410, 1410,
-     1410, 1410, 1410,  467,  626, 1410, 1410, 1410,  469,  470,
-      471, 1410, 1410, 1410, 1410,  489,  490, 1410,  469,  470,
-      471, 1410, 1410,  491,  492,  493,  494,  495, 1410,  496,
-      497, 1410,  465,  498,  499,  627,  628,  629, 1410, 1410,
-      949,  950,  544, 1410,  503, 1410, 1410, 1410, 1410,  504,
-      505,  634,  545, 1410,  465,  465, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  466,  546,
-      634,  547, 1410, 1410, 1410, 1410, 1410,  465,  548,  549,
-
-      625, 1410,  634,  634,  634,  634,  634,  634,  634,  468,
-      466,  550, 1410,  551,  468, 1410,  552,  553, 1410, 1410,
-      468, 1410, 1410,  625,  485,  485,  468, 1410, 1410,  485,
-      485,  485,  485,  485,  467,  485,  486,  485,  485,  465,
-      469,  470,  471, 1410, 1410,  469,  470,  471, 1410, 1410,
-      485,  469,  470,  471,  485, 1410,  467,  469,  470,  471,
-     1410, 1410,  465,  485,  485, 1410, 1410, 1410,  485,  485,
-      485,  485,  485, 1410,  485,  486,  485,  485,  465, 1410,
-     1410, 1410,  487,  485,  485, 1410,  485, 1410, 1410,  485,
-     1410, 1410, 1410,  485, 1410, 1410,  634,  634,  634,  634,
-
-     1410,  465,  485,  485, 1410, 1410, 1410,  485,  485,  485,
-      485,  485, 1410,  485,  486,  485,  485,  465, 1410, 1410,
-     1410,  487,  485,  485,  634,  485, 1410, 1410,  485, 1410,
-     1410, 1410,  485, 1410, 1410, 1410, 1410,  468, 1410, 1410,
-      465,  485,  485, 1410, 1410, 1410,  485,  485,  485,  485,
-      485,  465,  485,  486,  485,  485,  634, 1410, 1410,  468,
-      487,  485,  485, 1410,  485, 1410, 1410,  485,  469,  470,
-      471,  485, 1410, 1410,  465, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  626, 1410,  466, 1410, 1410,
-      469,  470,  471, 1410, 1410, 1410,  489,  490, 1410,  487,
-
-      485,  485, 1410,  485,  491,  492,  493,  494,  495, 1410,
-      496,  497, 1410, 1410,  498,  499,  627,  628,  629, 1410,
-     1410, 1410, 1410, 1410,  488,  503, 1410, 1410, 1410,  465,
-      504,  505, 1410,  467, 1410,  489,  490, 1410, 1410, 1410,
-     1410, 1410, 1410,  491,  492,  493,  494,  495, 1410,  496,
-      497, 1410,  465,  498,  499,  500,  501,  502, 1410, 1410,
-     1410, 1410, 1410,  488,  503,  466, 1410, 1410, 1410,  504,
-      505, 1410, 1410, 1410,  489,  490, 1410, 1410, 1410, 1410,
-     1410,  465,  491,  492,  493,  494,  495, 1410,  496,  497,
-     1410, 1410,  498,  499,  500,  501,  502, 1410, 1410, 1410,
-
-     1410, 1410,  488,  503,  465, 1410, 1410, 1410,  504,  505,
-     1410,  467, 1410,  489,  490,  634, 1410,  466, 1410, 1410,
-      465,  491,  492,  493,  494,  495, 1410,  496,  497, 1410,
-     1410,  498,  499,  500,  501,  502,  468, 1410, 1410, 1410,
-     1410, 1410,  503,  465,  485,  485, 1410,  504,  505,  485,
-      485,  485,  485,  485,  465,  485,  486,  485,  485,  465,
-     1410, 1410, 1410,  467, 1410, 1410, 1410,  469,  470,  471,
-      485, 1410, 1410, 1410,  485, 1410,  465,  465, 1410, 1410,
-     1410, 1410,  465, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      466, 1410, 1410, 1410, 1410,  466, 1410, 1410, 1410,  465,
-
-     1410, 1410,  487,  485,  485, 1410,  485,  634,  634, 1410,
-      634,  634,  466, 1410,  468, 1410,  634,  634,  634,  634,
-      634,  634,  634,  634,  634,  465, 1410, 1410,  465, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410,  467, 1410, 1410, 1410,
-     1410,  467, 1410, 1410, 1410,  469,  470,  471,  465, 1410,
-     1410,  465, 1410, 1410, 1410, 1410, 1410, 1410,  467, 1410,
-     1410,  466, 1410,  634,  466, 1410,  468, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  465, 1410,  634,
-      634,  634,  634, 1410, 1410,  634,  634,  634,  634,  634,
-      634,  634, 1410, 1410, 1410, 1410,  465,  469,  470,  471,
-
-      465, 1410, 1410, 1410, 1410,  488,  465,  467, 1410, 1410,
-      467, 1410, 1410,  466, 1410, 1410,  489,  490, 1410,  465,
-     1410, 1410, 1410, 1410,  491,  492,  493,  494,  495,  465,
-      496,  497,  466, 1410,  498,  499,  500,  501,  502,  468,
-     1410, 1410,  466, 1410,  468,  503, 1410,  634,  634, 1410,
-      504,  505,  634,  634,  634,  634,  634,  634,  634,  467,
-     1410,  468, 1410, 1410, 1410,  634,  634,  634,  634,  634,
-      469,  470,  471, 1410, 1410,  469,  470,  471,  467,  465,
-     1410, 1410,  465, 1410, 1410,  465, 1410, 1410,  467, 1410,
-     1410, 1410,  469,  470,  471, 1410,  634,  634,  634,  634,
-
-     1410, 1410,  465, 1410, 1410,  465, 1410, 1410,  465, 1410,
-      468, 1410, 1410,  468, 1410,  466, 1410, 1410,  466, 1410,
-     1410,  466, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      634,  634,  634,  634, 1410, 1410, 1410, 1410,  634, 1410,
-     1410,  469,  470,  471,  469,  470,  471, 1410,  634,  634,
-     1410, 1410,  634, 1410,  634,  634,  634, 1410, 1410, 1410,
-      465,  467,  468, 1410,  467,  465, 1410,  467, 1410,  465,
-     1410,  634,  634,  634,  634,  634,  634, 1410, 1410, 1410,
-     1410,  468, 1410,  465,  465, 1410, 1410, 1410,  465, 1410,
-     1410,  468,  465,  469,  470,  471,  466, 1410, 1410, 1410,
-
-     1410,  466, 1410, 1410,  465,  466, 1410,  465, 1410,  465,
-     1410, 1410,  469,  470,  471,  634,  634,  634,  634,  634,
-      466, 1410,  469,  470,  471, 1410, 1410,  465, 1410, 1410,
-      634,  634,  465,  634, 1410, 1410, 1410, 1410, 1410,  634,
-      466, 1410,  467, 1410, 1410,  466,  465,  467, 1410, 1410,
-     1410,  467,  465, 1410, 1410, 1410, 1410, 1410,  952, 1410,
-     1410, 1410, 1410, 1410,  468, 1410,  467,  468, 1410,  465,
-      468, 1410, 1410, 1410, 1410,  465, 1410, 1410, 1410, 1410,
-     1410, 1410,  466, 1410, 1410, 1410,  467, 1410,  466, 1410,
-     1410,  467,  952,  952,  952,  469,  470,  471,  469,  470,
-
-      471,  469,  470,  471,  634,  634,  634,  634,  634,  634,
-      634,  634,  634,  634,  634,  634,  952,  952,  952,  952,
-      952,  952,  952,  952,  952,  952,  952, 1410,  467, 1410,
-     1410, 1410, 1410, 1410,  467,  465, 1410, 1410, 1410,  952,
-      952,  952, 1410,  952, 1410,  468, 1410, 1410, 1410, 1410,
-      468, 1410,  465, 1410,  468, 1410,  465,  952,  465, 1410,
-     1410,  465, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  468,
-     1410,  466,  952,  952,  952,  465,  469,  470,  471,  465,
-     1410,  469,  470,  471,  465,  469,  470,  471,  466,  468,
-     1410,  952,  466, 1410,  468, 1410, 1410,  466, 1410, 1410,
-
-      469,  470,  471,  952,  952,  952,  952,  952,  952,  952,
-      952,  952,  952,  952,  952,  952, 1410,  467, 1410, 1410,
-      469,  470,  471, 1410, 1410,  469,  470,  471,  952,  465,
-     1410,  468, 1410, 1410,  467, 1410, 1410,  468,  467, 1410,
-     1410, 1410, 1410,  467, 1410, 1410, 1410, 1410,  465, 1410,
-     1410,  465,  465, 1410,  952,  952,  952,  952,  952,  952,
-      952, 1410,  469,  470,  471,  466, 1410, 1410,  469,  470,
-      471,  465,  465, 1410,  465, 1410,  952,  952,  952,  952,
-      952, 1410, 1410, 1410,  466, 1410, 1410,  466, 1410,  465,
-     1410, 1410, 1410, 1410, 1410,  465, 1410,  952,  952,  952,
-
-     1410,  952,  952,  952,  952,  952,  465, 1410,  466,  465,
-     1410,  467,  465, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      468, 1410, 1410,  952,  952,  466,  465, 1410, 1410,  465,
-      467, 1410,  465,  467, 1410,  952,  952,  468, 1410, 1410,
-     1410,  468,  466, 1410, 1410,  466,  468, 1410, 1410,  465,
-     1410,  469,  470,  471,  467, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  466, 1410, 1410, 1410,  465, 1410,  469,  470,
-      471,  467,  469,  470,  471, 1410, 1410,  469,  470,  471,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  467,  465,
-     1410,  467, 1410, 1410, 1410,  953,  952,  952,  952,  952,
-
-      952, 1410,  466,  465, 1410, 1410, 1410, 1410,  467, 1410,
-     1410, 1410,  952, 1410,  468, 1410,  952,  952,  953,  465,
-     1410, 1410, 1410,  952, 1410, 1410,  465, 1410, 1410, 1410,
-     1410,  433, 1410,  468, 1410, 1410,  468,  952,  952,  466,
-     1410, 1410,  465, 1410, 1410,  469,  470,  471,  467, 1410,
-     1410,  952,  952,  952,  952,  466, 1410,  468, 1410, 1410,
-     1410, 1410, 1410,  965,  469,  470,  471,  469,  470,  471,
-     1410, 1410, 1410, 1410,  468, 1410, 1410,  434, 1410,  952,
-      952,  952,  952,  952,  952,  467,  965, 1410,  469,  470,
-      471,  468,  445, 1410,  468, 1410, 1410, 1410, 1410,  433,
-
-     1410,  467, 1410, 1410, 1410,  469,  470,  471, 1410, 1410,
-     1410,  468, 1410,  953, 1410,  445,  952, 1410, 1410, 1410,
-     1410, 1410,  469,  470,  471,  469,  470,  471,  433,  952,
-      952,  952,  952,  952, 1410, 1410,  953, 1410, 1410, 1410,
-     1410,  445,  469,  470,  471,  434, 1410, 1410, 1410,  433,
-     1410,  468,  958,  958,  958,  958,  958,  958,  958,  958,
-      958,  958,  716, 1410,  445, 1410, 1410, 1410,  952,  952,
-      445, 1410, 1410, 1410,  434, 1410, 1410,  433, 1410, 1410,
-      954, 1410,  469,  470,  471,  716,  683, 1410,  468, 1410,
-     1410, 1410, 1410,  445, 1410,  434, 1410, 1410,  433,  721,
-
-      722, 1410, 1410, 1410,  468, 1410,  433, 1410, 1410,  683,
-     1410,  955,  956,  957, 1410,  965, 1410, 1410, 1410,  469,
-      470,  471,  774,  434, 1410,  959,  960,  960,  960,  960,
-      960,  960,  960,  960,  960,  469,  470,  471,  965, 1410,
-     1410, 1410,  445,  971,  434, 1410, 1410, 1410,  966, 1410,
-     1410,  433,  434, 1410,  970,  970,  970,  970,  970,  970,
-      970,  970,  970,  970,  445,  445, 1410, 1410,  775, 1410,
-      445, 1410, 1410, 1410, 1410, 1410, 1410,  446,  433,  967,
-      968,  969, 1410, 1410,  445, 1410,  972,  445, 1410,  973,
-      974,  445, 1410,  445, 1410, 1410, 1410,  434,  954,  695,
-
-      433, 1410, 1410, 1410, 1410, 1410,  433,  445,  447,  448,
-      449, 1410, 1410, 1410,  445, 1410, 1410, 1410, 1410, 1410,
-      433, 1410,  695, 1410,  434, 1410,  446,  433, 1410,  955,
-      956,  957, 1410,  183, 1410,  433, 1410, 1410, 1410,  183,
-     1410, 1410, 1410, 1410, 1410, 1410,  434,  976, 1410, 1410,
-     1410, 1410,  434, 1410, 1410,  446,  183,  447,  448,  449,
-     1410,  975,  183, 1410, 1410, 1410,  434, 1410, 1410,  184,
-     1410,  961, 1410,  434, 1410,  184, 1410, 1410,  977,  978,
-      979,  434, 1410,  690,  183, 1410,  447,  448,  449,  690,
-      690,  690,  690,  690,  690,  690,  690,  690,  690,  690,
-
-      966,  183,  962,  963,  964, 1410, 1410,  183, 1410, 1410,
-      690, 1410,  445, 1410, 1410,  185, 1410, 1410, 1410, 1410,
-      184,  185, 1410, 1410,  183, 1410, 1410,  446,  445, 1410,
-     1410,  967,  968,  969,  690,  445,  690,  184, 1410,  445,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  433,  446,
-     1410,  445, 1410, 1410, 1410,  446, 1410, 1410,  447,  448,
-      449, 1410,  445, 1410,  433, 1410,  185, 1410, 1410,  446,
-     1410, 1410, 1410, 1410, 1410,  433,  446, 1410,  985, 1410,
-      447,  448,  449,  185,  980, 1410,  447,  448,  449,  989,
-      984, 1410, 1410, 1410,  434, 1410, 1410, 1410, 1410, 1410,
-
-      447,  448,  449,  986,  987, 1410, 1410,  447,  448,  449,
-      434, 1410,  989, 1410, 1410,  981,  982,  983,  186, 1410,
-      988,  434, 1410, 1410,  186,  184, 1410, 1410,  700,  700,
-      700,  700,  700,  700,  700,  700,  700,  700, 1410,  445,
-     1410, 1410, 1410,  705, 1410, 1410, 1410, 1410, 1410,  187,
-      188,  189, 1410,  183, 1410,  187,  188,  189,  996,  997,
-      183, 1410,  445,  994, 1410, 1410,  705,  183, 1410,  186,
-     1410,  185, 1410,  995, 1410,  433,  183, 1410, 1410,  433,
-     1410, 1410, 1410,  183, 1410, 1410,  186, 1410, 1410,  184,
-      183, 1410, 1410, 1410, 1410, 1410,  184,  446, 1410, 1410,
-
-      187,  188,  189,  184,  183, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  446, 1410, 1410, 1410,  187,  188,  189,
-     1410,  434, 1410, 1410,  446,  434, 1410,  183,  447,  448,
-      449,  183, 1410, 1410, 1410,  185, 1410, 1410, 1410, 1410,
-      184, 1410,  185, 1410,  447,  448,  449, 1410, 1008,  185,
-     1410, 1410, 1410, 1410,  183,  447,  448,  449,  998, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  184, 1410, 1410,
-     1410, 1008, 1410, 1410,  990, 1410, 1410, 1410, 1410, 1005,
-     1006, 1410, 1410, 1410,  184, 1410,  185,  710,  710,  710,
-      710,  710,  710,  710,  710,  710,  710,  183, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1003,  991,  992,  993, 1410, 1410,
-     1410,  183, 1004,  185, 1410, 1410, 1410, 1410, 1410, 1410,
-      183, 1410, 1410, 1007,  446, 1410, 1410, 1410,  999, 1410,
-      185,  183, 1410,  184,  183, 1410, 1410, 1410,  186, 1410,
-     1410, 1410, 1410, 1410, 1410,  186, 1410,  184, 1410, 1410,
-      711, 1410,  186, 1410,  183,  447,  448,  449,  328, 1000,
-     1001, 1002, 1410, 1410, 1410, 1410, 1410,  184, 1410,  187,
-      188,  189, 1410, 1410, 1410, 1410,  187,  188,  189,  185,
-     1410,  328, 1410,  187,  188,  189, 1410,  183, 1410,  186,
-     1410, 1410,  716,  185,  184,  183, 1410,  329,  330,  330,
-
-      330,  330,  330,  330,  330,  330,  330, 1410, 1410, 1410,
-      183, 1410, 1410,  185, 1410,  716,  186, 1410,  183, 1410,
-      187,  188,  189,  184, 1410, 1410, 1410, 1410,  433,  721,
-      722,  184, 1410, 1009, 1410, 1410, 1410, 1410, 1410,  183,
-      185, 1410, 1014, 1410,  183, 1410, 1410,  187,  188,  189,
-      711,  711,  711,  711,  711,  711,  711,  711,  711,  711,
-      711,  711,  183, 1410, 1010, 1011, 1012,  183, 1410,  185,
-     1410, 1410, 1410, 1410,  434,  184, 1410,  185, 1410, 1410,
-      184, 1410,  186, 1410, 1410, 1410, 1410,  445, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410,  186,  711, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410,  711, 1410, 1410, 1410,
-      445, 1410, 1410,  187,  188,  189,  186,  445, 1410, 1410,
-     1410,  185, 1410,  433, 1410, 1410,  185,  187,  188,  189,
-     1410, 1410, 1410, 1410,  445, 1410, 1410, 1410, 1410, 1410,
-      445, 1410, 1410,  331, 1410,  445, 1013,  187,  188,  189,
-     1410, 1410, 1410,  433, 1410, 1410, 1410,  445, 1015, 1016,
-     1410, 1410, 1410, 1017, 1410, 1410, 1410, 1410,  445,  434,
-      433, 1410,  186, 1410,  332,  333,  334,  976, 1410, 1410,
-      186,  433, 1410, 1410,  681,  682,  682,  682,  682,  682,
-      682,  682,  682,  682,  683, 1410, 1410, 1410, 1410,  434,
-
-     1410, 1410, 1410,  187,  188,  189, 1410, 1410,  977,  978,
-      979,  187,  188,  189, 1410, 1410,  434,  683, 1410, 1410,
-     1410, 1410, 1410, 1410,  186, 1410, 1410,  434,  445,  186,
-      433, 1410, 1024,  684,  685,  685,  685,  685,  685,  685,
-      685,  685,  685, 1018, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  445, 1410, 1025, 1026,  187,  188,  189, 1410, 1410,
-      187,  188,  189, 1410,  433, 1410, 1018, 1410, 1023, 1410,
-     1410,  183,  446, 1410, 1410, 1410,  434,  183, 1410,  433,
-      721,  722,  723,  723,  723,  723,  723,  723,  723,  723,
-      723,  723, 1410, 1410,  183, 1410, 1410, 1410, 1410, 1410,
-
-      183, 1410,  446,  447,  448,  449, 1410,  184, 1410, 1410,
-      434, 1410, 1410,  184, 1410, 1410, 1410, 1410,  183,  446,
-     1410, 1410, 1410, 1410, 1410,  434, 1410, 1410, 1410, 1410,
-      446, 1410, 1410,  447,  448,  449, 1410, 1410, 1410, 1410,
-     1410,  183, 1410, 1410,  340, 1410, 1410, 1027, 1410, 1410,
-      447,  448,  449,  185,  184, 1410, 1410, 1410, 1410,  185,
-     1410,  447,  448,  449, 1410, 1410, 1410,  340, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  686,
-      184,  341,  342,  343,  343,  343,  343,  343,  343,  343,
-      343,  343,  343,  183, 1410, 1410,  728, 1410, 1410, 1410,
-
-      185, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      687,  688,  689,  446, 1410, 1410,  183, 1410,  183, 1410,
-     1410,  728, 1410, 1410, 1410, 1410,  185, 1029, 1019,  184,
-     1410, 1030, 1410, 1410, 1410, 1410, 1410,  728, 1410, 1410,
-     1410,  183, 1410, 1410,  447,  448,  449, 1410, 1410, 1410,
-     1029, 1410, 1410, 1030,  184, 1030,  186, 1410, 1410, 1020,
-     1021, 1022,  186, 1031, 1410, 1410, 1410, 1410,  183, 1410,
-     1410, 1410, 1410, 1410, 1410,  185, 1410, 1410, 1410, 1410,
-     1410, 1410, 1030, 1410, 1410, 1410, 1410,  187,  188,  189,
-     1410,  183, 1410,  187,  188,  189, 1410, 1410, 1410, 1410,
-
-      185, 1410, 1043,  186,  184, 1410, 1030, 1410, 1410, 1032,
-     1410, 1410,  728,  728,  728,  728,  728,  728,  728,  728,
-      728,  728,  728, 1410, 1410, 1043, 1410, 1410, 1030,  344,
-     1030, 1410, 1410, 1410,  187,  188,  189, 1410, 1044, 1410,
-      183, 1030, 1410, 1030, 1030, 1037,  350, 1410, 1410,  350,
-      185,  183, 1410, 1410, 1410, 1410, 1410, 1030, 1410,  728,
-      345,  346,  347,  183, 1410, 1037,  350, 1410, 1037,  350,
-     1410,  350, 1410,  350,  183, 1410,  184, 1410,  186, 1410,
-     1410,  735, 1410, 1410, 1045, 1410, 1410,  184, 1037, 1410,
-     1410,  350, 1410,  350,  736, 1410, 1410, 1410, 1410, 1410,
-
-      350,  735, 1410,  186, 1410, 1410, 1410, 1410, 1410,  187,
-      188,  189, 1033, 1410,  736, 1410, 1030, 1410, 1030, 1030,
-      350, 1410,  185, 1410, 1410, 1410, 1410,  737, 1037,  350,
-     1410, 1410,  350,  185,  187,  188,  189, 1410, 1410, 1410,
-     1410, 1410, 1410, 1034, 1035, 1036, 1410,  737, 1410, 1410,
-     1410, 1037, 1410,  186,  350, 1410,  350, 1410, 1410,  350,
-     1410,  350,  350, 1410,  735, 1410,  183, 1410, 1410, 1410,
-     1410, 1410, 1037,  350, 1410, 1410,  350,  736, 1410,  350,
-     1410,  350,  350,  350,  187,  188,  189, 1046, 1410,  183,
-     1410,  198, 1410, 1410, 1410, 1037,  199, 1410,  350, 1410,
-
-      350, 1410,  184, 1410, 1410, 1410, 1410, 1410,  735, 1410,
-      737, 1037,  350, 1410, 1410,  350, 1051, 1410, 1047, 1048,
-     1049,  736, 1410,  183, 1410,  186, 1410,  350, 1410, 1410,
-     1038, 1410, 1410, 1410, 1037, 1410,  186,  350, 1410,  350,
-     1410, 1410,  350, 1410,  350,  350,  183,  735,  185, 1410,
-     1038,  744,  348, 1410,  737,  348,  187,  188,  189,  184,
-      736, 1039, 1040, 1041, 1410, 1410,  350,  187,  188,  189,
-     1410, 1410, 1410, 1052,  744, 1410, 1410,  348, 1410,  348,
-     1410, 1039, 1040, 1041, 1410,  202,  350,  351,  350,  350,
-     1410, 1053, 1054,  737, 1410, 1410, 1410, 1410,  349,  350,
-
-     1057, 1410,  350, 1410, 1410,  185,  348, 1410, 1410, 1410,
-     1410, 1410, 1410, 1038, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  349, 1410, 1410,  350,  350,  350,  350,  350, 1410,
-     1055, 1410, 1410,  743,  351, 1410,  349,  350, 1410, 1410,
-      350, 1410,  200,  201, 1039, 1040, 1041,  733, 1410, 1410,
-     1410,  186, 1410,  350, 1410, 1410, 1410, 1038, 1410,  349,
-     1410, 1410,  350, 1410,  350,  348, 1410,  348,  348, 1410,
-     1410, 1410,  351, 1410, 1410,  349,  350, 1410, 1410,  350,
-      352, 1410,  187,  188,  189,  733, 1410, 1410, 1039, 1040,
-     1041,  350, 1410, 1410, 1410, 1410, 1038,  374,  349, 1410,
-
-     1410,  350, 1410,  350, 1410, 1410, 1410, 1410,  186, 1410,
-     1410,  351,  350, 1410,  350,  350, 1410, 1410,  352, 1410,
-      374, 1410, 1410, 1410,  733, 1410,  183, 1039, 1040, 1041,
-      350, 1410, 1410,  184, 1410, 1410, 1058,  183, 1410,  187,
-      188,  189, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  183,
-      350, 1410,  350,  350, 1410,  744, 1410,  352, 1410, 1410,
-      183, 1410,  184, 1410, 1410, 1410, 1410, 1059, 1060, 1061,
-     1410, 1410, 1410,  184, 1410, 1410, 1410, 1410, 1410,  185,
-     1410, 1410, 1410,  353,  349,  350, 1410, 1410,  350,  350,
-     1410,  350,  350, 1410,  744,  744,  744,  744,  744,  744,
-
-      744,  744,  744,  744,  744, 1410, 1410,  349,  185, 1410,
-      350, 1410,  350,   49,  354,  355,  356, 1410, 1410,  185,
-      351,  353,  349,  350, 1410, 1410,  350, 1410,  183, 1410,
-     1410, 1410, 1410,  733,  183, 1410, 1410, 1410,  183,  350,
-     1410,  744,  183, 1410, 1410,  349, 1410, 1410,  350, 1410,
-      350,  183,  354,  355,  356, 1410,  756,  183,  351, 1410,
-      353,  183, 1410, 1410,  184,  183,  352, 1410, 1410, 1410,
-      184,  733, 1410, 1410,  184, 1410,  756,  350,  433, 1410,
-     1410, 1410,  375, 1410, 1410, 1410, 1410, 1410, 1410,  445,
-     1410,  354,  355,  356, 1410,  780,  432, 1410,  350,  432,
-
-      350,  350, 1410, 1410,  352, 1410, 1410, 1410, 1410,  445,
-      185,  186,  445,  376,  377,  378,  185, 1410,  780, 1410,
-      185,  432,  186,  432,  434,  433, 1410, 1410, 1410, 1410,
-     1410,  433,  445, 1410,  744, 1410,  350, 1410,  350,  350,
-     1410,  744,  187,  188,  189,  433, 1410,  756, 1410, 1410,
-      432,  445, 1410,  187,  188,  189, 1410,  756,  756,  756,
-      756,  756,  756,  756,  756,  756,  756,  756, 1410,  353,
-     1410,  434, 1410, 1410,  445, 1410, 1410,  762, 1410, 1410,
-      183, 1410, 1410, 1410, 1410, 1410, 1410,  433, 1410, 1410,
-     1410,  434, 1410, 1410, 1410,  445, 1410, 1410, 1410,  183,
-
-      354,  355,  356,  183,  756, 1410,  183,  353,  763,  432,
-     1410,  432,  432,  186, 1410, 1410,  184, 1410,  445,  186,
-     1410, 1410,  183,  186, 1410, 1410, 1410,  435,  763,  183,
-     1410,  433, 1410,  434, 1410,  184, 1410, 1410,  354,  355,
-      356, 1410,  184, 1410,  187,  188,  189,  183, 1410, 1410,
-      187,  188,  189,  183,  187,  188,  189, 1410,  436,  437,
-      438,  445,  185, 1410,  445, 1410, 1410,  445, 1410, 1410,
-      183, 1410, 1410,  445,  446, 1410,  183,  434, 1410, 1410,
-     1063,  185, 1410,  184,  445, 1410, 1410,  445,  185,  184,
-      445, 1410, 1410, 1410,  446, 1410,  445,  774, 1410, 1410,
-
-      774,  763, 1410,  774, 1410,  447,  448,  449,  445,  774,
-     1410, 1064, 1065, 1066,  763,  763,  763,  763,  763,  763,
-      763,  763,  763,  763,  763,  447,  448,  449, 1410,  185,
-     1410,  445, 1410, 1410, 1410,  185,  446, 1410, 1410, 1410,
-     1410, 1410, 1410,  775,  774, 1410,  775,  445, 1410,  775,
-      440,  441, 1410,  445, 1410,  775, 1410, 1410, 1410, 1410,
-     1410,  763, 1410, 1410, 1410,  186,  444,  447,  448,  449,
-      445,  445,  442,  443, 1410, 1410,  445, 1410, 1410, 1410,
-      446, 1410, 1410,  433,  186, 1410, 1410, 1410, 1410,  433,
-      775,  186, 1070, 1071,  445, 1410,  187,  188,  189, 1410,
-
-     1410, 1410, 1410, 1410, 1410,  445, 1410,  433, 1410, 1069,
-     1410,  447,  448,  449,  445,  187,  188,  189, 1068, 1410,
-      445, 1410,  187,  188,  189,  445, 1410, 1072,  445,  434,
-     1410,  445,  186, 1410, 1410,  434, 1410,  445,  186, 1410,
-     1410,  433, 1410,  445, 1410, 1410,  776, 1410,  445,  776,
-      433, 1410,  776,  434,  445, 1410,  433, 1410,  776, 1410,
-     1410,  433, 1410,  187,  188,  189, 1410,  433, 1410,  187,
-      188,  189,  780, 1410, 1410, 1410, 1410,  777,  778,  779,
-      777,  778,  779,  777,  778,  779, 1410,  434, 1410,  777,
-      778,  779,  445,  776, 1410,  445,  434, 1410, 1410,  445,
-
-     1410, 1410,  434, 1410, 1410, 1410, 1410,  434, 1410, 1410,
-     1410, 1410, 1410,  434,  465,  445, 1410, 1410,  445, 1410,
-     1410,  780,  445, 1410,  777,  778,  779, 1410,  433, 1410,
-     1410,  433,  446,  780, 1410,  433, 1410,  465,  446,  780,
-      780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
-      793, 1410, 1410, 1410, 1410, 1410,  446,  780,  432, 1410,
-     1410,  432, 1410,  447,  448,  449, 1410, 1410,  465,  447,
-      448,  449,  465, 1410,  434, 1410, 1410,  434,  465, 1410,
-      780,  434,  780,  432,  465,  432,  780,  447,  448,  449,
-      446,  465, 1410,  433, 1410,  465,  794, 1410, 1410,  446,
-
-     1410,  465, 1410, 1410,  793,  446, 1410,  465,  793, 1410,
-      446,  784,  432, 1410,  793, 1410,  446, 1410,  782,  783,
-      793,  447,  448,  449, 1410, 1410, 1410, 1410, 1410, 1410,
-      447,  448,  449, 1410, 1410, 1410,  447,  448,  449,  762,
-      781,  447,  448,  449, 1410, 1410,  465,  447,  448,  449,
-      794, 1410,  465, 1410,  794, 1410, 1410, 1410, 1410, 1410,
-      794, 1410, 1410, 1410, 1410, 1410,  794, 1410, 1410,  465,
-     1410,  432, 1410,  432,  432,  465, 1410,  446, 1410, 1410,
-      446, 1410,  466, 1410,  446, 1410, 1410, 1410,  466, 1410,
-     1410, 1076, 1077, 1410, 1410, 1410, 1410,  465, 1410,  795,
-
-     1410,  800,  464, 1078, 1410,  464, 1410, 1410,  447,  448,
-      449,  447,  448,  449, 1410,  447,  448,  449, 1410, 1074,
-      465, 1410,  465, 1075,  800,  465, 1410,  464,  467,  464,
-      796,  797,  798,  466,  467, 1410, 1410,  466, 1410, 1410,
-     1410,  805, 1063, 1410,  465,  465, 1410, 1410,  465, 1410,
-     1410, 1410, 1410,  795, 1410, 1410,  464,  795,  466, 1410,
-     1410,  466, 1410,  795,  805, 1410, 1410,  465, 1410,  795,
-      465,  800, 1410, 1064, 1065, 1066, 1410, 1085, 1410,  467,
-      793, 1410, 1410,  799,  796,  797,  798, 1410,  796,  797,
-      798,  465, 1410,  465,  796,  797,  798,  465, 1410, 1410,
-
-      796,  797,  798, 1410,  467, 1410,  793,  467, 1410, 1410,
-     1410, 1410, 1410, 1410,  465,  464,  800,  464,  464, 1410,
-      465, 1410, 1410, 1086, 1410, 1410,  794,  793, 1410, 1410,
-     1410,  468, 1410,  793, 1410, 1410, 1410,  468,  465, 1410,
-     1410,  800,  800,  800,  800,  800,  800,  800,  800,  800,
-      800,  800,  794, 1410, 1410,  465, 1410, 1410, 1410, 1410,
-     1410,  465,  469,  470,  471, 1410, 1410, 1410,  469,  470,
-      471, 1410, 1410,  794,  793,  800, 1410, 1410,  465,  794,
-     1410, 1410,  468, 1410, 1410, 1410, 1080, 1410,  800, 1093,
-     1094,  793, 1410, 1410, 1410, 1091, 1410, 1410, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  468, 1410, 1410,
-      468, 1410, 1410,  469,  470,  471, 1095, 1081, 1082, 1083,
-      794, 1410, 1410, 1410, 1410, 1410, 1087, 1410,  465,  795,
-     1410, 1410, 1410, 1410, 1410, 1410, 1092,  794,  469,  470,
-      471,  469,  470,  471, 1097,  472, 1410, 1410,  472, 1410,
-     1410,  465, 1410, 1410, 1410,  795,  465, 1088, 1089, 1090,
-      796,  797,  798, 1410,  793, 1410,  465, 1097, 1410, 1410,
-      472, 1410,  472, 1410,  811, 1410,  795, 1410, 1410,  465,
-      793,  465,  795, 1410, 1410, 1410,  796,  797,  798,  465,
-     1410, 1410,  793, 1410, 1410, 1410, 1410, 1410, 1410,  472,
-
-     1410, 1410,  793, 1410,  465,  465, 1410,  796,  797,  798,
-      794, 1410, 1410,  796,  797,  798,  465,  466, 1410, 1410,
-     1410, 1410, 1410,  795, 1410, 1410, 1098, 1410,  465, 1410,
-      465, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  794,  465,
-      795,  466, 1410, 1410, 1410, 1410, 1410,  811,  794, 1410,
-     1410, 1410,  466,  465,  796,  797,  798, 1410,  472, 1410,
-      472,  472, 1410,  467, 1410, 1410,  466,  465, 1410, 1410,
-      465,  796,  797,  798, 1410,  811,  811,  811,  811,  811,
-      811,  811,  811,  811,  811,  811, 1410,  467, 1410, 1410,
-      465, 1410, 1410,  465, 1410,  800,  464, 1410,  467,  464,
-
-     1410, 1410, 1410,  466, 1410, 1410,  466, 1410, 1410, 1410,
-     1410, 1410,  467,  795, 1410, 1410,  811, 1410,  800, 1410,
-      465,  464,  811,  464, 1410, 1410, 1410, 1410, 1410, 1099,
-     1410,  466, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  795, 1410,  465,  796,  797,  798, 1410, 1410,  467,
-      464,  795,  467, 1410, 1410, 1410,  466, 1410, 1410, 1410,
-     1100, 1101, 1102, 1410, 1410, 1410,  468,  800, 1410, 1410,
-     1410, 1410,  796,  797,  798,  801, 1410,  799, 1410, 1410,
-     1410, 1410,  796,  797,  798, 1410,  802,  803, 1410,  804,
-      468, 1410, 1410, 1410, 1410,  465, 1410,  469,  470,  471,
-
-     1410,  468,  467, 1410, 1410, 1410, 1410, 1410, 1410,  464,
-     1410,  464,  464, 1410,  465,  468, 1410, 1410,  465, 1410,
-     1410,  469,  470,  471, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  466,  469,  470,  471, 1410, 1410,  465,  465, 1410,
-     1410, 1410, 1410,  465, 1410, 1410,  469,  470,  471, 1410,
-      466, 1410,  468,  465, 1410,  468, 1410, 1410, 1410, 1410,
-     1410,  465, 1410, 1410, 1410, 1410,  465,  465, 1410, 1410,
-     1410, 1410,  485, 1410,  466, 1410,  465,  467,  485,  466,
-     1080, 1410,  485,  469,  470,  471,  469,  470,  471,  466,
-      465, 1410, 1410,  485,  485, 1410,  467, 1410,  485, 1410,
-
-     1410, 1410,  485,  466, 1410,  468, 1410, 1410, 1410, 1410,
-     1410, 1081, 1082, 1083, 1410,  524, 1410,  525, 1410, 1410,
-      467, 1410, 1410, 1410, 1410,  467, 1410,  526, 1410, 1410,
-      527, 1410, 1410, 1410, 1410,  467,  469,  470,  471,  528,
-      832,  530,  531, 1410, 1410,  532,  533, 1410, 1410,  467,
-     1410,  534, 1410, 1410,  535, 1410,  536,  800, 1410,  537,
-     1410,  538,  539,  540, 1410,  541, 1410, 1410,  465, 1410,
-     1410, 1410,  835, 1410,  555,  556, 1410, 1410, 1410, 1410,
-      468, 1410, 1410, 1410,  485,  485,  833,  834,  544,  485,
-      485,  465, 1410,  465, 1410,  485, 1410, 1410,  545,  468,
-
-     1410, 1410, 1410, 1410,  466, 1410, 1410, 1410, 1410, 1410,
-      465,  469,  470,  471, 1410,  546,  465,  547, 1410, 1410,
-     1410, 1410, 1410,  468,  548,  549, 1410, 1410,  468,  466,
-      469,  470,  471,  465, 1410, 1410, 1410,  550,  468,  551,
-     1410, 1410,  552,  553,  465, 1410,  466, 1410, 1410, 1410,
-      467, 1410,  468, 1410,  469,  470,  471, 1410, 1410,  469,
-      470,  471, 1410, 1410, 1410, 1410, 1410,  465,  465,  469,
-      470,  471, 1410, 1410, 1410,  467, 1410, 1410, 1410, 1410,
-      466, 1410, 1410,  469,  470,  471,  800,  464, 1410, 1410,
-      464,  465,  467, 1410,  485, 1410, 1410, 1410, 1410, 1410,
-
-     1410, 1410, 1410, 1410,  466, 1410, 1410, 1410, 1410,  800,
-     1103, 1103,  464, 1410,  464, 1103, 1103, 1103, 1103, 1103,
-     1410, 1103,  486, 1103, 1103, 1410,  467, 1410, 1410,  485,
-     1410, 1410,  485, 1410, 1410,  485, 1103, 1410, 1410, 1410,
-     1103,  464, 1410, 1410,  800,  485, 1410, 1410, 1410, 1410,
-      467,  485, 1410,  468, 1410,  485, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410,  485,  485,  827, 1103,
-     1103,  485, 1103, 1410, 1410,  485, 1410, 1410,  468, 1410,
-      485,  485, 1410, 1410,  469,  470,  471, 1410, 1410,  485,
-      485,  485,  485,  485,  485,  468,  485,  485, 1410,  465,
-
-      464, 1410,  464,  464, 1410, 1410, 1410,  465, 1410,  469,
-      470,  471, 1410, 1410, 1410, 1410,  465, 1410, 1410, 1410,
-     1410, 1410,  465, 1410, 1410, 1410,  469,  470,  471,  468,
-      465, 1410, 1410, 1410, 1410,  466, 1410, 1410, 1410,  465,
-     1410, 1410, 1410,  466, 1410, 1410, 1410, 1410, 1410,  485,
-     1410, 1410,  466,  468, 1410, 1410, 1410, 1410, 1410, 1410,
-      469,  470,  471, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1104, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  467, 1105, 1106,  469,  470,  471, 1410, 1410,  467,
-     1107, 1108, 1109, 1110, 1111, 1410, 1112, 1113,  467, 1410,
-
-     1114, 1115, 1116, 1117, 1118, 1410, 1410, 1410, 1410, 1410,
-     1410, 1119, 1410, 1410, 1410, 1410, 1120, 1121,  465, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  800,  632,  632,  632, 1410,
-     1410,  465, 1410,  632,  632,  632,  632,  632,  632,  632,
-      632,  632,  632,  465,  466,  632,  632,  632,  632,  633,
-      633,  633,  633,  633,  633,  633,  633, 1410,  485,  485,
-      485,  485, 1410,  485,  485,  485,  465, 1410, 1410, 1410,
-     1410, 1410, 1410,  633,  468, 1410, 1410, 1410, 1410,  466,
-     1410, 1410,  468, 1410, 1410,  465,  633, 1410, 1410, 1410,
-
-      467,  468, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  469,  470,  471,  465, 1410,
-     1410, 1410, 1410,  469,  470,  471, 1410, 1410, 1410, 1410,
-     1410,  466,  469,  470,  471,  467, 1410,  800,  800,  800,
-      800,  800,  800,  800,  800,  800,  800,  800, 1410, 1410,
-     1410, 1410, 1410,  631,  631,  631,  631,  631,  631,  631,
-      631,  631,  631,  631,  631,  631,  631,  631,  631,  631,
-      631,  631,  631,  631,  631,  631,  631,  467, 1410, 1410,
-     1410, 1410, 1410, 1410,  800,  631,  631,  631,  631,  631,
-      631,  631,  631,  631,  631,  631,  631,  631,  631,  631,
-
-      631, 1410, 1410,  468, 1410, 1410, 1410, 1410, 1410, 1410,
-      465, 1410, 1410, 1410, 1410, 1410,  465, 1410, 1410,  465,
-     1410, 1410, 1410,  485,  485, 1410,  485,  485,  465, 1410,
-     1410, 1410, 1410,  465,  469,  470,  471,  465,  468,  465,
-     1410,  485,  465,  485,  485,  485,  466, 1410, 1410, 1410,
-     1410,  465,  466,  465, 1410,  466, 1410, 1410, 1410, 1410,
-      465, 1410, 1410, 1410,  466, 1410, 1410, 1410, 1410,  469,
-      470,  471, 1410,  466, 1410, 1410,  465,  485,  485, 1410,
-      468, 1410,  485,  485,  485,  485,  485, 1410,  485,  486,
-      485,  485,  467, 1410, 1410, 1410, 1410, 1410,  467, 1410,
-
-     1410,  467, 1410,  485, 1410, 1410,  465,  485, 1410,  465,
-      467,  469,  470,  471, 1410, 1410, 1410, 1410, 1410,  467,
-     1410, 1410, 1410, 1410,  465, 1410, 1410, 1410, 1410,  465,
-     1410, 1410,  465, 1410, 1410,  487,  485,  485,  831,  485,
-      555,  556,  466, 1410, 1410,  466, 1410,  465, 1410,  485,
-     1410, 1410, 1410, 1410, 1410, 1410,  631,  631,  631,  631,
-      466,  631,  631,  631,  631,  631,  631,  631,  631,  631,
-      631,  631,  631,  631, 1410,  631,  631,  631,  631,  631,
-      631,  631,  631,  631,  631,  631,  631,  800,  467, 1410,
-     1410,  467, 1410, 1410, 1410,  468, 1410, 1410, 1410, 1410,
-
-     1410,  468, 1410, 1410,  468, 1410,  467, 1410, 1410,  485,
-     1410, 1410, 1410,  468, 1410, 1410, 1410,  631,  631, 1410,
-     1410, 1410,  468, 1410, 1410, 1410,  469,  470,  471,  465,
-     1410, 1410,  469,  470,  471,  469,  470,  471,  488, 1410,
-     1410, 1410, 1410, 1410,  469,  470,  471, 1410,  485,  489,
-      490, 1410,  465,  469,  470,  471,  465,  491,  492,  493,
-      494,  495, 1410,  496,  497,  466, 1410,  498,  499,  500,
-      501,  502, 1410, 1410, 1410, 1410, 1410,  569,  503,  465,
-     1410,  570,  571,  504,  505,  572,  573, 1410, 1410, 1410,
-     1410,  468,  466, 1410,  468, 1410, 1410, 1410,  485,  485,
-
-      485, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  468,
-     1410,  467, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  469,  470,  471,  469,  470,  471, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  467, 1410,
-      469,  470,  471, 1410, 1410, 1410, 1410, 1410,  485,  485,
-      485,  485,  485,  485,  485,  485,  485,  485,  485,  485,
-      485,  485, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      465, 1410, 1410, 1410, 1410,  631,  631,  631,  631, 1410,
-      631,  631,  631,  631,  631,  631,  631,  631,  631,  631,
-      631,  631,  631,  465,  631,  631,  631,  631,  631,  631,
-
-      631,  631,  631,  631,  631,  631,  466, 1410, 1410, 1410,
-     1410, 1410,  465, 1410,  468, 1410, 1410, 1410, 1410, 1410,
-     1410, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
-     1124, 1410, 1410, 1410, 1410,  465,  631,  631, 1410, 1410,
-     1410,  468, 1410, 1410, 1410,  469,  470,  471,  466, 1410,
-     1410, 1410,  467, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
-     1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1410,
-     1410, 1410,  469,  470,  471, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      632,  632,  632, 1410,  467, 1410, 1410,  632,  632,  632,
-
-      632,  632,  632,  632,  632,  632,  632, 1410, 1410,  632,
-      632,  632,  632,  633,  633,  633,  633,  633,  633,  633,
-      633, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  465, 1410,
-     1410, 1410,  524, 1410,  525, 1410, 1410,  633, 1410, 1410,
-     1410, 1410, 1410, 1410,  526, 1410, 1410,  527, 1410,  953,
-      633,  465, 1410, 1410, 1410,  468,  528,  828,  530,  531,
-     1410, 1410,  532,  533,  466, 1410, 1410, 1410,  534, 1410,
-     1410,  535,  953,  536, 1410, 1410,  537, 1410,  538,  539,
-      540, 1410,  541, 1410, 1410,  774,  469,  470,  471,  800,
-      464, 1410, 1410,  464, 1410, 1410, 1410,  468, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      467, 1410,  800, 1103, 1103,  464, 1410,  464, 1103, 1103,
-     1103, 1103, 1103, 1410, 1103,  486, 1103, 1103,  469,  470,
-      471,  775, 1410, 1410, 1410, 1410, 1410, 1410,  465, 1103,
-     1410,  465, 1410, 1103,  464, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  465, 1410, 1410,  465, 1410, 1410, 1410, 1410, 1410,
-     1410,  827, 1103, 1103,  466, 1103, 1410,  466, 1410,  511,
-      512, 1410, 1410, 1410,  513, 1410,  514, 1410,  515, 1410,
-      516,  465, 1410, 1410, 1410, 1410,  517,  518, 1410, 1410,
-
-     1410, 1410,  519,  464,  520,  464,  464,  521, 1410,  522,
-      523, 1410, 1410,  468,  465, 1410, 1410, 1410, 1410, 1410,
-      467, 1410, 1410,  467, 1410, 1410,  465,  466, 1410, 1410,
-     1410, 1410, 1410, 1410, 1172, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410,  469,  470,  471, 1410, 1410,  465,
-     1410, 1410, 1410, 1410, 1410, 1410,  465, 1410, 1410, 1410,
-     1410, 1410,  466, 1410,  485, 1173, 1174, 1175, 1410, 1410,
-     1410, 1410, 1410,  467, 1104, 1410,  574,  575,  576,  465,
-     1410, 1410,  577, 1410, 1410, 1105, 1106,  578, 1410,  579,
-      580, 1410,  466, 1107, 1108, 1109, 1110, 1111, 1410, 1112,
-
-     1113, 1410, 1410, 1114, 1115, 1116, 1117, 1118,  467, 1410,
-      829,  830,  544, 1410, 1119, 1410, 1410, 1410, 1410, 1120,
-     1121, 1410,  545,  468, 1410, 1410,  468, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  467,  546,
-     1410,  547, 1410, 1410, 1410, 1410, 1410, 1410,  548,  549,
-     1410, 1410, 1410, 1410,  469,  470,  471,  469,  470,  471,
-     1410,  550, 1410,  551,  557, 1410,  552,  553, 1410,  558,
-      559, 1410,  560, 1410, 1410, 1410,  468, 1410,  561, 1410,
-      562,  563,  564, 1410,  565, 1410,  566, 1410,  567, 1410,
-     1410, 1410,  568, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1410,  485,  485,  485,  485,  485,  485,  469,  470,  471,
-     1410,  468, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
-     1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
-     1123, 1123, 1123, 1123, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  468,  469,  470,  471, 1122, 1122, 1122, 1122, 1122,
-     1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
-     1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1410,
-     1410, 1410,  469,  470,  471, 1410, 1410, 1122, 1122, 1122,
-     1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
-     1122, 1122, 1122, 1122, 1122, 1122, 1122, 1410, 1122, 1122,
-
-     1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
-     1122, 1410, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
-     1122, 1122, 1122, 1122, 1123, 1123, 1123, 1123, 1123, 1123,
-     1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
-     1410, 1410, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
-     1123, 1123, 1123, 1123, 1122, 1122, 1123, 1123, 1123, 1123,
-     1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
-     1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
-     1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
-     1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
-
-     1123, 1123, 1123, 1410, 1123, 1123, 1123, 1123, 1123, 1123,
-     1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
-     1123, 1123, 1123, 1410, 1410, 1410, 1410, 1123, 1123, 1123,
-     1123, 1123, 1123, 1123, 1123, 1123, 1123, 1410,  465, 1123,
-     1123, 1123, 1123, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
-     1124, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  465, 1410, 1410, 1410, 1410, 1410, 1124, 1410, 1410,
-     1410, 1410, 1410, 1410,  466, 1410, 1410, 1410, 1410, 1410,
-     1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
-     1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
-
-     1410, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
-     1124, 1124, 1124, 1124, 1124, 1410, 1124, 1410, 1410,  465,
-      467, 1124, 1410, 1124, 1124, 1139, 1140, 1141, 1410, 1142,
-     1410, 1143, 1144, 1410, 1145, 1410, 1410, 1410, 1410, 1410,
-     1410, 1146,  465, 1147, 1410, 1410, 1410, 1148, 1410, 1149,
-     1150, 1410, 1151, 1410, 1410,  466, 1152,  554, 1410,  555,
-      556, 1153, 1410, 1154, 1155, 1156, 1157,  465, 1410, 1410,
-      465, 1410, 1410, 1158, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1159, 1410, 1410, 1410, 1160, 1410, 1410,
-      465,  485,  485,  465, 1410, 1410,  485,  485,  485,  485,
-
-      485,  467,  485,  486,  485,  485,  466, 1410, 1410,  465,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  485, 1410, 1410,
-     1410,  485, 1410,  468, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  465, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410,  465,  466, 1410, 1410, 1410,  487,
-      485,  485,  467,  485,  469,  470,  471, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  465, 1410, 1410,
-      480,  485,  465, 1410, 1410, 1410, 1410,  485, 1410,  465,
-      466,  485, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  467,  485,  485, 1410,  465, 1410,  485,  485,  485,
-
-     1410,  485,  465, 1410,  468, 1410, 1410,  445,  466, 1410,
-     1410, 1410, 1410, 1410, 1410,  466, 1410,  465, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410,  467, 1410,  485, 1410,
-      445,  485, 1410,  465,  485,  469,  470,  471, 1410, 1410,
-      465, 1410, 1410,  433, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  485,  488,  466,  467,  468,  465, 1410, 1410, 1410,
-     1410,  467, 1410,  489,  490, 1410, 1410, 1410, 1410,  466,
-     1410,  491,  492,  493,  494,  495, 1410,  496,  497,  485,
-      485,  498,  499,  500,  501,  502,  469,  470,  471,  434,
-     1410, 1410,  503, 1410,  468, 1410,  465,  504,  505,  467,
-
-      485,  485, 1410,  485,  485,  485,  485,  485,  485, 1410,
-     1410, 1410, 1410, 1410, 1410,  467, 1410, 1410,  485,  465,
-      485,  485,  485, 1410, 1410,  469,  470,  471, 1410,  468,
-     1410, 1410,  466, 1410, 1410, 1410,  485,  485,  485,  485,
-      485,  485,  485,  485,  485,  485,  485,  485,  485,  485,
-      569, 1410, 1177, 1410,  570,  571, 1410,  468,  572,  573,
-      469,  470,  471, 1410,  468, 1410, 1410, 1410,  574,  575,
-      576,  465, 1410, 1410,  577,  445, 1410, 1410,  467,  578,
-      445,  579,  580, 1410, 1410, 1410, 1410, 1410,  469,  470,
-      471, 1410,  446, 1410,  465,  469,  470,  471,  445, 1410,
-
-     1410, 1410,  468,  445, 1410,  465, 1410,  466, 1410, 1410,
-     1410,  433, 1410, 1410, 1410, 1410,  433, 1410,  468, 1410,
-     1410, 1410, 1410,  447,  448,  449, 1410, 1410,  465, 1410,
-     1410, 1410, 1410,  469,  470,  471, 1410, 1410, 1410, 1410,
-     1410,  466, 1410, 1410, 1410, 1410, 1410,  511,  512,  469,
-      470,  471,  513,  467,  514, 1410,  515,  434,  516, 1410,
-      965, 1410,  434,  445,  517,  518, 1410, 1410, 1410,  445,
-      519, 1410,  520, 1410, 1410,  521, 1410,  522,  523, 1410,
-     1410,  468, 1410,  965, 1410, 1410,  445,  467, 1410, 1410,
-     1410,  524,  445,  525, 1178, 1179,  774,  465, 1410,  433,
-
-     1410, 1410, 1410,  526, 1410,  774,  527, 1410, 1410, 1410,
-     1410, 1410,  469,  470,  471,  528,  529,  530,  531, 1410,
-      465,  532,  533,  465,  542,  543,  544,  534, 1410, 1410,
-      535, 1176,  536,  466, 1410,  537,  545,  538,  539,  540,
-     1410,  541,  775, 1410, 1410,  434,  465, 1410,  445, 1410,
-     1410,  775, 1410,  546, 1410,  547,  468, 1410, 1410,  466,
-      446, 1410,  548,  549, 1410,  446, 1410, 1410, 1410, 1410,
-     1410,  445, 1410, 1410, 1410,  550, 1410,  551,  625,  467,
-      552,  553, 1180,  445,  774, 1410, 1410,  469,  470,  471,
-      468,  447,  448,  449, 1410, 1410,  447,  448,  449, 1410,
-
-     1410,  625,  485,  485, 1410,  467,  445,  485,  485,  485,
-      485,  485, 1410,  485,  486,  485,  485, 1410, 1410,  774,
-     1191,  469,  470,  471, 1410, 1410, 1410, 1410,  485, 1410,
-      775, 1410,  485, 1410, 1410,  557, 1410, 1410, 1410, 1410,
-      558,  559,  947,  560, 1410, 1186, 1410, 1410,  446,  561,
-     1410,  562,  563,  564,  776,  565, 1410,  566, 1410,  567,
-      487,  485,  485,  568,  485,  775, 1410, 1410, 1410,  485,
-      485, 1410, 1410, 1410, 1410, 1410, 1187, 1188, 1189,  447,
-      448,  449,  468, 1410, 1410,  777,  778,  779,  445, 1410,
-     1410, 1410, 1410, 1192, 1410,  465, 1410, 1410,  965, 1410,
-
-     1410, 1410, 1193, 1194, 1410, 1410, 1410, 1410,  468, 1181,
-     1410,  445, 1410,  469,  470,  471, 1410, 1410,  465, 1410,
-     1410,  965, 1410, 1410,  774, 1410, 1410, 1410, 1410, 1410,
-     1410,  466, 1181,  776,  774, 1410, 1410, 1410, 1410,  469,
-      470,  471, 1410, 1410, 1410,  433, 1410, 1410,  958,  958,
-      958,  958,  958,  958,  958,  958,  958,  958, 1410, 1410,
-     1410, 1410, 1410,  626,  777,  778,  779, 1410,  776, 1410,
-      775, 1410, 1410, 1410,  489,  490, 1410,  467, 1410, 1410,
-      775, 1410,  491,  492,  493,  494,  495, 1410,  496,  497,
-     1410,  434,  498,  499,  627,  628,  629, 1410, 1410,  777,
-
-      778,  779, 1410,  503, 1410, 1410, 1410, 1195,  504,  505,
-      465, 1410, 1410, 1410,  947,  632,  632,  632, 1410, 1410,
-     1410, 1410,  632,  632,  632,  632,  632,  632,  632,  632,
-      632,  632, 1410,  465,  632,  632,  632,  632,  633,  633,
-      633,  633,  633,  633,  633,  633,  466, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  633, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  776, 1410,  633, 1410, 1410, 1410, 1410,
-      468, 1410, 1410, 1186,  445, 1410, 1410,  445, 1410, 1410,
-     1410, 1410,  467, 1410, 1182, 1410, 1410, 1410, 1410, 1410,
-
-     1410, 1410, 1410, 1410,  777,  778,  779,  445, 1410, 1410,
-      445,  469,  470,  471, 1187, 1188, 1189, 1410, 1410, 1410,
-      433, 1410, 1410,  433, 1410, 1183, 1184, 1185, 1410,  631,
-      631,  631,  631, 1410,  631,  631,  631,  631,  631,  631,
-      631,  631,  631,  631,  631,  631,  631,  465,  631,  631,
-      631,  631,  631,  631,  631,  631,  631,  631,  631,  631,
-      947, 1410, 1410,  965, 1410, 1410,  434, 1410, 1410,  434,
-      465,  485,  485, 1410, 1410, 1410,  485,  485,  485,  485,
-      485, 1410,  485,  486,  485,  485,  965, 1410, 1410,  445,
-      631,  631, 1410, 1410, 1410,  468, 1410,  485,  445,  774,
-
-     1410,  485, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
-     1190, 1190,  445, 1201, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  445, 1410, 1410, 1410,  433,  469,  470,  471,  487,
-      485,  485, 1197,  485,  433, 1196, 1201, 1410, 1410,  445,
-     1410, 1410,  683, 1410, 1410,  775, 1410, 1410, 1410,  433,
-     1410, 1410,  970,  970,  970,  970,  970,  970,  970,  970,
-      970,  970,  445, 1410, 1410,  683, 1410, 1410, 1410,  446,
-     1410,  434,  446, 1410, 1410,  433, 1410, 1410,  433, 1410,
-      434,  684,  685,  685,  685,  685,  685,  685,  685,  685,
-      685,  445, 1410, 1410, 1410,  434, 1410, 1410, 1410, 1410,
-
-      447,  448,  449,  447,  448,  449,  445, 1410, 1198, 1199,
-      445, 1410, 1410,  445,  445, 1410, 1410, 1200, 1410, 1410,
-     1410,  434, 1410, 1410,  434, 1410, 1410,  433, 1410,  445,
-     1410, 1410,  488,  445, 1410, 1410,  445, 1410, 1410, 1410,
-     1410, 1410,  433,  489,  490, 1410,  433, 1410, 1186,  433,
-     1410,  491,  492,  493,  494,  495, 1410,  496,  497, 1410,
-     1410,  498,  499,  500,  501,  502, 1410,  445, 1410, 1410,
-     1410, 1410,  503,  434,  446, 1410, 1410,  504,  505, 1187,
-     1188, 1189, 1410,  446, 1410,  445, 1410, 1410,  434,  971,
-      445, 1410,  434, 1410, 1410,  434, 1410, 1410, 1202, 1410,
-
-     1410, 1410, 1410,  433, 1410,  447,  448,  449,  445, 1410,
-      971, 1410, 1410, 1410,  447,  448,  449, 1410, 1410, 1410,
-     1410,  433, 1410, 1410,  446,  971, 1410,  686,  445, 1203,
-     1204, 1205,  971,  971,  971,  971,  971,  971,  971,  971,
-      971,  971,  971, 1410, 1410, 1410, 1410, 1410, 1410,  434,
-      445,  445, 1410, 1410,  445,  447,  448,  449,  687,  688,
-      689, 1206, 1410, 1410,  433, 1410, 1410,  434, 1410, 1410,
-     1410, 1410, 1410,  445, 1410, 1410,  446,  445,  445,  971,
-     1410, 1410, 1410, 1410, 1410, 1410,  433, 1410, 1410, 1410,
-      433,  446, 1410, 1410, 1410,  446, 1410,  445,  446, 1410,
-
-     1410,  445, 1410, 1410, 1208, 1209, 1410,  447,  448,  449,
-      434, 1410, 1207, 1410,  433, 1410, 1410,  695, 1410, 1410,
-      445, 1410,  447,  448,  449, 1410,  447,  448,  449,  447,
-      448,  449,  434,  433, 1410,  183,  434, 1410,  183, 1410,
-      695,  183, 1410, 1410, 1410, 1410, 1410, 1210, 1410, 1410,
-     1410, 1410,  446,  184, 1410, 1410, 1410, 1410,  183, 1410,
-      434,  183, 1410, 1410,  183, 1410, 1410, 1410, 1410, 1410,
-      446,  184, 1410, 1410,  184, 1410, 1410,  184, 1410,  434,
-     1410, 1410, 1410,  447,  448,  449, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1212, 1410, 1213, 1214,  185,
-
-     1410,  447,  448,  449,  183, 1211, 1410,  705, 1410, 1410,
-     1410,  183, 1410,  446, 1410, 1410, 1215,  185, 1410,  183,
-      185, 1410, 1410,  185, 1410, 1410, 1410,  183, 1410, 1410,
-      705, 1410, 1410, 1410,  183,  446, 1410, 1410, 1410,  446,
-      184, 1410,  183,  184,  447,  448,  449,  184, 1410, 1410,
-     1410, 1410, 1410, 1410,  984,  184, 1410, 1410, 1410, 1410,
-      984, 1410, 1410,  446, 1410, 1410,  447,  448,  449, 1410,
-      447,  448,  449, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  446,  183, 1410, 1410,  185, 1410,  984,  185,
-     1410, 1410, 1410,  185,  447,  448,  449, 1410, 1410, 1410,
-
-     1410,  185,  696, 1410, 1410, 1410,  183, 1410, 1410, 1410,
-     1410, 1410, 1410,  447,  448,  449, 1410, 1410, 1410,  184,
-      186, 1410, 1410,  186, 1410, 1410,  186,  989, 1410, 1410,
-     1410, 1410, 1410,  697,  698,  699, 1410, 1410,  984,  984,
-      984,  984,  984,  984,  984,  984,  984,  984,  984, 1221,
-      989,  187,  188,  189,  187,  188,  189,  187,  188,  189,
-     1410,  183, 1220,  433,  445,  185,  958,  958,  958,  958,
-      958,  958,  958,  958,  958,  958, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410,  183,  984, 1410,  445, 1410,  186,
-      445, 1410,  706, 1410, 1410, 1410,  186,  184, 1410, 1410,
-
-      433, 1410, 1222, 1223,  186, 1410, 1410, 1410,  328,  434,
-     1410, 1410, 1410,  445, 1410, 1410, 1410, 1410, 1410, 1410,
-      187,  188,  189,  707,  708,  709,  433,  187,  188,  189,
-     1410,  328, 1410, 1410,  445,  187,  188,  189, 1410, 1410,
-     1410, 1410,  445,  185,  433, 1410,  434,  684,  685,  685,
-      685,  685,  685,  685,  685,  685,  685,  445, 1410,  445,
-     1410, 1410, 1410, 1410, 1410,  445, 1410, 1410,  186,  445,
-      433, 1410,  434, 1410, 1410, 1410, 1410, 1410,  433, 1410,
-     1224, 1410,  445,  994,  445, 1410, 1410,  183, 1410, 1410,
-      434, 1410,  445, 1410,  445,  433, 1410, 1410, 1410,  187,
-
-      188,  189, 1410,  183, 1410,  433, 1410,  445, 1410, 1410,
-      183, 1410, 1216, 1410,  183, 1410,  434,  445, 1410, 1410,
-      433, 1410, 1410,  184,  434, 1410,  183, 1410, 1410,  183,
-      433, 1410, 1410, 1410, 1410, 1410, 1410,  183, 1410,  184,
-      994,  434, 1410, 1217, 1218, 1219,  186, 1410,  183,  446,
-      184,  434,  183,  994,  994,  994,  994,  994,  994,  994,
-      994,  994,  994,  994, 1410,  184,  434, 1410, 1410,  185,
-     1410,  183, 1410, 1410, 1410,  446,  434,  187,  188,  189,
-      447,  448,  449, 1410,  184,  185, 1410, 1226,  994, 1410,
-     1410, 1410,  183,  701, 1410, 1410,  185, 1410, 1410, 1410,
-
-      994, 1410, 1410, 1227, 1228, 1410,  447,  448,  449, 1410,
-     1225,  185, 1410, 1229, 1410,  183, 1410, 1410, 1410,  446,
-     1410, 1410, 1003, 1410,  702,  703,  704,  446,  184, 1410,
-      185, 1410, 1235, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
-     1003, 1003, 1003, 1003,  446,  716, 1410, 1410, 1003, 1410,
-      447,  448,  449, 1410,  446,  183, 1410, 1410,  447,  448,
-      449, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  716,  446,
-     1410, 1410,  186, 1410,  185,  447,  448,  449,  183,  446,
-     1003,  184,  341,  342, 1410,  447,  448,  449,  186, 1410,
-     1410,  184, 1410, 1410, 1410, 1410, 1410, 1410, 1003,  186,
-
-      447,  448,  449,  187,  188,  189,  183, 1410, 1410, 1410,
-      447,  448,  449, 1008,  186, 1410, 1410, 1410, 1410,  187,
-      188,  189, 1410, 1410, 1410, 1410, 1410,  185, 1410,  183,
-      187,  188,  189,  186, 1410, 1410, 1008,  185, 1410, 1410,
-      183, 1410,  184, 1234, 1410,  187,  188,  189, 1410,  433,
-     1410, 1410,  970,  970,  970,  970,  970,  970,  970,  970,
-      970,  970,  183,  183,  187,  188,  189,  183, 1410, 1410,
-     1410, 1410, 1410, 1410, 1236, 1237,  184,  186, 1410, 1410,
-     1410, 1410,  183, 1410, 1410,  183, 1410, 1410,  185, 1410,
-      183, 1410, 1410, 1410, 1410,  434, 1410, 1410,  184, 1410,
-
-     1410,  445, 1410,  184, 1410,  183,  445, 1410,  187,  188,
-      189,  445, 1410, 1410, 1410, 1410, 1410, 1410,  184, 1410,
-     1410, 1410,  185, 1410,  445, 1238, 1410, 1410, 1410,  445,
-      717, 1410, 1410, 1410,  445, 1410, 1410,  433, 1410, 1410,
-      186, 1410,  433, 1410,  185,  445, 1410,  433, 1410,  185,
-     1410,  445, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1013,
-     1410,  718,  719,  720,  185, 1410, 1410, 1410,  445, 1410,
-     1410,  187,  188,  189,  445, 1410, 1410, 1410, 1410, 1410,
-     1410,  433, 1410,  434, 1410, 1410, 1013,  433,  434, 1410,
-     1410,  186, 1410,  434, 1410, 1410, 1410, 1410, 1230, 1410,
-
-     1410, 1013, 1013, 1013, 1013, 1013, 1013, 1013, 1013, 1013,
-     1013, 1013, 1013,  445, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  187,  188,  189,  186, 1410,  434, 1410, 1231,
-     1232, 1233, 1410,  434, 1410, 1410,  445, 1410,  445, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1247,  186, 1013,  433,
-     1410, 1410,  186, 1410, 1410, 1410,  187,  188,  189, 1410,
-     1410,  445, 1246, 1410, 1250, 1018, 1410,  186, 1410, 1410,
-     1248, 1249, 1410, 1410,  433, 1410, 1410, 1410,  187,  188,
-      189, 1410, 1410,  187,  188,  189,  446, 1410, 1018, 1410,
-     1410,  446, 1410, 1410, 1410,  434,  446, 1410,  187,  188,
-
-      189,  774, 1239, 1240, 1241, 1241, 1241, 1241, 1241, 1241,
-     1241, 1241, 1241, 1241,  445, 1410, 1410,  447,  448,  449,
-      434, 1410,  447,  448,  449, 1410, 1410,  447,  448,  449,
-      446, 1410, 1023, 1410,  340, 1410,  446,  445, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  775, 1410, 1410,
-      433, 1410, 1410, 1410, 1410, 1410, 1410,  340, 1410, 1410,
-     1410,  447,  448,  449, 1410, 1410, 1410,  447,  448,  449,
-      433,  721,  722,  723,  723,  723,  723,  723,  723,  723,
-      723,  723,  723,  445, 1410, 1410, 1410, 1410, 1023, 1029,
-     1410, 1410, 1410, 1030, 1410, 1410,  434, 1410,  446, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410,  445, 1410, 1410, 1410,
-     1410, 1410, 1029, 1410, 1410, 1030,  434, 1030, 1410,  433,
-     1410, 1410, 1410,  446, 1410, 1031, 1410, 1410, 1410,  447,
-      448,  449, 1410, 1023, 1023, 1023, 1023, 1023, 1023, 1023,
-     1023, 1023, 1023, 1023, 1030, 1410, 1410, 1410, 1410, 1410,
-     1242, 1410, 1410, 1410,  447,  448,  449, 1410, 1410, 1410,
-     1410, 1410, 1029, 1410, 1410,  434, 1030, 1410, 1410, 1410,
-     1410, 1032, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1023, 1243, 1244, 1245, 1410, 1029, 1410, 1410, 1030, 1410,
-     1030, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1044,  446,
-
-     1029, 1410, 1023, 1030, 1030, 1030, 1030, 1410, 1410, 1410,
-     1410, 1029, 1410, 1410, 1410, 1030, 1410, 1030, 1410,  724,
-     1029, 1410, 1410, 1029, 1030, 1410, 1030, 1410, 1030, 1410,
-      447,  448,  449, 1410, 1029, 1410, 1031, 1030, 1410, 1030,
-     1410, 1029, 1410, 1029, 1045, 1030, 1030, 1031, 1030, 1410,
-      725,  726,  727, 1410, 1410, 1030, 1031, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1029, 1410, 1030, 1030,  446, 1030,
-     1410, 1410, 1410, 1410, 1033, 1030, 1030, 1031, 1030, 1030,
-     1410, 1410, 1032, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1032, 1410, 1410, 1030, 1410, 1410,  447,
-
-      448,  449, 1032, 1410, 1410, 1034, 1035, 1036, 1410, 1410,
-     1410, 1410, 1410, 1410, 1030, 1410, 1030, 1030, 1037,  350,
-     1410, 1410,  350, 1032, 1410, 1030, 1410, 1030, 1030, 1410,
-     1410, 1410, 1410, 1410, 1030, 1410, 1030, 1030, 1410, 1258,
-     1259, 1037, 1410, 1410,  350, 1410,  350, 1251, 1037,  350,
-     1410, 1256,  350, 1410, 1262, 1030, 1257, 1030, 1030, 1410,
-     1260, 1410, 1410, 1410, 1410, 1037,  350, 1263, 1410,  350,
-     1410, 1037, 1410,  350,  350, 1410,  350, 1410, 1252, 1253,
-     1254, 1410, 1410, 1410,  735, 1033, 1410, 1410, 1037, 1410,
-     1410,  350, 1410,  350, 1410, 1410, 1033,  736, 1410, 1410,
-
-     1264,  735, 1410,  350, 1410, 1033, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410,  736, 1410, 1034, 1035, 1036, 1410,
-      350, 1410, 1410, 1410, 1410, 1410, 1033, 1034, 1035, 1036,
-      737, 1410,  350, 1410,  350,  350, 1034, 1035, 1036, 1410,
-     1037,  350, 1410, 1410,  350, 1410, 1410,  737, 1410,  445,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1034, 1035, 1036,
-     1410, 1410,  350, 1037,  350,  350,  350, 1410,  350, 1410,
-     1037,  350,  445, 1410,  350, 1410,  735, 1410, 1410,  350,
-     1410,  350,  350, 1410, 1410,  433, 1410, 1410, 1043,  736,
-     1410, 1410, 1030, 1037, 1410,  350,  350, 1410,  350, 1269,
-
-     1410, 1410, 1410, 1265, 1410, 1410,  735, 1410, 1410, 1410,
-     1270, 1043, 1410, 1410, 1030, 1410, 1030, 1410, 1410,  736,
-     1410, 1410,  737, 1410, 1044,  350, 1410, 1410, 1410, 1410,
-     1410,  434, 1410, 1038, 1266, 1267, 1268, 1410, 1410, 1410,
-     1410, 1410, 1410, 1030, 1410, 1410, 1410, 1410, 1410, 1410,
-     1038, 1410,  737, 1410,  350, 1410,  350,  350, 1410, 1271,
-     1272, 1410,  445, 1410, 1039, 1040, 1041, 1043, 1410, 1410,
-     1045, 1030, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1039, 1040, 1041,  350,  445,  350,  350, 1410, 1273,
-     1043, 1410, 1410, 1030, 1410, 1030, 1410, 1410,  433, 1410,
-
-      780, 1410, 1030, 1275, 1030, 1030, 1410, 1043, 1410, 1410,
-     1410, 1030, 1410, 1410, 1043, 1410, 1410, 1410, 1030, 1410,
-     1410, 1410, 1030, 1410, 1410, 1038, 1410, 1410, 1410, 1410,
-     1043, 1410, 1410, 1030,  446, 1030, 1410, 1043, 1410, 1410,
-     1030, 1410, 1030, 1044,  434, 1410, 1410, 1410, 1410, 1276,
-     1044, 1410, 1410, 1410, 1410, 1038, 1039, 1040, 1041, 1410,
-     1410, 1410, 1030, 1410, 1410,  447,  448,  449, 1410, 1030,
-     1410, 1410, 1410, 1046, 1043, 1410, 1410, 1410, 1030, 1410,
-     1410, 1030, 1410, 1030, 1030, 1410, 1039, 1040, 1041, 1045,
-     1043, 1410, 1410, 1410, 1030, 1410, 1045, 1043, 1410,  445,
-
-     1030, 1410, 1030, 1410, 1047, 1048, 1049,  781, 1410, 1410,
-     1044, 1410, 1410, 1043, 1410, 1410, 1030, 1410, 1030, 1410,
-     1410, 1030,  445, 1030, 1030, 1410, 1044, 1410, 1030, 1030,
-     1030, 1030, 1410, 1410, 1410,  433, 1410, 1410, 1410, 1410,
-     1269,  734, 1410, 1410,  734, 1030, 1410,  446, 1410, 1410,
-     1410, 1410, 1277, 1410, 1410, 1410, 1045, 1410, 1282, 1283,
-     1410, 1410, 1410, 1269,  445, 1410,  734, 1410,  734, 1410,
-     1410, 1410, 1045, 1410, 1410, 1410,  735, 1410,  447,  448,
-      449,  434, 1410, 1278, 1279, 1280, 1410,  445, 1030, 1288,
-     1030, 1030, 1046, 1284, 1285,  734, 1410, 1410, 1410, 1046,
-
-      433, 1410, 1410,  445, 1030, 1410, 1030, 1030, 1410, 1286,
-     1410, 1410,  349,  350, 1410, 1410,  350, 1410,  782,  783,
-     1410, 1410, 1050, 1047, 1048, 1049,  445, 1410, 1410, 1410,
-     1047, 1048, 1049, 1410, 1410,  349, 1410, 1410,  350,  774,
-      350, 1410, 1410, 1410, 1410, 1410,  434, 1410,  735, 1410,
-     1410, 1410, 1410, 1410,  734, 1410,  734,  734, 1410, 1046,
-     1410,  736, 1410, 1410, 1410, 1410, 1410,  350, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1046, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  784,  446,  775, 1410, 1410, 1410, 1410,
-     1047, 1048, 1049, 1410,  737, 1037,  350, 1410, 1410,  350,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1047, 1048, 1049, 1410,
-     1410, 1410, 1410, 1410, 1410,  447,  448,  449, 1037, 1410,
-     1410,  350, 1410,  350, 1410, 1289,  350, 1410,  350,  350,
-     1410,  735, 1410, 1410, 1410, 1410, 1037,  350, 1410, 1410,
-      350, 1410, 1410, 1410,  736, 1410, 1410, 1410, 1410,  446,
-      350, 1410, 1410,  445, 1410, 1410, 1290, 1291, 1292, 1037,
-      465, 1410,  350,  465,  350, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  735, 1410, 1410, 1410,  445,  737, 1410, 1410,
-      447,  448,  449,  465, 1410,  736,  465, 1410,  776,  774,
-     1410,  350, 1410, 1410, 1410, 1410,  793,  738, 1410,  466,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  350,
-     1410,  350,  350, 1410, 1051,  445, 1410, 1410,  737,  777,
-      778,  779, 1410, 1410, 1410, 1410, 1410, 1410,  739,  740,
-      741, 1410, 1410, 1410, 1410,  775, 1410, 1410,  445, 1410,
-     1410, 1410,  794, 1037,  350,  467, 1410,  350, 1410, 1410,
-      350,  774,  350,  350, 1410, 1051, 1051, 1051, 1051, 1051,
-     1051, 1051, 1051, 1051, 1051, 1051, 1037, 1410, 1410,  350,
-     1410,  350, 1068, 1037,  350, 1410, 1410,  350, 1410,  735,
-     1038, 1410,  349,  350, 1410, 1410,  350, 1410, 1410, 1410,
-     1410, 1029,  736, 1410, 1410, 1030, 1037,  775,  350,  350,
-
-     1410,  350, 1051, 1410, 1410,  349, 1410, 1410,  350,  735,
-      350, 1039, 1040, 1041, 1029, 1410, 1410, 1030,  351, 1030,
-     1410, 1038,  736, 1410, 1410,  737, 1410, 1031,  350, 1410,
-     1410,  733, 1410, 1410, 1068, 1410, 1410,  350,  776,  349,
-      350, 1410, 1410,  350, 1410,  795, 1030, 1410,  468, 1410,
-     1410, 1410, 1039, 1040, 1041,  737, 1410,  350, 1410,  350,
-      350, 1410,  349, 1410,  352,  350, 1410,  350, 1410,  777,
-      778,  779, 1410, 1032, 1410,  351,  796,  797,  798,  469,
-      470,  471, 1410, 1410, 1410, 1410, 1410,  350,  733,  350,
-      350, 1410, 1051, 1051,  350, 1410,  350, 1410,  350,  350,
-
-      776,  445, 1410, 1410, 1410, 1030, 1410, 1030, 1030, 1410,
-     1410, 1410, 1410,  349,  350, 1410, 1410,  350, 1410, 1410,
-     1410,  352, 1410, 1410,  445, 1410, 1410, 1410, 1038, 1410,
-     1410,  777,  778,  779, 1410, 1410,  349,  774, 1410,  350,
-     1410,  350, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  351,
-      465, 1410, 1410,  350, 1410,  350,  350, 1410, 1038, 1039,
-     1040, 1041,  733, 1410, 1410, 1410, 1410,  353,  350, 1410,
-     1410, 1410, 1410,  465, 1410, 1410, 1033, 1410, 1068,  773,
-     1410, 1410,  773,  775,  745, 1410,  793, 1410, 1410, 1039,
-     1040, 1041,  349,  350, 1410,  352,  350, 1410,  354,  355,
-
-      356, 1068,  465, 1410,  773, 1410,  773, 1034, 1035, 1036,
-     1410, 1410, 1410, 1410,  774,  349, 1410, 1410,  350, 1410,
-      350, 1410,  349,  350,  353,  465,  350,  350,  351,  350,
-      350,  445,  794,  773, 1410, 1410, 1410, 1410,  793, 1410,
-      465,  733, 1410, 1410, 1410,  349, 1410,  350,  350, 1410,
-      350, 1068, 1410, 1410,  445,  354,  355,  356,  351, 1410,
-     1067, 1410, 1410,  465,  744, 1074,  792,  774, 1410,  792,
-     1410,  733, 1410, 1410,  352, 1410,  466,  350, 1410, 1410,
-     1410, 1410, 1410, 1410,  794, 1410,  776,  465, 1074, 1410,
-     1410,  792,  773,  792,  773,  773, 1410, 1410,  353, 1410,
-
-     1074,  793, 1410, 1410,  352, 1410,  350, 1410,  350,  350,
-      465,  746,  747,  775, 1410, 1410, 1410,  777,  778,  779,
-      792, 1074,  467,  793, 1410, 1410, 1410, 1410, 1410,  354,
-      355,  356, 1410, 1410, 1410,  795,  350, 1410,  350,  350,
-     1410,  748,  465, 1410, 1410, 1410, 1410, 1073,  465, 1410,
-     1068, 1068, 1068, 1068, 1068, 1068, 1068, 1068, 1068, 1068,
-     1068, 1410, 1410, 1294, 1410,  465,  796,  797,  798,  794,
-     1410,  465, 1410, 1410, 1410, 1410, 1410,  353,  793,  792,
-     1410,  792,  792, 1410,  466, 1410, 1410,  795, 1410, 1410,
-     1410,  800,  465, 1410, 1295, 1296, 1297, 1068,  465, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1074,  353,  354,  355,
-      356, 1410, 1410, 1410, 1410,  465,  776, 1410,  796,  797,
-      798,  465, 1410, 1410,  794,  468, 1410, 1410,  466, 1410,
-      467, 1410, 1410, 1410,  466, 1410, 1410,  465,  354,  355,
-      356, 1410, 1410, 1410, 1410, 1410, 1410,  777,  778,  779,
-     1299, 1410,  465, 1410, 1410,  465,  469,  470,  471, 1410,
-      465, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074,
-     1074, 1074,  795,  793,  467,  465, 1410, 1410,  465,  465,
-      467, 1300, 1301, 1302, 1410, 1410, 1410, 1410,  793, 1410,
-      465,  793, 1410,  801, 1410, 1410, 1410, 1410, 1410,  465,
-
-     1410, 1410,  465,  796,  797,  798,  465, 1410, 1074, 1410,
-     1410,  802,  803,  465, 1410,  793, 1410,  804, 1410,  794,
-     1410, 1410,  465, 1410, 1410, 1410,  793,  795, 1410,  465,
-     1410, 1410, 1410,  468,  794,  793, 1410,  794, 1410, 1410,
-     1410, 1410,  793, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  465, 1410, 1410, 1410, 1410, 1410,  465,  796,  797,
-      798,  794, 1410, 1410,  469,  470,  471, 1410,  465, 1410,
-     1410, 1410,  794, 1410,  465, 1410, 1410,  468, 1410, 1410,
-      465,  794, 1410,  468, 1410, 1410, 1410,  793,  794, 1410,
-     1410,  465, 1410,  793, 1410, 1410,  805, 1410, 1093, 1094,
-
-     1092, 1410, 1410, 1091,  793, 1410,  465, 1410,  469,  470,
-      471,  465, 1410, 1410,  469,  470,  471, 1410, 1095,  805,
-     1410,  465,  795, 1410, 1410, 1091, 1410, 1410, 1410,  465,
-     1410, 1410,  793,  794,  465, 1410, 1410,  795, 1410,  794,
-      795, 1410,  793, 1410,  465, 1410, 1410,  793, 1410, 1410,
-      794, 1410, 1410,  796,  797,  798, 1410,  793, 1410, 1410,
-     1410, 1410,  465, 1410,  795, 1410, 1410, 1410,  796,  797,
-      798,  796,  797,  798, 1410,  795, 1091,  465,  794, 1410,
-     1410, 1410,  465, 1410,  795,  465, 1410, 1410,  794, 1410,
-     1410,  795, 1410,  794, 1410,  796,  797,  798,  466, 1410,
-
-      465, 1091, 1410,  794, 1410,  465,  796,  797,  798, 1410,
-     1410, 1410, 1410,  466, 1410,  796,  797,  798,  793, 1410,
-     1410, 1410,  796,  797,  798, 1091, 1091, 1091, 1091, 1091,
-     1091, 1091, 1091, 1091, 1091, 1091,  795, 1410, 1410, 1410,
-     1410, 1410,  795, 1410,  467, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  795, 1091,  792, 1410, 1410,  792,  467,
-     1410, 1410, 1091, 1410,  794, 1410, 1092,  796,  797,  798,
-     1410,  465, 1091,  796,  797,  798, 1410, 1091, 1410, 1410,
-      792,  806,  792, 1410,  796,  797,  798, 1410,  485, 1410,
-      793,  795, 1410, 1410,  465,  465,  795, 1410, 1410, 1410,
-
-     1410, 1093, 1094, 1410, 1410, 1410,  795,  793, 1410,  792,
-     1410, 1410,  807,  808,  809, 1410, 1410, 1410,  465,  465,
-     1410, 1410,  796,  797,  798, 1410, 1410,  796,  797,  798,
-     1410,  466, 1410, 1410, 1410, 1410, 1073,  796,  797,  798,
-     1410, 1410,  465,  485,  485, 1410, 1410,  468,  485,  485,
-      485,  485,  485,  794,  485,  486,  485,  485,  485, 1410,
-      465, 1410,  468, 1410, 1410, 1410, 1410,  795,  792,  485,
-      792,  792, 1410,  485, 1410, 1410, 1410,  467,  469,  470,
-      471, 1410, 1410,  465, 1410, 1410, 1410, 1410, 1410, 1410,
-     1095, 1410, 1410,  469,  470,  471,  466,  465,  796,  797,
-
-      798,  487,  485,  485,  465,  485, 1410, 1410, 1410,  465,
-     1410, 1410,  465, 1410, 1410, 1410, 1410, 1410,  445, 1410,
-      465, 1410, 1410, 1410, 1410, 1410, 1410,  465, 1410, 1410,
-     1410, 1410,  465,  466, 1410,  465, 1410, 1410,  465, 1304,
-      466,  445,  467, 1410, 1410,  466,  800,  485,  466, 1410,
-     1410, 1410, 1410,  485,  774, 1410,  795,  485, 1410, 1410,
-     1410,  465, 1410, 1410, 1410, 1410, 1410, 1410,  485,  485,
-     1305, 1306, 1307,  485,  466, 1410, 1410,  485, 1410,  467,
-      468, 1410, 1410, 1410, 1410, 1410,  467,  796,  797,  798,
-     1410,  467, 1410, 1410,  467, 1410, 1410, 1410, 1410, 1410,
-
-      775, 1410, 1410, 1410,  488,  485,  485,  485,  485,  485,
-      485,  469,  470,  471, 1410,  489,  490, 1410, 1410,  465,
-      467, 1410, 1410,  491,  492,  493,  494,  495, 1410,  496,
-      497, 1410, 1410,  498,  499,  500,  501,  502, 1410, 1410,
-      485,  485,  465, 1410,  503,  468, 1410, 1410,  485,  504,
-      505, 1410, 1410, 1410, 1410,  466,  465,  485, 1410, 1410,
-      485, 1410, 1410,  485,  465,  485,  485,  485,  485, 1309,
-     1410,  485,  485,  485, 1410, 1410,  469,  470,  471,  465,
-     1410, 1410,  468, 1410, 1410, 1410, 1410,  465, 1410,  468,
-     1410, 1410,  466,  485,  468, 1410, 1410,  468, 1410, 1410,
-
-      466,  467, 1410,  776, 1410, 1410, 1410, 1410,  485,  485,
-     1410, 1410, 1410,  469,  470,  471, 1410, 1410, 1410, 1410,
-      469,  470,  471,  468, 1410,  469,  470,  471,  469,  470,
-      471, 1410, 1410, 1410,  777,  778,  779, 1410,  467, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410,  467,  485,  485, 1410,
-      485,  485, 1410, 1410,  469,  470,  471, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  485,  465,  485,  485,  485,
-     1410,  465, 1410, 1410,  465,  485,  485,  485,  485,  485,
-      485,  485,  485,  485,  485,  485,  485,  485,  485,  465,
-     1410, 1410, 1410, 1410,  465,  465, 1410,  465, 1410, 1410,
-
-     1410, 1410,  466, 1410,  468, 1410, 1410,  466, 1410, 1410,
-      466, 1410, 1410, 1410, 1410,  511,  512, 1410,  465, 1410,
-      513, 1410,  514, 1410,  515, 1410,  516, 1410, 1410, 1410,
-     1410,  466,  517,  518, 1410,  469,  470,  471,  519, 1410,
-      520,  468, 1410,  521, 1410,  522,  523, 1410,  467,  468,
-     1410, 1410, 1410,  467, 1410, 1410,  467, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  465,  469,  470,  471, 1410, 1410,  467, 1410, 1410,
-      469,  470,  471, 1410, 1410, 1410,  524, 1410,  525, 1410,
-      829,  830,  544,  831,  465,  555,  556, 1410,  526, 1410,
-
-     1410,  527,  545, 1410, 1410, 1410, 1410,  466, 1410, 1410,
-      528,  828,  530,  531,  465, 1410,  532,  533, 1410,  546,
-     1410,  547,  534, 1410, 1410,  535, 1410,  536,  548,  549,
-      537, 1410,  538,  539,  540, 1410,  541,  465, 1410, 1410,
-      445,  550, 1410,  551, 1410, 1410,  552,  553, 1410, 1410,
-      466,  468, 1410,  467, 1410, 1410,  468, 1410,  953,  468,
-     1410, 1410, 1410,  445, 1410, 1410,  569, 1410, 1410, 1410,
-      570,  571, 1410, 1410,  572,  573,  774, 1410, 1410, 1410,
-      468,  953,  469,  470,  471, 1410, 1410,  469,  470,  471,
-      469,  470,  471, 1410,  433, 1410,  467, 1410, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  557,
-     1410,  469,  470,  471,  558,  559,  445,  560, 1410, 1410,
-     1410, 1410,  775,  561, 1410,  562,  563,  564, 1410,  565,
-     1410,  566, 1410,  567, 1410, 1410, 1410,  568, 1410,  445,
-      434, 1410, 1410, 1410, 1410,  445, 1410, 1410, 1410,  574,
-      575,  576,  774, 1410, 1410,  577,  468, 1410, 1410, 1410,
-      578, 1410,  579,  580,  242,  242, 1410, 1410,  445,  242,
-      242,  242,  242,  242, 1410,  242,  242,  242,  242, 1410,
-     1410,  774, 1410, 1410, 1410, 1310, 1410,  469,  470,  471,
-      242, 1410, 1410, 1410,  242, 1410, 1410, 1410,  775,  468,
-
-     1410, 1410, 1410,  242,  242, 1410, 1410, 1410,  242,  242,
-      242,  242,  242, 1410,  242,  242,  242,  242, 1410, 1410,
-     1410, 1410,  242,  242,  242,  776,  242,  775, 1410,  242,
-      469,  470,  471,  242, 1410, 1311, 1312, 1410, 1410, 1410,
-      242,  242, 1410,  954, 1410,  242,  242,  242,  242,  242,
-     1410,  242,  242,  242,  242, 1410,  777,  778,  779, 1410,
-      445,  242,  242,  242, 1313,  242,  242, 1410, 1410, 1410,
-      242, 1410, 1410, 1410,  955,  956,  957, 1410, 1410, 1410,
-     1410,  242,  242,  445, 1410, 1410,  242,  242,  242,  242,
-      242, 1410,  242,  242,  242,  242,  433, 1410,  242,  242,
-
-      242,  776,  242, 1410, 1410, 1410, 1410,  242, 1410, 1410,
-     1410,  242, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  581, 1410, 1410, 1410, 1410,
-      776, 1410,  777,  778,  779, 1410,  582,  583, 1410,  242,
-      242,  242,  434,  242,  584,  585,  586,  587,  588, 1410,
-      589,  590, 1410, 1410,  591,  592,  593,  594,  595, 1410,
-     1410,  777,  778,  779,  581,  596, 1410, 1410, 1410, 1410,
-      597,  598, 1410, 1410, 1410,  582,  583, 1410, 1410, 1176,
-     1410, 1410, 1410,  584,  585,  586,  587,  588, 1410,  589,
-      590, 1410, 1410,  591,  592,  593,  594,  595, 1410, 1410,
-
-     1410,  581,  445, 1410,  596, 1410, 1410, 1410, 1410,  597,
-      598, 1410,  582,  583, 1410, 1410, 1410, 1410, 1410, 1410,
-      584,  585,  586,  587,  588,  445,  589,  590, 1410, 1410,
-      591,  592,  593,  594,  595, 1410, 1410, 1410,  433, 1410,
-     1410,  596,  581, 1410, 1410,  446,  597,  598, 1410, 1410,
-     1410, 1410, 1410,  582,  583, 1410, 1410, 1410, 1410, 1410,
-     1410,  584,  585,  586,  587,  588, 1410,  589,  590, 1410,
-     1410,  591,  592,  593,  594,  595,  447,  448,  449, 1410,
-     1410, 1410,  596, 1410,  434, 1410, 1410,  597,  598, 1125,
-     1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125,
-
-     1125, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308,
-     1308, 1308,  445, 1410, 1410,  445, 1410, 1410, 1181, 1410,
-     1410, 1176, 1176, 1176, 1176, 1176, 1176, 1176, 1176, 1176,
-     1176, 1176, 1410,  445, 1410,  445, 1410, 1410,  445, 1410,
-     1410, 1181, 1410, 1410, 1410, 1410, 1410, 1410,  433, 1410,
-     1410,  433, 1410,  445,  774, 1410,  445, 1314, 1314, 1314,
-     1314, 1314, 1314, 1314, 1314, 1314, 1314,  445, 1176,  433,
-      445, 1410, 1410,  445, 1410, 1410,  445, 1410,  445, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  446,  445,  433,
-      445, 1410, 1410,  445,  434, 1410,  445,  434, 1410, 1410,
-
-      775,  445, 1410,  433, 1410, 1410,  433, 1410,  445,  774,
-     1410,  445, 1410, 1410,  774,  434, 1410, 1410,  447,  448,
-      449, 1410, 1410, 1410,  774, 1410, 1410,  445, 1410, 1410,
-     1410,  445, 1410, 1201, 1176,  434, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410,  774, 1410, 1410, 1410, 1410,  434,
-      445, 1410,  434, 1410, 1410,  775, 1201, 1410, 1410, 1410,
-      775, 1410, 1176,  774, 1410, 1410, 1410, 1410, 1410,  774,
-      775, 1410, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
-     1190, 1190, 1410, 1410, 1319, 1410, 1321, 1322, 1410, 1323,
-      775, 1410, 1410, 1410, 1410, 1410, 1410,  446, 1320, 1410,
-
-      446, 1410, 1410, 1315, 1410, 1410, 1410, 1326, 1327,  775,
-     1410, 1410, 1410, 1410, 1410,  775, 1410,  965,  446, 1410,
-     1410,  445, 1410, 1325, 1324,  445, 1410, 1328,  447,  448,
-      449,  447,  448,  449, 1316, 1317, 1318, 1410,  446,  445,
-      965, 1410, 1410, 1410,  445, 1410, 1191, 1410,  445,  447,
-      448,  449,  446,  433, 1410,  446, 1410,  774,  776, 1410,
-     1410,  433,  445,  776, 1410, 1410, 1410, 1410, 1410,  447,
-      448,  449, 1410,  776,  445,  774, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  447,  448,  449,  447,  448,  449,  777,
-      778,  779,  683,  776,  777,  778,  779,  445, 1410,  434,
-
-     1410, 1410, 1410,  775,  777,  778,  779,  434, 1410, 1410,
-      774, 1410,  776, 1410, 1410,  683, 1410, 1410, 1329, 1410,
-     1410,  775, 1410, 1410,  777,  778,  779, 1410,  774, 1410,
-     1410,  959,  960,  960,  960,  960,  960,  960,  960,  960,
-      960, 1410, 1410,  777,  778,  779,  445, 1410, 1410, 1330,
-     1331, 1332, 1410, 1410,  445, 1410,  775, 1410, 1191, 1191,
-     1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,  445,
-     1410, 1191,  445, 1410,  775, 1196,  445,  445, 1410, 1410,
-      445, 1410,  433, 1410,  716, 1410, 1410, 1410, 1410, 1410,
-      433, 1410, 1410, 1191, 1410,  445,  445, 1410, 1410,  445,
-
-     1410, 1410,  966,  445, 1410, 1191,  776,  716,  433, 1410,
-      446, 1410,  433, 1410, 1410, 1410,  433, 1410, 1410,  445,
-      433,  721,  722, 1410,  776,  445, 1410, 1410,  434, 1410,
-     1410, 1410,  433,  967,  968,  969,  434,  777,  778,  779,
-     1201,  447,  448,  449, 1410, 1410, 1410, 1410,  445, 1410,
-     1410, 1410, 1410, 1410,  434,  777,  778,  779,  434,  776,
-     1410,  433,  434, 1201, 1410, 1196,  434, 1410, 1410, 1410,
-      445, 1410, 1410, 1196, 1410, 1410,  774,  961,  434, 1190,
-     1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1410,
-      777,  778,  779,  445, 1410, 1196, 1196, 1196, 1196, 1196,
-
-     1196, 1196, 1196, 1196, 1196, 1196,  433,  434,  962,  963,
-      964, 1410, 1410,  445, 1410, 1335, 1336,  445, 1410, 1410,
-     1410, 1410,  775, 1333,  695, 1334, 1410, 1410, 1410, 1410,
-     1410,  446, 1410, 1410, 1410, 1410,  445, 1410, 1410,  446,
-      445, 1410, 1196, 1410, 1337, 1410, 1410,  695, 1410,  433,
-     1410,  445,  434,  433, 1410, 1410, 1410,  446, 1410, 1410,
-      433,  446,  447,  448,  449,  446, 1410, 1410, 1410,  976,
-      447,  448,  449, 1410,  445, 1410, 1410, 1410, 1410, 1410,
-      445,  446, 1410, 1410, 1410, 1410,  445,  433,  447,  448,
-      449, 1410,  447,  448,  449,  434,  447,  448,  449,  434,
-
-      977,  978,  979,  445, 1410, 1410,  434, 1410,  445,  445,
-      446, 1410,  447,  448,  449,  445,  433, 1410, 1410, 1410,
-     1206, 1410,  433, 1410,  445, 1329, 1410, 1410, 1410,  445,
-     1410,  445, 1206,  434, 1410, 1410, 1206, 1410,  445, 1410,
-     1410,  447,  448,  449,  433, 1410, 1410,  445, 1410, 1410,
-     1410,  433,  445, 1410, 1410,  446, 1330, 1331, 1332, 1410,
-      433, 1410,  434, 1410, 1410,  433, 1410, 1410,  434, 1410,
-     1206, 1206, 1206, 1206, 1206, 1206, 1206, 1206, 1206, 1206,
-     1206, 1410, 1410, 1410, 1410, 1410,  447,  448,  449, 1410,
-      434,  445, 1410, 1410, 1410, 1410,  445,  434,  446, 1211,
-
-     1410,  183,  446, 1410, 1410, 1211,  434, 1410, 1410,  980,
-     1410,  434, 1410, 1410,  445, 1410, 1410, 1206, 1410,  445,
-     1410, 1410, 1410, 1410,  183, 1410, 1410,  433, 1410,  447,
-      448,  449,  433,  447,  448,  449,  446,  184, 1410,  705,
-      981,  982,  983, 1211, 1211, 1211, 1211, 1211, 1211, 1211,
-     1211, 1211, 1211, 1211, 1410, 1410, 1410, 1410, 1211, 1410,
-     1410, 1410,  705, 1410, 1410,  446, 1338,  447,  448,  449,
-     1410,  446, 1410,  434, 1339,  433, 1410, 1410,  434, 1410,
-     1410, 1410,  183,  185, 1410, 1410, 1410, 1410, 1410, 1410,
-     1211, 1410, 1410,  446, 1410, 1410,  447,  448,  449, 1410,
-
-      446, 1410,  447,  448,  449,  183, 1410,  183, 1410,  446,
-     1340, 1341,  989, 1410,  446, 1342, 1410, 1410,  184, 1410,
-     1220,  434, 1410, 1410,  447,  448,  449, 1410, 1410, 1410,
-      183,  447,  448,  449, 1410,  989, 1410, 1410, 1410, 1410,
-      447,  448,  449,  184, 1410,  447,  448,  449,  184, 1410,
-     1410,  700,  700,  700,  700,  700,  700,  700,  700,  700,
-      700,  183, 1410, 1410,  185, 1410, 1410,  445, 1410, 1410,
-      445, 1410, 1410, 1410, 1410, 1410,  446, 1410, 1410, 1410,
-     1410,  446, 1410, 1410,  183, 1410,  186, 1410, 1410,  185,
-      445, 1410, 1410,  445,  185, 1410, 1410,  184, 1410, 1410,
-
-     1410, 1220, 1410,  433, 1410, 1410,  433,  447,  448,  449,
-     1410, 1410,  447,  448,  449, 1410, 1410,  187,  188,  189,
-     1410, 1410,  445, 1410,  999, 1410, 1220, 1220, 1220, 1220,
-     1220, 1220, 1220, 1220, 1220, 1220, 1220, 1410,  445, 1410,
-     1410, 1410, 1410,  185, 1410,  445, 1410, 1410, 1410,  434,
-     1410, 1410,  434, 1410, 1410, 1000, 1001, 1002,  433,  445,
-     1410,  445, 1410, 1410, 1410, 1410, 1410,  186, 1410, 1410,
-     1410, 1410, 1410, 1220,  433, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410,  445, 1410, 1410, 1410, 1225, 1410, 1410, 1225,
-     1410, 1410,  186, 1410, 1410,  433, 1410,  990,  187,  188,
-
-      189, 1410, 1410, 1410,  434, 1410, 1410, 1410,  445, 1410,
-     1410, 1220,  445, 1410, 1410,  445, 1410, 1410, 1410, 1410,
-      434, 1410, 1410,  187,  188,  189, 1410, 1410,  991,  992,
-      993,  445, 1410,  183, 1410,  445, 1410, 1410,  445, 1410,
-     1410,  434, 1410, 1410,  433, 1410,  186, 1410,  433, 1410,
-     1410,  433,  446,  183, 1410,  446,  183, 1225, 1225, 1225,
-     1225, 1225, 1225, 1225, 1225, 1225, 1225, 1225, 1410,  184,
-     1410, 1410, 1225, 1410, 1410, 1410,  183,  187,  188,  189,
-     1410, 1410, 1410,  447,  448,  449,  447,  448,  449,  184,
-      434, 1410, 1410, 1410,  434, 1410, 1410,  434, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1225, 1410, 1410,  446, 1410, 1410,
-     1343, 1410, 1410, 1410, 1410,  185, 1410, 1410, 1410, 1410,
-     1410, 1410, 1008,  446, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1345, 1346, 1410, 1347,  185, 1410,  183,  447,  448,
-      449, 1410, 1410, 1410,  446, 1008, 1410, 1410, 1410, 1410,
-     1410, 1410, 1234, 1344,  447,  448,  449, 1410,  184,  183,
-      183,  710,  710,  710,  710,  710,  710,  710,  710,  710,
-      710, 1410, 1410,  184, 1410,  447,  448,  449, 1410, 1410,
-     1410, 1410,  183, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  446, 1410,  184, 1410,  446, 1410, 1410,
-
-      446, 1410, 1410, 1234,  185, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410,  445, 1410,  186,  185,
-     1410, 1410, 1410, 1410,  447,  448,  449, 1410,  447,  448,
-      449,  447,  448,  449, 1410, 1410, 1410, 1410,  186,  445,
-     1410,  185, 1410, 1410,  445, 1410, 1410, 1410, 1410,  187,
-      188,  189,  774, 1410, 1410, 1410, 1234, 1234, 1234, 1234,
-     1234, 1234, 1234, 1234, 1234, 1234, 1234,  445, 1410,  187,
-      188,  189, 1410, 1410, 1410, 1410, 1410, 1410, 1234, 1410,
-      774, 1410, 1410, 1348, 1349, 1349, 1349, 1349, 1349, 1349,
-     1349, 1349, 1349, 1410, 1410, 1410,  445, 1410,  775, 1410,
-
-     1410, 1410, 1410, 1234, 1410, 1410, 1410, 1009, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  445,
-      683, 1410,  186, 1410, 1410, 1410,  775, 1410, 1410, 1410,
-     1410, 1410,  774, 1410,  445, 1352, 1353, 1410, 1010, 1011,
-     1012, 1410, 1410,  683,  186, 1410, 1018, 1410, 1410, 1410,
-     1410, 1410, 1410,  187,  188,  189,  774,  445, 1410,  959,
-      960,  960,  960,  960,  960,  960,  960,  960,  960, 1018,
-      774, 1410,  445, 1410, 1410,  187,  188,  189,  775, 1410,
-     1410, 1410,  774, 1239, 1240, 1241, 1241, 1241, 1241, 1241,
-     1241, 1241, 1241, 1241, 1241,  445, 1410, 1410, 1410, 1410,
-
-     1410,  776,  775, 1410, 1410, 1410, 1410,  445,  774, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410,  775, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1018,  775,  776,
-      445, 1410,  777,  778,  779, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  433, 1410, 1410, 1410, 1350, 1410, 1410,
-     1018, 1410, 1410, 1410,  775, 1410, 1410,  445, 1410, 1410,
-      777,  778,  779,  433,  721,  722,  723,  723,  723,  723,
-      723,  723,  723,  723,  723,  723, 1410, 1410, 1410, 1351,
-      445,  776, 1410, 1410,  445, 1410, 1410,  445, 1410,  434,
-     1410, 1354, 1410,  433, 1410, 1410, 1410, 1410, 1410, 1043,
-
-     1410, 1410, 1410, 1030, 1410,  961, 1410,  445, 1410,  434,
-      445,  445,  777,  778,  779, 1410, 1410, 1410, 1410,  776,
-      433, 1410, 1043,  774, 1410, 1030, 1246, 1030, 1410, 1410,
-     1410, 1242, 1410, 1410,  445, 1044,  962,  963,  964,  434,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410,  433, 1410, 1410,
-      777,  778,  779, 1410, 1030, 1410, 1410,  776, 1410, 1410,
-     1410, 1410, 1243, 1244, 1245, 1410,  434, 1410, 1410,  775,
-     1410, 1410, 1410, 1043, 1410, 1410, 1410, 1030, 1410, 1410,
-     1410, 1045, 1410,  445, 1410, 1410, 1410, 1410,  777,  778,
-      779, 1410,  446,  434, 1410, 1410, 1043, 1410, 1410, 1030,
-
-     1410, 1030, 1410, 1246, 1410, 1410,  445, 1246, 1410, 1044,
-     1410, 1410, 1019, 1030, 1410, 1030, 1030, 1410, 1410,  774,
-     1410, 1410, 1410,  447,  448,  449, 1410, 1410, 1030, 1410,
-     1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246,
-     1246, 1410,  446, 1020, 1021, 1022, 1410, 1410, 1410, 1410,
-     1355, 1410, 1410, 1410, 1410, 1045, 1410, 1043, 1410, 1410,
-     1410, 1030, 1410, 1410, 1410,  775, 1410, 1410, 1410,  446,
-     1410,  445,  776,  447,  448,  449, 1410, 1246, 1410, 1410,
-     1043, 1410, 1410, 1030, 1046, 1030, 1410, 1030, 1410, 1030,
-     1030, 1410, 1410, 1044,  445, 1410,  446, 1410, 1410, 1410,
-
-      447,  448,  449,  777,  778,  779, 1410,  774, 1410, 1410,
-     1043, 1410, 1030, 1410, 1030, 1047, 1048, 1049, 1356, 1410,
-     1410, 1410, 1410, 1410,  465, 1410, 1410,  447,  448,  449,
-     1410, 1256,  182, 1043, 1068, 1028, 1030, 1410, 1030, 1045,
-     1410, 1410, 1410, 1410, 1410, 1410, 1044,  465, 1410, 1410,
-     1410, 1410, 1029,  775, 1256, 1410, 1030, 1028, 1046, 1028,
-      793, 1410, 1410, 1410, 1410, 1030, 1410, 1031,  776, 1410,
-     1410, 1030, 1410, 1030, 1030, 1029, 1357, 1358, 1030, 1410,
-     1030, 1410, 1410, 1410, 1410, 1410, 1028, 1410, 1031, 1047,
-     1048, 1049, 1045, 1410, 1029, 1410, 1410, 1410, 1030,  777,
-
-      778,  779, 1410, 1410, 1410, 1410,  794, 1030, 1410, 1410,
-     1410, 1410, 1410, 1255, 1410, 1029, 1069, 1029, 1410, 1030,
-     1030, 1410, 1030, 1410, 1030, 1410, 1030, 1030, 1410, 1359,
-     1031, 1410, 1410, 1410, 1032, 1410, 1029, 1410, 1029, 1410,
-     1030, 1030, 1046, 1030, 1410, 1028, 1410, 1028, 1028, 1030,
-     1410, 1031, 1410, 1410, 1410, 1410,  776, 1029, 1410, 1029,
-     1410, 1030, 1030, 1410, 1030, 1410, 1030, 1410, 1030, 1030,
-     1030, 1410, 1031, 1047, 1048, 1049, 1032, 1410, 1410, 1410,
-     1029, 1410, 1410, 1030, 1410, 1030, 1410,  777,  778,  779,
-     1410, 1030, 1410, 1031, 1410, 1046, 1410, 1032, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1030,  795,
-     1030, 1030, 1030, 1256, 1410, 1410, 1361, 1410, 1032, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1047, 1048, 1049, 1030,
-     1410, 1030, 1030, 1410, 1256, 1410, 1410, 1033, 1410, 1032,
-      796,  797,  798, 1410, 1410, 1410, 1410, 1362, 1363, 1364,
-     1030, 1410, 1030, 1030, 1410, 1256, 1256, 1256, 1256, 1256,
-     1256, 1256, 1256, 1256, 1256, 1256, 1410, 1410, 1034, 1035,
-     1036, 1030, 1410, 1030, 1030, 1410, 1410, 1410, 1410, 1033,
-     1037,  350, 1410, 1410,  350, 1410, 1410, 1410, 1410, 1410,
-      445, 1410, 1410, 1410, 1043, 1410, 1410, 1410, 1030, 1410,
-
-     1033, 1410, 1256, 1037, 1410, 1410,  350, 1256,  350, 1410,
-     1034, 1035, 1036,  445, 1410, 1410, 1262, 1043, 1410, 1410,
-     1030, 1033, 1030, 1410, 1410, 1410,  774, 1410, 1410, 1263,
-     1275, 1034, 1035, 1036, 1410,  350, 1410, 1410, 1410, 1410,
-     1410, 1410, 1033, 1037,  350, 1410, 1410,  350, 1410, 1030,
-     1410, 1410, 1034, 1035, 1036, 1410, 1410, 1037,  350, 1410,
-     1410,  350, 1264, 1410, 1410, 1410, 1037, 1410, 1410,  350,
-     1410,  350,  775, 1034, 1035, 1036, 1276, 1410, 1410, 1262,
-     1037, 1410, 1410,  350, 1410,  350, 1410, 1410, 1410, 1410,
-     1410, 1410, 1263, 1262,  350, 1410,  350,  350,  350, 1410,
-
-     1037,  350, 1410, 1410,  350, 1410, 1263, 1410, 1030, 1072,
-     1030, 1030,  350, 1410, 1410, 1410, 1410, 1037,  350, 1410,
-     1410,  350, 1410, 1037, 1410, 1264,  350, 1410,  350, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1262, 1410, 1410, 1264,
-     1037, 1410, 1410,  350, 1410,  350, 1410, 1410, 1410, 1263,
-     1410, 1410, 1410, 1262, 1410,  350, 1410,  350, 1410,  350,
-      350, 1410, 1410, 1410, 1410, 1265, 1263,  445, 1410, 1410,
-     1410,  350,  350,  350,  350,  776, 1410, 1410, 1410, 1277,
-     1410, 1410, 1264, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      445, 1410, 1410, 1410, 1366, 1410, 1266, 1267, 1268, 1264,
-
-     1410,  465, 1367,  774, 1410, 1410,  777,  778,  779, 1410,
-     1278, 1279, 1280, 1410,  350, 1410,  350,  350, 1410, 1368,
-     1369, 1410, 1037,  350,  465, 1410,  350, 1410, 1265, 1410,
-     1410,  350, 1410,  350,  350, 1410, 1370,  793, 1410, 1410,
-     1037,  350, 1265, 1410,  350, 1037, 1410, 1410,  350,  775,
-      350, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  735, 1266,
-     1267, 1268, 1410, 1037, 1410, 1410,  350, 1410,  350, 1410,
-     1410,  736, 1410, 1266, 1267, 1268,  735,  350,  465, 1410,
-     1410, 1410, 1410,  794, 1410, 1265, 1070, 1071, 1410,  736,
-      465, 1410, 1410, 1410, 1410,  350, 1410, 1410, 1410, 1410,
-
-     1410,  465, 1265, 1410,  737, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410,  465,  793, 1410, 1266, 1267, 1268, 1410,
-     1076, 1077,  737, 1410, 1410, 1410,  793, 1037,  350, 1410,
-     1410,  350, 1410, 1266, 1267, 1268,  350, 1410,  350,  350,
-     1410,  465, 1410, 1410, 1410, 1037,  350, 1410, 1410,  350,
-     1037, 1410,  776,  350,  350,  350,  350,  350, 1410, 1269,
-      794, 1410, 1410,  735,  465, 1037,  350, 1410, 1037,  350,
-     1410,  350,  794,  350, 1410, 1410,  736,  793, 1410, 1410,
-     1410,  735,  350,  777,  778,  779,  795, 1410, 1037, 1410,
-     1410,  350, 1410,  350,  736, 1410, 1410, 1410, 1410, 1410,
-
-      350,  735, 1410, 1410, 1410, 1410, 1410, 1038, 1410,  737,
-     1410, 1410, 1410, 1410,  736, 1410, 1410,  796,  797,  798,
-      350, 1410, 1410,  794, 1410, 1038, 1410,  737, 1410, 1074,
-     1410, 1410, 1410, 1410, 1410, 1075, 1410, 1410, 1039, 1040,
-     1041,  350, 1410,  350,  350, 1410, 1410,  737, 1410, 1410,
-     1410, 1410, 1410,  953, 1410, 1410, 1039, 1040, 1041,  350,
-     1078,  350,  350,  795, 1269, 1269, 1269, 1269, 1269, 1269,
-     1269, 1269, 1269, 1269, 1269,  795,  953, 1269, 1410,  350,
-     1410,  350,  350, 1410, 1269, 1410, 1410, 1043, 1410,  774,
-     1410, 1030, 1410, 1043,  796,  797,  798, 1030, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1043,  796,  797,  798, 1030,
-     1043, 1269, 1038, 1030, 1410, 1030, 1043, 1410, 1410, 1030,
-     1410, 1030, 1410, 1275, 1410, 1410,  795, 1410, 1043, 1275,
-     1038, 1030, 1410, 1030, 1410,  775, 1410, 1410, 1410, 1410,
-     1410, 1275, 1030, 1039, 1040, 1041, 1410, 1410, 1030, 1410,
-     1038, 1410, 1410, 1410, 1410, 1410, 1410,  796,  797,  798,
-     1030, 1039, 1040, 1041, 1410, 1410, 1410, 1410, 1410, 1276,
-     1410, 1410, 1043, 1410, 1410, 1276, 1030, 1410, 1410, 1410,
-     1410, 1039, 1040, 1041, 1410, 1410, 1410, 1276, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1043, 1410, 1410, 1030, 1410,
-
-     1030, 1030, 1410, 1030, 1030, 1410, 1410, 1030, 1275, 1030,
-     1030, 1043, 1410, 1410, 1410, 1030, 1410, 1410, 1410, 1030,
-      465, 1030, 1030, 1410, 1410, 1282,  432, 1030, 1410, 1042,
-     1410, 1410, 1043, 1410, 1043, 1410, 1030, 1030, 1172, 1030,
-     1410, 1410, 1410,  465, 1372, 1410, 1410, 1275, 1282, 1410,
-     1373, 1042, 1410, 1042, 1276, 1043,  793, 1410, 1030, 1410,
-     1030, 1044, 1410, 1410, 1410, 1410, 1030, 1410, 1044, 1173,
-     1174, 1175, 1277, 1410, 1410, 1410, 1410, 1410, 1277, 1410,
-     1042, 1410, 1410, 1410, 1410, 1410, 1030, 1030, 1030, 1030,
-     1277, 1374, 1375, 1276, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1410, 1410,  794, 1278, 1279, 1280, 1410, 1281, 1410, 1278,
-     1279, 1280, 1410, 1410, 1045, 1410, 1410, 1410, 1410, 1410,
-     1410, 1278, 1279, 1280, 1410, 1030, 1410, 1030, 1030,  965,
-     1376, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1042,
-     1043, 1042, 1042, 1410, 1030, 1410, 1030, 1410, 1030, 1030,
-     1410, 1043,  965, 1410, 1410, 1030, 1410, 1277, 1410, 1410,
-     1410, 1410, 1410, 1043, 1410,  774, 1030, 1410, 1030, 1410,
-     1410, 1091, 1410, 1410, 1043, 1410, 1044, 1030,  465, 1030,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1044, 1278, 1279,
-     1280, 1410, 1410, 1410, 1410, 1030, 1277, 1410, 1410, 1410,
-
-     1410,  465, 1410,  465, 1410,  795, 1030, 1410, 1410, 1410,
-     1378,  775, 1410, 1410,  793, 1410, 1410, 1046, 1410, 1410,
-     1410, 1410, 1045, 1410, 1410, 1410,  465, 1278, 1279, 1280,
-      465, 1410, 1410, 1045, 1410, 1410,  796,  797,  798,  793,
-     1410, 1379, 1380, 1381, 1410, 1410, 1410, 1410, 1047, 1048,
-     1049, 1410, 1410,  465, 1030, 1410, 1030, 1030, 1043, 1282,
-      794, 1410, 1030, 1410, 1410, 1030,  793, 1030, 1030, 1410,
-     1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282,
-     1282, 1043, 1410, 1043, 1030,  794, 1030, 1030, 1410, 1410,
-     1410, 1410, 1410, 1410, 1044, 1037,  350, 1093, 1094,  350,
-
-     1410, 1410, 1410, 1410, 1410,  445, 1043, 1410, 1410, 1030,
-     1410, 1030,  794, 1030, 1186, 1410, 1410, 1282, 1037, 1044,
-     1410,  350, 1410,  350, 1410, 1046, 1410, 1410,  445, 1410,
-     1410,  735, 1410, 1410, 1410, 1410, 1046, 1410, 1030, 1410,
-     1045,  774, 1410,  445,  736, 1187, 1188, 1189, 1092, 1095,
-      350, 1410, 1410, 1410, 1410, 1043, 1047, 1048, 1049, 1030,
-     1410, 1410, 1410,  795, 1410, 1045,  445, 1047, 1048, 1049,
-     1410, 1410, 1030, 1410, 1030, 1030, 1410,  737, 1043,  774,
-     1410, 1030, 1410, 1030, 1410, 1410, 1410,  775,  795, 1410,
-     1410, 1044, 1410, 1410,  796,  797,  798, 1030, 1410, 1030,
-
-     1030, 1410, 1282, 1037,  350, 1410, 1410,  350, 1282,  350,
-     1030,  350,  350, 1410, 1410,  795, 1410, 1410, 1410,  796,
-      797,  798, 1410, 1410, 1309,  775, 1037, 1410, 1410,  350,
-     1410,  350, 1410, 1410, 1410, 1410, 1410, 1045, 1410,  735,
-     1410, 1410, 1410, 1046, 1410, 1410,  796,  797,  798, 1410,
-     1410, 1410,  736, 1410, 1410, 1410, 1410, 1410,  350, 1410,
-     1037,  350, 1410, 1410,  350, 1410, 1410, 1410, 1046, 1030,
-     1410, 1030, 1030, 1410, 1047, 1048, 1049, 1410, 1410, 1410,
-     1038, 1410, 1410, 1037, 1410,  737,  350, 1410,  350, 1410,
-      776, 1410, 1410, 1309, 1410, 1410,  735, 1410, 1410, 1047,
-
-     1048, 1049, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  736,
-     1410, 1039, 1040, 1041, 1410,  350, 1410,  350, 1410,  350,
-      350,  777,  778,  779, 1410, 1410, 1410, 1410,  776, 1410,
-     1037,  350, 1410, 1410,  350, 1410, 1410, 1410, 1410, 1410,
-     1046, 1410,  737, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1037, 1269, 1410,  350, 1410,  350,  777,
-      778,  779, 1410, 1410, 1410, 1410,  735, 1410, 1410, 1410,
-     1410, 1047, 1048, 1049,  350, 1410,  350,  350, 1410,  736,
-     1037,  350, 1410, 1410,  350,  350, 1410, 1410, 1038, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1383, 1084, 1410, 1037, 1084, 1270,  350,  445,  350, 1410,
-     1410, 1410,  737, 1410, 1410, 1410,  735, 1410,  445, 1039,
-     1040, 1041, 1410, 1383, 1410, 1410, 1084, 1410, 1084,  736,
-      445, 1410, 1410, 1410, 1410,  350,  793, 1410, 1410, 1410,
-     1410,  445, 1410,  774,  350, 1038,  350,  350, 1410, 1271,
-     1272, 1410, 1410, 1410,  774, 1084, 1410, 1410, 1410, 1410,
-      242,  242,  737, 1410, 1410,  242,  242,  242,  242,  242,
-      445,  242,  242,  242,  242,  445, 1039, 1040, 1041, 1410,
-     1410, 1410, 1384, 1410, 1410,  445,  242, 1410, 1410,  775,
-      242, 1410, 1410,  445,  350, 1410,  350,  350,  445, 1273,
-
-      775, 1410, 1410, 1410, 1410, 1410,  774, 1410,  445, 1410,
-     1410,  774, 1410, 1410, 1084, 1038, 1084, 1084,  242,  242,
-      242,  774,  242, 1410, 1410, 1410, 1309, 1309, 1309, 1309,
-     1309, 1309, 1309, 1309, 1309, 1309, 1309, 1309,  445, 1410,
-     1410, 1410, 1410, 1410, 1410,  445, 1039, 1040, 1041, 1410,
-     1410, 1410,  775, 1410, 1410,  445, 1410,  775, 1410, 1410,
-     1410,  445, 1410, 1410, 1410, 1038, 1181,  775,  445, 1410,
-     1410, 1410, 1410, 1309,  774, 1410, 1410, 1410,  445, 1410,
-     1410,  433, 1410, 1410, 1410, 1385, 1410, 1410, 1410, 1181,
-     1410,  433,  776, 1410, 1410, 1410, 1039, 1040, 1041, 1410,
-
-     1410, 1410,  774,  776, 1393, 1314, 1314, 1314, 1314, 1314,
-     1314, 1314, 1314, 1314, 1314, 1390, 1386, 1387, 1388, 1410,
-      775,  581, 1410,  777,  778,  779, 1389,  434, 1410, 1410,
-     1410, 1410,  582,  583,  777,  778,  779,  434, 1410, 1410,
-      584,  585,  586,  587,  588, 1410,  589,  590,  775,  445,
-      591,  592,  593,  594,  595,  776, 1410, 1391, 1392, 1410,
-      776,  596, 1410, 1410, 1319, 1410,  597,  598, 1410, 1410,
-      776, 1181,  445, 1410, 1319, 1319, 1319, 1319, 1319, 1319,
-     1319, 1319, 1319, 1319, 1319,  433,  777,  778,  779, 1410,
-     1410,  777,  778,  779, 1181, 1410, 1410,  445, 1410, 1410,
-
-     1410,  777,  778,  779, 1410,  445, 1410,  433, 1410, 1410,
-      958,  958,  958,  958,  958,  958,  958,  958,  958,  958,
-      445, 1319,  445,  776, 1410, 1410, 1410, 1410,  445, 1410,
-      446,  434, 1410,  433, 1410, 1410, 1410, 1410, 1410, 1410,
-      446,  774, 1410, 1410, 1410,  445, 1410, 1410, 1410, 1410,
-     1410, 1315, 1410,  434,  777,  778,  779,  445,  774, 1410,
-     1410,  447,  448,  449, 1410,  445, 1410, 1410, 1410,  445,
-     1410,  447,  448,  449, 1410,  445, 1410, 1410, 1410,  434,
-      445, 1410, 1316, 1317, 1318, 1410,  445,  775,  445, 1410,
-     1410,  445,  445,  774, 1410, 1410, 1410, 1410,  445, 1319,
-
-     1410,  774, 1410, 1410,  775,  433, 1410, 1410, 1410,  445,
-      445,  774, 1410, 1410,  445, 1410, 1319, 1410, 1410, 1410,
-     1410, 1410,  774, 1410, 1324, 1410,  445,  774, 1410, 1410,
-     1410, 1410, 1410,  445,  446, 1410, 1410, 1410, 1410,  775,
-     1410, 1410, 1410, 1410, 1410, 1410,  774,  775, 1410,  445,
-     1410,  434, 1410, 1410, 1410, 1410, 1182,  775, 1410, 1410,
-     1410, 1410,  433, 1410, 1410,  447,  448,  449,  775, 1410,
-      445, 1410, 1324,  775, 1410, 1410, 1324, 1410, 1410, 1410,
-     1410, 1410,  446, 1410, 1410, 1410, 1410, 1183, 1184, 1185,
-      776, 1410,  775,  445, 1324, 1324, 1324, 1324, 1324, 1324,
-
-     1324, 1324, 1324, 1324, 1324, 1410,  433,  776,  434, 1410,
-     1396, 1397,  445,  447,  448,  449, 1394, 1410, 1410, 1333,
-     1410,  777,  778,  779, 1410, 1410, 1410, 1410,  445, 1398,
-     1410, 1395,  445, 1410, 1410,  445, 1410, 1410,  777,  778,
-      779, 1324,  776, 1410, 1410, 1333, 1410, 1410,  433, 1410,
-      776,  445,  434, 1410,  446,  445, 1410, 1410, 1410, 1410,
-      776, 1410, 1410, 1410,  433, 1410, 1410, 1410,  433, 1410,
-     1410,  776, 1410,  777,  778,  779,  776, 1201, 1410, 1410,
-     1410,  777,  778,  779, 1410,  447,  448,  449, 1410, 1333,
-     1410,  777,  778,  779,  434,  776, 1410, 1410, 1410, 1410,
-
-     1201, 1410,  777,  778,  779, 1410, 1410,  777,  778,  779,
-      434,  446, 1410,  433,  434, 1410,  970,  970,  970,  970,
-      970,  970,  970,  970,  970,  970,  777,  778,  779,  989,
-     1410, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333,
-     1333, 1333,  447,  448,  449, 1410, 1410, 1338, 1410, 1410,
-     1410, 1410,  989, 1410, 1410,  446,  445, 1410, 1410,  434,
-     1410, 1410, 1410, 1410, 1410,  433, 1410, 1410,  958,  958,
-      958,  958,  958,  958,  958,  958,  958,  958, 1333,  445,
-     1410, 1410, 1338,  445, 1410, 1410,  447,  448,  449, 1410,
-     1410, 1410,  433, 1410, 1410, 1410, 1410,  446, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410,  445, 1410, 1410, 1410,
-     1410,  434, 1410,  446, 1410, 1410, 1410,  446,  445,  433,
-     1410, 1410, 1410, 1410,  445, 1410, 1410, 1410,  447,  448,
-      449, 1410, 1410,  445, 1410, 1410,  445, 1410,  434, 1410,
-     1410,  445, 1410, 1410,  447,  448,  449,  445,  447,  448,
-      449, 1410, 1410, 1410,  433, 1410,  445, 1410, 1410,  445,
-      433, 1410, 1202, 1410, 1410,  434, 1410, 1410, 1410,  433,
-     1410, 1410,  433, 1410, 1410, 1338, 1338, 1338, 1338, 1338,
-     1338, 1338, 1338, 1338, 1338, 1338, 1410, 1008, 1410, 1410,
-     1410, 1410, 1410, 1203, 1204, 1205, 1410, 1410, 1410, 1410,
-
-      434, 1410, 1338, 1410, 1410, 1410,  434, 1410, 1410, 1410,
-     1008, 1410, 1410,  953, 1216,  434, 1410, 1410,  434, 1410,
-     1410, 1410, 1338,  433, 1410, 1410,  970,  970,  970,  970,
-      970,  970,  970,  970,  970,  970,  953, 1343, 1410, 1410,
-     1410,  446, 1410, 1343, 1410, 1217, 1218, 1219, 1410,  774,
-     1410, 1410, 1410, 1410, 1410, 1343, 1343, 1343, 1343, 1343,
-     1343, 1343, 1343, 1343, 1343, 1343, 1410, 1410,  446,  434,
-     1410, 1410,  447,  448,  449,  445, 1410, 1410, 1410, 1410,
-     1410,  445, 1410, 1343,  953, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410,  775, 1410, 1410,  445,  447,
-
-      448,  449, 1343,  446,  445, 1410, 1410,  953, 1410,  446,
-     1410,  774, 1410, 1410, 1410, 1410, 1410,  774,  446, 1410,
-      774,  446, 1410, 1314, 1314, 1314, 1314, 1314, 1314, 1314,
-     1314, 1314, 1314,  445,  447,  448,  449, 1018, 1410, 1410,
-      447,  448,  449, 1410, 1410, 1410, 1410, 1410, 1410,  447,
-      448,  449,  447,  448,  449, 1410,  445,  775, 1410, 1410,
-     1018, 1410, 1410,  775, 1410, 1410,  775, 1410, 1410,  774,
-     1410, 1410, 1230,  774, 1239, 1240, 1241, 1241, 1241, 1241,
-     1241, 1241, 1241, 1241, 1241, 1241,  445, 1410, 1410, 1410,
-     1410,  465, 1410, 1410, 1350, 1410, 1410, 1410, 1172, 1410,
-
-     1350, 1410, 1410, 1231, 1232, 1233, 1410, 1410, 1410,  445,
-     1410, 1410, 1029, 1410,  465,  775, 1030, 1410, 1410,  775,
-     1410, 1043,  774, 1410, 1410, 1030, 1410,  793, 1410, 1173,
-     1174, 1175, 1410, 1410, 1410, 1029, 1410, 1410, 1030, 1410,
-     1030, 1410, 1410, 1410, 1043, 1410, 1410, 1030, 1044, 1030,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1044, 1410, 1410,
-      776, 1410, 1410, 1410, 1410, 1410,  776, 1030,  775, 1172,
-     1410, 1410, 1410,  794, 1410, 1410, 1030, 1410, 1410, 1410,
-     1410, 1410, 1410, 1350, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410,  777,  778,  779, 1045, 1410, 1410,  777,  778,  779,
-
-     1173, 1174, 1175, 1045, 1410, 1350, 1350, 1350, 1350, 1350,
-     1350, 1350, 1350, 1350, 1350, 1350, 1410, 1410,  776, 1410,
-     1410, 1410, 1242, 1410, 1410, 1410, 1030, 1410, 1030, 1030,
-     1410, 1410, 1410,  465, 1410, 1030, 1410, 1030, 1030, 1043,
-     1355, 1410, 1410, 1030, 1410, 1410, 1410, 1410, 1410,  777,
-      778,  779, 1350, 1243, 1244, 1245,  465, 1410, 1410, 1043,
-     1410, 1410, 1043, 1030, 1410, 1030, 1410, 1030, 1410,  793,
-     1410,  776, 1410, 1410, 1410, 1044,  795, 1410, 1410, 1410,
-     1410, 1410, 1043, 1410, 1410, 1030, 1410, 1030, 1410, 1410,
-     1410, 1410, 1410, 1410, 1030, 1044, 1043, 1251, 1410, 1410,
-
-     1030, 1410,  777,  778,  779, 1410, 1046,  796,  797,  798,
-     1410, 1410, 1410, 1410, 1030,  794, 1410, 1410, 1410, 1043,
-     1410, 1045, 1030, 1410, 1030, 1410, 1410, 1410, 1252, 1253,
-     1254, 1410, 1044, 1410, 1410, 1410, 1410, 1047, 1048, 1049,
-     1410, 1045, 1410, 1410, 1410, 1410, 1029, 1410, 1410, 1410,
-     1030, 1030, 1410, 1030,  465, 1030, 1030, 1410, 1355, 1355,
-     1355, 1355, 1355, 1355, 1355, 1355, 1355, 1355, 1355, 1029,
-     1410, 1410, 1030, 1030, 1030, 1030, 1030,  465, 1045, 1410,
-     1410, 1410, 1031, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      793, 1029, 1410, 1410, 1410, 1030, 1410, 1410, 1410, 1410,
-
-     1410, 1030, 1410, 1029, 1410, 1355, 1410, 1030, 1410, 1355,
-     1030, 1410, 1030, 1030, 1029, 1355, 1410, 1030,  795, 1030,
-     1410, 1410, 1410, 1410, 1046, 1410, 1029, 1031, 1032, 1030,
-     1410, 1030, 1410, 1410, 1410, 1410,  794, 1410, 1410, 1031,
-     1410, 1410, 1410, 1410, 1046, 1410, 1030, 1410, 1410,  796,
-      797,  798, 1410, 1410, 1410, 1047, 1048, 1049, 1030, 1410,
-     1030, 1029, 1030, 1030, 1410, 1030, 1410, 1410, 1029, 1410,
-     1410, 1410, 1030, 1032, 1410, 1047, 1048, 1049, 1410, 1410,
-     1410, 1046, 1410, 1410, 1029, 1032, 1410, 1030, 1410, 1030,
-     1410, 1029, 1410, 1410, 1030, 1410, 1030, 1031, 1410, 1075,
-
-     1410, 1410, 1410, 1410, 1031, 1030, 1410, 1030, 1030, 1410,
-      465, 1410, 1047, 1048, 1049, 1410, 1030, 1030, 1410, 1030,
-     1030, 1410, 1410, 1030,  445, 1410, 1410, 1410, 1410, 1410,
-     1410, 1033, 1410,  465, 1410, 1410, 1410, 1410, 1410,  795,
-     1410, 1410, 1256, 1032, 1410, 1410,  793,  445, 1257, 1410,
-     1032, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      774, 1410, 1034, 1035, 1036, 1410, 1410, 1410, 1410, 1410,
-      796,  797,  798, 1410, 1410, 1030, 1033, 1030, 1030, 1410,
-     1258, 1259, 1030, 1410, 1030, 1030, 1410, 1260, 1033, 1366,
-     1261, 1410,  794, 1261, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1037,  350, 1410, 1410,  350, 1410,  775, 1034, 1035, 1036,
-     1410, 1410, 1366, 1410, 1410, 1261, 1410, 1261, 1410, 1034,
-     1035, 1036, 1410, 1037, 1410, 1262,  350, 1410,  350, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1262, 1410, 1400, 1037,
-      350, 1410, 1410,  350, 1261, 1410, 1033, 1410, 1410, 1263,
-     1410, 1410, 1410, 1033, 1410,  350, 1410, 1410, 1410, 1410,
-     1410, 1074, 1037, 1410, 1410,  350, 1410,  350, 1410, 1410,
-     1410, 1365, 1410, 1410, 1389, 1262, 1410, 1034, 1035, 1036,
-     1410, 1410, 1264, 1410, 1034, 1035, 1036, 1410, 1263, 1410,
-     1410, 1410, 1410, 1410,  350,  795, 1037,  350, 1410, 1410,
-
-      350, 1410, 1410, 1261, 1410, 1261, 1261, 1410, 1410,  776,
-     1410, 1037,  350, 1410,  350,  350,  350,  350, 1410, 1037,
-     1410, 1264,  350, 1410,  350, 1410,  796,  797,  798, 1410,
-     1410, 1410, 1262, 1410, 1037, 1410, 1410,  350, 1410,  350,
-      777,  778,  779, 1410, 1410, 1263, 1410, 1262, 1410, 1410,
-     1410,  350, 1410,  350, 1410,  350,  350, 1410, 1366, 1410,
-     1263, 1410, 1410, 1410, 1410, 1410,  350, 1410, 1372,  773,
-     1410, 1410, 1274, 1410, 1401, 1410, 1410, 1410, 1264, 1410,
-     1410, 1410, 1410, 1410, 1410, 1265, 1410, 1410, 1410, 1410,
-     1410, 1372, 1410, 1264, 1274, 1410, 1274, 1410, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1275, 1402, 1403, 1404, 1410, 1410,
-      350, 1410,  350,  350, 1410, 1410, 1266, 1267, 1268, 1410,
-     1410, 1410,  465, 1274, 1265,  350, 1410,  350,  350, 1410,
-     1366, 1366, 1366, 1366, 1366, 1366, 1366, 1366, 1366, 1366,
-     1366, 1410, 1410, 1037,  350,  465, 1366,  350, 1410, 1410,
-     1371, 1410, 1410, 1410, 1410, 1266, 1267, 1268,  793, 1410,
-     1410, 1410, 1410, 1043, 1410, 1410, 1037, 1030, 1410,  350,
-     1410,  350, 1410, 1410, 1410, 1410, 1410, 1366, 1410, 1262,
-     1410, 1265, 1274, 1043, 1274, 1274, 1043, 1030, 1410, 1030,
-     1410, 1030, 1263, 1410, 1410, 1410, 1265, 1410,  350, 1275,
-
-     1410, 1410, 1410, 1410,  794, 1410, 1043, 1410, 1410, 1030,
-     1410, 1030, 1266, 1267, 1268, 1410, 1410, 1410, 1030, 1275,
-     1410, 1410, 1410, 1410, 1410, 1264, 1410, 1266, 1267, 1268,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1030, 1410,
-     1410, 1076, 1077, 1410, 1410, 1276, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1406, 1410, 1410, 1410,  350, 1410,  350,
-      350, 1410, 1366, 1410, 1410, 1276, 1410, 1410, 1043, 1410,
-     1410, 1410, 1030, 1410, 1410, 1410, 1410, 1030, 1410, 1030,
-     1030, 1410, 1410, 1410, 1407, 1408, 1409, 1410, 1043, 1410,
-     1410, 1043, 1030, 1410, 1030,  465, 1030, 1030, 1410, 1030,
-
-     1030, 1410, 1372, 1410, 1275, 1410, 1410,  795, 1410, 1410,
-     1410, 1043, 1410, 1410, 1030, 1410, 1030, 1410,  465, 1410,
-     1410, 1410, 1410, 1030, 1275, 1410, 1410, 1410, 1265, 1410,
-     1410,  793, 1410, 1410, 1410, 1410, 1410, 1410,  796,  797,
-      798, 1410, 1410, 1030, 1410, 1410, 1410, 1410, 1277, 1410,
-     1276, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1266,
-     1267, 1268, 1410, 1410, 1410, 1410, 1410, 1410, 1277, 1410,
-     1276, 1410, 1410, 1410, 1410, 1410, 1410,  794, 1410, 1278,
-     1279, 1280, 1030, 1410, 1030, 1030, 1410, 1372, 1372, 1372,
-     1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1410, 1278,
-
-     1279, 1280, 1030, 1410, 1030, 1030, 1410, 1043, 1410, 1410,
-     1410, 1030, 1410, 1043, 1078, 1410, 1410, 1030, 1410, 1043,
-     1410, 1410, 1410, 1030, 1410, 1410, 1410, 1410, 1043, 1410,
-     1043, 1410, 1030, 1030, 1372, 1030, 1043, 1410, 1372, 1030,
-     1410, 1030, 1043, 1275, 1410, 1030, 1410, 1030, 1410, 1044,
-     1410, 1043, 1410, 1277, 1030, 1044, 1030, 1410, 1410, 1410,
-     1410, 1410, 1030, 1410, 1044, 1410, 1410, 1410, 1030, 1410,
-     1410, 1410, 1410, 1277, 1030, 1410, 1410, 1410, 1410, 1410,
-      795, 1410, 1410, 1030, 1278, 1279, 1280, 1410, 1410, 1276,
-     1410, 1410, 1043, 1410, 1410, 1045, 1030, 1410, 1410, 1410,
-
-     1410, 1045, 1410, 1410, 1278, 1279, 1280, 1410, 1410, 1410,
-     1045,  796,  797,  798,  445, 1043, 1410, 1410, 1030, 1410,
-     1030, 1030, 1410, 1030, 1030, 1410, 1372, 1030, 1044, 1030,
-     1030, 1410, 1410, 1030, 1410, 1030, 1030,  445, 1410, 1043,
-     1410, 1410, 1030, 1030, 1030, 1030, 1410, 1030, 1410, 1410,
-      774, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1074,
-      792, 1410, 1043,  792, 1410, 1030, 1410, 1030, 1410, 1410,
-     1282, 1410, 1410, 1283, 1045, 1044, 1410, 1410, 1410, 1410,
-     1410, 1410, 1074, 1410, 1410,  792, 1410,  792, 1410, 1410,
-     1410, 1410, 1277, 1410, 1030,  793,  775, 1410, 1046, 1410,
-
-     1410, 1410, 1410, 1410, 1046, 1410, 1030, 1410, 1030, 1030,
-     1410, 1284, 1285, 1046,  792,  445, 1410, 1410, 1410, 1410,
-     1410, 1045, 1410, 1278, 1279, 1280, 1410, 1410, 1410, 1047,
-     1048, 1049, 1410, 1389,  445, 1047, 1048, 1049,  445, 1410,
-     1410, 1073, 1410, 1181, 1047, 1048, 1049, 1410, 1410, 1410,
-     1410,  774, 1410, 1030, 1410, 1030, 1030,  445, 1286, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1181, 1410, 1410,  445,
-      774, 1410, 1410,  792, 1410,  792,  792, 1046, 1410,  774,
-     1410, 1410, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1314,
-     1314, 1314,  445, 1410, 1410, 1410, 1410,  775, 1410,  776,
-
-     1410, 1410, 1410,  445, 1410,  774, 1410, 1410, 1047, 1048,
-     1049, 1410, 1410, 1410, 1410, 1410,  775, 1410, 1410, 1410,
-     1410, 1410, 1201, 1410, 1046,  775,  445, 1410, 1410, 1410,
-      777,  778,  779, 1410, 1389, 1410, 1410, 1410, 1410,  774,
-     1410, 1410, 1410, 1410, 1299, 1201, 1410, 1410,  445, 1410,
-     1410,  775, 1410, 1394, 1410, 1047, 1048, 1049,  774, 1410,
-     1410, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
-     1190,  445, 1410, 1410, 1410, 1300, 1301, 1302, 1410, 1410,
-     1410, 1410,  445, 1410,  774,  775, 1410, 1410, 1389, 1389,
-     1389, 1389, 1389, 1389, 1389, 1389, 1389, 1389, 1389, 1410,
-
-      776, 1410, 1410, 1410,  775,  445, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,  774,  776,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1315, 1410,
-      775,  777,  778,  779, 1410, 1389, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-      777,  778,  779, 1394,  776, 1410, 1410, 1410, 1410, 1316,
-     1317, 1318, 1410, 1410,  775, 1410, 1410, 1394, 1394, 1394,
-     1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1410, 1410,
-     1037,  350, 1410, 1410,  350,  777,  778,  779,  776, 1043,
-     1410, 1410, 1410, 1030, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1410, 1394, 1410, 1037, 1410, 1410,  350, 1329,  350, 1410,
-     1410, 1410, 1043, 1410, 1394, 1030, 1262, 1030, 1410,  777,
-      778,  779, 1410, 1410, 1410, 1275, 1410, 1037,  350, 1263,
-     1410,  350, 1410,  776, 1410,  350, 1410, 1410, 1330, 1331,
-     1332, 1410, 1410, 1410, 1030, 1410, 1410, 1410, 1410, 1410,
-     1037, 1410, 1410,  350, 1410,  350, 1410, 1410, 1410, 1410,
-     1410, 1410, 1264, 1262,  777,  778,  779,  776, 1410, 1410,
-     1410, 1276, 1410, 1410, 1410, 1410, 1263, 1410, 1410, 1410,
-     1410, 1410,  350, 1410, 1410, 1037,  350, 1410, 1410,  350,
-     1410, 1410, 1410, 1410,  350, 1410,  350,  350,  777,  778,
-
-      779, 1410, 1410, 1030, 1410, 1030, 1030, 1410, 1037, 1264,
-     1410,  350, 1410,  350, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1262, 1037,  350, 1410, 1410,  350, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1263, 1410, 1410, 1410, 1410, 1410,
-      350,  350, 1410,  350,  350, 1037, 1410, 1410,  350, 1410,
-      350, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1262, 1410,
-     1410, 1410, 1410, 1410, 1043, 1265, 1410, 1264, 1030, 1410,
-     1410, 1263, 1410, 1410, 1277, 1410, 1410,  350, 1366, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1043, 1410, 1410,
-     1030, 1410, 1030, 1410, 1410, 1410, 1266, 1267, 1268,  350,
-
-     1275,  350,  350, 1410, 1264, 1278, 1279, 1280, 1410, 1410,
-     1410, 1410, 1265, 1410, 1410, 1410, 1410, 1410, 1410, 1030,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1037,  350, 1410,
-     1367,  350, 1410, 1410, 1410, 1410,  350, 1410,  350,  350,
-     1410, 1368, 1369, 1266, 1267, 1268, 1276, 1410, 1410, 1410,
-     1037, 1410, 1410,  350, 1410,  350, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1262, 1410, 1410, 1410, 1410, 1410, 1043,
-     1265, 1410, 1410, 1030, 1410, 1410, 1263, 1410, 1030, 1410,
-     1030, 1030,  350, 1410, 1410, 1410, 1410, 1043, 1410, 1410,
-     1410, 1030, 1043, 1410, 1410, 1030, 1410, 1030, 1410, 1410,
-
-     1410, 1266, 1267, 1268, 1410, 1275, 1410, 1265, 1410, 1264,
-     1043, 1410, 1410, 1030, 1410, 1030, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1275, 1030, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1043, 1410, 1410, 1410, 1030, 1410, 1266, 1267,
-     1268,  350, 1030,  350,  350, 1410, 1370, 1410, 1410, 1277,
-     1410, 1276, 1410, 1410, 1410, 1043, 1410, 1410, 1030, 1410,
-     1030, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1275, 1276,
-     1410, 1410, 1410, 1410, 1043, 1410, 1410, 1410, 1030, 1410,
-     1278, 1279, 1280, 1030, 1410, 1030, 1030, 1030, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1043, 1410, 1410,
-
-     1030, 1030, 1030, 1030, 1030, 1410, 1410, 1410, 1410, 1410,
-     1275, 1410, 1265, 1410, 1276, 1410, 1410, 1410, 1410, 1410,
-     1372, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1030,
-     1410, 1410, 1373, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1266, 1267, 1268, 1030, 1410, 1030, 1030,
-     1410, 1374, 1375, 1410, 1277, 1410, 1276, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1277, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1278, 1279, 1280, 1030, 1410,
-     1030, 1030, 1410, 1376, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1410, 1410, 1410, 1278, 1279, 1280, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1277, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1278, 1279,
-     1280, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1277,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1278, 1279, 1280,    4,    4,    4,    4,    4,    4,    4,
-
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,   12,    4,    4,   18,
         4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
         4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,   22,    4,   23,    4,    4,    4,    4,    4,    4,
+
         4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
         4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+       28,    4,    4,    4,    4,    4,    4,    4,    4,    4,
         4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
         4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
         4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
         4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,   29,
+        4,   33,   34,    4,    4,    4,    4,    4,    4,    4,
         4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
 
         4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
@@ -4586,9683 +1032,533 @@ static const flex_int32_t yy_nxt[60116] =
         4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
 
         4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,   37,   37,
-       37,   37,   37,   37,   37,   37,   37, 1410,   37,   37,
-     1410,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37, 1410,   37, 1410,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37, 1410,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-     1410,   37, 1410, 1410,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-
-       37,   37,   37,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1410,   45,   45, 1410,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1410,   45, 1410,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1410,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1410,   45,   45, 1410,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   54,   54,
-       54,   54,   54,   54,   54,   54,   54, 1410,   54,   54,
-     1410,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54, 1410,   54, 1410,   54,   54,   54,   54,   54,
-
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54, 1410,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-     1410,   54, 1410, 1410,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   62,   62,   62,   62,   62,   62,   62,
-       62,   62, 1410,   62,   62, 1410,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62, 1410,   62, 1410,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62, 1410,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62, 1410,   62, 1410, 1410,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   95,   95,
-       95,   95,   95,   95,   95,   95,   95, 1410,   95,   95,
-     1410,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-
-       95,   95, 1410,   95, 1410,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95, 1410,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-     1410,   95, 1410, 1410,   95,   95,   95,   95,   95,   95,
-
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,  182,  182,  182,  182,  182,  182,  182,
-      182,  182, 1410,  182,  182, 1410,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182, 1410,  182, 1410,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182, 1410,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182, 1410,  182, 1410, 1410,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  190,  190,
-      190,  190,  190,  190,  190,  190,  190, 1410,  190,  190,
-     1410,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190, 1410,  190, 1410,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190, 1410,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-
-     1410,  190, 1410, 1410,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  213,  213,  213,  213,  213,  213,  213,
-      213,  213, 1410,  213,  213, 1410,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213, 1410,  213, 1410,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213, 1410,  213,  213,  213,
-
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213, 1410,  213, 1410, 1410,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,   62,   62,
-       62,   62,   62,   62,   62,   62,   62, 1410,   62,   62,
-
-     1410,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62, 1410,   62, 1410,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62, 1410,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-     1410,   62, 1410, 1410,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,  319,  319,  319,  319,  319,  319,  319,
-      319,  319, 1410,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  190,  190,
-
-      190,  190,  190,  190,  190,  190,  190, 1410,  190,  190,
-     1410,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190, 1410,  190, 1410,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190, 1410,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-     1410,  190, 1410, 1410,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  182,  182,  182,  182,  182,  182,  182,
-      182,  182, 1410,  182,  182, 1410,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182, 1410,  182, 1410,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182, 1410,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182, 1410,  182, 1410, 1410,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  182,  182,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,   95,   95,   95,   95,   95,   95,   95,
-       95, 1410, 1410,   95,   95, 1410,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95, 1410,   95,   95, 1410,   95, 1410,
-
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95, 1410,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95, 1410,   95, 1410, 1410,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,  363,  432,  432,  432,  432,  432,  432,  432,
-      432,  432, 1410,  432,  432, 1410,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-
-      432,  432,  432,  432,  432,  432,  432, 1410,  432, 1410,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432, 1410,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432, 1410,  432, 1410, 1410,  432,
-
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190, 1410,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
-      190,  190,  190,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  456,  456,  456,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,  463,  463,  463,  463,  463,  463,  463,
-      463,  463,  463,   54,   54,   54,   54,   54,   54,   54,
-
-       54,   54, 1410,   54,   54, 1410,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54, 1410,   54, 1410,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54, 1410,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54, 1410,   54, 1410, 1410,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,  464,  464,
-      464,  464,  464,  464,  464,  464,  464, 1410,  464,  464,
-     1410,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464, 1410,  464, 1410,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464, 1410,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-     1410,  464, 1410, 1410,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-
-      464,  464,  464,  472,  472,  472,  472,  472,  472,  472,
-      472,  472, 1410,  472,  472, 1410,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472, 1410,  472, 1410,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472, 1410,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472, 1410,  472, 1410, 1410,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-
-      213,  213, 1410,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
-      603,  603,  603,  603,  603,  603,  603,  603,  319,  319,
-      319,  319,  319,  319,  319,  319,  319, 1410,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  432,  432,  432,  432,  432,  432,  432,
-      432,  432, 1410,  432,  432, 1410,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432, 1410,  432, 1410,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432, 1410,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432, 1410,  432, 1410, 1410,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  182,  182,
-      182,  182,  182,  182,  182,  182,  182, 1410,  182,  182,
-     1410,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182, 1410,  182, 1410,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182, 1410,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-     1410,  182, 1410, 1410,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  749,  749,
-
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      749,  749,  749,   95,   95,   95,   95,   95,   95,   95,
-       95,   95, 1410,   95,   95, 1410,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95, 1410,   95, 1410,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95, 1410,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95, 1410,   95, 1410, 1410,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-
-       95,   95,   95,   95,   95,   95,   95,   95,   37,   37,
-       37,   37,   37,   37,   37,   37,   37, 1410,   37,   37,
-     1410,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37, 1410,   37, 1410,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37, 1410,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-     1410,   37, 1410, 1410,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-
-      750,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      750,  750,  750,  750,  750,  750,  750,  750,  432,  432,
-      432,  432,  432,  432,  432,  432,  432, 1410,  432,  432,
-     1410,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432, 1410,  432, 1410,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432, 1410,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-     1410,  432, 1410, 1410,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  768,  768,  768,  773,  773,
-      773,  773,  773,  773,  773,  773,  773, 1410,  773,  773,
-     1410,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773, 1410,  773, 1410,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773, 1410,  773,  773,  773,  773,  773,  773,  773,  773,
-
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-     1410,  773, 1410, 1410,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  785,   54,   54,
-       54,   54,   54,   54,   54,   54, 1410, 1410,   54,   54,
-     1410,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54, 1410,
-       54,   54, 1410,   54, 1410,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-
-       54, 1410,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-     1410,   54, 1410, 1410,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,  464,  464,  464,  464,  464,  464,  464,
-
-      464,  464, 1410,  464,  464, 1410,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464, 1410,  464, 1410,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464, 1410,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464, 1410,  464, 1410, 1410,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  792,  792,
-      792,  792,  792,  792,  792,  792,  792, 1410,  792,  792,
-     1410,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792, 1410,  792, 1410,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792, 1410,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-     1410,  792, 1410, 1410,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-
-      792,  792,  792,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472, 1410,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,  472,  472,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-
-      816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  213,  213,  213,  213,  213,  213,  213,
-      213,  213, 1410,  213,  213, 1410,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213, 1410,  213, 1410,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213, 1410,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213, 1410,  213, 1410, 1410,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  926,  926,  926,  926,  926,  926,  926,
-      926,  926,  926,  432,  432,  432,  432,  432,  432,  432,
-      432,  432, 1410,  432,  432, 1410,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432, 1410,  432, 1410,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432, 1410,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432, 1410,  432, 1410, 1410,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  773,  773,
-      773,  773,  773,  773,  773,  773,  773, 1410,  773,  773,
-     1410,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773, 1410,  773, 1410,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773, 1410,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-
-     1410,  773, 1410, 1410,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  182,  182,  182,  182,  182,  182,  182,
-      182,  182, 1410,  182,  182, 1410,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182, 1410,  182, 1410,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182, 1410,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182, 1410,  182, 1410, 1410,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1410, 1028, 1028,
-
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734, 1042, 1042,
-
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1410, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1410, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
-     1056, 1056, 1056,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,   95,   95,
-       95,   95,   95,   95,   95,   95, 1410, 1410,   95,   95,
-     1410,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95, 1410,
-       95,   95, 1410,   95, 1410,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95, 1410,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-     1410,   95, 1410, 1410,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,  182,  182,  182,  182,  182,  182,  182,
-      182,  182, 1410,  182,  182, 1410,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  182, 1410,  182, 1410,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182, 1410,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182, 1410,  182, 1410, 1410,  182,
-
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
-     1062, 1062, 1062,  432,  432,  432,  432,  432,  432,  432,
-      432,  432, 1410,  432,  432, 1410,  432,  432,  432,  432,
-
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432, 1410,  432, 1410,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432, 1410,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-
-      432,  432,  432,  432,  432, 1410,  432, 1410, 1410,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  773,  773,
-      773,  773,  773,  773,  773,  773,  773, 1410,  773,  773,
-     1410,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773, 1410,  773, 1410,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-
-      773, 1410,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-     1410,  773, 1410, 1410,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  792,  792,  792,  792,  792,  792,  792,
-
-      792,  792, 1410,  792,  792, 1410,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792, 1410,  792, 1410,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792, 1410,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792, 1410,  792, 1410, 1410,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
-
-     1079, 1079, 1079,  464,  464,  464,  464,  464,  464,  464,
-      464,  464, 1410,  464,  464, 1410,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464, 1410,  464, 1410,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464, 1410,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464, 1410,  464, 1410, 1410,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1410, 1084, 1084,
-     1410, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1410, 1084, 1410, 1084, 1084, 1084, 1084, 1084,
-
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1410, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1410, 1084, 1410, 1410, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
-     1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,  773,  773,
-      773,  773,  773,  773,  773,  773,  773, 1410,  773,  773,
-     1410,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-
-      773,  773, 1410,  773, 1410,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773, 1410,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-     1410,  773, 1410, 1410,  773,  773,  773,  773,  773,  773,
-
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  432,  432,  432,  432,  432,  432,  432,
-      432,  432, 1410,  432,  432, 1410,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432, 1410,  432, 1410,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432, 1410,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432, 1410,  432, 1410, 1410,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  182,  182,
-      182,  182,  182,  182,  182,  182,  182, 1410,  182,  182,
-     1410,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182, 1410,  182, 1410,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182, 1410,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-     1410,  182, 1410, 1410,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1410, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1410, 1042, 1042,
-
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1410, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1261, 1261,
-
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-
-      734,  734,  734,  734,  734,  734,  734,  734, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1410, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  432,  432,  432,  432,  432,  432,  432,
-      432,  432, 1410,  432,  432, 1410,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-
-      432,  432,  432,  432,  432,  432,  432, 1410,  432, 1410,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432, 1410,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432, 1410,  432, 1410, 1410,  432,
-
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1293,  773,  773,  773,  773,  773,  773,  773,
-      773,  773, 1410,  773,  773, 1410,  773,  773,  773,  773,
-
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773, 1410,  773, 1410,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773, 1410,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-
-      773,  773,  773,  773,  773, 1410,  773, 1410, 1410,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298,  792,  792,  792,  792,  792,  792,  792,
-
-      792,  792, 1410,  792,  792, 1410,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792, 1410,  792, 1410,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792, 1410,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792, 1410,  792, 1410, 1410,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  464,  464,
-      464,  464,  464,  464,  464,  464,  464, 1410,  464,  464,
-     1410,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464, 1410,  464, 1410,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464, 1410,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-     1410,  464, 1410, 1410,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-
-      464,  464,  464, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1410, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
-     1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,  182,  182,
-      182,  182,  182,  182,  182,  182,  182, 1410,  182,  182,
-     1410,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182, 1410,  182, 1410,  182,  182,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182, 1410,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-     1410,  182, 1410, 1410,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1410, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
-     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1360, 1360, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1410, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1410, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,  773,  773,
-
-      773,  773,  773,  773,  773,  773,  773, 1410,  773,  773,
-     1410,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773, 1410,  773, 1410,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773, 1410,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-     1410,  773, 1410, 1410,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  792,  792,  792,  792,  792,  792,  792,
-      792,  792, 1410,  792,  792, 1410,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792, 1410,  792, 1410,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792, 1410,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792, 1410,  792, 1410, 1410,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-
-      792,  792,  792,  792,  792,  792,  792,  792, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382,  432,  432,  432,  432,  432,  432,  432,
-      432,  432, 1410,  432,  432, 1410,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432, 1410,  432, 1410,
-
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432, 1410,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432, 1410,  432, 1410, 1410,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1410, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028,
-     1028, 1028, 1028, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1261, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1410, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1274, 1274, 1274,  792,  792,  792,  792,  792,  792,  792,
-
-      792,  792, 1410,  792,  792, 1410,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792, 1410,  792, 1410,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792, 1410,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792, 1410,  792, 1410, 1410,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792,  792, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-
-     1298, 1298, 1298,  773,  773,  773,  773,  773,  773,  773,
-      773,  773, 1410,  773,  773, 1410,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773, 1410,  773, 1410,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773, 1410,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773, 1410,  773, 1410, 1410,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,    3, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410
-    } ;
+        4,    4,    5,   19,   14,    5,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   35,   40,   46,   47,
+       53,   54,   55,   56,   60,   63,   19,    5,   51,    5,
+       57,   64,   61,   68,   72,   77,   78,    5,   80,   81,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+       14,   51,   85,   57,    5,   61,    5,   38,   38,   38,
+       38,   38,   38,   38,   38,   38,   38,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   86,   87,   88,
+       89,   90,   91,    5,   74,   74,   74,   74,   74,   74,
+
+       74,   74,   74,   74,   92,   93,   49,   94,   95,   96,
+      101,  102,  103,  105,  107,  108,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    5,    7,    7,    5,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+      109,    7,  113,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,  115,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
 
-static const flex_int32_t yy_chk[60116] =
-    {   0,
-        0,    0,    0,    0,    0,    0,    0,    0,    1,    1,
-        0,    0,    1,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1031,    0,    0,    0,    0,    0,
-        0,    1,    1,    1,    1, 1044,    1,    1,    1,    1,
-        1,    1,   16,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,   95,    1, 1031,
-       99,    1,    1,    1,  351,   16,    0,  735,  100,    0,
-     1044, 1262,   10,   15,  102,   10,   15,  351,    0,   54,
-      735,   58,    4,  101, 1262,    0,   47,   60,  352,   47,
-        1,    1,    1,    0,    1,  463,    0,   10,   15,   10,
-
-       15,  352,   54,   95,   58,    4,   99,   10,   15,   59,
-       60,   47,    5,   47,  100,   54,    7,   58,    4,    8,
-      102,   47,    1,   60,    1,    1,   10,   15,  749,  101,
-      107,  107,   59,   39,  352,    5,   39,  585,  585,    7,
-       47,  463,    8,    0,  595,   59,  595,  595,    5,  737,
-      879,  879,    7,    0,   15,    8,    0,  102,   39,  865,
-       39,   54,  737,   58,    4, 1131,  101,  101,   39,   60,
-      865,  865, 1169,   11,  749,   99, 1168,  100,  584,  584,
-      584,  584,  584,  584, 1166,   10,   15,   39,   10,   15,
-      585,   59,  904,    1,    5,  737,   11, 1131,    7,   47,
-
-     1164,    8,   47,  904,    1,    1,   60,   60, 1160,   11,
-       11,   11,    1,    1,    1,    1,    1, 1155,    1,    1,
-      874,  874,    1,    1,    1,    1,    1,   16,    5,  591,
-      591,  591,   58,    1,  588,  588,  588,  588,    1,    1,
-        2,    2,  876,  876,    2, 1154,   39, 1152,   39,   39,
-      858,  858,  880,  880,   59,   11,  885,  885,   16,   16,
-       16, 1275,  858,    2,    2,    2,    2,    4,    2,    2,
-        2,    2,    2,    2, 1150,    2,    2,    2,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,   13,
-        2,  889,  889,    2,    2,    2, 1275,    5,    4,    4,
-
-        4,    7,  902,  902,    8,  875,  875,  875,  908,  908,
-      586, 1147,   13,  586, 1145,    9,  586,  883,  883,  883,
-      883, 1136,    2,    2,    2,   13,    2,  921,    5,    5,
-        5, 1130,    7,    7,    7,    8,    8,    8,    9,    9,
-        9,   61,   13, 1129,    9,    9,    9,    9,    9,   14,
-        9,    9,    9,    9,    2, 1128,    2,    2,   11,  209,
-      211,  586,  586,  104,   61,    9,  903,  903,  903,    9,
-       12,   13,   14,  921,  877,  877,  877,   61,  877,  877,
-      877, 1127,  209,  211, 1086,   14,  104,  914,  914,   11,
-       11,   11, 1264,   12,  925,  209,  211,    9,    9,    9,
-
-      924,    9,  923,  361,   20, 1264,   12,   12,   12,   12,
-       12,   12,   12,   12,   12,   12,   12,   12,   12,  906,
-      906,  906,  906,   61,  597,    2,  361,   20,  597,  597,
-      913,   14,  597,  597, 1141, 1141,    2,    2, 1264,  361,
-       20,  209,  211,  909,    2,    2,    2,    2,    2,  901,
-        2,    2,   12,   19,    2,    2,    2,    2,    2,  900,
-       61,  894,  894,  894,  894,    2,  896,   21,  873, 1032,
-        2,    2,   23,  872,   13,  870,   19,  867,  209,   26,
-      884,  884,  884,  884,  884,  361,   20, 1159, 1159,   19,
-       21,   24, 1126, 1126, 1126,   23,  864,  894,  894,  863,
-
-        9,   22,   26,   21, 1032,   13,   13,   13,   23,  862,
-      211,    9,    9,  861,   24,   26,   27, 1162, 1162,    9,
-        9,    9,    9,    9,   22,    9,    9,   24,  860,    9,
-        9,    9,    9,    9,   14,   19,   29,   22,  859,   27,
-        9,  890,  890,  890,  890,    9,    9, 1045,  104,   21,
-     1032,  857,   27,  361,   23,   12, 1151, 1151, 1151,   29,
-      589,   26, 1153, 1153, 1153,   14,   14,   14,  911,  911,
-      911,  911,   29,   24,  890,  890,  583,   19,  582,  104,
-      104,  104, 1045,   22,  474,   20,   12,   12,   12,   20,
-      912,  912,  373,   21, 1163, 1163,   25,  372,   27,  370,
-
-       23,   23, 1171, 1171,   19,   19,  350,  216,  912,  912,
-       24,   19,  192,   24,  108,   19,   24,  106,   29,   25,
-       20,   20,   20,  598,  598,  598,   19,   19, 1045,  598,
-      105,   19,   25,    3,  598,   19,  598,  598,   19,    0,
-       26,   26,   26,   26,   28,    0,   22,   22,   22,   22,
-       22,   22,   21,   23,    0,   27,    0,   23,  212,    0,
-        0,   24,   24,    0,   26,    0,    0,   28,   30,   19,
-       19,   19, 1135, 1135, 1135, 1135,   24,  359,   25, 1276,
-       28,  212,    0,   21,   21,   21,   22,    0,   23,   23,
-       23,   30,    0,    0,  212,   26,   26,   26,    0,    0,
-
-      359,   27,    0,    0,   30,  907,  907,   24,   24,   24,
-       29,   29,   29,  359, 1276,    0,    0,   22,   22,   22,
-        0,   29,    0,    0,   25,   25,   28,   25,   25,    0,
-        0,    0,   27,   27,   27, 1137, 1137, 1137, 1137, 1137,
-      212,    0,   25,    0,   25,   25,   25,  907,  907,  907,
-       30,  907,   29,   29,   29,    0,   31,    0,    0,  359,
-     1276,   32,    0,   28,   28,   28,   28,   28,   28,   28,
-       28,   28,   28,   28,   28,   28,   28,  212,    0,   31,
-      581,   25,   35,    0,   32,  362,  581,    0,    0,    0,
-      581,    0,   31,    0,    0,    0,  359,   32,    0,    0,
-
-        0,  581,  581,    0,    0,   35,  581,    0,  362,    0,
-      581,    0,   25,   25,   25,    0,    0,    0,   35,   30,
-       30,  362,    0,   33,   30,    0,   30,    0,   30,   28,
-       30,    0,    0,    0,   36,    0,   30,   30,   31,    0,
-        0,    0,   30,   32,   30,    0,   33,   30,    0,   30,
-       30,    0,  922,   30,  922,  922,  922,   36,    0,   33,
-       28,   28,   28,    0,   35,    0,    0,  362,    0,  922,
-       36,    0,   34,    0,  922,    0,   31,    0,   31,    0,
-       32,   32,   32,    0,   30,   30,   30,    0,   31,    0,
-        0,   31,   32,    0,    0,   34, 1138, 1138, 1138, 1138,
-
-       31,   31,   31,   31,  362,   33,   31,   31,   34,   32,
-        0,   32,   31,    0,    0,   31,   36,   31,   32,   32,
-       31,    0,   31,   31,   31,    0,   31,   37,    0,    0,
-        0,   32,   38,   32,    0,    0,   32,   32,    0,    0,
-        0,   31,   33,    0,   33,   33,   32,    0, 1140, 1140,
-       37, 1140, 1140,   35,   34,   38,    0,   35,   35,    0,
-        0,   35,   35,   37,    0,    0,   42,   35,   38,   36,
-       36,   36,   31,   31,   31,   36,    0,   32,   32,   32,
-       36,   41,   36,   36,  868,  868,  868,  868,  868,   42,
-        0,    0,    0,  868,  868,    0,    0,    0,   35,   35,
-
-       35,    0,   42,    0,   41,    0,    0,    0,   33,   37,
-       34,    0,    0,    0,   38,   34,   34,   41,   34,   36,
-       40,    0,    0,   40,   34,    0,   34,   34,   34,    0,
-       34,    0,   34,   43,   34,    0,   44,    0,   34,   33,
-       33,   33,   45,    0,    0,   40,    0,   40,   42,    0,
-       36,   36,   36,    0,    0,   40,   43,   34,   46,   44,
-        0,    0,    0,   41,    0,   45,    0,    0,    0,   43,
-        0,    0,   44,   48,   40,    0,   48,    0,   45,    0,
-       50,   46,    0,   51,    0,    0,   52,    0,   34,   34,
-       34,    0,    0,    0,   46,    0,    0,    0,   48,    0,
-
-       48,   40,    0,   50,   56,   53,   51,   56,   48,   52,
-        0,   42,   37,    0,    0,   43,   50,   38,   44,   51,
-        0,    0,   52,    0,   45,    0,    0,   48,   53,   56,
-        0,   56,   41,   40,   55,   40,   40,    0,    0,   56,
-       46,   53,    0,   37,   37,   37,    0,    0,   38,   38,
-       38,   42,   43,   43,   48,   44,    0,   55,   56,    0,
-        0,    0,   50,    0,    0,   51,   41,    0,   52,    0,
-       55,    0,    0,   62,   46,    0,   57,    0,    0,   57,
-        0,    0,   42,   42,   42,    0,   48,   53,    0,   48,
-      869,  869,  869,  869,  869,  869,   62,   41,   41,   41,
-
-        0,   57,    0,   57,    0,   52,   52,    0,    0,   62,
-        0,   57,  184,    0,    0,  184,   55,   56,   43,   56,
-       56,   44,    0,    0,   53,   68,    0,   45,   51,    0,
-       57,   50, 1161, 1161, 1161, 1161, 1161,  184,    0,  184,
-        0,    0,    0,   46,   69,    0,    0,  184,   68,   43,
-       43,   43,   44,   44,   44,   62,    0,   57,   45,   45,
-       45,   68,    0,    0,    0,   50,  184,   69,   51,    0,
-        0,   52,   67,    0,   46,   46,   46,    0,    0,    0,
-       69,    0,  882,  882,  882,  882,  882,  882,  882,   57,
-       53,   57,   57,   71,    0,   67,   50,   50,   50,   51,
-
-       51,   51,   52,   52,   52,    0,    0,   68,   67,    0,
-       63, 1165, 1165, 1165, 1165, 1165,   71,  882,  882,   55,
-        0,   53,   53,   53,    0,  184,   69,  184,  184,   71,
-        0,    0,    0,   63,   63,   63,    0,    0,    0,   63,
-       63,   63,   63,   63,    0,   63,   63,   63,   63,   64,
-       55,   55,   55,    0,   67,    0,    0,    0,   62,    0,
-       63, 1157, 1157, 1157,   63, 1157, 1157, 1157, 1157, 1157,
-       69,    0,   64,   64,   64,   71,    0,   72,   64,   64,
-       64,   64,   64,    0,   64,   64,   64,   64,    0,   62,
-       62,   62,   63,   63,   63,    0,   63,    0,    0,   64,
-
-       72,    0,    0,   64,    0,    0,   68,    0,    0,    0,
-       68,    0,    0,   72,  895,  895,  895,  895,    0,  895,
-      895,   71,   71,   67,   67, 1167, 1167, 1167, 1167,   69,
-       67,   64,   64,   64,   67,   64,    0,    0,    0,    0,
-       70,   68,   68,   68,    0,   67,   67,    0,  587,  587,
-       67,  587,  587,    0,   67,    0,    0,   67,    0,   72,
-       69,   69,   69,   70,    0,    0,  587,    0,  587,  587,
-      587,    0,    0,    0,   71,    0,   70,    0,   71,  871,
-      871,  871,  871,  871,  871,  871,  871,  871,   67,   67,
-       67, 1142, 1142, 1142, 1142,   63,   72,    0,    0,   72,
-
-       73,    0,   72,    0,    0,    0,   63,   63,    0,   71,
-       71,   71,    0,    0,   63,   63,   63,   63,   63,    0,
-       63,   63,   70,   73,   63,   63,   63,   63,   63, 1158,
-     1158, 1158, 1158, 1158,   64,   63,   73,    0,    0,    0,
-       63,   63,    0, 1142, 1142,   64,   64,   72,   72,    0,
-        0,    0,    0,   64,   64,   64,   64,   64,    0,   64,
-       64,    0,   72,   64,   64,   64,   64,   64,  905,  905,
-      905,  905,  905,  905,   64,    0, 1158, 1158,    0,   64,
-       64,   65,   73,    0,   65,   70,   70,   70,   70,   70,
-       70,    0,    0,   72,   72,   72, 1133, 1133, 1133, 1133,
-
-     1133, 1133, 1133,    0,   65,   65,   65,    0,   65,   65,
-       65,   65,   65,   65,    0,   65,   65,   65,   65, 1143,
-     1143, 1143, 1143,    0,    0,   70,    0, 1143,   73,   73,
-       65,   73,   73,    0,   65,   65,    0,    0,   74,    0,
-        0, 1143,   75, 1143, 1143, 1143,   73,    0,   73,   73,
-       73, 1170, 1170, 1170, 1170, 1170,   70,   70,   70,    0,
-        0,   74,   65,   65,   65,   75,   65, 1134, 1134, 1134,
-     1134, 1134, 1134, 1134,   74,    0,    0,    0,   75, 1144,
-     1144, 1144, 1144, 1144, 1144,   73,    0,   90,    0,    0,
-        0,    0,    0,    0,   65,    0,   65,   65,  371,  371,
-
-      371,  371,  371,  371,  371,  371,  371,  371,  371,    0,
-       90,    0,    0,    0,    0,    0,   73,   73,   73,    0,
-       74,   86,    0,   90,   75,    0,   77,    0,    0,    0,
-        0,   81, 1146, 1146, 1146, 1146, 1146,    0,   83,    0,
-        0,    0,    0,    0,   86,  371,    0, 1146, 1146,   77,
-     1146,    0,    0,    0,   81,    0,   76,   86,   86,   86,
-        0,   83,   77,    0,    0,   65,    0,   81,    0,   90,
-        0,    0,    0,    0,   83,    0,   65,   65,    0,   76,
-        0,   75,    0,    0,   65,   65,   65,   65,   65,    0,
-       65,   65,   76,    0,   65,   65,   65,   65,   65,   74,
-
-       74,   74,   74,   86,    0,   65,    0,    0,   77,    0,
-       65,   65,   66,   81,    0,   66,    0,    0,    0,    0,
-       83,    0,    0,   74,    0,    0,    0,   75,    0,    0,
-        0,    0,   90,    0,    0,   66,   66,   66,   76,   66,
-       66,   66,   66,   66,   66,    0,   66,   66,   66,   66,
-       81,    0,   81,   81,   74,   74,   74,    0,   75,   75,
-       75,   66,    0,    0,    0,   66,   66,    0,    0,    0,
-        0,    0,   90,    0,    0,   76,   76,   76,   76,   76,
-       76,   76,   76,   76,   76,   76,   76,   76,   76,    0,
-        0,    0,    0,   66,   66,   66,   78,   66,    0,    0,
-
-       77,   77,   77,   90,   90,   90,   86,    0,    0,   83,
-        0,   77,    0,   83,   83,    0,   81,   83,   83,   78,
-        0,    0,    0,   83,    0,   66,    0,   66,   66,    0,
-       82,    0,   78,    0,    0,    0,    0,   86,   86,   86,
-        0,   76,   77,   77,   77,    0,    0,   81,   81,   81,
-        0,    0,    0,   82,   83,   83,   83,  886,  886,  886,
-      886,  886,  886,  886,  886,    0,   82,    0,    0,    0,
-        0,    0,   76,   76,   76,   79,  886,    0,   78,  590,
-      590,  590,  590,  590,  590,  590,  590,  590,  590,  590,
-      590,  590,  590,    0,    0,    0,   66,   96,   79, 1139,
-
-     1139, 1139, 1139, 1139, 1139, 1139,    0,   66,   66,   80,
-        0,   79,   82,    0,    0,   66,   66,   66,   66,   66,
-       96,   66,   66,    0,    0,   66,   66,   66,   66,   66,
-        0,    0,   80,   96,    0,    0,   66,    0,    0,    0,
-        0,   66,   66,    0,    0,   80,    0,   78,   78,    0,
-        0,    0,   78,    0,   78,    0,   78,   79,   78,    0,
-        0,    0,    0,    0,   78,   78,    0,    0,   82,    0,
-       78,    0,   78,   82,   82,   78,   82,   78,   78,   96,
-       89,   78,   82,    0,   82,   82,   82,    0,   82,    0,
-       82,   80,   82,    0,    0,   79,   82,   79,    0,    0,
-
-        0,   84,    0,   89,    0,    0,    0,   79,    0,    0,
-       79,    0,   78,   78,   78,   82,   89,    0,    0,   79,
-       79,   79,   79,    0,   84,   79,   79,    0,   80,   80,
-       80,   79,    0,    0,   79,    0,   79,   84,    0,   79,
-       80,   79,   79,   79,    0,   79,   82,   82,   82,    0,
-        0,   91,    0,    0,    0,    0,    0,   80,    0,   80,
-       79,    0,   89,   87,    0,    0,   80,   80,    0,    0,
-        0,    0,    0,    0,   91,    0,    0,    0,    0,   80,
-        0,   80,   96,   84,   80,   80,   87,   91,    0,    0,
-        0,   79,   79,   79,   80,    0,    0,    0,    0,   87,
-
-        0,    0,   87,   87,   87,   87,   87,   87,   87,   87,
-       87,   87,   88,   96,   96,   96, 1156, 1156, 1156, 1156,
-     1156, 1156, 1156,    0,    0,   80,   80,   80,    0,    0,
-        0,   89,    0,   91,    0,   88,   84,   84,   84,   92,
-       97,   97,   84,    0,   97,   87,    0,   84,   88,   84,
-       84,   88,   88,   88,   88,   88,   88,   88,   88,   88,
-       88,    0,   92,   97,   93,   89,   97,    0,   97,    0,
-       91,   91,    0,    0,    0,   92,   97, 1132, 1132, 1132,
-     1132, 1132, 1132, 1132, 1132, 1132,   84,   93,    0,    0,
-        0,    0,    0,  109,   88,   97,   89,   89,   89,    0,
-
-       93,   93,   93,   93,   93,   93,   93,   93,   93,   93,
-       93,   93,   93,    0,    0,    0,  109,   84,   84,   84,
-        0,   92,    0,    0, 1132,    0,    0,   94,   94,  109,
-        0,   94,    0,  918,    0,  918,   91,  918,  918,  918,
-      918,  918,  918,  918,    0,    0,   93,    0,   87,  110,
-       94,    0,    0,   94,   97,   94,   97,   97,   92,    0,
-       98,   98,    0,   94,   98,    0,  111,   91,   91,   91,
-      113,    0,  110,    0,    0,  109,   94,    0,  115,   87,
-       87,   87,   94,   98,  116,  110,   98,    0,   98,  111,
-      103,  103,    0,  113,  103,    0,   98,   88,    0,    0,
-
-        0,  115,  111,    0,    0,    0,  113,  116,    0,   94,
-        0,    0,    0,  103,  115,   98,  103,    0,  103,    0,
-      116,    0,    0,    0,   92,    0,  103,    0,   88,   88,
-       88,  110,    0,    0,  185,    0,    0,  185,    0,    0,
-        0,   94,   98,   94,   94,  103,    0,  112,  111,   93,
-        0,    0,  113,    0,    0,   92,   92,   92,    0,  185,
-      115,  185,    0,    0,  117,  110,  116,    0,    0,  185,
-      112,    0,  103,    0,   98,    0,   98,   98,  109,    0,
-       93,   93,   93,  112,    0,    0,    0,  117,  185,    0,
-      114,    0,    0,    0,  118,    0,    0,    0,    0,  120,
-
-      117,    0,    0,    0,  103,    0,  103,  103,    0,  109,
-      109,  109,   94,  114,    0,  185,  119,  118,    0,  113,
-        0,    0,  120,    0,    0,    0,  114,    0,    0,  112,
-      118,    0,    0,    0,  110,  120,    0,    0,    0,  119,
-        0,    0,    0,   94,   94,   94,  117,  185,    0,  185,
-      185,  111,  119,    0,  121,  113,    0,  116,  115,    0,
-        0,    0,    0,  115,    0,  110,  110,  110,    0,  116,
-        0,    0,  114,    0,    0,  103,  118,  121,    0,    0,
-        0,  120,  111,  111,  111,    0,  113,  113,  113,    0,
-      121,    0,    0,    0,  115,  115,  115,    0,  119,    0,
-
-      116,  116,  116,    0,    0,    0,  103,  103,  103,    0,
-        0,  124,    0,    0,  112,  112,  112,  112,  112,  112,
-      112,  112,  112,  112,  112,  112,  112,  112,  112,    0,
-        0,  117,  112,    0,  124,    0,  121,  123,    0,  119,
-        0,    0,    0,    0,    0,  114,  114,  124,    0,  117,
-        0,    0,    0,  122,    0,    0,    0,  114,    0,    0,
-      123,    0,    0,  112,  112,  112,    0,    0,  118,    0,
-      120,    0,    0,  123,    0,  114,  122,    0,    0,  118,
-      117,  117,  117,    0,  120,    0,    0,    0,  121,  122,
-        0,    0,    0,  124,    0,    0,    0,    0,    0,  121,
-
-      121,  119,    0,    0,    0,    0,  114,  114,  114,    0,
-      118,  118,  118,    0,    0,  120,  120,  120,  125,  123,
-        0,  126,    0,    0,    0,    0,    0,    0,  127,    0,
-        0,    0,  119,  119,  119,  122,    0,  128,    0,  121,
-        0,  125,    0,    0,  126,    0,  124,  124,  124,  124,
-      124,  127,    0,    0,  125,  124,  124,  126,    0,    0,
-      128,  123,    0,    0,  127,    0,    0,    0,    0,    0,
-      121,  121,  121,  128,    0,  129,  122,  122,  122,  122,
-      122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
-      122,    0,  122,    0,    0,    0,  124,    0,  129,    0,
-
-      125,    0,    0,  126,    0,    0,    0,    0,    0,    0,
-      127,  129,    0,    0,    0,    0,    0,    0,    0,  128,
-        0,    0,  123,  130,    0,    0,    0,  124,  124,  124,
-      122,  122,  122,  122,    0,    0,    0,  131,  122,    0,
-        0,  132,    0,    0,    0,    0,  130,  125,  125,  125,
-      125,  125,  125,  123,  123,  123,  128,  129,    0,  130,
-      131,    0,    0,    0,  132,    0,  133,    0,    0,  122,
-      122,  122,    0,  131,    0,    0,    0,  132,    0,  127,
-      127,  127,  127,  127,  127,  127,  127,  127,    0,  133,
-        0,    0,  135,    0,    0,    0,    0,    0,    0,  126,
-
-        0,    0,  133,  125,    0,  130,  126,    0,    0,    0,
-        0,    0,    0,  127,    0,  135,    0,    0,    0,  131,
-      141,    0,  128,  132,    0,    0,    0,    0,  135,    0,
-        0,    0,    0,    0,  125,  125,  125,  126,  126,  126,
-      129,  134,  130,  141,  127,  127,  127,    0,  133,  136,
-        0,    0,    0,  128,  128,  128,  141,    0,    0,    0,
-      129,  137,    0,    0,  134,    0,    0,    0,    0,  130,
-      130,    0,  136,    0,  135,    0,    0,  134,    0,    0,
-        0,    0,    0,    0,  137,  136,    0,    0,    0,  139,
-        0,  129,  129,  129,    0,    0,  145,  137,    0,  131,
-
-      131,  131,  141,    0,    0,  133,  133,  133,  130,  133,
-      133,  133,  139,  132,  132,  135,  135,    0,    0,  145,
-        0,    0,  131,  134,    0,  139,  132,    0,  596,    0,
-        0,  136,  145,  596,  596,    0,  596,    0,    0,  130,
-      130,  130,  596,  137,  596,  596,  596,    0,  596,  138,
-      596,  133,  596,  131,  131,  131,  596,  132,  132,  132,
-      134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
-      134,  139,  138,    0,    0,    0,    0,  135,  145,    0,
-        0,    0,  133,  133,  133,  138,  600,  600,  600,  600,
-      600,  600,  600,  600,  600,  600,  600,    0,  136,  136,
-
-        0,  141,  141,    0,  140,  141,    0,  152,  135,  135,
-      135,    0,  137,  137,  137,  137,  137,  137,  137,  142,
-      137,  137,  137,  137,  137,  137,  134,  140,  145,  145,
-      152,  138,    0,  600,  136,    0,  141,  141,  141,    0,
-      140,    0,  142,  152,    0,    0,  137,    0,  433,  146,
-        0,  433,    0,    0,    0,  142,    0,  134,  134,  134,
-        0,    0,    0,    0,    0,  136,  136,  136,  139,  139,
-      139,  139,  146,  433,  139,  433,    0,  137,  137,  137,
-        0,  145,    0,  433,    0,  146,  140,  147,    0,  152,
-        0,    0,    0,    0,  138,  138,  138,  138,  138,  138,
-
-      138,  142,  433,    0,    0,  139,  139,  139,    0,    0,
-      147,    0,  145,  145,  145,    0,    0,    0,    0,    0,
-        0,    0,    0,  147,    0,    0,    0,    0,    0,  138,
-      138,  146,  150,    0,  138,    0,    0,  151,  142,  142,
-      142,  142,  142,  142,  142,  142,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  150,    0,  142,    0,    0,
-      151,  433,    0,  433,  433,  138,  138,  138,  150,  147,
-        0,    0,    0,  151,  152,    0,  146,  146,  146,  146,
-        0,    0,  140,  140,  140,  140,  140,    0,    0,  140,
-        0,    0,  152,  833,  833,  833,  833,  833,  833,  833,
-
-      833,  833,  833,  833,  142,    0,    0,    0,    0,  146,
-      146,    0,    0,    0,  150,    0,    0,    0,    0,  151,
-      140,  140,  140,  152,  152,  152,    0,    0,    0,    0,
-        0,    0,    0,    0,  146,  142,  142,  142,  143,    0,
-      833,    0,    0,    0,    0,  158,  147,  147,  147,  147,
-      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
-      162,  143,    0,    0,    0,  146,  146,  146,  158,    0,
-        0,    0,  147,    0,  143,  150,  150,  150,  150,    0,
-        0,  158,    0,  162,    0,    0,    0,  156,    0,  881,
-      881,  881,  881,  881,  881,  881,  162,  881,  881,  881,
-
-      881,  881,  881,  147,  147,  147,    0,    0,    0,    0,
-      156,  150,  150,  151,  151,  151,  151,  150,  151,  151,
-      143,    0,  151,  156,    0,    0,    0,  158,  878,  878,
-      878,  878,  878,  878,  878,  878,  878,  878,  878,    0,
-        0,    0,  162,    0,    0,    0,    0,    0,  150,  150,
-      150,    0,    0,  151,  151,  151,    0,  143,  143,  143,
-      143,  143,  143,  143,  143,  143,  143,  143,    0,  156,
-        0,    0,    0,  143,  143,  143,  143,  143,  143,  143,
-      143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
-      143,  143,  143,  143,  143,  143,  143,  143,  143,    0,
-
-        0,    0,    0,    0,  143,  143,  143,  143,  143,  143,
-      143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
-      143,    0,    0,  143,    0,    0,  158,  158,    0,    0,
-      158,  162,  162,  162,  162,    0,    0,    0,  156,    0,
-        0,    0,    0,    0,    0,  162,    0,    0,    0,    0,
-        0,  180,    0,    0,  143,  143,  143,  144,    0,    0,
-        0,  158,  158,  158,    0,    0,    0,    0,    0,    0,
-        0,  179,  156,    0,  180,  157,  162,  162,  162,  169,
-      144,    0,    0,    0,    0,    0,  148,  180,    0,    0,
-        0,  149,    0,  144,  179,    0,    0,    0,  157,    0,
-
-        0,    0,  169,  156,  156,  156,    0,  179,    0,  148,
-        0,  157,  592,  592,  149,  169,    0,  592,    0,  592,
-        0,  592,  148,  592,    0,    0,    0,  149,    0,  592,
-      592,    0,    0,  180,    0,  592,    0,  592,    0,  144,
-      592,    0,  592,  592,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  179,    0,    0,    0,  157,    0,    0,
-        0,  169,    0,    0,    0,    0,    0,    0,  148,    0,
-        0,    0,    0,  149,    0,    0,  144,  144,  144,  144,
-        0,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,    0,  144,  144,  144,  144,  144,
-
-      144,  144,  144,  144,  144,  144,  144,  144,    0,    0,
-      148,  148,  180,  149,  149,  149,  149,  149,  149,  149,
-      149,  149,  149,  149,  149,  149,  149,  149,  149,  149,
-      149,  149,  149,  149,  149,    0,  180,  144,  144,    0,
-      179,  169,  144,  148,  148,  148,  148,  148,  148,  148,
-      148,  148,  148,  157,    0,    0,  179,    0,    0,    0,
-      157,    0,    0,    0,  169,    0,    0,  180,  180,  180,
-        0,  148,    0,  144,  144,  144,  149,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  179,  179,  179,
-        0,  157,  157,  157,    0,  169,  169,  169,    0,    0,
-
-        0,    0,  148,  148,  148,    0,    0,  149,  149,  149,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153,  154,  154,  949,  949,  949,  949,
-      949,  949,  949,  949,  949,  949,  949,    0,  154,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
-
-      154,  154,  154,  154,  154,  155,  154,  154,  154,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
-      154,  154,    0,  949,  159,    0,    0,  160,  155,    0,
-      161,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  155,    0,    0,    0,    0,  165,  159,  434,  163,
-      160,  434,    0,  161,    0,    0,    0,    0,    0,    0,
-      159,  466,    0,  160,  466,  774,  161,    0,  774,  165,
-        0,    0,  163,  434,    0,  434,    0,    0,    0,    0,
-        0,    0,  165,  434,  164,  163,  466,  155,  466,    0,
-      774,    0,  774,    0,    0,    0,  466,    0,    0,    0,
-
-      774,    0,  434,    0,    0,    0,  159,  164,    0,  160,
-        0,    0,  161,    0,    0,  466,    0,    0,    0,  774,
-      164,    0,    0,    0,  155,  155,  155,  155,  165,  434,
-        0,  163,  155,  155,  155,  155,  155,  155,  155,  155,
-      155,  155,    0,    0,  155,  155,  155,  155,  155,  155,
-      155,  155,  155,  155,  155,  155,  159,  159,  159,  793,
-        0,  434,  793,  434,  434,    0,  164,    0,    0,  170,
-        0,    0,  155,    0,  466,  168,  466,  466,  774,    0,
-      774,  774,  163,  163,  793,  155,  793,    0,    0,    0,
-      155,  166,  170,    0,  793,    0,  165,  160,  168,  161,
-
-      161,  161,  161,  161,  161,  170,    0,    0,  160,  159,
-        0,  168,  160,  793,  166,  161,  167,    0,    0,    0,
-        0,  155,  155,  155,  163,  163,  163,  166,  163,    0,
-        0,  165,    0,    0,  163,    0,    0,    0,    0,  167,
-      159,  159,  159,  160,  160,  160,  161,  161,  161,  164,
-      164,  170,  167,    0,  207,  207,  181,  168,  207,    0,
-        0,    0,  165,  165,  165,  163,  163,  163,    0,  164,
-        0,    0,  793,  166,  793,  793,    0,  207,    0,  181,
-      207,    0,  207,    0,    0,    0,    0,    0,    0,    0,
-      207,    0,  181,    0,    0,    0,    0,    0,  167,    0,
-
-      164,  164,  164,    0,    0,    0,    0,    0,  171,  207,
-        0,  166,  166,  166,  166,  166,  166,  166,  166,  166,
-      166,  166,  166,  166,  168,  168,    0,    0,    0,    0,
-        0,  171,    0,    0,    0,    0,  207,    0,  181,    0,
-      166,  166,  168,  168,  171,    0,    0,    0,    0,    0,
-      170,  170,    0,    0,  170,    0,    0,    0,  177,    0,
-      168,    0,    0,  167,  167,  167,  167,    0,  207,    0,
-      207,  207,    0,    0,  182,    0,  166,  183,    0,    0,
-      186,  177,    0,    0,    0,  170,  170,  170,  173,    0,
-      171,  168,  168,  168,  177,    0,    0,  182,    0,    0,
-
-      183,  167,    0,  186,    0,    0,    0,  166,  166,  166,
-      182,  173,  181,  183,    0,    0,  186,    0,    0,    0,
-        0,    0,    0,    0,  173,    0,    0,    0,    0,    0,
-        0,    0,  167,  167,  167,    0,    0,    0,    0,    0,
-      177,  181,    0,  171,  171,  171,  171,  171,  171,  171,
-      171,  171,  171,    0,    0,    0,  182,    0,    0,  183,
-        0,    0,  186,  892,  892,    0,    0,    0,    0,    0,
-      173,    0,  181,  181,  181,  171,  171,  171,  171,  171,
-      171,  171,  171,  171,  171,  171,  171,  171,  171,  171,
-      171,    0,    0,  171,  177,    0,  892,  892,  892,  892,
-
-      892,  892,  892,  892,  892,  892,  189,    0,  173,  173,
-      173,    0,  173,  173,  173,  173,  173,  173,  188,  173,
-      173,  173,  173,    0,  171,  171,  171,  172,    0,  189,
-        0,  186,    0,  173,  173,    0,    0,    0,  173,  173,
-      177,  188,  189,  177,    0,    0,  174,    0,    0,    0,
-      172,    0,    0,    0,  188,    0,    0,    0,    0,  182,
-        0,    0,  183,  172,    0,  186,  173,  173,  173,  174,
-      173,    0,    0,  173,  177,  177,  177,    0,    0,    0,
-        0,    0,  174,    0,    0,    0,    0,    0,  189,    0,
-      182,  182,  182,  183,  183,  183,  186,  186,  186,    0,
-
-      188,    0,    0,  187,  173,  173,  173,    0,  178,  172,
-      856,  856,  856,  856,  856,  856,  856,  856,  856,  856,
-      856,  856,  856,  856,  856,  189,  187,    0,  174,    0,
-        0,  178,    0,    0,    0,    0,    0,  188,  188,  187,
-        0,    0,    0,    0,  178,    0,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,    0,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-        0,  172,    0,  175,    0,  187,  172,    0,  172,  172,
-      178,  189,  174,    0,  174,    0,  174,  174,  174,  174,
-
-      174,  174,  174,  188,    0,    0,  175,    0,    0,    0,
-        0,    0,  172,    0,    0,    0,    0,    0,    0,  175,
-        0,    0,  189,  189,  189,    0,    0,    0,    0,    0,
-      190,  174,    0,  193,  188,  188,  188,    0,    0,    0,
-        0,    0,    0,  172,  172,  172,    0,    0,  187,    0,
-        0,  176,    0,  190,    0,  196,  193,    0,  194,    0,
-        0,    0,  174,  174,  174,  175,  190,    0,  178,  193,
-      178,  178,  178,    0,  176,    0,    0,    0,  196,    0,
-        0,  194,    0,    0,    0,  178,    0,  176,  187,    0,
-      178,  196,    0,  178,  194,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,  175,    0,  195,    0,
-        0,    0,  190,    0,    0,  193,  175,  175,    0,  187,
-      187,  187,    0,  175,  178,  178,  178,    0,    0,    0,
-        0,  195,    0,  176,  198,  175,    0,  196,  175,    0,
-      194,    0,    0,  175,  195,  175,  175,    0,  175,    0,
-        0,    0,    0,    0,    0,    0,    0,  198,    0,    0,
-      175,    0,    0,  175,  175,    0,    0,    0,  175,    0,
-      198,  176,  176,  176,  196,  176,    0,  176,  176,    0,
-      176,  199,    0,    0,  193,    0,    0,  176,    0,  176,
-      195,    0,    0,  176,    0,  176,  176,    0,  176,  175,
-
-      175,  175,  176,  194,  199,    0,    0,  176,    0,  176,
-      176,  176,  176,    0,    0,  190,  198,  199,  193,  176,
-        0,    0,    0,    0,    0,    0,    0,  195,  195,  176,
-      197,  197,    0,  176,  197,    0,  176,    0,    0,    0,
-      196,    0,    0,  194,    0,    0,  190,  190,  190,  193,
-      193,  193,    0,  197,  200,    0,  197,    0,  197,  201,
-        0,    0,    0,  199,    0,    0,  197,  176,  176,  176,
-        0,  196,  196,  196,  194,  194,  194,  200,    0,    0,
-        0,  202,  201,    0,    0,  197,    0,    0,    0,    0,
-      200,    0,    0,  195,    0,  201,    0,    0,    0,    0,
-
-      199,    0,    0,    0,  202,    0,  203,    0,    0,  206,
-        0,    0,  197,    0,    0,    0,    0,  202,    0,  198,
-      208,    0,    0,    0,  195,  195,  195,    0,    0,  203,
-        0,  205,  206,    0,  204,    0,  200,    0,    0,    0,
-        0,  201,  203,  208,  197,  206,  197,  197,  213,    0,
-      198,  198,  198,    0,  205,    0,  208,  204,    0,    0,
-        0,    0,    0,  202,    0,    0,  199,  205,    0,  214,
-      204,  213,    0,  200,  200,  200,  200,  200,  200,  200,
-      200,  200,  200,  200,  213,    0,    0,    0,  203,    0,
-        0,  206,  214,    0,    0,    0,  218,  199,  199,  199,
-
-      202,    0,  208,    0,    0,  214,  217,    0,    0,  201,
-        0,    0,    0,  205,    0,  197,  204,    0,    0,  218,
-      200,    0,    0,    0,    0,  203,    0,    0,  206,  217,
-      213,    0,  218,    0,    0,    0,    0,    0,    0,  200,
-        0,    0,  217,    0,  201,    0,  197,  197,  197,    0,
-      210,  214,    0,  204,  204,  204,  204,  204,  204,  204,
-      204,  204,  204,  204,    0,    0,  202,    0,    0,    0,
-      200,  200,  200,  210,    0,  201,  201,  201,  218,  219,
-        0,  205,    0,    0,    0,  220,  210,    0,  217,    0,
-        0,  203,    0,    0,  206,    0,    0,  202,  202,  202,
-
-      204,    0,  219,    0,    0,  208,  225,    0,  220,    0,
-        0,    0,    0,    0,    0,  219,  205,    0,    0,  204,
-        0,  220,  203,  203,  203,  206,  206,  206,    0,  225,
-        0,    0,  210,  213,    0,    0,  208,  208,  208,    0,
-        0,  218,  225,    0,    0,    0,    0,  205,  205,  205,
-      204,  204,  204,    0,  214,    0,    0,  217,    0,    0,
-        0,  219,    0,    0,  213,  213,  213,  220,    0,  210,
-      210,  210,  210,  210,  210,  210,  210,  210,  210,  210,
-        0,  218,    0,    0,    0,  214,  214,  214,  225,    0,
-        0,  217,    0,    0,    0,    0,  221,    0,  219,  219,
-
-        0,    0,    0,    0,  220,    0,    0,    0,    0,    0,
-        0,    0,  218,  218,  218,    0,  210,    0,    0,  221,
-      221,  221,  217,  217,  217,  221,  221,  221,  221,  221,
-        0,  221,  221,  221,  221,    0,    0,  226,    0,  357,
-      357,    0,    0,  357,    0,    0,  221,    0,    0,  228,
-      221,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      226,    0,  357,    0,  219,  357,    0,  357,    0,    0,
-      220,    0,  228,  226,    0,  357,    0,    0,  221,  221,
-      221,    0,  221,    0,    0,  228,    0,  225,    0,    0,
-        0,  225,    0,    0,  357,  219,  219,  219,    0,  222,
-
-      222,  220,  220,  220,  222,  222,  222,  222,  222,    0,
-      222,  222,  222,  222,    0,    0,    0,    0,    0,  226,
-        0,  357,  225,  225,  225,  222,    0,    0,    0,  222,
-        0,  228,    0,    0,    0,    0,  223,  223,    0,    0,
-        0,  223,  223,  223,  223,  223,    0,  223,  223,  223,
-      223,    0,    0,  357,    0,  357,  357,  222,  222,  222,
-        0,  222,  223,  226,    0,    0,  223,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  228,  228,    0,
-        0,  221,  224,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  221,  221,  223,  223,  223,    0,  223,    0,
-
-      221,  221,  221,  221,  221,  224,  221,  221,    0,    0,
-      221,  221,  221,  221,  221,    0,  229,    0,  224,    0,
-        0,  221,  226,    0,    0,  227,  221,  221,    0,    0,
-      228,    0,    0,  231,  228,    0,    0,    0,    0,  229,
-        0,    0,    0,    0,    0,    0,    0,    0,  227,    0,
-        0,    0,  229,  226,  226,  226,  231,    0,    0,    0,
-      222,  227,    0,    0,  224,  228,  228,  228,    0,  231,
-        0,  222,  222,    0,    0,    0,  230,    0,    0,  222,
-      222,  222,  222,  222,    0,  222,  222,    0,    0,  222,
-      222,  222,  222,  222,    0,    0,    0,  223,  229,  230,
-
-      222,    0,    0,    0,    0,  222,  222,  227,  223,  223,
-        0,    0,  230,    0,    0,  231,  223,  223,  223,  223,
-      223,    0,  223,  223,    0,    0,  223,  223,  223,  223,
-      223,    0,    0,  224,  224,  229,    0,  223,  229,    0,
-      224,  229,  223,  223,  224,  232,    0,    0,    0,    0,
-        0,    0,    0,  234,  360,  224,  224,    0,  230,    0,
-      224,    0,    0,    0,  224,    0,    0,  224,  232,    0,
-      227,  227,  227,  227,  227,  227,  234,  360,    0,    0,
-      233,  232,    0,    0,    0,    0,  229,  229,    0,  234,
-      360,    0,    0,    0,  231,  231,  231,  231,  224,  224,
-
-      224,  229,    0,  233,  230,  230,    0,  230,  230,    0,
-      227,    0,    0,    0,    0,    0,  233,    0,  231,    0,
-        0,    0,  230,    0,  230,  230,  230,  232,    0,    0,
-        0,  235,  229,  229,  229,  234,  360,    0,    0,    0,
-        0,  227,  227,  227,    0,    0,    0,    0,    0,  231,
-      231,  231,    0,    0,  235,    0,    0,    0,    0,    0,
-        0,  230,  233,  467,    0,    0,  467,  235,    0,    0,
-        0,    0,    0,  360,  360,  360,  360,  360,  360,  360,
-      360,  360,  360,  360,  232,    0,    0,    0,  467,    0,
-      467,    0,  230,  230,  230,  236,    0,    0,  467,  233,
-
-      233,  233,  233,  233,  233,  233,  233,  233,  233,  233,
-      233,  233,  233,  235,    0,    0,    0,  467,  236,    0,
-      360,    0,    0,    0,    0,    0,    0,  234,  234,  234,
-      232,  236,  251,    0,    0,    0,  238,    0,  234,    0,
-        0,    0,    0,    0,  467,    0,    0,    0,    0,    0,
-      237,    0,    0,    0,    0,  251,    0,    0,    0,  238,
-        0,  232,  232,  232,    0,  233,    0,    0,  251,  234,
-      234,  234,  238,  237,    0,    0,  467,  236,  467,  467,
-        0,    0,  235,  235,    0,  239,  237,  235,    0,  235,
-        0,  235,    0,  235,    0,    0,  233,  233,  233,  235,
-
-      235,  240,    0,    0,    0,  235,    0,  235,  239,    0,
-      235,    0,  235,  235,  251,  236,  235,  236,  238,    0,
-        0,  239,    0,    0,  240,    0,    0,  236,    0,    0,
-      236,    0,  237,    0,    0,    0,    0,  240,    0,  236,
-      236,  236,  236,    0,    0,  236,  236,  235,  235,  235,
-      250,  236,    0,    0,  236,  238,  236,  238,  238,  236,
-        0,  236,  236,  236,    0,  236,    0,  239,    0,  237,
-      237,  237,    0,  250,  241,    0,    0,    0,  252,    0,
-      236,  237,    0,  240,    0,    0,  250,  251,  251,    0,
-        0,    0,    0,    0,    0,    0,    0,  241,  237,  251,
-
-      237,  252,    0,    0,    0,    0,    0,  237,  237,    0,
-      241,  236,  236,  236,  252,    0,    0,  251,    0,    0,
-      237,  238,  237,  239,    0,  237,  237,    0,  239,  239,
-        0,  239,  250,    0,    0,  237,    0,  239,    0,  239,
-      239,  239,    0,  239,    0,  239,    0,  239,  251,  251,
-      251,  239,  238,  238,  238,    0,  241,    0,    0,    0,
-      252,  253,    0,    0,    0,    0,  237,  237,  237,    0,
-      239,    0,  240,    0,    0,    0,  240,  240,    0,    0,
-      240,  240,  242,  242,  253,    0,  240,  242,  242,  242,
-      242,  242,    0,  242,  242,  242,  242,  253,    0,  250,
-
-        0,  239,  239,  239,    0,    0,    0,    0,  242,  241,
-      241,  241,  242,    0,    0,  241,    0,  240,  240,  240,
-      241,    0,  241,  241,  254,    0,    0,    0,  243,  243,
-        0,    0,  243,    0,    0,  250,    0,    0,    0,    0,
-      242,  242,  242,  253,  242,    0,    0,  254,    0,    0,
-        0,  243,    0,    0,  243,    0,  243,    0,  252,  241,
-      254,    0,    0,  252,  243,    0,  250,  250,  250,    0,
-        0,    0,    0,    0,    0,  256,    0,    0,    0,    0,
-        0,    0,    0,  243,    0,    0,    0,    0,    0,    0,
-      241,  241,  241,    0,  252,  252,  252,    0,  256,    0,
-
-        0,    0,    0,  244,  244,    0,  254,  244,    0,    0,
-      243,  256,    0,    0,  257,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  244,    0,    0,  244,
-        0,  244,    0,    0,  253,    0,    0,  257,    0,  244,
-        0,    0,  243,  242,  243,  243,  253,    0,    0,    0,
-      257,    0,    0,    0,  242,  242,    0,  256,  244,    0,
-        0,    0,  242,  242,  242,  242,  242,    0,  242,  242,
-        0,    0,  242,  242,  242,  242,  242,  253,  253,  253,
-      243,    0,    0,  242,    0,  244,  243,    0,  242,  242,
-      243,  254,    0,    0,    0,  249,  257,    0,  256,    0,
-
-        0,  243,  243,    0,    0,    0,  243,    0,    0,  254,
-      243,    0,    0,  243,    0,    0,    0,  244,  249,  244,
-      244,    0,    0,  244,    0,  244,    0,    0,    0,  245,
-      245,  249,    0,  245,    0,  244,    0,    0,  244,    0,
-      254,  254,  254,    0,  243,  243,  243,  244,  244,  244,
-      244,    0,  245,  244,  244,  245,    0,  245,    0,  244,
-      256,    0,  244,    0,  244,  245,    0,  244,    0,  244,
-      244,  244,    0,  244,  246,  246,    0,  249,  246,    0,
-        0,    0,    0,    0,  245,  257,    0,    0,  244,    0,
-        0,  256,  256,  256,    0,    0,    0,  246,    0,  257,
-
-      246,    0,  246,    0,    0,    0,    0,    0,    0,    0,
-      246,  245,    0,    0,    0,    0,    0,    0,    0,  244,
-      244,  244,    0,    0,    0,    0,    0,    0,    0,  246,
-      257,  257,  257,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  245,    0,  245,  245,    0,  245,  245,
-      245,    0,    0,    0,    0,    0,  246,    0,    0,    0,
-      245,    0,  249,  249,  249,  249,  249,  249,  249,  249,
-      249,  249,  249,  249,  249,  249,  249,  245,    0,  245,
-      249,    0,    0,    0,  255,    0,  245,  245,  246,    0,
-      246,  246,    0,  246,    0,  246,  246,    0,    0,  245,
-
-        0,  245,    0,  260,  245,  245,    0,  255,    0,    0,
-        0,  249,  249,  249,  245,    0,    0,    0,    0,  248,
-      255,    0,    0,    0,    0,    0,  260,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  260,
-        0,    0,  248,  248,  248,  245,  245,  245,  248,  248,
-      248,  248,  248,  258,  248,  248,  248,  248,    0,  246,
-        0,    0,    0,  262,    0,    0,  255,    0,    0,  248,
-        0,    0,    0,  248,    0,  263,  258,    0,    0,    0,
-        0,    0,    0,    0,    0,  260,  262,    0,    0,  258,
-      246,  246,  246,  247,  247,    0,    0,  247,  263,  262,
-
-        0,  248,  248,  248,    0,  248,    0,    0,    0,    0,
-        0,  263,    0,    0,    0,    0,  247,  247,  247,  247,
-        0,  247,  247,  247,  247,  247,  247,  260,  247,  247,
-      247,  247,  265,    0,    0,  258,  267,    0,    0,    0,
-        0,    0,    0,  247,    0,  262,    0,  247,  247,    0,
-        0,    0,    0,    0,    0,  265,    0,  263,  255,  267,
-        0,    0,    0,    0,    0,    0,    0,    0,  265,  255,
-        0,    0,  267,    0,    0,  247,  247,  247,    0,  247,
-        0,    0,    0,    0,    0,    0,    0,  258,  260,    0,
-        0,    0,  262,  262,  262,  262,  262,  262,  258,  258,
-
-      255,  255,  255,    0,  248,  259,    0,  247,    0,  247,
-      247,    0,    0,    0,  265,  248,  248,    0,  267,  260,
-      260,  260,    0,  248,  248,  248,  248,  248,  259,  248,
-      248,  261,    0,  248,  248,  248,  248,  248,  258,    0,
-      264,  259,    0,    0,  248,    0,    0,    0,  262,  248,
-      248,  265,    0,  263,  261,  267,    0,    0,    0,    0,
-      263,    0,    0,  264,    0,    0,    0,  261,    0,  258,
-      258,  258,    0,    0,    0,    0,  264,    0,  247,  262,
-      262,  262,  267,  267,    0,    0,    0,  259,    0,  247,
-      247,  263,  263,  263,    0,    0,    0,  247,  247,  247,
-
-      247,  247,    0,  247,  247,    0,    0,  247,  247,  247,
-      247,  247,    0,  261,    0,    0,    0,  265,  247,    0,
-      266,  267,  264,  247,  247,    0,    0,    0,  259,  259,
-      259,  259,  259,  259,  259,  259,  259,  259,  259,  259,
-      259,  259,  259,  266,  259,    0,    0,    0,  265,  265,
-      265,    0,  267,  267,  267,    0,  266,    0,    0,    0,
-        0,    0,    0,    0,  268,    0,  261,  261,  261,  261,
-      261,    0,    0,    0,    0,  261,  261,    0,  269,    0,
-        0,  293,  259,  259,  259,  259,    0,  268,  271,    0,
-      259,  264,  264,  264,  264,  264,  264,  264,  264,  264,
-
-      268,  269,  266,    0,  293,    0,  272,    0,    0,    0,
-        0,  271,    0,    0,  269,  270,  261,  293,  273,    0,
-        0,  259,  259,  259,  271,  264,    0,    0,    0,  272,
-        0,    0,    0,  594,  594,  594,    0,    0,  270,    0,
-        0,  273,  272,    0,    0,  594,  268,  261,  261,  261,
-        0,  270,    0,    0,  273,    0,  264,  264,  264,    0,
-      269,    0,  594,  293,  594,    0,    0,    0,    0,    0,
-      271,  594,  594,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  276,  594,  266,  594,    0,  272,  594,
-      594,    0,    0,    0,    0,  274,    0,  270,    0,    0,
-
-      273,    0,    0,    0,    0,  266,  276,  271,  271,  271,
-      271,  271,  271,  271,  271,  271,  271,  271,  274,  276,
-        0,    0,    0,    0,    0,  275,  268,  268,  268,  272,
-      272,  274,  293,    0,    0,    0,  266,  266,  266,  277,
-        0,    0,    0,    0,    0,    0,    0,  278,  275,  268,
-      269,  269,    0,    0,  270,  270,  270,    0,  270,  270,
-      270,  275,  277,  269,    0,  276,  293,  273,  273,    0,
-      278,    0,    0,  271,    0,  277,    0,  274,    0,    0,
-      268,  268,  268,  278,    0,    0,    0,    0,    0,    0,
-        0,  272,    0,    0,  269,  269,  269,  293,  293,  293,
-
-      270,    0,    0,  273,  271,  271,  271,  275,  910,  910,
-      910,  910,  910,  910,  910,  910,  910,  910,  910,  910,
-      910,  277,  272,  272,  272,    0,    0,    0,    0,  278,
-        0,  270,  270,  270,  273,  273,  273,  910,  910,    0,
-        0,    0,    0,    0,    0,    0,  274,  274,  274,  274,
-      274,  274,  274,    0,  274,  274,  274,  274,  274,  274,
-        0,    0,  276,  276,  276,  276,  279,    0,  276,    0,
-      275,  275,  275,  275,  275,  275,  275,    0,    0,    0,
-      274,    0,    0,    0,    0,    0,  282,    0,    0,  279,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  276,
-
-      276,  276,  279,    0,    0,  275,  275,    0,    0,  282,
-      275,  274,  274,  274,  283,    0,    0,  277,  277,  277,
-      277,  277,  282,    0,  277,    0,    0,    0,  278,  278,
-        0,  289,  278,    0,    0,  287,    0,  283,    0,    0,
-        0,  275,  275,  275,    0,    0,    0,    0,  279,    0,
-      283,    0,    0,    0,  289,  277,  277,  277,  287,    0,
-        0,    0,    0,  278,  278,  278,    0,  289,  282,    0,
-        0,  287,    0,  775,  284,    0,  775,    0,    0,  288,
-        0,    0,    0,    0,  294,  279,  279,  279,  279,  279,
-      279,  279,  279,    0,    0,    0,  283,  284,  775,    0,
-
-      775,    0,  288,    0,  279,    0,    0,  294,  775,    0,
-      284,    0,    0,  289,    0,  288,    0,  287,  282,  282,
-      294,    0,    0,    0,    0,    0,    0,  775,    0,    0,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,   49,    7,
+      116,  117,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+      119,    8,    8,  121,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+
+        8,    8,    8,    8,    8,  122,    8,  123,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,  124,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,  125,    8,  126,  131,    8,    8,    8,
+
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    9,    9,   10,   15,
+        9,  133,  134,  135,  136,  137,  138,  139,   15,  140,
+      141,   25,  142,  143,  144,    0,    0,    0,    0,    9,
+        0,   10,    9,    0,    9,    0,    0,    0,    0,    0,
+        0,   15,    9,   37,   25,   10,   10,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,    0,    0,    0,
+        0,    9,    0,    0,    0,    0,   37,    0,    0,    0,
+        0,    0,   41,    0,    0,    0,    0,    0,    0,    0,
+
+       37,   37,    0,    0,    0,    0,    0,    0,    9,    0,
+        0,    0,    0,    0,    0,   41,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,  100,  100,  100,  100,
+      100,  100,  100,  100,  100,  100,    0,    0,    0,    0,
+        9,    0,    9,    9,    0,    0,    9,    0,   10,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   15,   13,
+       13,   25,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   37,   13,    0,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   41,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,    0,   13,    0,    0,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+
+       13,   13,   13,   13,   20,   20,   20,   20,   20,   20,
+       20,   20,    0,    0,   20,   20,    0,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,    0,   20,   20,    0,   20,
+        0,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,    0,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,    0,   20,    0,    0,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   21,
+       21,    0,    0,   21,    0,   27,   27,    0,    0,   27,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  283,  283,  283,  283,    0,    0,    0,    0,    0,
-        0,  279,    0,    0,  775,    0,  284,    0,    0,    0,
-        0,  288,    0,    0,    0,    0,  294,    0,    0,    0,
-        0,  282,    0,    0,  283,  283,    0,    0,  287,  287,
-      287,  287,  279,  279,  279,  280,  775,    0,  775,  775,
-      295,    0,    0,    0,    0,    0,    0,    0,  289,  283,
-
-        0,    0,  282,  282,  282,    0,    0,    0,  280,    0,
-        0,    0,    0,  295,  287,  287,  289,    0,    0,    0,
-      287,  280,    0,    0,    0,    0,  295,    0,    0,    0,
-      283,  283,  283,  284,  284,  284,  284,  284,  284,  284,
-      284,  284,  284,  284,  284,  284,  284,  289,  289,  289,
-        0,  287,  287,  287,    0,  288,  288,  288,  288,  284,
-      288,  288,  294,  296,  288,    0,    0,  280,    0,  294,
-        0,    0,  295,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  296,    0,    0,    0,
-      284,  284,  284,    0,    0,  288,  288,  288,    0,  296,
-
-      294,  294,  294,    0,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,    0,    0,    0,    0,    0,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,    0,  296,    0,    0,    0,    0,
-        0,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,    0,    0,
-      280,  295,  295,    0,    0,  295,  891,  891,  891,  891,
-      891,  891,  891,  891,  891,  891,  891,  891,  891,  891,
-        0,    0,    0,    0,    0,  296,  296,  296,    0,    0,
-
-        0,  280,  280,  280,  281,    0,  295,  295,  295,    0,
-        0,    0,    0,    0,    0,    0,  326,    0,    0,    0,
-        0,  301,    0,    0,  329,    0,    0,  281,    0,    0,
-      297,    0,    0,  285,    0,    0,    0,    0,  286,  326,
-      281,    0,    0,    0,  301,    0,    0,  329,  296,    0,
-        0,    0,  326,  297,    0,    0,  285,  301,    0,    0,
-      329,  286,    0,  593,    0,  593,  297,    0,    0,  285,
-        0,    0,    0,    0,  286,  593,    0,    0,  593,  296,
-      296,  296,    0,    0,    0,    0,  281,  593,  593,  593,
-      593,    0,    0,  593,  593,    0,    0,    0,  326,  593,
-
-        0,    0,  593,  301,  593,    0,  329,  593,    0,  593,
-      593,  593,  297,  593,    0,  285,    0,    0,    0,    0,
-      286,    0,    0,  281,  281,  281,  281,    0,  281,  281,
-      281,  281,  281,  281,  281,  281,  281,  281,  281,  281,
-      281,    0,  281,  281,  281,  281,  281,  281,  281,  281,
-      281,  281,  281,  281,  281,    0,    0,  285,  285,    0,
-      286,  286,  286,  286,  286,  286,  286,  286,  286,  286,
-      286,  286,  286,  286,  286,  286,  286,  286,  286,  286,
-      286,  286,    0,    0,  281,  281,  301,  301,    0,  281,
-      285,  285,  285,  285,  285,  285,  285,  285,  285,  285,
-
-      297,  326,    0,    0,    0,    0,  301,    0,    0,  329,
-        0,  297,    0,    0,    0,  297,    0,    0,  285,    0,
-      281,  281,  281,  286,    0,    0,    0,    0,    0,    0,
-        0,    0,  326,  326,  326,    0,    0,  301,  301,  301,
-      329,  329,  329,    0,    0,    0,  297,  297,  297,  285,
-      285,  285,    0,    0,  286,  286,  286,  290,  290,  290,
-      290,  290,  290,  290,  290,  290,  290,  290,  290,  290,
-      290,  290,  290,  290,  290,  290,  290,  290,  290,  290,
-      290,  290,  290,  290,  290,  290,  290,  290,  290,  290,
-      290,  290,  290,  290,  290,  290,  290,  290,  290,  290,
-
-      290,  290,  290,  290,  290,  290,  290,  290,  290,  290,
-      290,  290,  290,  290,  290,  290,  290,  290,  290,  290,
-      290,  291,  291,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  291,  291,  291,  291,  291,
-      291,  291,  291,  291,  291,  291,  291,  291,  291,  291,
-      291,  291,  292,  291,  291,  291,  291,  291,  291,  291,
-      291,  291,  291,  291,  291,  291,  291,  291,  291,  298,
-        0,    0,    0,  299,  919,  292,  300,    0,    0,  302,
-        0,    0,    0,    0,  919,  919,    0,    0,  292,    0,
-        0,  919,  298,    0,    0,    0,  299,    0,    0,  300,
-
-        0,    0,  302,  919,    0,  298,  919,    0,    0,  299,
-        0,  919,  300,  919,  919,  302,  919,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  919,    0,
-        0,  919,  919,    0,  292,    0,    0,    0,    0,    0,
-      306,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  298,    0,    0,    0,  299,    0,    0,  300,    0,
-        0,  302,    0,  306,    0,    0,    0,    0,    0,    0,
-        0,  292,  292,  292,  292,    0,  306,    0,    0,  292,
-      292,  292,  292,  292,  292,  292,  292,  292,  292,  303,
-        0,  292,  292,  292,  292,  292,  292,  292,  292,  292,
-
-      292,  292,  292,    0,    0,    0,    0,    0,    0,  300,
-      300,    0,  303,    0,    0,    0,    0,    0,    0,  292,
-        0,    0,  306,    0,    0,  303,  305,    0,    0,  302,
-        0,    0,  292,    0,    0,    0,    0,  292,  298,  298,
-      298,  298,  298,  298,  299,  299,  299,  299,    0,  305,
-        0,  300,  300,  300,  298,  300,    0,    0,  299,    0,
-        0,  300,  305,    0,  302,  304,    0,    0,  292,  292,
-      292,  303,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  298,  298,  298,  304,  299,
-      299,  299,  300,  300,  300,  302,  302,  302,    0,  317,
-
-        0,  304,  306,    0,  307,    0,    0,    0,  305,  303,
-      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
-      303,  303,  317,    0,    0,  306,  308,  307,    0,    0,
-        0,    0,    0,    0,    0,  317,    0,    0,  303,  303,
-      307,  314,    0,    0,  316,    0,    0,  304,  358,  308,
-        0,    0,    0,    0,    0,  324,  306,  306,  306,    0,
-        0,    0,  308,    0,  314,    0,    0,  316,    0,    0,
-        0,  358,    0,    0,  303,  305,  305,  314,  324,    0,
-      316,  317,    0,    0,  358,    0,  307,    0,    0,    0,
-        0,  324,    0,  305,  305,    0,    0,    0,  318,    0,
-
-        0,    0,    0,    0,    0,  303,  303,  303,  308,    0,
-        0,  305,  304,  304,  304,  304,    0,    0,    0,    0,
-        0,  318,    0,  314,    0,    0,  316,    0,    0,    0,
-      358,    0,    0,    0,  318,    0,  311,  324,    0,    0,
-        0,    0,  305,  305,  305,    0,    0,    0,    0,    0,
-      304,    0,    0,    0,    0,    0,    0,    0,    0,  311,
-      317,  308,  308,  308,  308,  308,  308,  308,  308,  308,
-      308,    0,  311,    0,  324,  324,    0,  314,    0,    0,
-      318,  304,  304,  304,  317,  307,  307,    0,    0,  307,
-        0,    0,    0,  308,  308,  308,  308,  308,  308,  308,
-
-      308,  308,  308,  308,  308,  308,  308,  308,  308,    0,
-        0,  308,    0,  316,    0,  317,  317,  317,  311,    0,
-      307,  307,  307,  314,    0,    0,  314,    0,    0,  316,
-        0,    0,    0,  358,    0,    0,    0,    0,    0,    0,
-      324,    0,  308,  308,  308,  309,    0,    0,    0,    0,
-        0,    0,    0,    0,  318,    0,    0,  314,  314,  314,
-      316,  316,  316,    0,  358,  358,  358,    0,  309,    0,
-        0,  324,  324,  324,    0,    0,    0,    0,    0,    0,
-        0,  309,  311,  318,  311,    0,  311,  311,  311,  311,
-      311,  311,  311,    0,    0,    0,    0,    0,  917,  917,
-
-      917,    0,  917,  917,  917,  917,  917,  917,    0,  917,
-      917,  917,  917,    0,  318,  318,  318,    0,    0,  310,
-        0,  311,    0,  917,  917,    0,  312,  309,  917,  917,
+        0,    0,   21,    0,    0,   21,    0,   21,   27,    0,
+        0,   27,    0,   27,    0,   21,    0,   31,   31,   43,
+
+        0,   27,   31,   31,   31,   31,   31,    0,   31,   31,
+       31,   31,    0,    0,   21,    0,    0,    0,    0,    0,
+       27,    0,   43,   31,    0,    0,   73,   31,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  310,    0,    0,    0,    0,    0,    0,  312,
-        0,    0,  311,  311,  311,  310,  917,  917,  917,    0,
-      917,    0,  312,    0,  309,  309,  309,  309,  309,  309,
-      309,  309,  309,  309,  309,  309,  309,  309,  309,  309,
-      309,  309,  309,    0,  309,  309,  309,  309,  309,  309,
-      309,  309,  309,  309,  309,  309,  309,  309,    0,  309,
-
-        0,  310,    0,    0,  309,    0,  309,  309,  312,    0,
+        0,   21,    0,    0,    0,    0,    0,   27,    0,   73,
+        0,    0,    0,    0,    0,   31,   31,   31,    0,   31,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   21,    0,   21,   21,    0,    0,   27,
+        0,   27,   27,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,    0,   30,   30,   31,   30,   30,   30,   30,
+
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,    0,   30,   43,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   73,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+
+       30,   30,   30,   30,   30,    0,   30,    0,    0,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   32,   32,
+        0,    0,   32,    0,    0,    0,    0,    0,   75,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      309,  313,    0,    0,    0,    0,    0,    0,    0,  310,
-      310,  310,    0,  310,  310,  310,  310,  310,  310,  312,
-      310,  310,  310,  310,  313,    0,    0,  315,    0,  312,
-      312,  309,  309,  309,  310,  310,  312,  313,    0,  310,
-      310,    0,    0,    0,    0,    0,    0,    0,  312,  320,
-      315,  312,    0,    0,    0,    0,  312,    0,  312,  312,
-        0,  312,    0,  315,    0,    0,    0,  310,  310,  310,
-
-        0,  310,  320,  312,  310,    0,  312,  312,    0,    0,
-        0,  312,    0,  313,    0,  320,    0,    0,  320,  320,
-      320,  320,  320,  320,  320,  320,  320,  320,    0,    0,
-        0,    0,    0,    0,    0,  310,  310,  310,    0,  315,
-        0,  322,  312,  312,  312,  323,    0,    0,  325,    0,
-        0,  313,  313,  313,    0,  313,    0,  313,  313,    0,
-      313,  320,    0,    0,  322,    0,    0,  313,  323,  313,
-        0,  325,    0,  313,    0,  313,  313,  322,  313,    0,
-        0,  323,  313,    0,  325,    0,    0,  313,    0,  313,
-      313,  313,  313,    0,    0,    0,    0,    0,    0,  313,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  313,
-        0,    0,    0,  313,    0,    0,  313,  315,  331,  315,
-      315,  315,    0,  322,    0,    0,    0,  323,    0,    0,
-      325,    0,    0,    0,  315,    0,  333,    0,    0,  315,
-      321,  331,  315,    0,    0,    0,    0,  313,  313,  313,
-        0,    0,    0,    0,  331,  332,    0,    0,    0,  333,
-        0,    0,    0,  321,  320,    0,  327,  325,    0,    0,
-        0,    0,  333,  315,  315,  315,  321,    0,  332,  321,
-      321,  321,  321,  321,  321,  321,  321,  321,  321,  327,
-      323,  332,  322,    0,    0,  320,  320,  320,    0,    0,
-
-      331,    0,  327,    0,    0,  327,  327,  327,  327,  327,
-      327,  327,  327,  327,  327,  335,    0,    0,  333,    0,
-        0,    0,  321,    0,  334,    0,  322,    0,    0,    0,
-      323,  328,    0,  325,    0,    0,    0,  332,  335,    0,
-        0,    0,    0,    0,    0,  330,    0,  334,  327,    0,
-        0,  335,  335,  335,  328,  333,  333,  322,  322,  322,
-      334,  323,  323,  323,  325,  325,  325,  328,  330,  331,
-      328,  328,  328,  328,  328,  328,  328,  328,  328,  328,
-        0,  330,  336,    0,  330,  330,  330,  330,  330,  330,
-      330,  330,  330,  330,    0,    0,    0,  335,    0,    0,
-
-      332,    0,    0,  331,    0,  336,  334,    0,  338,    0,
-        0,    0,  794,  328,    0,  794,    0,    0,  336,    0,
-        0,  333,    0,    0,    0,  321,  339,  330,    0,    0,
-        0,  338,    0,    0,  331,  331,  331,  794,    0,  794,
-      332,    0,    0,  334,  338,    0,    0,  794,    0,  339,
-        0,  327,  333,  333,  333,  337,  321,  321,  321,    0,
-        0,    0,  339,    0,  336,    0,  794,    0,    0,    0,
-        0,  332,  332,  332,    0,    0,    0,    0,  337,    0,
-        0,    0,  327,  327,  327,    0,    0,    0,    0,    0,
-      338,  337,    0,  794,    0,    0,    0,    0,    0,    0,
-
-      335,  336,    0,    0,    0,    0,    0,    0,  339,  334,
-        0,    0,    0,    0,    0,    0,  328,    0,    0,    0,
-        0,    0,    0,    0,    0,  794,    0,  794,  794,    0,
-      330,  335,  335,  335,    0,    0,    0,  337,    0,    0,
-      334,  334,  334,    0,    0,  339,    0,  328,  328,  328,
-        0,    0,    0,    0,    0,    0,    0,    0,  338,    0,
-        0,  330,  330,  330,    0,    0,    0,  336,    0,    0,
-        0,    0,    0,    0,  337,  337,  337,  337,  337,  337,
-      337,  337,  337,  337,  337,    0,    0,    0,    0,    0,
-        0,    0,    0,  338,  344,    0,    0,    0,  336,  336,
-
-      336,    0,    0,    0,    0,    0,    0,    0,    0,  340,
-        0,  339,    0,    0,    0,    0,    0,  344,    0,    0,
-        0,  337,    0,    0,  338,  338,  338,    0,    0,    0,
-      344,    0,  340,    0,    0,    0,    0,    0,  341,    0,
-      337,    0,  339,  339,  339,  340,  340,  340,  340,  340,
-      340,  340,  340,  340,  340,  340,  340,  340,    0,    0,
-        0,  341,    0,    0,  342,    0,    0,    0,    0,    0,
-        0,  337,  337,  337,  341,    0,  344,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  342,    0,    0,
-      343,  340,    0,    0,    0,    0,    0,    0,    0,    0,
-
-      342,    0,    0,  342,  342,  342,  342,  342,  342,  342,
-      342,  342,  342,  343,    0,    0,  345,    0,    0,  346,
-      341,    0,    0,    0,  347,    0,  343,  343,  343,  343,
-      343,  343,  343,  343,  343,  343,  343,  343,  343,  345,
-        0,    0,  346,    0,    0,  344,  342,  347,    0,    0,
-        0,    0,  345,    0,    0,  346,    0,    0,    0,    0,
-      347,    0,    0,    0,    0,    0,    0,    0,    0,  348,
-      348,    0,  343,  348,    0,    0,    0,    0,    0,  344,
-        0,  349,  349,    0,    0,  349,    0,    0,    0,    0,
-        0,    0,  348,    0,  340,  348,    0,  348,  345,    0,
-
-        0,  346,    0,    0,  349,  348,  347,  349,    0,  349,
-      344,  344,  344,    0,    0,    0,    0,  349,  348,    0,
-        0,    0,    0,  341,  348,  340,  340,  340,    0,    0,
-      349,    0,    0,    0,  363,    0,  349,    0,  346,  346,
-        0,  353,  353,  347,    0,  353,    0,    0,    0,  342,
-        0,  348,    0,    0,  341,  341,  341,  363,    0,    0,
-        0,  345,    0,  349,  353,    0,    0,  353,    0,  353,
-      363,    0,    0,    0,    0,  343,    0,  353,    0,    0,
-      342,  342,  342,  348,    0,  348,  348,    0,    0,    0,
-      353,  364,    0,    0,    0,  349,  353,  349,  349,    0,
-
-        0,  345,    0,    0,  346,    0,  343,  343,  343,  347,
-        0,    0,    0,    0,  364,    0,  363,    0,    0,    0,
-      354,  354,    0,  353,  354,    0,  366,  364,    0,  367,
-        0,    0,  345,  345,  345,  346,  346,  346,  375,    0,
-      347,  347,  347,  354,    0,    0,  354,    0,  354,  366,
-        0,    0,  367,    0,  348,  353,  354,  353,  353,    0,
-        0,  375,  366,    0,    0,  367,  349,  355,  355,  354,
-        0,  355,    0,  364,  375,  354,    0,    0,  356,  356,
-        0,    0,  356,    0,    0,  348,  348,  348,    0,  379,
-      355,    0,  353,  355,    0,  355,    0,  349,  349,  349,
-
-        0,  356,  354,  355,  356,    0,  356,    0,  366,    0,
-        0,  367,  379,    0,  356,    0,  355,  365,  365,  363,
-      375,  365,  355,    0,    0,  379,  353,  356,    0,    0,
-        0,  368,    0,  356,  354,    0,  354,  354,    0,  369,
-      365,    0,    0,  365,    0,  365,  374,    0,    0,  355,
-      363,  363,  363,  365,  368,    0,    0,  353,  353,  353,
-      356,    0,  369,    0,    0,  354,    0,  368,    0,  374,
-        0,  379,  365,    0,  367,  369,  364,  366,    0,    0,
-        0,  355,  374,  355,  355,    0,  355,  355,    0,  375,
-        0,    0,  356,  376,  356,  356,  378,  356,    0,  365,
-
-        0,    0,    0,    0,    0,  354,    0,  364,  364,  364,
-        0,  366,    0,  368,  367,    0,  376,  377,    0,  378,
-        0,  369,    0,  375,    0,    0,    0,    0,  374,  376,
-        0,  365,  378,  365,  365,    0,  354,  354,  354,    0,
-      377,  381,  366,  366,  366,  367,  367,  367,    0,    0,
-      368,  368,  355,  377,  375,  375,  375,  380,  369,    0,
-        0,    0,  374,  356,  381,    0,    0,    0,  382,    0,
-        0,    0,    0,    0,  379,  376,    0,  381,  378,    0,
-      380,    0,    0,  355,  355,  355,  383,    0,    0,    0,
-        0,  382,    0,  380,  356,  356,  356,    0,    0,  377,
-
-        0,    0,  365,    0,  382,  379,  379,  379,    0,  383,
-        0,    0,    0,    0,    0,  378,  368,    0,    0,    0,
-        0,    0,  383,  381,  369,    0,    0,    0,    0,    0,
-        0,  374,    0,  365,  365,  365,  377,  377,  376,  380,
-        0,    0,    0,  384,    0,    0,  385,  368,  368,  368,
-      382,    0,    0,    0,  388,  369,  369,  369,    0,    0,
-        0,  386,  374,  374,  374,  387,  384,    0,  383,  385,
-      389,    0,    0,  380,    0,    0,    0,  388,  376,  384,
-      390,  378,  385,    0,  386,    0,    0,    0,  387,    0,
-      388,    0,    0,  389,    0,    0,    0,  386,    0,    0,
-
-        0,  387,  377,  390,    0,    0,  389,    0,  391,  376,
-      376,  376,  378,  378,  378,    0,  390,    0,    0,    0,
-        0,    0,    0,    0,    0,  384,  381,    0,  385,    0,
-        0,  391,    0,  377,  377,  377,  388,    0,    0,    0,
-        0,    0,  380,  386,  391,    0,    0,  387,    0,    0,
-        0,    0,  389,  382,    0,    0,    0,  381,  381,  381,
-      393,    0,  390,    0,    0,  392,    0,    0,    0,  395,
-        0,  383,  396,  380,  380,  380,    0,    0,    0,    0,
-      386,  386,  386,  393,  382,  382,  382,  394,  392,  388,
-      391,    0,  395,    0,    0,  396,  393,    0,    0,    0,
-
-        0,  392,  383,  383,  383,  395,    0,    0,  396,    0,
-      394,    0,    0,    0,    0,  387,    0,    0,    0,    0,
-        0,    0,  390,  394,    0,    0,    0,    0,  384,    0,
-        0,  385,    0,    0,    0,    0,  389,    0,    0,  388,
-        0,    0,  393,    0,    0,    0,  386,  392,    0,    0,
-      387,  395,    0,  397,  396,  389,    0,    0,  391,  384,
-      384,  384,  385,  385,  385,  390,    0,    0,    0,  394,
-      388,  388,  388,    0,    0,    0,  397,  386,  386,  386,
-        0,  387,  387,  387,    0,    0,  389,  389,  389,  397,
-      391,    0,    0,  391,    0,    0,  390,  390,  390,    0,
-
-      392,  392,  392,  392,  392,  392,  392,  392,  392,    0,
-        0,    0,    0,  395,  395,  395,  395,  398,    0,    0,
-      399,    0,    0,    0,  391,  391,  391,  393,  393,  393,
-      393,  393,  393,  393,    0,  397,  396,  400,    0,    0,
-      398,    0,    0,  399,    0,  393,    0,  392,    0,    0,
-      392,    0,    0,  398,  395,    0,  399,  396,    0,    0,
-      400,    0,    0,  394,  394,  394,  394,  394,  394,  394,
-        0,    0,  394,  400,    0,  401,  393,  393,  393,    0,
-        0,  392,  392,  392,  405,  395,  395,  395,  396,  396,
-      396,  402,    0,  397,  397,  397,  397,  397,  401,  398,
-
-      403,    0,  399,  394,  394,  394,    0,  405,    0,    0,
-        0,  401,    0,    0,  402,    0,    0,    0,    0,  400,
-      405,    0,    0,  403,    0,    0,    0,  402,    0,    0,
-        0,    0,    0,    0,    0,    0,  403,    0,  397,    0,
-        0,  406,  398,  398,  398,  398,  399,  399,  399,  399,
-      399,  399,  399,    0,    0,    0,    0,  401,    0,    0,
-      404,    0,    0,  407,  406,    0,  405,    0,    0,  397,
-      397,  397,    0,  402,    0,    0,    0,  406,    0,    0,
-        0,    0,  403,  404,    0,    0,  407,    0,    0,    0,
-        0,    0,    0,    0,  401,  401,  404,    0,    0,  407,
-
-        0,    0,  398,    0,    0,  399,    0,    0,    0,    0,
-      402,  402,  402,  402,    0,  400,  400,    0,  400,  400,
-        0,    0,  400,  406,  403,  403,  403,  403,    0,  413,
-        0,    0,  403,  398,  398,  398,  399,  399,  399,    0,
-        0,  410,  404,    0,  405,  407,  403,  412,  403,  403,
-      403,    0,  413,  400,  400,  400,    0,    0,    0,  411,
-      401,    0,  402,  402,  410,  413,    0,  408,    0,  405,
-      412,  406,  406,  406,  406,  406,  402,  410,    0,    0,
-        0,    0,  411,  412,    0,  403,  406,  406,  407,  406,
-      408,  401,  401,  401,    0,  411,    0,    0,    0,    0,
-
-      405,  405,  405,  408,    0,    0,    0,  402,  402,  402,
-        0,  413,    0,    0,    0,    0,  403,  403,  403,    0,
-        0,    0,    0,  410,    0,    0,  406,    0,  414,  412,
-        0,    0,    0,    0,    0,  404,  404,  404,  404,  404,
-      404,  411,    0,    0,    0,  404,  409,    0,  407,  408,
-        0,  414,  413,  413,  413,    0,    0,  406,  406,  406,
-        0,    0,    0,    0,  414,    0,    0,    0,    0,  409,
-        0,    0,    0,    0,    0,    0,  404,  404,  404,  407,
-      407,  407,  409,    0,    0,    0,    0,  408,  408,  408,
-      408,  408,  408,  408,  408,  408,  408,  408,  408,  408,
-
-      408,  408,  408,  408,  408,  408,  408,  408,  408,  408,
-      414,    0,  415,    0,  413,    0,    0,  410,    0,    0,
-        0,    0,    0,    0,    0,  412,  410,    0,  409,    0,
-        0,    0,  412,  416,    0,  415,    0,  417,  411,  411,
-      411,    0,    0,    0,  411,  413,  413,  413,  415,    0,
-        0,  419,  408,    0,    0,  420,  416,  410,  410,  410,
-      417,    0,    0,  412,  412,  412,  409,  409,  409,  416,
-        0,    0,    0,  417,  419,  411,  411,  411,  420,    0,
-        0,  414,    0,  408,  408,  408,    0,  419,    0,  418,
-        0,  420,    0,  421,  415,    0,    0,  409,  409,  409,
-
-      409,  409,  409,  409,  409,  409,  409,  409,  409,  409,
-        0,  422,  418,  414,    0,  416,  421,    0,    0,  417,
-        0,    0,    0,    0,    0,  418,    0,    0,    0,  421,
-        0,  409,    0,  419,  422,    0,    0,  420,  423,    0,
-        0,    0,    0,    0,  414,  414,  414,  422,    0,  424,
-        0,    0,  416,  416,  416,  416,  416,  416,  416,    0,
-        0,  423,  409,  409,  409,    0,    0,    0,    0,    0,
-        0,  418,  424,    0,  423,  421,    0,    0,    0,    0,
-        0,    0,  417,  417,  417,  424,  417,  417,  417,  417,
-      417,    0,    0,  422,  415,    0,    0,  415,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  418,
-      418,  418,  418,  418,    0,    0,  425,    0,  416,    0,
-      423,    0,  417,    0,    0,  419,  419,    0,  415,  415,
-      415,  424,    0,    0,    0,    0,  419,  420,    0,  425,
-      420,    0,    0,    0,    0,    0,    0,    0,    0,  416,
-      416,  416,  425,  417,  417,  417,  418,  418,  426,    0,
-      421,  421,  421,  421,  421,  427,    0,  419,  419,  419,
-        0,  420,  420,  420,  418,    0,  428,    0,  421,  422,
-      422,  426,    0,    0,    0,    0,    0,    0,  427,    0,
-        0,    0,    0,    0,  426,  429,  422,    0,  425,  428,
-
-        0,  427,  431,  423,  423,  418,  418,  418,    0,  421,
-      421,  421,  428,    0,  432,    0,    0,    0,  429,    0,
-        0,  424,    0,  423,    0,  431,    0,  422,  422,  422,
-        0,  429,    0,    0,  424,    0,  430,  432,  431,  435,
-      426,    0,    0,    0,    0,    0,    0,  427,    0,    0,
-      432,    0,    0,  436,  423,  423,  423,    0,  428,  430,
-        0,    0,  435,    0,  440,  424,  424,  424,    0,    0,
-        0,    0,  430,    0,    0,  435,  436,  429,    0,    0,
-        0,  426,    0,    0,  431,    0,    0,  440,  437,  436,
-      425,  425,  425,  425,  425,    0,  432,    0,    0,    0,
-
-      440,  425,    0,  438,    0,    0,    0,  427,  427,  427,
-      427,  437,    0,  443,    0,    0,    0,    0,  430,    0,
-        0,  435,    0,    0,  437,    0,  438,    0,    0,  428,
-        0,    0,  425,  425,  425,  436,  443,    0,    0,  438,
-        0,    0,    0,  426,    0,  429,  440,    0,    0,  443,
-      427,  431,  431,    0,    0,    0,    0,    0,    0,    0,
-        0,  428,  430,  430,  430,  430,  430,    0,    0,    0,
-      437,    0,    0,    0,  426,  426,  426,    0,  441,    0,
-      429,  427,  427,  427,    0,  438,    0,  431,    0,    0,
-      435,    0,  428,  428,  428,  443,    0,    0,  436,  432,
-
-        0,  441,    0,    0,    0,    0,    0,  437,  437,    0,
-        0,  429,  429,  429,  441,    0,    0,    0,  431,  431,
-      431,  430,  438,    0,  435,  444,    0,    0,    0,    0,
-      432,  432,  432,    0,    0,    0,  439,  439,  436,    0,
-      439,    0,  445,    0,    0,    0,    0,    0,  444,  440,
-        0,  442,  430,  430,  430,  435,  435,  435,    0,  439,
-      441,  444,  439,  443,  439,  445,  447,    0,    0,  436,
-      436,  436,  439,  437,  442,    0,    0,  446,  445,    0,
-      440,  440,  440,    0,    0,    0,  448,  442,  438,  447,
-        0,  439,    0,    0,    0,    0,    0,  441,  443,    0,
-
-      446,    0,  447,  449,  437,  437,  437,  444,    0,  448,
-        0,    0,    0,  446,    0,  451,    0,    0,  439,  438,
-      438,  438,  448,    0,  445,    0,  449,    0,    0,  443,
-      443,  443,    0,  442,    0,    0,    0,    0,  451,  449,
-        0,    0,    0,    0,  444,    0,    0,    0,  447,    0,
-      439,  451,  439,  439,    0,    0,    0,    0,    0,  446,
-        0,    0,    0,  441,    0,    0,  452,    0,  448,    0,
-      442,  442,  442,  442,  442,  442,  442,  442,  442,  442,
-      442,    0,    0,    0,    0,  449,    0,    0,    0,  452,
-        0,    0,    0,    0,  441,  441,  441,  451,    0,    0,
-
-        0,    0,  452,    0,    0,  448,  448,    0,  454,    0,
-      444,  447,    0,    0,    0,    0,    0,  442,    0,    0,
-        0,  439,  449,    0,    0,    0,    0,  445,  446,    0,
-        0,  454,    0,    0,  455,    0,  442,    0,    0,    0,
-        0,  444,  444,  444,  454,    0,    0,    0,  452,    0,
-        0,  447,  439,  439,  439,    0,    0,  455,  445,  445,
-      445,    0,  446,    0,    0,    0,    0,  442,  442,  442,
-      455,  448,    0,  450,  450,    0,    0,  450,    0,    0,
-        0,    0,  447,  447,  447,  452,    0,  453,  449,    0,
-      454,  456,    0,  446,  446,  446,  450,    0,    0,  450,
-
-      451,  450,  448,  448,  448,    0,    0,    0,    0,  450,
-      453,    0,  457,    0,  456,    0,  455,    0,    0,  449,
-      449,  449,    0,  453,    0,    0,    0,  456,  450,    0,
-        0,  451,  451,  451,    0,  457,  459,    0,    0,    0,
-      458,  458,    0,    0,  458,    0,    0,    0,  457,    0,
-        0,  452,  462,  455,    0,  450,  460,    0,  454,  459,
-        0,    0,  461,  458,    0,    0,  458,    0,  458,  453,
-        0,    0,  459,  456,    0,  462,  458,    0,    0,  460,
-        0,  464,  452,  452,  452,  461,    0,  450,  462,  450,
-      450,    0,  460,  454,  457,  458,    0,  465,  461,    0,
-
-        0,    0,    0,    0,  464,    0,  453,  453,  453,  453,
-      453,  453,  453,  453,  453,  453,  453,  464,  459,  455,
-      465,    0,  458,    0,  454,  454,  454,    0,    0,    0,
-        0,    0,  468,  465,  462,    0,    0,    0,  460,    0,
-        0,  469,    0,    0,  461,    0,    0,    0,    0,    0,
-      455,  455,  455,  453,  458,  468,  458,  458,  450,    0,
-        0,    0,  471,  464,  469,    0,    0,    0,  468,    0,
-        0,  462,  453,    0,    0,    0,  456,  469,    0,  465,
-        0,  461,  461,  470,    0,  471,    0,  459,    0,  450,
-      450,  450,    0,    0,    0,    0,    0,  457,  471,    0,
-
-        0,  460,    0,  453,  453,  453,  470,  456,  456,  456,
-      472,    0,    0,  475,  468,    0,    0,    0,    0,  470,
-        0,  459,    0,  469,    0,  458,    0,  476,  457,  457,
-      457,    0,    0,  472,    0,    0,  475,  462,    0,  480,
-        0,  460,    0,    0,  471,    0,  472,  461,  478,  475,
-      476,    0,  459,  459,  459,    0,  458,  458,  458,    0,
-        0,    0,  480,  476,  477,  470,  464,    0,  462,  462,
-      462,  478,  460,  460,  460,  480,    0,    0,  461,  461,
-      461,  471,  465,  468,  478,    0,  469,  477,  481,    0,
-        0,    0,  472,    0,    0,  475,    0,  464,  464,  464,
-
-      477,    0,  470,  470,    0,    0,  479,  479,    0,  476,
-      479,  481,    0,  465,  465,  465,    0,  468,    0,    0,
-        0,  480,    0,    0,  481,    0,  469,    0,    0,  479,
-      478,    0,  479,  483,  479,    0,    0,    0,    0,    0,
-        0,    0,  479,    0,    0,    0,  477,  471,  468,  468,
-      468,    0,    0,    0,    0,    0,  483,  469,  469,  469,
-        0,  479,    0,    0,  475,    0,    0,  478,  470,  483,
-      481,    0,  476,    0,    0,    0,    0,    0,  471,  471,
-      471,  484,    0,  477,  477,  490,    0,    0,  479,    0,
-        0,    0,    0,    0,    0,  472,    0,    0,  475,  470,
-
-      470,  470,    0,    0,  484,    0,    0,  481,  490,    0,
-        0,  482,  476,    0,    0,  483,    0,  484,    0,    0,
-      479,  490,  479,  479,  480,    0,  472,  472,  472,  475,
-      475,  475,    0,  478,  482,    0,    0,    0,  489,    0,
-        0,    0,    0,  476,  476,  476,    0,  482,    0,  477,
-        0,    0,    0,    0,    0,  480,  480,  480,    0,    0,
-        0,  489,  488,  484,  478,  478,  478,  490,    0,    0,
-        0,    0,  496,  481,  489,    0,    0,    0,    0,    0,
-      477,  477,  477,  483,    0,  488,    0,    0,    0,    0,
-        0,  479,    0,  482,    0,  496,    0,    0,  488,    0,
-
-      484,    0,    0,    0,  481,  481,  481,    0,  496,    0,
-        0,  490,    0,    0,    0,    0,    0,    0,  483,    0,
-      489,    0,  479,  479,  479,  491,    0,    0,    0,    0,
-      482,  482,  482,  482,  482,  482,  482,  482,  482,  482,
-      482,    0,    0,    0,  488,    0,    0,    0,  491,  483,
-      483,  483,    0,    0,  496,  485,    0,    0,    0,    0,
-        0,  491,    0,    0,    0,    0,  484,    0,    0,    0,
-      490,    0,    0,    0,    0,    0,    0,  482,  485,  485,
-      485,    0,    0,    0,  485,  485,  485,  485,  485,    0,
-      485,  485,  485,  485,    0,    0,  482,  484,  484,  484,
-
-        0,  490,  490,  490,    0,  485,    0,  491,    0,  485,
-      492,  496,    0,  488,  488,    0,    0,    0,    0,  489,
-      488,    0,    0,  489,  488,    0,    0,  482,  482,  482,
-        0,    0,    0,  492,    0,  488,  488,  485,  485,  485,
-      488,  485,    0,    0,  488,    0,  492,  488,    0,    0,
-        0,    0,    0,    0,  489,  489,  489,  496,    0,    0,
+        0,   32,    0,    0,   32,    0,   32,    0,    0,    0,
+        0,   75,    0,    0,   32,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      491,  491,  491,  491,  491,  491,    0,    0,  488,  488,
-      488,    0,    0,    0,    0,    0,    0,    0,  496,  496,
-      496,    0,  492,  495,    0,    0,  512,    0,    0,    0,
-
-        0,  494,    0,    0,    0,    0,    0,    0,    0,    0,
-      491,    0,  493,    0,    0,    0,  495,    0,    0,  512,
-        0,    0,    0,    0,  494,    0,    0,    0,    0,  495,
-        0,  498,  512,    0,    0,  493,    0,  494,  492,  492,
-      485,  491,  491,  491,    0,    0,    0,    0,  493,    0,
-        0,  485,  485,    0,  498,    0,    0,    0,    0,  485,
-      485,  485,  485,  485,    0,  485,  485,  498,    0,  485,
-      485,  485,  485,  485,    0,  495,    0,    0,  512,    0,
-      485,    0,    0,  494,    0,  485,  485,  486,    0,    0,
-      486,  492,    0,    0,  493,  492,    0,    0,    0,    0,
+        0,    0,    0,   32,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      486,  486,  486,  498,  486,  486,  486,  486,  486,  486,
-        0,  486,  486,  486,  486,    0,  492,  492,  492,  494,
-      494,  493,  494,  494,  493,    0,  486,  493,    0,    0,
-      486,  486,    0,    0,    0,  512,    0,  494,    0,  494,
-      494,  494,    0,    0,  495,  495,  495,  495,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  486,  486,
-      486,    0,  486,    0,    0,    0,    0,    0,  495,    0,
-        0,  512,  493,  493,    0,    0,  494,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  493,    0,    0,
-
-      486,    0,  486,  486,  497,  498,  498,  498,    0,  495,
-      495,  495,  512,  512,  512,    0,  498,  494,  494,  494,
-        0,    0,    0,    0,    0,    0,    0,  497,  493,  493,
-      493,    0,  514,    0,    0,    0,    0,    0,  501,    0,
-      497,    0,    0,    0,    0,    0,    0,  498,  498,  498,
-        0,    0,    0,    0,    0,  514,    0,    0,    0,    0,
-        0,  501,  502,    0,    0,    0,    0,    0,  514,    0,
-        0,  486,    0,    0,  501,    0,    0,    0,    0,    0,
-        0,    0,  486,  486,    0,  502,  497,    0,    0,    0,
-      486,  486,  486,  486,  486,    0,  486,  486,  502,    0,
-
-      486,  486,  486,  486,  486,    0,    0,    0,    0,    0,
-        0,  486,    0,    0,  514,    0,  486,  486,  487,    0,
-      501,  487,    0,  497,  497,  497,  497,  497,  497,  497,
-      497,  497,  497,  497,  497,  497,  497,    0,    0,    0,
-        0,  487,  487,  487,  502,  487,  487,  487,  487,  487,
-      487,    0,  487,  487,  487,  487,    0,  501,  501,  501,
-        0,    0,    0,    0,    0,    0,    0,  487,    0,  501,
-        0,  487,  487,    0,    0,    0,    0,    0,    0,    0,
-        0,  502,    0,  502,  502,    0,  501,    0,  501,  497,
-        0,    0,    0,  499,    0,  501,  501,    0,    0,  487,
-
-      487,  487,    0,  487,    0,    0,    0,    0,  501,    0,
-      501,    0,  514,  501,  501,    0,  499,  514,    0,    0,
-      497,  497,  497,  501,    0,    0,    0,    0,    0,  499,
-        0,  487,    0,  487,  487,    0,  500,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  502,  514,  514,
-      514,    0,    0,    0,  501,  501,  501,    0,  504,  500,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      503,    0,  500,    0,    0,  499,    0,    0,  502,  502,
-      502,  504,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  503,  504,    0,    0,    0,    0,    0,
-
-        0,    0,  487,    0,    0,    0,  503,  506,    0,    0,
-        0,    0,    0,  487,  487,    0,    0,    0,  500,    0,
-        0,  487,  487,  487,  487,  487,    0,  487,  487,    0,
-      506,  487,  487,  487,  487,  487,    0,    0,    0,    0,
-      504,  509,  487,  506,  499,  499,    0,  487,  487,  499,
-        0,  499,  503,  499,    0,  499,  500,    0,  500,    0,
-        0,  499,  499,    0,  509,  505,    0,  499,  500,  499,
-        0,  500,  499,    0,  499,  499,    0,  509,  499,    0,
-      500,  500,  500,  500,    0,    0,  500,  500,  505,  506,
-        0,    0,  500,    0,    0,  500,    0,  500,    0,    0,
-
-      500,  505,  500,  500,  500,    0,  500,    0,  503,  499,
-      499,  499,    0,  503,  503,    0,  503,    0,    0,    0,
-        0,  500,  503,  509,  503,  503,  503,    0,  503,  504,
-      503,    0,  503,  504,  504,    0,  503,  504,  504,    0,
-        0,    0,    0,  504,    0,    0,    0,  505,    0,    0,
-        0,    0,  500,  500,  500,  503,    0,    0,    0,  506,
-      509,    0,  509,  509,    0,  506,    0,  507,    0,  506,
-        0,    0,  508,    0,  504,  504,  504,    0,    0,    0,
-      506,  506,    0,    0,    0,  506,  503,  503,  503,  506,
-      507,    0,  506,  511,    0,  508,    0,    0,    0,    0,
-
-      505,  505,  505,  507,    0,    0,  505,    0,  508,    0,
-        0,  505,    0,  505,  505,  516,  511,    0,    0,  517,
-        0,    0,    0,  506,  506,  506,  509,    0,    0,  511,
-        0,    0,    0,  515,    0,    0,    0,    0,  516,    0,
-        0,    0,  517,    0,    0,    0,    0,    0,    0,  507,
-      505,  516,    0,    0,  508,  517,  515,  509,  509,  509,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  515,
-        0,    0,    0,    0,    0,  511,    0,    0,    0,    0,
-        0,  505,  505,  505,    0,    0,    0,  507,    0,  507,
-        0,  508,  508,  508,    0,    0,    0,  516,    0,  507,
-
-        0,  517,  507,  508,  513,    0,    0,    0,    0,    0,
-        0,  507,  507,  507,  507,  515,    0,  507,  507,    0,
-      508,    0,  508,  507,    0,    0,  507,  513,  507,  508,
-      508,  507,    0,  507,  507,  507,    0,  507,    0,    0,
-      513,    0,  508,    0,  508,    0,    0,  508,  508,    0,
-        0,    0,  507,    0,    0,    0,    0,  508,    0,    0,
-      511,  511,  511,  511,  511,  511,  511,  511,  511,  511,
-      511,  511,  511,  511,  511,    0,  518,    0,  511,    0,
-        0,    0,  516,  507,  507,  507,  513,    0,  508,  508,
-      508,  510,  510,  517,    0,  510,    0,    0,    0,  518,
-
-      516,    0,    0,    0,  517,    0,  515,    0,    0,  511,
-      511,  511,  518,    0,  510,  510,  510,  510,  515,  510,
-      510,  510,  510,  510,  510,    0,  510,  510,  510,  510,
-        0,  516,  516,  516,  520,  517,  517,  517,    0,    0,
-        0,  510,  519,    0,    0,  510,  510,    0,    0,  515,
-      515,  515,    0,    0,    0,    0,    0,  520,  518,  513,
-      513,    0,  522,    0,    0,  519,    0,    0,    0,    0,
-      520,  513,    0,  510,  510,  510,    0,  510,  519,    0,
-        0,    0,    0,    0,    0,  522,    0,    0,    0,  513,
-        0,    0,  525,    0,    0,    0,    0,    0,  522,  518,
-
-        0,    0,    0,    0,    0,  510,    0,  510,  510,  521,
-        0,    0,    0,    0,    0,  525,  520,    0,  523,    0,
-      513,  513,  513,    0,  519,    0,    0,    0,  525,    0,
-        0,    0,  521,    0,    0,  524,    0,    0,    0,    0,
-        0,  523,    0,    0,  522,  521,    0,  528,    0,    0,
-        0,    0,    0,    0,  523,    0,    0,    0,  524,    0,
-        0,  518,    0,    0,    0,    0,    0,    0,  520,    0,
-      528,  524,    0,    0,  525,    0,  510,    0,    0,  520,
-      520,    0,    0,  528,    0,    0,  522,  510,  510,  526,
-        0,  521,  518,  518,  518,  510,  510,  510,  510,  510,
-
-      523,  510,  510,    0,    0,  510,  510,  510,  510,  510,
-        0,    0,  526,  519,    0,    0,  510,  524,    0,  520,
-        0,  510,  510,    0,    0,  526,    0,  519,    0,  528,
-        0,    0,  521,  521,  521,  521,  521,  521,  521,  521,
-      521,  521,  521,  521,  521,  521,  521,  522,  521,  527,
-      520,  520,  520,  523,  523,  523,  523,  523,  519,  519,
-      519,    0,  523,  523,  524,  524,  524,  524,  524,  524,
-      525,  526,  527,    0,    0,  529,    0,  525,  522,  522,
-      522,    0,    0,    0,    0,  527,  521,  521,  521,  521,
-        0,    0,    0,  530,  521,    0,    0,    0,  529,    0,
-
-        0,  531,    0,  523,    0,    0,    0,    0,  525,  525,
-      525,  529,  528,    0,    0,    0,  530,    0,    0,    0,
-      524,    0,    0,    0,  531,  521,  521,  521,    0,  530,
-        0,  527,  528,    0,  523,  523,  523,  531,    0,    0,
-      526,  526,  526,  526,  526,  526,  526,  526,  526,    0,
-        0,  524,  524,  524,    0,  532,    0,  529,    0,  534,
-        0,    0,    0,  528,  528,  528,    0,    0,  527,    0,
-        0,    0,    0,    0,  526,  530,    0,    0,  532,    0,
-        0,    0,  534,  531,    0,    0,    0,    0,    0,    0,
-        0,  532,    0,  535,  529,  534,    0,  536,    0,    0,
-
-        0,    0,  533,    0,    0,  526,  526,  526,  540,    0,
-        0,    0,    0,    0,    0,    0,  535,    0,    0,    0,
-      536,  529,  529,    0,    0,  533,    0,    0,    0,  535,
-        0,  540,    0,  536,  527,    0,    0,  532,  533,    0,
-        0,  534,    0,    0,  540,    0,    0,    0,    0,    0,
-        0,    0,    0,  537,    0,  530,  530,  530,    0,    0,
-      529,    0,    0,    0,    0,  527,  527,  527,    0,    0,
-        0,    0,    0,  531,  531,  535,  537,    0,  530,  536,
-      538,    0,  534,  534,  533,    0,  531,    0,    0,  537,
-      540,  529,  529,  529,  532,  532,  532,  539,  532,  532,
-
-      532,    0,    0,  538,    0,    0,    0,    0,    0,  530,
-      530,  530,    0,    0,    0,    0,  538,  531,  531,  531,
-      539,  533,  533,  533,  533,  533,  533,  533,  533,  533,
-      533,  533,    0,  539,    0,  537,    0,    0,    0,    0,
-      532,    0,  535,  535,  534,  550,    0,    0,  536,  536,
-      536,  536,  536,  536,  536,    0,  536,  536,  536,  536,
-      536,  536,  538,    0,    0,    0,    0,    0,  550,  541,
-        0,  532,  532,  532,    0,  534,  534,  534,  535,  539,
-        0,  550,  536,    0,    0,  544,    0,  533,    0,  540,
-      540,    0,  541,  540,    0,    0,    0,    0,  537,  537,
-
-      537,  537,  537,  537,  537,  541,    0,    0,  544,  535,
-      535,  535,    0,  536,  536,  536,    0,    0,  533,  533,
-      533,  544,  545,    0,  540,  540,  540,  550,    0,    0,
-        0,    0,    0,  537,  537,    0,    0,    0,  537,    0,
-        0,    0,    0,    0,    0,  545,    0,    0,    0,  549,
-        0,  541,    0,    0,    0,    0,    0,    0,  545,  538,
-      538,  538,  538,    0,    0,  538,    0,  544,    0,  537,
-      537,  537,  549,    0,    0,  539,  539,  539,  539,  539,
-        0,    0,  539,  546,    0,  549,    0,    0,  541,  541,
-      541,  541,  541,  541,  541,  541,  538,  538,  538,    0,
-
-        0,    0,  551,    0,  545,    0,  546,  541,    0,    0,
-        0,    0,    0,  539,  539,  539,    0,  544,  544,  546,
-        0,  550,  550,  550,  550,  551,  550,  550,    0,    0,
-      550,  549,    0,    0,    0,    0,    0,    0,  551,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  545,
-      545,  545,  545,    0,  541,    0,    0,    0,    0,    0,
-        0,  550,  550,  550,    0,  546,    0,    0,    0,    0,
-      544,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  545,  545,  551,  541,  541,  541,  542,    0,
-        0,    0,  549,  549,  549,  549,  555,    0,    0,  556,
-
-        0,  544,  544,  544,    0,    0,    0,  545,    0,    0,
-        0,  542,    0,    0,    0,    0,    0,    0,    0,  555,
-        0,    0,  556,    0,  542,    0,    0,    0,  549,  549,
-        0,    0,  555,    0,  549,  556,    0,    0,  545,  545,
-      545,    0,  546,  546,  546,  546,  546,  546,  546,  546,
-      546,  546,  546,  546,  546,  546,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  549,  549,  549,  546,  551,
-      542,    0,    0,    0,    0,    0,    0,    0,  555,    0,
-        0,  556,    0,    0,    0,    0,    0,  551,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  546,
-
-      546,  546,    0,    0,    0,    0,    0,  542,  542,  542,
-      542,  542,  542,  542,  542,  542,  542,  542,  551,  551,
-      551,    0,    0,  542,  542,  542,  542,  542,  542,  542,
-      542,  542,  542,  542,  542,  542,  542,  542,  542,  542,
-      542,  542,  542,  542,  542,  542,  542,  555,    0,    0,
-        0,    0,    0,    0,  542,  542,  542,  542,  542,  542,
-      542,  542,  542,  542,  542,  542,  542,  542,  542,  542,
-      542,    0,    0,  542,    0,    0,    0,  556,    0,    0,
-        0,  555,    0,    0,  556,    0,    0,    0,    0,    0,
+       32,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,  579,    0,    0,  542,  542,  542,  543,    0,    0,
-        0,    0,  555,  555,  555,  556,  556,  556,    0,    0,
-        0,    0,  557,    0,  579,  563,    0,    0,    0,    0,
-      543,  569,    0,    0,    0,    0,  547,  579,    0,    0,
-        0,  548,    0,  543,    0,  557,    0,    0,  563,    0,
-        0,    0,    0,    0,  569,    0,    0,    0,  557,  547,
-        0,  563,    0,    0,  548,    0,    0,  569,    0,    0,
-        0,    0,  547,    0,    0,    0,    0,  548,    0,    0,
-        0,    0,    0,  579,    0,    0,    0,    0,    0,  543,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,  557,    0,    0,  563,    0,    0,
-        0,    0,    0,  569,    0,    0,    0,    0,  547,    0,
-        0,    0,    0,  548,    0,    0,  543,  543,  543,  543,
-        0,  543,  543,  543,  543,  543,  543,  543,  543,  543,
-      543,  543,  543,  543,    0,  543,  543,  543,  543,  543,
-      543,  543,  543,  543,  543,  543,  543,  543,    0,    0,
-      547,  547,  579,  548,  548,  548,  548,  548,  548,  548,
-      548,  548,  548,  548,  548,  548,  548,  548,  548,  548,
-      548,  548,  548,  548,  548,    0,  579,  543,  543,    0,
-      563,  563,  543,  547,  547,  547,  547,  547,  547,  547,
-
-      547,  547,  547,  557,  557,    0,    0,  557,    0,    0,
-      563,    0,  569,  569,    0,    0,  569,  579,  579,  579,
-        0,  547,    0,  543,  543,  543,  548,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  557,  557,
-      557,  563,  563,  563,    0,    0,    0,  569,  569,  569,
-        0,    0,  547,  547,  547,    0,    0,  548,  548,  548,
-      552,  552,  552,  552,  552,  552,  552,  552,  552,  552,
-      552,  552,  552,  552,  552,  552,  552,  552,  552,  552,
-      552,  552,  552,  552,  552,  552,  552,  552,  552,  552,
-      552,  552,  552,  552,  552,  552,  552,  552,  552,  552,
-
-      552,  552,  552,  552,  552,  552,  552,  552,  552,  552,
-      552,  552,  552,  552,  552,  552,  552,  552,  552,  552,
-      552,  552,  552,  552,  553,  553,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  553,  553,
-      553,  553,  553,  553,  553,  553,  553,  553,  553,  553,
-      553,  553,  553,  553,  553,  554,  553,  553,  553,  553,
-      553,  553,  553,  553,  553,  553,  553,  553,  553,  553,
-      553,  553,    0,    0,  558,    0,    0,  559,  554,    0,
-      560,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  554,    0,    0,    0,    0,  561,  558,    0,  562,
-
-      559,    0,    0,  560,    0,    0,    0,    0,    0,    0,
-      558,    0,    0,  559,    0,    0,  560,    0,    0,  561,
-        0,    0,  562,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  561,    0,    0,  562,    0,  554,    0,    0,
-        0,    0,    0,  568,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  558,  564,    0,  559,
-        0,    0,  560,    0,    0,    0,  568,    0,    0,    0,
-        0,    0,    0,    0,  554,  554,  554,  554,  561,  568,
-      564,  562,  554,  554,  554,  554,  554,  554,  554,  554,
-      554,  554,    0,  564,  554,  554,  554,  554,  554,  554,
-
-      554,  554,  554,  554,  554,  554,  558,  558,  558,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  566,
-        0,    0,  554,    0,    0,  568,    0,    0,    0,    0,
-        0,    0,  562,  562,    0,  554,    0,    0,    0,  564,
-      554,    0,  566,    0,    0,    0,    0,  559,    0,  560,
-      560,  560,  560,  560,  560,  566,    0,    0,  559,  558,
-        0,    0,  559,  565,    0,  560,  567,  561,  561,  561,
-      561,  554,  554,  554,  562,  562,  562,    0,  562,    0,
-        0,  561,    0,    0,  562,    0,  565,    0,  570,  567,
-      558,  558,  558,  559,  559,  559,  560,  560,  560,  565,
-
-      599,  566,  567,    0,    0,  568,    0,  564,    0,    0,
-        0,  570,  561,  561,  561,  562,  562,  562,  576,    0,
-        0,    0,    0,  599,  570,    0,    0,    0,  568,  578,
-        0,    0,    0,    0,    0,  603,  599,    0,    0,    0,
-      573,  576,  564,    0,    0,  565,    0,    0,  567,    0,
-        0,    0,  578,    0,  576,    0,    0,    0,  603,  568,
-      568,  568,    0,  573,    0,  578,  566,  566,  566,  566,
-      570,  603,    0,  564,  564,  564,  573,    0,    0,    0,
-        0,    0,  599,  565,  565,  565,  565,  565,  565,  565,
-      565,  565,  565,  565,  565,  565,    0,    0,    0,    0,
-
-      576,    0,    0,    0,  566,    0,    0,    0,    0,    0,
-        0,  578,  565,  565,    0,  567,  567,  603,    0,    0,
-        0,    0,  573,  570,  570,  570,  570,  570,  570,  570,
-      570,  570,  570,  567,  567,  566,  566,  566,    0,    0,
-        0,    0,    0,    0,    0,    0,  599,  599,  565,    0,
-        0,  567,    0,    0,  576,  570,  570,  570,  570,  570,
-      570,  570,  570,  570,  570,  570,  570,  570,  570,  570,
-      570,    0,    0,  570,    0,    0,    0,    0,    0,  565,
-      565,  565,  567,  567,  567,  599,  573,    0,  573,    0,
-      573,  573,  573,  573,  573,  573,  573,    0,  578,    0,
-
-      576,    0,    0,  576,  570,  570,  570,  571,    0,    0,
-        0,    0,    0,    0,  578,    0,  599,  599,  599,  580,
-      603,    0,    0,    0,    0,  573,    0,    0,    0,    0,
-      571,    0,    0,    0,  576,  576,  576,    0,    0,    0,
-        0,    0,  580,  571,    0,  578,  578,  578,    0,    0,
-        0,  603,  603,  603,    0,  580,  573,  573,  573,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,    0,  866,    0,    0,    0,    0,
-        0,  572,    0,    0,    0,    0,    0,    0,  574,  571,
+        0,    0,   32,    0,   32,   32,    0,    0,   32,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   75,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   39,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,  580,    0,    0,  572,    0,    0,    0,    0,    0,
-        0,  574,    0,  866,  866,  866,  866,  572,    0,    0,
-        0,    0,    0,    0,  574,    0,  571,  571,  571,  571,
-      571,  571,  571,  571,  571,  571,  571,  571,  571,  571,
-      571,  571,  571,  571,  571,    0,  571,  571,  571,  571,
-      571,  571,  571,  571,  571,  571,  571,  571,  571,  571,
-        0,  571,    0,  572,    0,    0,  571,    0,  571,  571,
-      574,    0,    0,    0,    0,  580,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   39,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  571,  575,    0,    0,    0,    0,    0,    0,
-
-        0,  572,  572,  572,  580,  572,  572,  572,  572,  572,
-      572,  574,  572,  572,  572,  572,  575,    0,    0,  577,
-        0,  574,  574,  571,  571,  571,  572,  572,  574,  575,
-        0,  572,  572,    0,    0,  580,  580,  580,    0,    0,
-      574,    0,  577,  574,    0, 1149, 1149, 1149,  574,    0,
-      574,  574,    0,  574,    0,  577,    0,    0,    0,  572,
-      572,  572,    0,  572,    0,  574,  572,    0,  574,  574,
-        0,    0,    0,  574,    0,  575, 1149, 1149, 1149, 1149,
-     1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149,    0,
-        0,    0,    0,    0,    0,    0,    0,  572,  572,  572,
-
-        0,  577,    0,    0,  574,  574,  574,  604,    0,    0,
-        0,    0,    0,  575,  575,  575,    0,  575,    0,  575,
-      575,    0,  575,  602,    0,    0,    0,    0,    0,  575,
-      604,  575,    0,  607,    0,  575,    0,  575,  575,    0,
-      575,    0,    0,  604,  575,    0,  602,    0,    0,  575,
-        0,  575,  575,  575,  575,    0,  607,    0,    0,  602,
-        0,  575,    0,    0,    0,    0,    0,    0,    0,  607,
-        0,  575,    0,    0,    0,  575,    0,    0,  575,  577,
-        0,  577,  577,  577,    0,    0,    0,    0,    0,  604,
-        0,    0,    0,    0,    0,    0,  577,    0,    0,    0,
-
-        0,  577,    0,    0,  577,  602,    0,    0,    0,  575,
-      575,  575,    0,    0,    0,  607,    0,    0,    0,    0,
+        0,    0,    0,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   39,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   45,   45,    0,    0,   45,    0,   48,   48,
+       50,    0,   48,    0,   67,    0,   52,    0,    0,   52,
+       59,   97,    0,   59,    0,   45,    0,    0,   45,   62,
+       45,   48,   62,   50,   48,    0,   48,   67,   45,    0,
+        0,   52,   99,   52,   97,   59,    0,   59,  104,    0,
+      106,   52,    0,  118,   62,   59,   62,   45,  120,    0,
+        0,    0,    0,   48,   62,   99,    0,    0,   66,   66,
+
+       52,  104,   66,  106,   59,    0,  118,    0,    0,    0,
+        0,  120,    0,   62,   45,    0,    0,    0,    0,    0,
+       48,   66,    0,    0,   66,    0,   66,   52,    0,    0,
+        0,   59,    0,    0,    0,    0,    0,    0,    0,    0,
+       62,    0,    0,   65,    0,    0,   45,    0,   45,   45,
+        0,    0,   48,   66,   48,   48,   50,    0,    0,   52,
+       50,   52,   52,   59,   67,   59,   59,   67,    0,    0,
+        0,   97,   62,    0,   62,   62,   65,   65,   71,    0,
+       66,   65,   65,   65,   65,   65,    0,   65,   65,   65,
+       65,    0,   99,    0,    0,    0,    0,    0,  104,    0,
+
+      106,   71,   65,  118,   79,    0,   65,    0,  120,    0,
+        0,    0,   66,    0,   66,   66,    0,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   79,    0,    0,
+        0,    0,    0,    0,   65,   65,   65,    0,   65,    0,
+        0,    0,    0,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  577,  577,  577,  601,    0,
-        0,    0,    0,  602,  602,  602,    0,    0,    0,    0,
-      602,  602,  602,  602,  602,  602,  602,  602,  602,  602,
-      608,  601,  602,  602,  602,  602,  602,  602,  602,  602,
-      602,  602,  602,  602,  601,    0,    0,    0,    0,    0,
-        0,    0,    0,  608,  607,  607,    0,    0,    0,    0,
-      602,  607,  604,    0,    0,  607,  608,    0,    0,    0,
-
-        0,    0,    0,  602,    0,    0,  607,  607,  602,  609,
-        0,  607,  615,    0,    0,  607,    0,    0,  607,    0,
-      601,    0,    0,  604,  604,  604,    0,    0,    0,    0,
-        0,    0,  609,    0,    0,  615,    0,    0,    0,  602,
-      602,  602,  608,    0,    0,  609,    0,    0,  615,  607,
-      607,  607,    0,    0,    0,    0,    0,  601,  601,  601,
-      601,    0,  601,  601,  601,  601,  601,  601,  601,  601,
-      601,  601,  601,  601,  601,  605,  601,  601,  601,  601,
-      601,  601,  601,  601,  601,  601,  601,  601,    0,    0,
-        0,  609,    0,    0,  615,    0,    0,    0,  605,  605,
-
-      605,    0,    0,  610,  605,  605,  605,  605,  605,    0,
-      605,  605,  605,  605,    0,    0,    0,    0,  601,  601,
-        0,    0,    0,  601,    0,  605,  610,    0,    0,  605,
-        0,    0,    0,    0,    0,  609,    0,  611,    0,  610,
-        0,  608,    0,    0,    0,  608,    0,    0,    0,    0,
-        0,  615,    0,    0,  601,  601,  601,  605,  605,  605,
-      611,  605,    0,  614,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  611,    0,    0,  608,  608,  608,  612,
-        0,    0,  637,    0,    0,  610,  614,    0,    0,    0,
-        0,    0,    0,    0,  609,    0,    0,  615,    0,  614,
-
-        0,    0,  612,    0,    0,  637,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  612,    0,    0,  637,  611,
-        0,    0,    0,    0,    0,  609,  609,  609,  615,  615,
-      615,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  614,    0,    0,  610,  610,
-      610,  610,  610,  610,    0,    0,    0,    0,    0,    0,
-      605,  612,    0,    0,  637,  611,  611,    0,    0,    0,
-        0,  605,  605,    0,    0,    0,    0,    0,    0,  605,
-      605,  605,  605,  605,    0,  605,  605,    0,  610,  605,
-      605,  605,  605,  605,    0,    0,    0,    0,  612,    0,
-
-      605,  612,    0,    0,  612,  605,  605,  606,  606,    0,
-        0,  606,    0,    0,    0,    0,    0,  637,  611,  610,
-      610,  610,  611,  613,  614,  614,  614,  614,    0,    0,
-      606,  606,  606,  606,    0,  606,  606,  606,  606,  606,
-      606,    0,  606,  606,  606,  606,  613,    0,  614,  612,
-      612,    0,    0,  611,  611,  611,    0,  606,    0,  613,
-        0,  606,  606,    0,  612,    0,    0,  637,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  614,
-      614,  614,    0,    0,  617,    0,    0,    0,    0,  606,
-      606,  606,    0,  606,    0,  612,  612,  612,  637,  637,
-
-      637,    0,    0,    0,    0,  613,    0,  617,    0,  621,
-        0,    0,    0,    0,  618,    0,    0,    0,    0,    0,
-      617,  606,    0,  606,  606,  616,    0,    0,    0,    0,
-        0,    0,  621,    0,    0,    0,    0,  618,    0,    0,
-        0,    0,    0,    0,  623,  621,    0,    0,  616,    0,
-      618,  613,  613,    0,  613,  613,    0,    0,    0,    0,
-        0,  616,    0,    0,    0,    0,  617,  623,    0,  613,
-        0,  613,  613,  613,    0,    0,    0,    0,    0,    0,
-      623,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  621,  606,    0,    0,    0,  618,    0,    0,    0,
-
-        0,    0,    0,  606,  606,    0,    0,  616,  613,    0,
-        0,  606,  606,  606,  606,  606,    0,  606,  606,    0,
-        0,  606,  606,  606,  606,  606,  623,    0,  621,    0,
-      621,  621,  606,    0,    0,    0,    0,  606,  606,  613,
-      613,  613,    0,    0,  616,  616,  616,  616,  616,  616,
-      616,  616,  616,  616,  616,  616,  616,  616,  617,  617,
-      617,    0,  619,    0,    0,  618,  618,    0,    0,  617,
-      618,    0,  618,    0,  618,    0,  618,    0,    0,    0,
-        0,    0,  618,  618,    0,  619,    0,    0,  618,    0,
-      618,    0,    0,  618,  621,  618,  618,    0,  619,  618,
-
-      617,  617,  617,    0,    0,    0,    0,    0,    0,    0,
-      616,  636,    0,    0,  620,  623,    0,    0,    0,  623,
-      623,    0,    0,  623,  623,  621,  621,  621,    0,  623,
-      618,  618,  618,    0,  636,  629,    0,  620,    0,    0,
-        0,  616,  616,  616,  619,    0,    0,  636,    0,  622,
-      620,    0,    0,    0,    0,    0,    0,    0,  629,    0,
-      623,  623,  623,    0,    0,    0,    0,    0,    0,    0,
-        0,  629,  622,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  619,    0,  619,  622,    0,    0,    0,    0,
-        0,    0,    0,  636,  619,    0,  620,  619,    0,    0,
-
-        0,  624,    0,    0,    0,    0,  619,  619,  619,  619,
-        0,    0,  619,  619,    0,    0,    0,  629,  619,    0,
-        0,  619,    0,  619,  624,    0,  619,    0,  619,  619,
-      619,  622,  619,  620,  620,  620,    0,  624,    0,    0,
-        0,    0,    0,    0,    0,  620,    0,  619,    0,    0,
-        0,    0,    0,    0,  629,    0,  629,  629,  626,    0,
-        0,  636,  620,    0,  620,    0,    0,    0,    0,    0,
-        0,  620,  620,    0,    0,    0,    0,  635,  619,  619,
-      619,  626,    0,  624,  620,    0,  620,  622,    0,  620,
-      620,    0,  622,  622,  626,  622,  636,    0,    0,  620,
-
-      635,  622,    0,  622,  622,  622,    0,  622,    0,  622,
-        0,  622,  656,  635,    0,  622,    0,    0,    0,    0,
-      629,    0,  627,    0,    0,    0,    0,  636,  636,  636,
-      620,  620,  620,    0,  622,  656,  624,  624,  624,  625,
-      626,    0,  624,    0,    0,  627,    0,  624,  656,  624,
-      624,  629,  629,  629,    0,    0,    0,    0,  627,  635,
-        0,    0,  625,  625,  625,  622,  622,  622,  625,  625,
-      625,  625,  625,    0,  625,  625,  625,  625,    0,    0,
-        0,    0,    0,    0,    0,    0,  624,    0,    0,  625,
-        0,    0,    0,  625,  656,    0,  635,  635,  635,    0,
-
-        0,    0,    0,    0,  627,    0,    0,    0,    0,  626,
-      626,    0,    0,    0,    0,    0,  626,  624,  624,  624,
-      626,  625,  625,  625,  638,  625,    0,    0,    0,  639,
-        0,  626,  626,    0,    0,  642,  626,  656,    0,    0,
-      626,  628,  627,  626,  627,    0,    0,  638,    0,    0,
-        0,    0,  639,    0,  627,    0,    0,  627,  642,    0,
-      638,    0,  635,    0,  628,  639,  627,  627,  627,  627,
-        0,  642,  627,  627,  626,  626,  626,  628,  627,    0,
-        0,  627,    0,  627,    0,    0,  627,    0,  627,  627,
-      627,    0,  627,  635,  635,  635,    0,  656,    0,    0,
-
-        0,    0,    0,    0,    0,    0,  638,  627,    0,    0,
-        0,  639,    0,    0,    0,    0,    0,  642,    0,    0,
-        0,    0,    0,  628,  625,    0,    0,    0,  656,  656,
-      656,    0,    0,    0,    0,  625,  625,    0,  627,  627,
-      627,    0,    0,  625,  625,  625,  625,  625,    0,  625,
-      625,    0,  644,  625,  625,  625,  625,  625,    0,    0,
-      628,  628,  628,    0,  625,    0,    0,    0,    0,  625,
-      625,  639,  628,    0,  640,  644,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  644,  628,
-      638,  628,    0,    0,    0,    0,    0,  640,  628,  628,
-
-      630,    0,  642,  642,  642,  642,  642,  642,  642,  638,
-      640,  628,    0,  628,  639,    0,  628,  628,    0,    0,
-      642,    0,    0,  630,  630,  630,  628,    0,    0,  630,
-      630,  630,  630,  630,  644,  630,  630,  630,  630,  631,
-      638,  638,  638,    0,    0,  639,  639,  639,    0,    0,
-      630,  642,  642,  642,  630,    0,  640,  628,  628,  628,
-        0,    0,  631,  631,  631,    0,    0,    0,  631,  631,
-      631,  631,  631,    0,  631,  631,  631,  631,  632,    0,
-        0,    0,  630,  630,  630,    0,  630,    0,    0,  631,
-        0,    0,    0,  631,    0,    0,  644,  644,  644,  644,
-
-        0,  632,  632,  632,    0,    0,    0,  632,  632,  632,
-      632,  632,    0,  632,  632,  632,  632,  633,    0,    0,
-        0,  631,  631,  631,  640,  631,    0,    0,  632,    0,
-        0,    0,  632,    0,    0,    0,    0,  644,    0,    0,
-      633,  633,  633,    0,    0,    0,  633,  633,  633,  633,
-      633,  645,  633,  633,  633,  633,  640,    0,    0,  640,
-      632,  632,  632,    0,  632,    0,    0,  633,  644,  644,
-      644,  633,    0,    0,  645,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  630,    0,  645,    0,    0,
-      640,  640,  640,    0,    0,    0,  630,  630,    0,  633,
-
-      633,  633,    0,  633,  630,  630,  630,  630,  630,    0,
-      630,  630,    0,    0,  630,  630,  630,  630,  630,    0,
-        0,    0,    0,    0,  631,  630,    0,    0,    0,  649,
-      630,  630,    0,  645,    0,  631,  631,    0,    0,    0,
-        0,    0,    0,  631,  631,  631,  631,  631,    0,  631,
-      631,    0,  649,  631,  631,  631,  631,  631,    0,    0,
-        0,    0,    0,  632,  631,  649,    0,    0,    0,  631,
-      631,    0,    0,    0,  632,  632,    0,    0,    0,    0,
-        0,  641,  632,  632,  632,  632,  632,    0,  632,  632,
-        0,    0,  632,  632,  632,  632,  632,    0,    0,    0,
-
-        0,    0,  633,  632,  641,    0,    0,    0,  632,  632,
-        0,  649,    0,  633,  633,  645,    0,  641,    0,    0,
-      634,  633,  633,  633,  633,  633,    0,  633,  633,    0,
-        0,  633,  633,  633,  633,  633,  645,    0,    0,    0,
-        0,    0,  633,  634,  634,  634,    0,  633,  633,  634,
-      634,  634,  634,  634,  647,  634,  634,  634,  634,  648,
-        0,    0,    0,  641,    0,    0,    0,  645,  645,  645,
-      634,    0,    0,    0,  634,    0,  643,  647,    0,    0,
-        0,    0,  648,    0,    0,    0,    0,    0,    0,    0,
-      647,    0,    0,    0,    0,  648,    0,    0,    0,  643,
-
-        0,    0,  634,  634,  634,    0,  634,  649,  649,    0,
-      649,  649,  643,    0,  649,    0,  641,  641,  641,  641,
-      641,  641,  641,  641,  641,  646,    0,    0,  650,    0,
-        0,    0,    0,    0,    0,    0,  647,    0,    0,    0,
-        0,  648,    0,    0,    0,  649,  649,  649,  646,    0,
-        0,  650,    0,    0,    0,    0,    0,    0,  643,    0,
-        0,  646,    0,  641,  650,    0,  641,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  651,    0,  647,
-      647,  647,  647,    0,    0,  648,  648,  648,  648,  648,
-      648,  648,    0,    0,    0,    0,  653,  641,  641,  641,
-
-      651,    0,    0,    0,    0,  634,  652,  646,    0,    0,
-      650,    0,    0,  651,    0,    0,  634,  634,    0,  653,
-        0,    0,    0,    0,  634,  634,  634,  634,  634,  652,
-      634,  634,  653,    0,  634,  634,  634,  634,  634,  647,
-        0,    0,  652,    0,  648,  634,    0,  650,  650,    0,
-      634,  634,  643,  643,  643,  643,  643,  643,  643,  651,
-        0,  643,    0,    0,    0,  646,  646,  646,  646,  646,
-      647,  647,  647,    0,    0,  648,  648,  648,  653,  654,
-        0,    0,  659,    0,    0,  655,    0,    0,  652,    0,
-        0,    0,  643,  643,  643,    0,  651,  651,  651,  651,
-
-        0,    0,  654,    0,    0,  659,    0,    0,  655,    0,
-      646,    0,    0,  650,    0,  654,    0,    0,  659,    0,
-        0,  655,    0,    0,    0,    0,    0,    0,    0,    0,
-      652,  652,  652,  652,    0,    0,    0,    0,  652,    0,
-        0,  646,  646,  646,  650,  650,  650,    0,  651,  651,
-        0,    0,  652,    0,  652,  652,  652,    0,    0,    0,
-      660,  654,  651,    0,  659,  661,    0,  655,    0,  662,
-        0,  653,  653,  653,  653,  653,  653,    0,    0,    0,
-        0,  653,    0,  660,  657,    0,    0,    0,  661,    0,
-        0,  652,  662,  651,  651,  651,  660,    0,    0,    0,
-
-        0,  661,    0,    0,  663,  662,    0,  657,    0,  664,
-        0,    0,  653,  653,  653,  655,  655,  655,  655,  655,
-      657,    0,  652,  652,  652,    0,    0,  663,    0,    0,
-      655,  655,  664,  655,    0,    0,    0,    0,    0,  654,
-      663,    0,  660,    0,    0,  664,  669,  661,    0,    0,
-        0,  662,  658,    0,    0,    0,    0,    0,  659,    0,
-        0,    0,    0,    0,  654,    0,  657,  659,    0,  669,
-      655,    0,    0,    0,    0,  658,    0,    0,    0,    0,
-        0,    0,  669,    0,    0,    0,  663,    0,  658,    0,
-        0,  664,  662,  662,  662,  654,  654,  654,  659,  659,
-
-      659,  655,  655,  655,  657,  657,  657,  657,  657,  657,
-      657,  657,  657,  657,  657,  657,  657,  657,  657,  657,
-      657,  657,  657,  657,  657,  657,  657,    0,  669,    0,
-        0,    0,    0,    0,  658,  665,    0,    0,    0,  660,
-      660,  660,    0,  661,    0,  660,    0,    0,    0,    0,
-      661,    0,  666,    0,  662,    0,  667,  663,  665,    0,
-        0,  668,    0,    0,    0,    0,    0,    0,    0,  657,
-        0,  665,  658,  658,  658,  666,  660,  660,  660,  667,
-        0,  661,  661,  661,  668,  662,  662,  662,  666,  663,
-        0,  664,  667,    0,  664,    0,    0,  668,    0,    0,
-
-      657,  657,  657,  658,  658,  658,  658,  658,  658,  658,
-      658,  658,  658,  658,  658,  658,    0,  665,    0,    0,
-      663,  663,  663,    0,    0,  664,  664,  664,  669,  670,
-        0,  669,    0,    0,  666,    0,    0,  658,  667,    0,
-        0,    0,    0,  668,    0,    0,    0,    0,  671,    0,
-        0,  673,  670,    0,  665,  665,  665,  665,  665,  665,
-      665,    0,  669,  669,  669,  670,    0,    0,  658,  658,
-      658,  671,  672,    0,  673,    0,  667,  667,  667,  667,
-      667,    0,    0,    0,  671,    0,    0,  673,    0,  675,
-        0,    0,    0,    0,    0,  672,    0,  666,  666,  666,
-
-        0,  666,  666,  666,  666,  666,  674,    0,  672,  676,
-        0,  670,  675,    0,    0,    0,    0,    0,    0,    0,
-      665,    0,    0,  667,  667,  675,  677,    0,    0,  674,
-      671,    0,  676,  673,    0,  668,  668,  666,    0,    0,
-        0,  667,  674,    0,    0,  676,  668,    0,    0,  677,
-        0,  665,  665,  665,  672,    0,    0,    0,    0,    0,
-        0,    0,  677,    0,    0,    0,  678,    0,  666,  666,
-      666,  675,  667,  667,  667,    0,    0,  668,  668,  668,
-        0,    0,    0,    0,    0,    0,    0,    0,  674,  678,
-        0,  676,    0,    0,    0,  681,  670,  670,  670,  670,
-
-      670,    0,  678,  679,    0,    0,    0,    0,  677,    0,
-        0,    0,  675,    0,  670,    0,  671,  671,  681,  680,
-        0,    0,    0,  673,    0,    0,  679,    0,    0,    0,
-        0,  681,    0,  671,    0,    0,  673,  672,  672,  679,
-        0,    0,  680,    0,    0,  670,  670,  670,  678,    0,
-        0,  676,  676,  676,  676,  680,    0,  672,    0,    0,
-        0,    0,    0,  684,  671,  671,  671,  673,  673,  673,
-        0,    0,    0,    0,  675,    0,    0,  681,    0,  677,
-      674,  674,  674,  674,  674,  679,  684,    0,  672,  672,
-      672,  674,  686,    0,  676,    0,    0,    0,    0,  684,
-
-        0,  680,    0,    0,    0,  675,  675,  675,    0,    0,
-        0,  677,    0,  682,    0,  686,  678,    0,    0,    0,
-        0,    0,  674,  674,  674,  676,  676,  676,  686,  679,
-      679,  679,  679,  679,    0,    0,  682,    0,    0,    0,
-        0,  687,  677,  677,  677,  684,    0,    0,    0,  682,
-        0,  678,  682,  682,  682,  682,  682,  682,  682,  682,
-      682,  682,  690,    0,  687,    0,    0,    0,  680,  680,
-      688,    0,    0,    0,  686,    0,    0,  687,    0,    0,
-      681,    0,  678,  678,  678,  690,  683,    0,  679,    0,
-        0,    0,    0,  688,    0,  682,    0,    0,  690,  690,
-
-      690,    0,    0,    0,  680,    0,  688,    0,    0,  683,
-        0,  681,  681,  681,    0,  685,    0,    0,    0,  679,
-      679,  679,  683,  687,    0,  683,  683,  683,  683,  683,
-      683,  683,  683,  683,  683,  680,  680,  680,  685,    0,
-        0,    0,  689,  686,  690,    0,    0,    0,  684,    0,
-        0,  685,  688,    0,  685,  685,  685,  685,  685,  685,
-      685,  685,  685,  685,  691,  689,    0,    0,  683,    0,
-      692,    0,    0,    0,    0,    0,    0,  686,  689,  684,
-      684,  684,    0,    0,  693,    0,  687,  691,    0,  688,
-      688,  694,    0,  692,    0,    0,    0,  685,  682,  695,
-
-      691,    0,    0,    0,    0,    0,  692,  693,  686,  686,
-      686,    0,    0,    0,  694,    0,    0,    0,    0,    0,
-      693,    0,  695,    0,  689,    0,  687,  694,    0,  682,
-      682,  682,    0,  697,    0,  695,    0,    0,    0,  696,
-        0,    0,    0,    0,    0,    0,  691,  690,    0,    0,
-        0,    0,  692,    0,    0,  688,  697,  687,  687,  687,
-        0,  689,  696,    0,    0,    0,  693,    0,    0,  697,
-        0,  683,    0,  694,    0,  696,    0,    0,  690,  690,
-      690,  695,    0,  691,  698,    0,  688,  688,  688,  692,
-      692,  692,  692,  692,  692,  692,  692,  692,  692,  692,
-
-      685,  699,  683,  683,  683,    0,    0,  698,    0,    0,
-      694,    0,  701,    0,    0,  697,    0,    0,    0,    0,
-      698,  696,    0,    0,  699,    0,    0,  689,  702,    0,
-        0,  685,  685,  685,  693,  701,  692,  699,    0,  703,
-        0,    0,    0,    0,    0,    0,    0,    0,  701,  691,
-        0,  702,    0,    0,    0,  692,    0,    0,  689,  689,
-      689,    0,  703,    0,  702,    0,  698,    0,    0,  693,
-        0,    0,    0,    0,    0,  703,  694,    0,  697,    0,
-      691,  691,  691,  699,  695,    0,  692,  692,  692,  700,
-      696,    0,    0,    0,  701,    0,    0,    0,    0,    0,
-
-      693,  693,  693,  698,  698,    0,    0,  694,  694,  694,
-      702,    0,  700,    0,    0,  695,  695,  695,  697,    0,
-      699,  703,    0,    0,  696,  700,    0,    0,  700,  700,
-      700,  700,  700,  700,  700,  700,  700,  700,    0,  704,
-        0,    0,    0,  705,    0,    0,    0,    0,    0,  697,
-      697,  697,    0,  706,    0,  696,  696,  696,  703,  703,
-      708,    0,  704,  701,    0,    0,  705,  707,    0,  698,
-        0,  700,    0,  702,    0,  704,  706,    0,    0,  705,
-        0,    0,    0,  708,    0,    0,  699,    0,    0,  706,
-      707,    0,    0,    0,    0,    0,  708,  701,    0,    0,
-
-      698,  698,  698,  707,  709,    0,    0,    0,    0,    0,
-        0,    0,    0,  702,    0,    0,    0,  699,  699,  699,
-        0,  704,    0,    0,  703,  705,    0,  709,  701,  701,
-      701,  712,    0,    0,    0,  706,    0,    0,    0,    0,
-      709,    0,  708,    0,  702,  702,  702,    0,  710,  707,
-        0,    0,    0,    0,  712,  703,  703,  703,  704,    0,
-        0,    0,    0,    0,    0,    0,    0,  712,    0,    0,
-        0,  710,    0,    0,  700,    0,    0,    0,    0,  708,
-      708,    0,    0,    0,  710,    0,  709,  710,  710,  710,
-      710,  710,  710,  710,  710,  710,  710,  718,    0,    0,
-
-        0,    0,    0,    0,  706,  700,  700,  700,    0,    0,
-        0,  714,  707,  712,    0,    0,    0,    0,    0,    0,
-      718,    0,    0,  709,  704,    0,    0,    0,  705,    0,
-      710,  713,    0,  718,  714,    0,    0,    0,  706,    0,
-        0,    0,    0,    0,    0,  708,    0,  714,    0,    0,
-      712,    0,  707,    0,  713,  704,  704,  704,  711,  705,
-      705,  705,    0,    0,    0,    0,    0,  713,    0,  706,
-      706,  706,    0,    0,    0,    0,  708,  708,  708,  718,
-        0,  711,    0,  707,  707,  707,    0,  715,    0,  709,
-        0,    0,  716,  714,  711,  717,    0,  711,  711,  711,
-
-      711,  711,  711,  711,  711,  711,  711,    0,    0,    0,
-      715,    0,    0,  713,    0,  716,  712,    0,  717,    0,
-      709,  709,  709,  715,    0,    0,    0,    0,  716,  716,
-      716,  717,    0,  710,    0,    0,    0,    0,    0,  719,
-      711,    0,  718,    0,  720,    0,    0,  712,  712,  712,
-      713,  713,  713,  713,  713,  713,  713,  713,  713,  713,
-      713,  714,  719,    0,  710,  710,  710,  720,    0,  715,
-        0,    0,    0,    0,  716,  719,    0,  717,    0,    0,
-      720,    0,  718,    0,    0,    0,    0,  725,    0,    0,
-        0,    0,    0,    0,    0,    0,  714,  713,    0,    0,
-
-        0,    0,    0,    0,    0,    0,  715,    0,    0,    0,
-      725,    0,    0,  718,  718,  718,  713,  724,    0,    0,
-        0,  719,    0,  725,    0,    0,  720,  714,  714,  714,
-        0,    0,    0,    0,  726,    0,    0,    0,    0,    0,
-      724,    0,    0,  711,    0,  721,  717,  713,  713,  713,
-        0,    0,    0,  724,    0,    0,    0,  726,  719,  719,
-        0,    0,    0,  720,    0,    0,    0,    0,  721,  725,
-      726,    0,  715,    0,  711,  711,  711,  716,    0,    0,
-      717,  721,    0,    0,  721,  721,  721,  721,  721,  721,
-      721,  721,  721,  721,  722,    0,    0,    0,    0,  724,
-
-        0,    0,    0,  715,  715,  715,    0,    0,  716,  716,
-      716,  717,  717,  717,    0,    0,  726,  722,    0,    0,
-        0,    0,    0,    0,  719,    0,    0,  721,  727,  720,
-      722,    0,  725,  722,  722,  722,  722,  722,  722,  722,
-      722,  722,  722,  723,    0,    0,    0,    0,    0,    0,
-        0,  727,    0,  726,  726,  719,  719,  719,    0,    0,
-      720,  720,  720,    0,  727,    0,  723,    0,  724,    0,
-        0,  731,  725,    0,    0,    0,  722,  729,    0,  723,
-      723,  723,  723,  723,  723,  723,  723,  723,  723,  723,
-      723,  723,    0,    0,  731,    0,    0,    0,    0,    0,
-
-      729,    0,  724,  725,  725,  725,    0,  731,    0,    0,
-      727,    0,    0,  729,    0,    0,    0,    0,  732,  726,
-        0,    0,    0,    0,    0,  723,    0,    0,    0,    0,
-      721,    0,    0,  724,  724,  724,    0,    0,    0,    0,
-        0,  732,    0,    0,  728,    0,    0,  727,    0,    0,
-      726,  726,  726,  731,  732,    0,    0,    0,    0,  729,
-        0,  721,  721,  721,    0,    0,    0,  728,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  722,
-      728,  728,  728,  728,  728,  728,  728,  728,  728,  728,
-      728,  728,  728,  730,    0,    0,  729,    0,    0,    0,
-
-      732,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      722,  722,  722,  727,    0,    0,  730,    0,  750,    0,
-        0,  731,    0,    0,    0,    0,  728,  733,  723,  730,
-        0,  733,    0,    0,    0,    0,    0,  732,    0,    0,
-        0,  750,    0,    0,  727,  727,  727,    0,    0,    0,
-      733,    0,    0,  733,  750,  733,  731,    0,    0,  723,
-      723,  723,  729,  733,    0,    0,    0,    0,  751,    0,
-        0,    0,    0,    0,    0,  730,    0,    0,    0,    0,
-        0,    0,  733,    0,    0,    0,    0,  731,  731,  731,
-        0,  751,    0,  729,  729,  729,    0,    0,    0,    0,
-
-      750,    0,  736,  732,  751,    0,  736,    0,    0,  733,
-        0,    0,  730,  730,  730,  730,  730,  730,  730,  730,
-      730,  730,  730,    0,    0,  736,    0,    0,  736,  728,
-      736,    0,    0,    0,  732,  732,  732,    0,  736,    0,
-      752,  733,    0,  733,  733,  734,  734,    0,    0,  734,
-      751,  753,    0,    0,    0,    0,    0,  736,    0,  730,
-      728,  728,  728,  752,    0,  738,  738,    0,  734,  738,
-        0,  734,    0,  734,  753,    0,  752,    0,  730,    0,
-        0,  734,    0,    0,  736,    0,    0,  753,  738,    0,
-        0,  738,    0,  738,  734,    0,    0,    0,    0,    0,
-
-      734,  738,    0,  750,    0,    0,    0,    0,    0,  730,
-      730,  730,  733,    0,  738,    0,  736,    0,  736,  736,
-      738,    0,  752,    0,    0,    0,    0,  734,  739,  739,
-        0,    0,  739,  753,  750,  750,  750,    0,    0,    0,
-        0,    0,    0,  733,  733,  733,    0,  738,    0,    0,
-        0,  739,    0,  751,  739,    0,  739,    0,    0,  734,
-        0,  734,  734,    0,  739,    0,  755,    0,    0,    0,
-        0,    0,  740,  740,    0,    0,  740,  739,    0,  738,
-        0,  738,  738,  739,  751,  751,  751,  736,    0,  755,
-        0,  752,    0,    0,    0,  740,  753,    0,  740,    0,
-
-      740,    0,  755,    0,    0,    0,    0,    0,  740,    0,
-      739,  741,  741,    0,    0,  741,  738,    0,  736,  736,
-      736,  740,    0,  754,    0,  752,    0,  740,    0,    0,
-      734,    0,    0,    0,  741,    0,  753,  741,    0,  741,
-        0,    0,  739,    0,  739,  739,  754,  741,  755,    0,
-      738,  743,  743,    0,  740,  743,  752,  752,  752,  754,
-      741,  734,  734,  734,    0,    0,  741,  753,  753,  753,
-        0,    0,    0,  739,  743,    0,    0,  743,    0,  743,
-        0,  738,  738,  738,    0,  755,  740,  743,  740,  740,
-        0,  740,  740,  741,    0,    0,    0,    0,  744,  744,
-
-      743,    0,  744,    0,    0,  754,  743,    0,    0,    0,
-        0,    0,    0,  739,    0,    0,    0,    0,    0,    0,
-        0,  744,    0,    0,  744,  741,  744,  741,  741,    0,
-      741,    0,    0,  743,  744,    0,  745,  745,    0,    0,
-      745,    0,  754,  754,  739,  739,  739,  744,    0,    0,
-        0,  755,    0,  744,    0,    0,    0,  740,    0,  745,
-        0,    0,  745,    0,  745,  743,    0,  743,  743,    0,
-        0,    0,  745,    0,    0,  746,  746,    0,    0,  746,
-      744,    0,  755,  755,  755,  745,    0,    0,  740,  740,
-      740,  745,    0,    0,    0,    0,  741,  756,  746,    0,
-
-        0,  746,    0,  746,    0,    0,    0,    0,  754,    0,
-        0,  746,  744,    0,  744,  744,    0,    0,  745,    0,
-      756,    0,    0,    0,  746,    0,  759,  741,  741,  741,
-      746,    0,    0,  756,    0,    0,  743,  757,    0,  754,
-      754,  754,    0,    0,    0,    0,    0,    0,    0,  759,
-      745,    0,  745,  745,    0,  745,    0,  746,    0,    0,
-      757,    0,  759,    0,    0,    0,    0,  743,  743,  743,
-        0,    0,    0,  757,    0,    0,    0,    0,    0,  756,
-        0,    0,    0,  744,  747,  747,    0,    0,  747,  746,
-        0,  746,  746,    0,  746,  746,  746,  746,  746,  746,
-
-      746,  746,  746,  746,  746,    0,    0,  747,  759,    0,
-      747,    0,  747,  756,  744,  744,  744,    0,    0,  757,
-      747,  745,  748,  748,    0,    0,  748,    0,  760,    0,
-        0,    0,    0,  747,  761,    0,    0,    0,  758,  747,
-        0,  746,  763,    0,    0,  748,    0,    0,  748,    0,
-      748,  760,  745,  745,  745,    0,  757,  761,  748,    0,
-      746,  758,    0,    0,  760,  763,  747,    0,    0,    0,
-      761,  748,    0,    0,  758,    0,  759,  748,  763,    0,
-        0,    0,  756,    0,    0,    0,    0,    0,    0,  764,
-        0,  746,  746,  746,    0,  762,  762,    0,  747,  762,
-
-      747,  747,    0,    0,  748,    0,    0,    0,    0,  767,
-      760,  759,  764,  756,  756,  756,  761,    0,  762,    0,
-      758,  762,  757,  762,  763,  764,    0,    0,    0,    0,
-        0,  762,  767,    0,  747,    0,  748,    0,  748,  748,
-        0,  748,  759,  759,  759,  767,    0,  760,    0,    0,
-      762,  766,    0,  757,  757,  757,    0,  758,  758,  758,
-      758,  758,  758,  758,  758,  758,  758,  758,    0,  747,
-        0,  764,    0,    0,  766,    0,    0,  762,    0,    0,
-      768,    0,    0,    0,    0,    0,    0,  766,    0,    0,
-        0,  767,    0,    0,    0,  765,    0,    0,    0,  769,
-
-      747,  747,  747,  768,  758,    0,  770,  748,  764,  762,
-        0,  762,  762,  760,    0,    0,  768,    0,  765,  761,
-        0,    0,  769,  758,    0,    0,    0,  763,  767,  770,
-        0,  765,    0,  766,    0,  769,    0,    0,  748,  748,
-      748,    0,  770,    0,  760,  760,  760,  772,    0,    0,
-      761,  761,  761,  771,  758,  758,  758,    0,  763,  763,
-      763,  773,  768,    0,  777,    0,    0,  776,    0,    0,
-      772,    0,    0,  778,  764,    0,  771,  765,    0,    0,
-      762,  769,    0,  772,  773,    0,    0,  777,  770,  771,
-      776,    0,    0,    0,  767,    0,  778,  773,    0,    0,
-
-      777,  766,    0,  776,    0,  764,  764,  764,  779,  778,
-        0,  762,  762,  762,  765,  765,  765,  765,  765,  765,
-      765,  765,  765,  765,  765,  767,  767,  767,    0,  772,
-        0,  779,    0,    0,    0,  771,  766,    0,    0,    0,
-        0,    0,    0,  773,  779,    0,  777,  780,    0,  776,
-      769,  770,    0,  781,    0,  778,    0,    0,    0,    0,
-        0,  765,    0,    0,    0,  768,  772,  766,  766,  766,
-      780,  783,  771,  771,    0,    0,  781,    0,    0,    0,
-      765,    0,    0,  780,  769,    0,    0,    0,    0,  781,
-      779,  770,  778,  778,  783,    0,  768,  768,  768,    0,
-
-        0,    0,    0,    0,    0,  785,    0,  783,    0,  777,
-        0,  765,  765,  765,  784,  769,  769,  769,  776,    0,
-      782,    0,  770,  770,  770,  786,    0,  779,  785,  780,
-        0,  788,  772,    0,    0,  781,    0,  784,  771,    0,
-        0,  785,    0,  782,    0,    0,  773,    0,  786,  777,
-      784,    0,  776,  783,  788,    0,  782,    0,  778,    0,
-        0,  786,    0,  772,  772,  772,    0,  788,    0,  771,
-      771,  771,  781,    0,    0,    0,    0,  773,  773,  773,
-      777,  777,  777,  776,  776,  776,    0,  785,    0,  778,
-      778,  778,  791,  779,    0,  789,  784,    0,    0,  790,
-
-        0,    0,  782,    0,    0,    0,    0,  786,    0,    0,
-        0,    0,    0,  788,  792,  791,    0,    0,  789,    0,
-        0,  783,  790,    0,  779,  779,  779,    0,  791,    0,
-        0,  789,  780,  784,    0,  790,    0,  792,  781,  782,
-      782,  782,  782,  782,  782,  782,  782,  782,  782,  782,
-      792,    0,    0,    0,    0,    0,  783,  787,  787,    0,
-        0,  787,    0,  780,  780,  780,    0,    0,  795,  781,
-      781,  781,  797,    0,  791,    0,    0,  789,  796,    0,
-      787,  790,  788,  787,  798,  787,  782,  783,  783,  783,
-      785,  795,    0,  787,    0,  797,  792,    0,    0,  784,
-
-        0,  796,    0,    0,  795,  782,    0,  798,  797,    0,
-      786,  791,  787,    0,  796,    0,  788,    0,  790,  790,
-      798,  785,  785,  785,    0,    0,    0,    0,    0,    0,
-      784,  784,  784,    0,    0,    0,  782,  782,  782,  787,
-      789,  786,  786,  786,    0,    0,  800,  788,  788,  788,
-      795,    0,  801,    0,  797,    0,    0,    0,    0,    0,
-      796,    0,    0,    0,    0,    0,  798,    0,    0,  800,
-        0,  787,    0,  787,  787,  801,    0,  791,    0,    0,
-      789,    0,  800,    0,  790,    0,    0,    0,  801,    0,
-        0,  797,  797,    0,    0,    0,    0,  804,    0,  792,
-
-        0,  799,  799,  798,    0,  799,    0,    0,  791,  791,
-      791,  789,  789,  789,    0,  790,  790,  790,    0,  795,
-      804,    0,  802,  796,  799,  803,    0,  799,  800,  799,
-      792,  792,  792,  804,  801,    0,    0,  799,    0,    0,
-        0,  805,  787,    0,  806,  802,    0,    0,  803,    0,
-        0,    0,    0,  795,    0,    0,  799,  797,  802,    0,
-        0,  803,    0,  796,  805,    0,    0,  806,    0,  798,
-      808,  801,    0,  787,  787,  787,    0,  805,    0,  804,
-      806,    0,    0,  799,  795,  795,  795,    0,  797,  797,
-      797,  807,    0,  808,  796,  796,  796,  809,    0,    0,
-
-      798,  798,  798,    0,  802,    0,  808,  803,    0,    0,
-        0,    0,    0,    0,  807,  799,  804,  799,  799,    0,
-      809,    0,    0,  805,    0,    0,  806,  807,    0,    0,
-        0,  800,    0,  809,    0,    0,    0,  801,  811,    0,
-        0,  802,  802,  802,  802,  802,  802,  802,  802,  802,
-      802,  802,  808,    0,    0,  812,    0,    0,    0,    0,
-        0,  811,  800,  800,  800,    0,    0,    0,  801,  801,
-      801,    0,    0,  807,  811,  803,    0,    0,  812,  809,
-        0,    0,  804,    0,    0,    0,  799,    0,  802,  808,
-      808,  812,    0,    0,    0,  806,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,  802,    0,    0,
-      803,    0,    0,  804,  804,  804,  809,  799,  799,  799,
-      811,    0,    0,    0,    0,    0,  805,    0,  815,  806,
-        0,    0,    0,    0,    0,    0,  807,  812,  802,  802,
-      802,  803,  803,  803,  810,  810,    0,    0,  810,    0,
-        0,  815,    0,    0,    0,  808,  813,  805,  805,  805,
-      806,  806,  806,    0,  815,    0,  814,  810,    0,    0,
-      810,    0,  810,    0,  812,    0,  807,    0,    0,  813,
-      810,  816,  809,    0,    0,    0,  808,  808,  808,  814,
-        0,    0,  813,    0,    0,    0,    0,    0,    0,  810,
-
-        0,    0,  814,    0,  816,  817,    0,  807,  807,  807,
-      815,    0,    0,  809,  809,  809,  819,  816,    0,    0,
-        0,    0,    0,  811,    0,    0,  810,    0,  817,    0,
-      820,    0,    0,    0,    0,    0,    0,    0,  813,  819,
-      812,  817,    0,    0,    0,    0,    0,  815,  814,    0,
-        0,    0,  819,  820,  811,  811,  811,    0,  810,    0,
-      810,  810,    0,  816,    0,    0,  820,  821,    0,    0,
-      822,  812,  812,  812,    0,  813,  813,  813,  813,  813,
-      813,  813,  813,  813,  813,  813,    0,  817,    0,    0,
-      821,    0,    0,  822,    0,  818,  818,    0,  819,  818,
-
-        0,    0,    0,  821,    0,    0,  822,    0,    0,    0,
-        0,    0,  820,  815,    0,    0,  814,    0,  818,    0,
-      823,  818,  813,  818,    0,    0,    0,    0,    0,  810,
-        0,  818,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  813,    0,  823,  815,  815,  815,    0,    0,  821,
-      818,  814,  822,    0,    0,    0,  823,    0,    0,    0,
-      810,  810,  810,    0,    0,    0,  816,  819,    0,    0,
-        0,    0,  813,  813,  813,  820,    0,  818,    0,    0,
-        0,    0,  814,  814,  814,    0,  821,  821,    0,  822,
-      817,    0,    0,    0,    0,  824,    0,  816,  816,  816,
-
-        0,  819,  823,    0,    0,    0,    0,    0,    0,  818,
-        0,  818,  818,    0,  839,  820,    0,    0,  824,    0,
-        0,  817,  817,  817,    0,    0,    0,    0,    0,    0,
-        0,  824,  819,  819,  819,    0,    0,  839,  828,    0,
-        0,    0,    0,  832,    0,    0,  820,  820,  820,    0,
-      839,    0,  821,  826,    0,  822,    0,    0,    0,    0,
-        0,  828,    0,    0,    0,    0,  832,  825,    0,    0,
-        0,    0,  823,    0,  828,    0,  826,  824,  823,  832,
-      818,    0,  823,  821,  821,  821,  822,  822,  822,  826,
-      825,    0,    0,  823,  823,    0,  839,    0,  823,    0,
-
-        0,    0,  823,  825,    0,  823,    0,    0,    0,    0,
-        0,  818,  818,  818,    0,  824,    0,  824,    0,    0,
-      828,    0,    0,    0,    0,  832,    0,  824,    0,    0,
-      824,    0,    0,    0,    0,  826,  823,  823,  823,  824,
-      824,  824,  824,    0,    0,  824,  824,    0,    0,  825,
-        0,  824,    0,    0,  824,    0,  824,  828,    0,  824,
-        0,  824,  824,  824,    0,  824,    0,    0,  840,    0,
-        0,    0,  826,    0,  826,  826,    0,    0,    0,    0,
-      824,    0,    0,    0,  828,  828,  825,  825,  825,  832,
-      832,  840,    0,  838,    0,  839,    0,    0,  825,  839,
-
-        0,    0,    0,    0,  840,    0,    0,    0,    0,    0,
-      843,  824,  824,  824,    0,  825,  838,  825,    0,    0,
-        0,    0,    0,  828,  825,  825,    0,    0,  832,  838,
-      839,  839,  839,  843,    0,    0,    0,  825,  826,  825,
-        0,    0,  825,  825,  841,    0,  843,    0,    0,    0,
-      840,    0,  825,    0,  828,  828,  828,    0,    0,  832,
-      832,  832,    0,    0,    0,    0,    0,  841,  842,  826,
-      826,  826,    0,    0,    0,  838,    0,    0,    0,    0,
-      841,    0,    0,  825,  825,  825,  827,  827,    0,    0,
-      827,  842,  843,    0,  840,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,  842,    0,    0,    0,    0,  827,
-      827,  827,  827,    0,  827,  827,  827,  827,  827,  827,
-        0,  827,  827,  827,  827,    0,  841,    0,    0,  843,
-        0,    0,  843,    0,    0,  843,  827,    0,    0,    0,
-      827,  827,    0,    0,  838,  838,    0,    0,    0,    0,
-      842,  838,    0,  840,    0,  838,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  838,  838,  827,  827,
-      827,  838,  827,    0,    0,  838,    0,    0,  838,    0,
-      843,  843,    0,    0,  840,  840,  840,    0,    0,  841,
-      841,  841,  841,  841,  841,  843,  842,  842,    0,  848,
-
-      827,    0,  827,  827,    0,    0,    0,  845,    0,  838,
-      838,  838,    0,    0,    0,    0,  831,    0,    0,    0,
-        0,    0,  848,    0,    0,    0,  843,  843,  843,  841,
-      845,    0,    0,    0,    0,  848,    0,    0,    0,  831,
-        0,    0,    0,  845,    0,    0,    0,    0,    0,  842,
-        0,    0,  831,  842,    0,    0,    0,    0,    0,    0,
-      841,  841,  841,    0,    0,    0,    0,    0,    0,    0,
-        0,  827,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  848,  827,  827,  842,  842,  842,    0,    0,  845,
-      827,  827,  827,  827,  827,    0,  827,  827,  831,    0,
-
-      827,  827,  827,  827,  827,    0,    0,    0,    0,    0,
-        0,  827,    0,    0,    0,    0,  827,  827,  829,    0,
+        0,    0,    0,    0,   65,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  831,  831,  831,  831,    0,
-        0,  829,    0,  831,  831,  831,  831,  831,  831,  831,
-      831,  831,  831,  926,  829,  831,  831,  831,  831,  831,
-      831,  831,  831,  831,  831,  831,  831,    0,  845,  845,
-      845,  845,    0,  848,  848,  848,  926,    0,    0,    0,
-        0,    0,    0,  831,  848,    0,    0,    0,    0,  926,
-        0,    0,  845,    0,    0,  844,  831,    0,    0,    0,
-
-      829,  831,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  848,  848,  848,  844,    0,
-        0,    0,    0,  845,  845,  845,    0,    0,    0,    0,
-        0,  844,  831,  831,  831,  926,    0,  829,  829,  829,
-      829,  829,  829,  829,  829,  829,  829,  829,    0,    0,
-        0,    0,    0,  829,  829,  829,  829,  829,  829,  829,
-      829,  829,  829,  829,  829,  829,  829,  829,  829,  829,
-      829,  829,  829,  829,  829,  829,  829,  844,    0,    0,
-        0,    0,    0,    0,  829,  829,  829,  829,  829,  829,
-      829,  829,  829,  829,  829,  829,  829,  829,  829,  829,
-
-      829,    0,    0,  829,    0,    0,    0,    0,    0,    0,
-      846,    0,    0,    0,    0,    0,  927,    0,    0,  852,
-        0,    0,    0,  844,  844,    0,  844,  844,  930,    0,
-        0,    0,    0,  846,  829,  829,  829,  830,  926,  927,
-        0,  844,  852,  844,  844,  844,  846,    0,    0,    0,
-        0,  930,  927,  836,    0,  852,    0,    0,    0,    0,
-      830,    0,    0,    0,  930,    0,    0,    0,    0,  926,
-      926,  926,    0,  830,    0,    0,  836,  836,  836,    0,
-      844,    0,  836,  836,  836,  836,  836,    0,  836,  836,
-      836,  836,  846,    0,    0,    0,    0,    0,  927,    0,
-
-        0,  852,    0,  836,    0,    0,  854,  836,    0,  937,
-      930,  844,  844,  844,    0,    0,    0,    0,    0,  830,
-        0,    0,    0,    0,  939,    0,    0,    0,    0,  854,
-        0,    0,  937,    0,    0,  836,  836,  836,  852,  836,
-      852,  852,  854,    0,    0,  937,    0,  939,    0,  846,
-        0,    0,    0,    0,    0,    0,  830,  830,  830,  830,
-      939,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,    0,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  830,  830,  854,    0,
-        0,  937,    0,    0,    0,  846,    0,    0,    0,    0,
-
-        0,  927,    0,    0,  852,    0,  939,    0,    0,  930,
-        0,    0,    0,  930,    0,    0,    0,  830,  830,    0,
-        0,    0,  830,    0,    0,    0,  846,  846,  846,  847,
-        0,    0,  927,  927,  927,  852,  852,  852,  836,    0,
-        0,    0,    0,    0,  930,  930,  930,    0,  937,  836,
-      836,    0,  847,  830,  830,  830,  834,  836,  836,  836,
-      836,  836,    0,  836,  836,  847,    0,  836,  836,  836,
-      836,  836,    0,    0,    0,    0,    0,  854,  836,  834,
-        0,  854,  854,  836,  836,  854,  854,    0,    0,    0,
-        0,  854,  834,    0,  937,    0,    0,    0,  939,  939,
-
-      939,    0,    0,    0,    0,    0,    0,    0,    0,  939,
-        0,  847,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  854,  854,  854,  937,  937,  937,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  834,    0,
-      939,  939,  939,    0,    0,    0,    0,    0,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,    0,    0,    0,    0,    0,    0,    0,    0,
-      835,    0,    0,    0,    0,  834,  834,  834,  834,    0,
-      834,  834,  834,  834,  834,  834,  834,  834,  834,  834,
-      834,  834,  834,  835,  834,  834,  834,  834,  834,  834,
-
-      834,  834,  834,  834,  834,  834,  835,    0,    0,    0,
-        0,    0,  850,    0,  847,    0,    0,    0,    0,    0,
-        0,  915,  915,  915,  915,  915,  915,  915,  915,  915,
-      915,    0,    0,    0,    0,  850,  834,  834,    0,    0,
-        0,  834,    0,    0,    0,  847,  847,  847,  850,    0,
-        0,    0,  835,  915,  915,  915,  915,  915,  915,  915,
-      915,  915,  915,  915,  915,  915,  915,  915,  915,    0,
-        0,    0,  834,  834,  834,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      835,  835,  835,    0,  850,    0,    0,  835,  835,  835,
-
-      835,  835,  835,  835,  835,  835,  835,    0,    0,  835,
-      835,  835,  835,  835,  835,  835,  835,  835,  835,  835,
-      835,    0,    0,    0,    0,    0,    0,    0,  849,    0,
-        0,    0,  850,    0,  850,    0,    0,  835,    0,    0,
-        0,    0,    0,    0,  850,    0,    0,  850,    0,  953,
-      835,  849,    0,    0,    0,  835,  850,  850,  850,  850,
-        0,    0,  850,  850,  849,    0,    0,    0,  850,    0,
-        0,  850,  953,  850,    0,    0,  850,    0,  850,  850,
-      850,    0,  850,    0,    0,  953,  835,  835,  835,  837,
-      837,    0,    0,  837,    0,    0,    0,  850,    0,    0,
-
+       82,   82,   82,   82,   82,   82,   82,   82,   71,    0,
+
+       82,   82,    0,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,    0,   82,   82,   79,   82,    0,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,    0,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,    0,   82,    0,    0,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,    0,   83,   83,    0,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,    0,
+       83,    0,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+
+       83,   83,   83,   83,   83,   83,   83,   83,    0,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,    0,   83,    0,
+        0,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+
+       84,   84,    0,    0,   84,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      849,    0,  837,  837,  837,  837,    0,  837,  837,  837,
-      837,  837,  837,    0,  837,  837,  837,  837,  850,  850,
-      850,  953,    0,    0,    0,    0,    0,    0,  931,  837,
-        0,  855,    0,  837,  837,    0,    0,    0,    0,    0,
+        0,    0,    0,   84,    0,    0,   84,    0,   84,    0,
+        0,    0,    0,    0,    0,    0,   84,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  931,    0,    0,  855,    0,    0,    0,    0,    0,
-        0,  837,  837,  837,  931,  837,    0,  855,    0,  849,
-      849,    0,    0,    0,  849,    0,  849,    0,  849,    0,
-      849,  851,    0,    0,    0,    0,  849,  849,    0,    0,
-
-        0,    0,  849,  837,  849,  837,  837,  849,    0,  849,
-      849,    0,    0,  849,  851,    0,    0,    0,    0,    0,
-      931,    0,    0,  855,    0,    0,  853,  851,    0,    0,
-        0,    0,    0,    0,  953,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  849,  849,  849,    0,    0,  853,
-        0,    0,    0,    0,    0,    0,  932,    0,    0,    0,
-        0,    0,  853,    0,  931,  953,  953,  953,    0,    0,
-        0,    0,    0,  851,  837,    0,  855,  855,  855,  932,
-        0,    0,  855,    0,    0,  837,  837,  855,    0,  855,
-      855,    0,  932,  837,  837,  837,  837,  837,    0,  837,
-
-      837,    0,    0,  837,  837,  837,  837,  837,  853,    0,
-      851,  851,  851,    0,  837,    0,    0,    0,    0,  837,
-      837,    0,  851,  931,    0,    0,  855,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  932,  851,
-        0,  851,    0,    0,    0,    0,    0,    0,  851,  851,
-        0,    0,    0,    0,  931,  931,  931,  855,  855,  855,
-        0,  851,    0,  851,  853,    0,  851,  851,    0,  853,
-      853,    0,  853,    0,    0,    0,  851,    0,  853,    0,
-      853,  853,  853,    0,  853,    0,  853,    0,  853,    0,
-        0,    0,  853,    0,    0,    0,    0,    0,    0,    0,
-
-        0,  932,  932,  932,  932,  932,  932,  851,  851,  851,
-        0,  853,  893,  893,  893,  893,  893,  893,  893,  893,
-      893,  893,  893,  893,  893,  893,  893,  893,  893,  893,
-      893,  893,  893,  893,    0,    0,    0,    0,    0,    0,
-        0,  932,  853,  853,  853,  887,  887,  887,  887,  887,
-      887,  887,  887,  887,  887,  887,  887,  887,  887,  887,
-      887,  887,  887,  887,  887,  887,  887,  887,  887,    0,
-        0,    0,  932,  932,  932,    0,    0,  887,  887,  887,
-      887,  887,  887,  887,  887,  887,  887,  887,  887,  887,
-      887,  887,  887,  888,  888,  888,  888,    0,  888,  888,
-
-      888,  888,  888,  888,  888,  888,  888,  888,  888,  888,
-      888,    0,  888,  888,  888,  888,  888,  888,  888,  888,
-      888,  888,  888,  888,  898,  898,  898,  898,  898,  898,
-      898,  898,  898,  898,  898,  898,  898,  898,  898,  898,
-        0,    0,  898,  898,  898,  898,  898,  898,  898,  898,
-      898,  898,  898,  898,  888,  888,  897,  897,  897,  897,
-      897,  897,  897,  897,  897,  897,  897,  897,  897,  897,
-      897,  897,  897,  897,  897,  897,  897,  897,  897,  897,
-      897,  897,  897,  897,  897,  897,  897,  897,  897,  897,
-      897,  897,  897,  897,  897,  897,  897,  897,  897,  897,
-
-      897,  897,  897,    0,  897,  897,  897,  897,  897,  897,
-      897,  897,  897,  897,  897,  897,  897,  897,  897,  897,
-      899,  899,  899,    0,    0,    0,    0,  899,  899,  899,
-      899,  899,  899,  899,  899,  899,  899,    0,  943,  899,
-      899,  899,  899,  899,  899,  899,  899,  899,  899,  899,
-      899,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  943,    0,    0,    0,    0,    0,  899,    0,    0,
-        0,    0,    0,    0,  943,    0,    0,    0,    0,    0,
-      899,  916,  916,  916,  916,  916,  916,  916,  916,  916,
-      916,  916,  916,  916,  916,  916,  916,  916,  916,  916,
-
-        0,  916,  916,  916,  916,  916,  916,  916,  916,  916,
-      916,  916,  916,  916,  916,    0,  916,    0,    0,  929,
-      943,  916,    0,  916,  916,  920,  920,  920,    0,  920,
-        0,  920,  920,    0,  920,    0,    0,    0,    0,    0,
-        0,  920,  929,  920,    0,    0,    0,  920,    0,  920,
-      920,    0,  920,    0,    0,  929,  920,  943,    0,  943,
-      943,  920,    0,  920,  920,  920,  920,  928,    0,    0,
-      933,    0,    0,  920,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  920,    0,    0,    0,  920,    0,    0,
-      928,  928,  928,  933,    0,    0,  928,  928,  928,  928,
-
-      928,  929,  928,  928,  928,  928,  933,    0,    0,  934,
-        0,    0,    0,    0,    0,    0,    0,  928,    0,    0,
-        0,  928,    0,  943,    0,    0,    0,    0,    0,    0,
-        0,    0,  934,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  936,  934,    0,    0,    0,  928,
-      928,  928,  933,  928,  943,  943,  943,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  936,    0,    0,
-      929,  929,  935,    0,    0,    0,    0,  929,    0,  945,
-      936,  929,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  934,  929,  929,    0,  935,    0,  929,  933,  933,
-
-        0,  929,  945,    0,  929,    0,    0,  955,  935,    0,
-        0,    0,    0,    0,    0,  945,    0,  938,    0,    0,
-        0,    0,    0,    0,    0,    0,  936,    0,  934,    0,
-      955,  934,    0,  946,  934,  929,  929,  929,    0,    0,
-      938,    0,    0,  955,    0,    0,    0,    0,    0,    0,
-        0,  933,  928,  938,  935,  933,  946,    0,    0,    0,
-        0,  945,    0,  928,  928,    0,    0,    0,    0,  946,
-        0,  928,  928,  928,  928,  928,    0,  928,  928,  934,
-      934,  928,  928,  928,  928,  928,  933,  933,  933,  955,
-        0,    0,  928,    0,  934,    0,  940,  928,  928,  938,
-
-      935,  935,    0,  935,  935,  936,  936,  936,  936,    0,
-        0,    0,    0,    0,    0,  946,    0,    0,  935,  940,
-      935,  935,  935,    0,    0,  934,  934,  934,    0,  936,
-        0,    0,  940,    0,    0,    0,  938,  938,  938,  938,
-      938,  938,  938,  938,  938,  938,  938,  938,  938,  938,
-      945,    0,  955,    0,  945,  945,    0,  935,  945,  945,
-      936,  936,  936,    0,  945,    0,    0,    0,  946,  946,
-      946,  941,    0,    0,  946,  956,    0,    0,  940,  946,
-      954,  946,  946,    0,    0,    0,    0,    0,  935,  935,
-      935,    0,  955,    0,  941,  945,  945,  945,  956,    0,
-
-        0,    0,  938,  954,    0,  942,    0,  941,    0,    0,
-        0,  956,    0,    0,    0,    0,  954,    0,  946,    0,
-        0,    0,    0,  955,  955,  955,    0,    0,  942,    0,
-        0,    0,    0,  938,  938,  938,    0,    0,    0,    0,
-        0,  942,    0,    0,    0,    0,    0,  940,  940,  946,
-      946,  946,  940,  941,  940,    0,  940,  956,  940,    0,
-      959,    0,  954,  957,  940,  940,    0,    0,    0,  961,
-      940,    0,  940,    0,    0,  940,    0,  940,  940,    0,
-        0,  940,    0,  959,    0,    0,  957,  942,    0,    0,
-        0,  941,  961,  941,  956,  956,  959,  944,    0,  957,
-
-        0,    0,    0,  941,    0,  961,  941,    0,    0,    0,
-        0,    0,  940,  940,  940,  941,  941,  941,  941,    0,
-      944,  941,  941,  948,  942,  942,  942,  941,    0,    0,
-      941,  954,  941,  944,    0,  941,  942,  941,  941,  941,
-        0,  941,  959,    0,    0,  957,  948,    0,  962,    0,
-        0,  961,    0,  942,    0,  942,  941,    0,    0,  948,
-      956,    0,  942,  942,    0,  954,    0,    0,    0,    0,
-        0,  962,    0,    0,    0,  942,    0,  942,  947,  944,
-      942,  942,  957,  963,  962,    0,    0,  941,  941,  941,
-      942,  956,  956,  956,    0,    0,  954,  954,  954,    0,
-
-        0,  947,  947,  947,    0,  948,  963,  947,  947,  947,
-      947,  947,    0,  947,  947,  947,  947,    0,    0,  963,
-      961,  942,  942,  942,    0,    0,    0,    0,  947,    0,
-      962,    0,  947,    0,    0,  944,    0,    0,    0,    0,
-      944,  944,  948,  944,    0,  959,    0,    0,  957,  944,
-        0,  944,  944,  944,  961,  944,    0,  944,    0,  944,
-      947,  947,  947,  944,  947,  963,    0,    0,    0,  948,
-      948,    0,    0,    0,    0,    0,  959,  959,  959,  957,
-      957,  957,  944,    0,    0,  961,  961,  961,  964,    0,
-        0,    0,    0,  962,    0,  951,    0,    0,  965,    0,
-
-        0,    0,  963,  963,    0,    0,    0,    0,  948,  958,
-        0,  964,    0,  944,  944,  944,    0,    0,  951,    0,
-        0,  965,    0,    0,  964,    0,    0,    0,    0,    0,
-        0,  951,  958,  962,  965,    0,    0,    0,    0,  948,
-      948,  948,    0,    0,    0,  958,    0,    0,  958,  958,
-      958,  958,  958,  958,  958,  958,  958,  958,    0,    0,
-        0,    0,    0,  947,  962,  962,  962,    0,  963,    0,
-      964,    0,    0,    0,  947,  947,    0,  951,    0,    0,
-      965,    0,  947,  947,  947,  947,  947,    0,  947,  947,
-        0,  958,  947,  947,  947,  947,  947,    0,    0,  963,
-
-      963,  963,    0,  947,    0,    0,    0,  964,  947,  947,
-      950,    0,    0,    0,  951,  951,  951,  951,    0,    0,
-        0,    0,  951,  951,  951,  951,  951,  951,  951,  951,
-      951,  951,    0,  950,  951,  951,  951,  951,  951,  951,
-      951,  951,  951,  951,  951,  951,  950,    0,    0,    0,
+        0,    0,    0,    0,    0,   84,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  951,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  964,    0,  951,    0,    0,    0,    0,
-      951,    0,    0,  965,  966,    0,    0,  967,    0,    0,
-        0,    0,  950,    0,  958,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,  964,  964,  964,  966,    0,    0,
-      967,  951,  951,  951,  965,  965,  965,    0,    0,    0,
-      966,    0,    0,  967,    0,  958,  958,  958,    0,  950,
-      950,  950,  950,    0,  950,  950,  950,  950,  950,  950,
-      950,  950,  950,  950,  950,  950,  950,  952,  950,  950,
-      950,  950,  950,  950,  950,  950,  950,  950,  950,  950,
-      950,    0,    0,  960,    0,    0,  966,    0,    0,  967,
-      952,  952,  952,    0,    0,    0,  952,  952,  952,  952,
-      952,    0,  952,  952,  952,  952,  960,    0,    0,  968,
-      950,  950,    0,    0,    0,  950,    0,  952,  969,  960,
-
-        0,  952,  960,  960,  960,  960,  960,  960,  960,  960,
-      960,  960,  968,  970,    0,    0,    0,    0,    0,    0,
-        0,  969,    0,    0,    0,  968,  950,  950,  950,  952,
-      952,  952,  967,  952,  969,  966,  970,    0,    0,  974,
-        0,    0,  971,    0,    0,  960,    0,    0,    0,  970,
-        0,    0,  970,  970,  970,  970,  970,  970,  970,  970,
-      970,  970,  974,    0,    0,  971,    0,    0,    0,  966,
-        0,  968,  967,    0,    0,  974,    0,    0,  971,    0,
-      969,  971,  971,  971,  971,  971,  971,  971,  971,  971,
-      971,  972,    0,    0,    0,  970,    0,    0,    0,    0,
-
-      966,  966,  966,  967,  967,  967,  975,    0,  968,  968,
-      976,    0,    0,  973,  972,    0,    0,  969,    0,    0,
-        0,  974,    0,    0,  971,    0,    0,  972,    0,  975,
-        0,    0,  952,  976,    0,    0,  973,    0,    0,    0,
-        0,    0,  975,  952,  952,    0,  976,    0,  960,  973,
-        0,  952,  952,  952,  952,  952,    0,  952,  952,    0,
-        0,  952,  952,  952,  952,  952,    0,  977,    0,    0,
-        0,    0,  952,  972,  968,    0,    0,  952,  952,  960,
-      960,  960,    0,  969,    0,  978,    0,    0,  975,  974,
-      977,    0,  976,    0,    0,  973,    0,    0,  970,    0,
-
-        0,    0,    0,  977,    0,  968,  968,  968,  978,    0,
-      972,    0,    0,    0,  969,  969,  969,    0,    0,    0,
-        0,  978,    0,    0,  974,  975,    0,  971,  979,  970,
-      970,  970,  973,  973,  973,  973,  973,  973,  973,  973,
-      973,  973,  973,    0,    0,    0,    0,    0,    0,  977,
-      981,  979,    0,    0,  980,  974,  974,  974,  971,  971,
-      971,  976,    0,    0,  979,    0,    0,  978,    0,    0,
-        0,    0,    0,  981,    0,    0,  972,  980,  982,  973,
-        0,    0,    0,    0,    0,    0,  981,    0,    0,    0,
-      980,  975,    0,    0,    0,  976,    0,  983,  973,    0,
-
-        0,  982,    0,    0,  978,  978,    0,  972,  972,  972,
-      979,    0,  977,    0,  982,    0,    0,  984,    0,    0,
-      983,    0,  975,  975,  975,    0,  976,  976,  976,  973,
-      973,  973,  981,  983,    0,  985,  980,    0,  987,    0,
-      984,  988,    0,    0,    0,    0,    0,  979,    0,    0,
-        0,    0,  977,  984,    0,    0,    0,    0,  985,    0,
-      982,  987,    0,    0,  988,    0,    0,    0,    0,    0,
-      978,  985,    0,    0,  987,    0,    0,  988,    0,  983,
-        0,    0,    0,  977,  977,  977,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  981,    0,  982,  982,  984,
-
-        0,  978,  978,  978,  991,  980,    0, 1003,    0,    0,
-        0,  990,    0,  979,    0,    0,  983,  985,    0,  986,
-      987,    0,    0,  988,    0,    0,    0,  991,    0,    0,
-     1003,    0,    0,    0,  990,  981,    0,    0,    0,  980,
-      991,    0,  986, 1003,  979,  979,  979,  990,    0,    0,
-        0,    0,    0,    0,  985,  986,    0,    0,    0,    0,
-      988,    0,    0,  982,    0,    0,  981,  981,  981,    0,
-      980,  980,  980,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  983,  992,    0,    0,  991,    0,  987, 1003,
-        0,    0,    0,  990,  982,  982,  982,    0,    0,    0,
-
-        0,  986,  984,    0,    0,    0,  992,    0,    0,    0,
-        0,    0,    0,  983,  983,  983,    0,    0,    0,  992,
-      985,    0,    0,  987,    0,    0,  988,  989,    0,    0,
-        0,    0,    0,  984,  984,  984,    0,    0,  986,  986,
-      986,  986,  986,  986,  986,  986,  986,  986,  986,  991,
-      989,  985,  985,  985,  987,  987,  987,  988,  988,  988,
-        0,  993,  990,  989,  995,  992,  989,  989,  989,  989,
-      989,  989,  989,  989,  989,  989,    0,    0,    0,    0,
-        0,    0,    0,    0,  993,  986,    0,  995,    0,  991,
-      997,    0, 1003,    0,    0,    0,  990,  993,    0,    0,
-
-      995,    0,  992,  992,  986,    0,    0,    0,  994,  989,
-        0,    0,    0,  997,    0,    0,    0,    0,    0,    0,
-      991,  991,  991, 1003, 1003, 1003,  997,  990,  990,  990,
-        0,  994,    0,    0,  996,  986,  986,  986,    0,    0,
-        0,    0, 1000,  993,  994,    0,  995,  994,  994,  994,
-      994,  994,  994,  994,  994,  994,  994,  996,    0,  999,
-        0,    0,    0,    0,    0, 1000,    0,    0,  992,  998,
-      996,    0,  997,    0,    0,    0,    0,    0, 1000,    0,
-      993,    0,  999,  995, 1001,    0,    0, 1010,    0,    0,
-      994,    0,  998,    0, 1002,  999,    0,    0,    0,  992,
-
-      992,  992,    0, 1004,    0,  998,    0, 1001,    0,    0,
-     1010,    0,  989,    0, 1005,    0,  996, 1002,    0,    0,
-     1001,    0,    0, 1010, 1000,    0, 1004,    0,    0, 1007,
-     1002,    0,    0,    0,    0,    0,    0, 1005,    0, 1004,
-      997,  999,    0,  989,  989,  989,  993,    0, 1006,  995,
-     1005,  998, 1007,  996,  996,  996,  996,  996,  996,  996,
-      996,  996,  996,  996,    0, 1007, 1001,    0,    0, 1010,
-        0, 1006,    0,    0,    0,  997, 1002,  993,  993,  993,
-      995,  995,  995,    0, 1006, 1004,    0, 1000,  998,    0,
-        0,    0, 1009,  994,    0,    0, 1005,    0,    0,    0,
-
-      996,    0,    0, 1001, 1001,    0,  997,  997,  997,    0,
-      999, 1007,    0, 1002,    0, 1009,    0,    0,    0,  996,
-        0,    0, 1004,    0,  994,  994,  994, 1000, 1009,    0,
-     1006,    0, 1010, 1005, 1005, 1005, 1005, 1005, 1005, 1005,
-     1005, 1005, 1005, 1005,  999, 1013,    0,    0, 1007,    0,
-      996,  996,  996,    0,  998, 1011,    0,    0, 1000, 1000,
-     1000,    0,    0,    0,    0,    0,    0,    0, 1013, 1001,
-        0,    0, 1010,    0, 1009,  999,  999,  999, 1011, 1002,
-     1005, 1013, 1013, 1013,    0,  998,  998,  998, 1004,    0,
-        0, 1011,    0,    0,    0,    0,    0,    0, 1006, 1005,
-
-     1001, 1001, 1001, 1010, 1010, 1010, 1012,    0,    0,    0,
-     1002, 1002, 1002, 1008, 1007,    0,    0,    0,    0, 1004,
-     1004, 1004,    0,    0,    0,    0,    0, 1013,    0, 1012,
-     1005, 1005, 1005, 1006,    0,    0, 1008, 1011,    0,    0,
-     1014,    0, 1012, 1009,    0, 1007, 1007, 1007,    0, 1008,
-        0,    0, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
-     1008, 1008, 1016, 1014, 1006, 1006, 1006, 1017,    0,    0,
-        0,    0,    0,    0, 1011, 1011, 1014, 1009,    0,    0,
-        0,    0, 1015,    0,    0, 1016,    0,    0, 1012,    0,
-     1017,    0,    0,    0,    0, 1008,    0,    0, 1016,    0,
-
-        0, 1020,    0, 1017,    0, 1015, 1062,    0, 1009, 1009,
-     1009, 1019,    0,    0,    0,    0,    0,    0, 1015,    0,
-        0,    0, 1014,    0, 1020, 1012,    0,    0,    0, 1062,
-     1013,    0,    0,    0, 1019,    0,    0, 1020,    0,    0,
-     1011,    0, 1062,    0, 1016, 1022,    0, 1019,    0, 1017,
-        0, 1021,    0,    0,    0,    0,    0,    0,    0, 1014,
-        0, 1013, 1013, 1013, 1015,    0,    0,    0, 1022,    0,
-        0, 1011, 1011, 1011, 1021,    0,    0,    0,    0,    0,
-        0, 1022,    0, 1020,    0,    0, 1017, 1021, 1062,    0,
-        0, 1012,    0, 1019,    0,    0,    0,    0, 1008,    0,
-
-        0, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
-     1015, 1015, 1016, 1024,    0,    0,    0,    0,    0,    0,
-        0,    0, 1012, 1012, 1012, 1014,    0, 1022,    0, 1008,
-     1008, 1008,    0, 1021,    0,    0, 1024,    0, 1026,    0,
-        0,    0,    0,    0,    0,    0, 1020, 1016, 1015, 1024,
-        0,    0, 1017,    0,    0,    0, 1014, 1014, 1014,    0,
-        0, 1026, 1019,    0, 1022, 1018,    0, 1015,    0,    0,
-     1021, 1021,    0,    0, 1026,    0,    0,    0, 1016, 1016,
-     1016,    0,    0, 1017, 1017, 1017, 1020,    0, 1018,    0,
-        0, 1062,    0,    0,    0, 1024, 1019,    0, 1015, 1015,
-
-     1015, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
-     1018, 1018, 1018, 1018, 1025,    0,    0, 1020, 1020, 1020,
-     1026,    0, 1062, 1062, 1062,    0,    0, 1019, 1019, 1019,
-     1022,    0, 1024,    0, 1023,    0, 1021, 1025,    0,    0,
-        0,    0,    0,    0,    0,    0,    0, 1018,    0,    0,
-     1025,    0,    0,    0,    0,    0,    0, 1023,    0,    0,
-        0, 1022, 1022, 1022,    0,    0,    0, 1021, 1021, 1021,
-     1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023,
-     1023, 1023, 1023, 1027,    0,    0,    0,    0, 1026, 1028,
-        0,    0,    0, 1028,    0,    0, 1025,    0, 1024,    0,
-
-        0,    0,    0,    0,    0,    0, 1027,    0,    0,    0,
-        0,    0, 1028,    0,    0, 1028, 1023, 1028,    0, 1027,
-        0,    0,    0, 1026,    0, 1028,    0,    0,    0, 1024,
-     1024, 1024,    0, 1025, 1025, 1025, 1025, 1025, 1025, 1025,
-     1025, 1025, 1025, 1025, 1028,    0,    0,    0,    0,    0,
-     1018,    0,    0,    0, 1026, 1026, 1026,    0,    0,    0,
-        0,    0, 1029,    0,    0, 1027, 1029,    0,    0,    0,
-        0, 1028,    0,    0,    0,    0,    0,    0,    0,    0,
-     1025, 1018, 1018, 1018,    0, 1029,    0,    0, 1029,    0,
-     1029,    0,    0,    0,    0,    0,    0,    0, 1029, 1025,
-
-     1033,    0, 1027, 1028, 1033, 1028, 1028,    0,    0,    0,
-        0, 1034,    0,    0,    0, 1034,    0, 1029,    0, 1023,
-     1035,    0,    0, 1033, 1035,    0, 1033,    0, 1033,    0,
-     1025, 1025, 1025,    0, 1034,    0, 1033, 1034,    0, 1034,
-        0, 1036,    0, 1035, 1029, 1036, 1035, 1034, 1035,    0,
-     1023, 1023, 1023,    0,    0, 1033, 1035,    0,    0,    0,
-        0,    0,    0,    0, 1036,    0, 1034, 1036, 1027, 1036,
-        0,    0,    0,    0, 1028, 1035, 1029, 1036, 1029, 1029,
-        0,    0, 1033,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0, 1034,    0,    0, 1036,    0,    0, 1027,
-
-     1027, 1027, 1035,    0,    0, 1028, 1028, 1028,    0,    0,
-        0,    0,    0,    0, 1033,    0, 1033, 1033, 1037, 1037,
-        0,    0, 1037, 1036,    0, 1034,    0, 1034, 1034,    0,
-        0,    0,    0,    0, 1035,    0, 1035, 1035,    0, 1035,
-     1035, 1037,    0,    0, 1037,    0, 1037, 1029, 1038, 1038,
-        0, 1033, 1038,    0, 1037, 1036, 1034, 1036, 1036,    0,
-     1036,    0,    0,    0,    0, 1039, 1039, 1037,    0, 1039,
-        0, 1038,    0, 1037, 1038,    0, 1038,    0, 1029, 1029,
-     1029,    0,    0,    0, 1038, 1033,    0,    0, 1039,    0,
-        0, 1039,    0, 1039,    0,    0, 1034, 1038,    0,    0,
-
-     1037, 1039,    0, 1038,    0, 1035,    0,    0,    0,    0,
-        0,    0,    0,    0, 1039,    0, 1033, 1033, 1033,    0,
-     1039,    0,    0,    0,    0,    0, 1036, 1034, 1034, 1034,
-     1038,    0, 1037,    0, 1037, 1037, 1035, 1035, 1035,    0,
-     1040, 1040,    0,    0, 1040,    0,    0, 1039,    0, 1063,
-        0,    0,    0,    0,    0,    0,    0, 1036, 1036, 1036,
-        0,    0, 1038, 1040, 1038, 1038, 1040,    0, 1040,    0,
-     1041, 1041, 1063,    0, 1041,    0, 1040,    0,    0, 1039,
-        0, 1039, 1039,    0,    0, 1063,    0,    0, 1042, 1040,
-        0,    0, 1042, 1041,    0, 1040, 1041,    0, 1041, 1038,
-
-        0,    0,    0, 1037,    0,    0, 1041,    0,    0,    0,
-     1039, 1042,    0,    0, 1042,    0, 1042,    0,    0, 1041,
-        0,    0, 1040,    0, 1042, 1041,    0,    0,    0,    0,
-        0, 1063,    0, 1038, 1037, 1037, 1037,    0,    0,    0,
-        0,    0,    0, 1042,    0,    0,    0,    0,    0,    0,
-     1039,    0, 1041,    0, 1040,    0, 1040, 1040,    0, 1040,
-     1040,    0, 1064,    0, 1038, 1038, 1038, 1043,    0,    0,
-     1042, 1043,    0,    0,    0,    0,    0,    0,    0,    0,
-        0, 1039, 1039, 1039, 1041, 1064, 1041, 1041,    0, 1041,
-     1043,    0,    0, 1043,    0, 1043,    0,    0, 1064,    0,
-
-     1063,    0, 1042, 1043, 1042, 1042,    0, 1046,    0,    0,
-        0, 1046,    0,    0, 1047,    0,    0,    0, 1047,    0,
-        0,    0, 1043,    0,    0, 1040,    0,    0,    0,    0,
-     1046,    0,    0, 1046, 1063, 1046,    0, 1047,    0,    0,
-     1047,    0, 1047, 1046, 1064,    0,    0,    0,    0, 1043,
-     1047,    0,    0,    0,    0, 1041, 1040, 1040, 1040,    0,
-        0,    0, 1046,    0,    0, 1063, 1063, 1063,    0, 1047,
-        0,    0,    0, 1042, 1048,    0,    0,    0, 1048,    0,
-        0, 1043,    0, 1043, 1043,    0, 1041, 1041, 1041, 1046,
-     1049,    0,    0,    0, 1049,    0, 1047, 1048,    0, 1065,
-
-     1048,    0, 1048,    0, 1042, 1042, 1042, 1064,    0,    0,
-     1048,    0,    0, 1049,    0,    0, 1049,    0, 1049,    0,
-        0, 1046, 1065, 1046, 1046,    0, 1049,    0, 1047, 1048,
-     1047, 1047,    0,    0,    0, 1065,    0,    0,    0,    0,
-     1050, 1050,    0,    0, 1050, 1049,    0, 1064,    0,    0,
-        0,    0, 1043,    0,    0,    0, 1048,    0, 1046, 1047,
-        0,    0,    0, 1050, 1066,    0, 1050,    0, 1050,    0,
-        0,    0, 1049,    0,    0,    0, 1050,    0, 1064, 1064,
-     1064, 1065,    0, 1043, 1043, 1043,    0, 1066, 1048, 1050,
-     1048, 1048, 1046, 1048, 1048, 1050,    0,    0,    0, 1047,
-
-     1066,    0,    0, 1068, 1049,    0, 1049, 1049,    0, 1049,
-        0,    0, 1051, 1051,    0,    0, 1051,    0, 1065, 1065,
-        0,    0, 1050, 1046, 1046, 1046, 1068,    0,    0,    0,
-     1047, 1047, 1047,    0,    0, 1051,    0,    0, 1051, 1068,
-     1051,    0,    0,    0,    0,    0, 1066,    0, 1051,    0,
-        0,    0,    0,    0, 1050,    0, 1050, 1050,    0, 1048,
-        0, 1051,    0,    0,    0,    0,    0, 1051,    0,    0,
-        0,    0,    0,    0,    0, 1049,    0,    0,    0,    0,
-        0,    0,    0, 1066, 1065, 1068,    0,    0,    0,    0,
-     1048, 1048, 1048,    0, 1051, 1052, 1052,    0,    0, 1052,
-
-        0,    0,    0,    0,    0,    0, 1049, 1049, 1049,    0,
-        0,    0,    0,    0,    0, 1065, 1065, 1065, 1052,    0,
-        0, 1052,    0, 1052,    0, 1050, 1051,    0, 1051, 1051,
-        0, 1052,    0,    0,    0,    0, 1053, 1053,    0,    0,
-     1053,    0,    0,    0, 1052,    0,    0,    0,    0, 1066,
-     1052,    0,    0, 1069,    0,    0, 1050, 1050, 1050, 1053,
-     1074,    0, 1053, 1079, 1053,    0,    0,    0,    0,    0,
-        0,    0, 1053,    0,    0,    0, 1069, 1052,    0,    0,
-     1066, 1066, 1066, 1074,    0, 1053, 1079,    0, 1068, 1069,
-        0, 1053,    0,    0,    0,    0, 1074, 1051,    0, 1079,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1052,
-        0, 1052, 1052,    0, 1052, 1072,    0,    0, 1053, 1068,
-     1068, 1068,    0,    0,    0,    0,    0,    0, 1051, 1051,
-     1051,    0,    0,    0,    0, 1069,    0,    0, 1072,    0,
-        0,    0, 1074, 1054, 1054, 1079,    0, 1054,    0,    0,
-     1053, 1072, 1053, 1053,    0, 1053, 1053, 1053, 1053, 1053,
-     1053, 1053, 1053, 1053, 1053, 1053, 1054,    0,    0, 1054,
-        0, 1054, 1069, 1055, 1055,    0,    0, 1055,    0, 1054,
-     1052,    0, 1056, 1056,    0,    0, 1056,    0,    0,    0,
-        0, 1057, 1054,    0,    0, 1057, 1055, 1072, 1054, 1055,
-
-        0, 1055, 1053,    0,    0, 1056,    0,    0, 1056, 1055,
-     1056, 1052, 1052, 1052, 1057,    0,    0, 1057, 1056, 1057,
-        0, 1053, 1055,    0,    0, 1054,    0, 1057, 1055,    0,
-        0, 1056,    0,    0, 1072,    0,    0, 1056, 1069, 1059,
-     1059,    0,    0, 1059,    0, 1074, 1057,    0, 1079,    0,
-        0,    0, 1053, 1053, 1053, 1055,    0, 1054,    0, 1054,
-     1054,    0, 1059,    0, 1056, 1059,    0, 1059,    0, 1069,
-     1069, 1069,    0, 1057,    0, 1059, 1074, 1074, 1074, 1079,
-     1079, 1079,    0,    0,    0,    0,    0, 1055, 1059, 1055,
-     1055,    0, 1055, 1054, 1059,    0, 1056,    0, 1056, 1056,
-
-     1072, 1071,    0,    0,    0, 1057,    0, 1057, 1057,    0,
-        0,    0,    0, 1058, 1058,    0,    0, 1058,    0,    0,
-        0, 1059,    0,    0, 1071,    0,    0,    0, 1054,    0,
-        0, 1072, 1072, 1072,    0,    0, 1058, 1071,    0, 1058,
-        0, 1058,    0,    0,    0,    0,    0,    0,    0, 1058,
-     1077,    0,    0, 1059,    0, 1059, 1059,    0, 1055, 1054,
-     1054, 1054, 1058,    0,    0,    0,    0, 1056, 1058,    0,
-        0,    0,    0, 1077,    0,    0, 1057,    0, 1067, 1067,
-        0,    0, 1067, 1071, 1059,    0, 1077,    0,    0, 1055,
-     1055, 1055, 1060, 1060,    0, 1058, 1060,    0, 1056, 1056,
-
-     1056, 1067, 1075,    0, 1067,    0, 1067, 1057, 1057, 1057,
-        0,    0,    0,    0, 1067, 1060,    0,    0, 1060,    0,
-     1060,    0, 1061, 1061, 1059, 1075, 1061, 1058, 1060, 1058,
-     1058, 1070, 1077, 1067,    0,    0,    0,    0, 1075,    0,
-     1080, 1060,    0,    0,    0, 1061,    0, 1060, 1061,    0,
-     1061, 1071,    0,    0, 1070, 1059, 1059, 1059, 1061,    0,
-     1067,    0,    0, 1080, 1058, 1073, 1073, 1070,    0, 1073,
-        0, 1061,    0,    0, 1060,    0, 1080, 1061,    0,    0,
-        0,    0,    0,    0, 1075,    0, 1071, 1078, 1073,    0,
-        0, 1073, 1067, 1073, 1067, 1067,    0,    0, 1058,    0,
-
-     1077, 1073,    0,    0, 1061,    0, 1060,    0, 1060, 1060,
-     1078, 1060, 1060, 1070,    0,    0,    0, 1071, 1071, 1071,
-     1073, 1075, 1080, 1078,    0,    0,    0,    0,    0, 1058,
-     1058, 1058,    0,    0,    0, 1077, 1061,    0, 1061, 1061,
-        0, 1061, 1076,    0,    0,    0,    0, 1073, 1081,    0,
-     1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070,
-     1070,    0,    0, 1067,    0, 1076, 1077, 1077, 1077, 1078,
-        0, 1081,    0,    0,    0,    0,    0, 1060, 1076, 1073,
-        0, 1073, 1073,    0, 1081,    0,    0, 1075,    0,    0,
-        0, 1080, 1082,    0, 1067, 1067, 1067, 1070, 1083,    0,
-
-        0,    0,    0,    0,    0,    0, 1078, 1061, 1060, 1060,
-     1060,    0,    0,    0,    0, 1082, 1070,    0, 1075, 1075,
-     1075, 1083,    0,    0, 1076, 1080,    0,    0, 1082,    0,
-     1081,    0,    0,    0, 1083,    0,    0, 1084, 1061, 1061,
-     1061,    0,    0,    0,    0,    0,    0, 1070, 1070, 1070,
-     1073,    0, 1087,    0,    0, 1088, 1080, 1080, 1080,    0,
-     1084, 1076, 1076, 1076, 1076, 1076, 1076, 1076, 1076, 1076,
-     1076, 1076, 1078, 1084, 1082, 1087,    0,    0, 1088, 1089,
-     1083, 1073, 1073, 1073,    0,    0,    0,    0, 1087,    0,
-     1091, 1088,    0, 1081,    0,    0,    0,    0,    0, 1090,
-
-        0,    0, 1089, 1078, 1078, 1078, 1092,    0, 1076,    0,
-        0, 1082, 1082, 1091,    0, 1089,    0, 1083,    0, 1084,
-        0,    0, 1090,    0,    0,    0, 1091, 1076,    0, 1092,
-        0,    0,    0, 1081, 1087, 1090,    0, 1088,    0,    0,
-        0,    0, 1092,    0,    0,    0,    0,    0,    0,    0,
-        0, 1094,    0,    0,    0,    0,    0, 1095, 1076, 1076,
-     1076, 1089,    0,    0, 1081, 1081, 1081,    0, 1096,    0,
-        0,    0, 1091,    0, 1094,    0,    0, 1082,    0,    0,
-     1095, 1090,    0, 1083,    0,    0,    0, 1094, 1092,    0,
-        0, 1096,    0, 1095,    0,    0, 1097,    0, 1089, 1089,
-
-     1088,    0,    0, 1087, 1096,    0, 1093,    0, 1082, 1082,
-     1082, 1099,    0,    0, 1083, 1083, 1083,    0, 1090, 1097,
-        0, 1100, 1084,    0,    0, 1092,    0,    0,    0, 1093,
-        0,    0, 1097, 1094, 1099,    0,    0, 1087,    0, 1095,
-     1088,    0, 1093,    0, 1100,    0,    0, 1099,    0,    0,
-     1096,    0,    0, 1084, 1084, 1084,    0, 1100,    0,    0,
-        0,    0, 1106,    0, 1089,    0,    0,    0, 1087, 1087,
-     1087, 1088, 1088, 1088,    0, 1091, 1095, 1105, 1097,    0,
-        0,    0, 1101,    0, 1090, 1106,    0,    0, 1093,    0,
-        0, 1092,    0, 1099,    0, 1089, 1089, 1089, 1106,    0,
-
-     1105, 1094,    0, 1100,    0, 1101, 1091, 1091, 1091,    0,
-        0,    0,    0, 1105,    0, 1090, 1090, 1090, 1101,    0,
-        0,    0, 1092, 1092, 1092, 1093, 1093, 1093, 1093, 1093,
-     1093, 1093, 1093, 1093, 1093, 1093, 1094,    0,    0,    0,
-        0,    0, 1095,    0, 1106,    0,    0,    0,    0,    0,
-        0,    0,    0, 1096, 1098, 1098,    0,    0, 1098, 1105,
-        0,    0, 1099,    0, 1101,    0, 1100, 1094, 1094, 1094,
-        0, 1102, 1093, 1095, 1095, 1095,    0, 1098,    0,    0,
-     1098, 1097, 1098,    0, 1096, 1096, 1096,    0, 1106,    0,
-     1098, 1093,    0,    0, 1102, 1104, 1099,    0,    0,    0,
-
-        0, 1101, 1101,    0,    0,    0, 1100, 1102,    0, 1098,
-        0,    0, 1097, 1097, 1097,    0,    0,    0, 1104, 1103,
-        0,    0, 1093, 1093, 1093,    0,    0, 1099, 1099, 1099,
-        0, 1104,    0,    0,    0,    0, 1098, 1100, 1100, 1100,
-        0,    0, 1103, 1103, 1103,    0,    0, 1106, 1103, 1103,
-     1103, 1103, 1103, 1102, 1103, 1103, 1103, 1103, 1105,    0,
-     1107,    0, 1105,    0,    0,    0,    0, 1101, 1098, 1103,
-     1098, 1098,    0, 1103,    0,    0,    0, 1104, 1106, 1106,
-     1106,    0,    0, 1107,    0,    0,    0,    0,    0,    0,
-     1102,    0,    0, 1105, 1105, 1105, 1107, 1114, 1101, 1101,
-
-     1101, 1103, 1103, 1103, 1111, 1103,    0,    0,    0, 1112,
-        0,    0, 1108,    0,    0,    0,    0,    0, 1172,    0,
-     1114,    0,    0,    0,    0,    0,    0, 1111,    0,    0,
-        0,    0, 1112, 1114,    0, 1108,    0,    0, 1109, 1098,
-     1111, 1172, 1107,    0,    0, 1112, 1104, 1104, 1108,    0,
-        0,    0,    0, 1104, 1172,    0, 1102, 1104,    0,    0,
-        0, 1109,    0,    0,    0,    0,    0,    0, 1104, 1104,
-     1098, 1098, 1098, 1104, 1109,    0,    0, 1104,    0, 1114,
-     1104,    0,    0,    0,    0,    0, 1111, 1102, 1102, 1102,
-        0, 1112,    0,    0, 1108,    0,    0,    0,    0,    0,
-
-     1172,    0,    0,    0, 1103, 1107, 1107, 1107, 1107, 1107,
-     1107, 1104, 1104, 1104,    0, 1103, 1103,    0,    0, 1110,
-     1109,    0,    0, 1103, 1103, 1103, 1103, 1103,    0, 1103,
-     1103,    0,    0, 1103, 1103, 1103, 1103, 1103,    0,    0,
-     1108, 1108, 1110,    0, 1103, 1107,    0,    0, 1112, 1103,
-     1103,    0,    0,    0,    0, 1110, 1113, 1109,    0,    0,
-     1109,    0,    0, 1109, 1115, 1111, 1111, 1111, 1111, 1172,
-        0, 1114, 1114, 1114,    0,    0, 1107, 1107, 1107, 1113,
-        0,    0, 1114,    0,    0,    0,    0, 1115,    0, 1111,
-        0,    0, 1113, 1108, 1112,    0,    0, 1108,    0,    0,
-
-     1115, 1110,    0, 1172,    0,    0,    0,    0, 1109, 1109,
-        0,    0,    0, 1114, 1114, 1114,    0,    0,    0,    0,
-     1111, 1111, 1111, 1109,    0, 1112, 1112, 1112, 1108, 1108,
-     1108,    0,    0,    0, 1172, 1172, 1172,    0, 1113,    0,
-        0,    0,    0,    0,    0,    0, 1115, 1110, 1110,    0,
-     1110, 1110,    0,    0, 1109, 1109, 1109,    0,    0,    0,
-        0,    0,    0,    0,    0, 1110, 1116, 1110, 1110, 1110,
-        0, 1117,    0,    0, 1118, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1116,
-        0,    0,    0,    0, 1117, 1120,    0, 1118,    0,    0,
-
-        0,    0, 1116,    0, 1110,    0,    0, 1117,    0,    0,
-     1118,    0,    0,    0,    0, 1115, 1115,    0, 1120,    0,
-     1115,    0, 1115,    0, 1115,    0, 1115,    0,    0,    0,
-        0, 1120, 1115, 1115,    0, 1110, 1110, 1110, 1115,    0,
-     1115, 1113,    0, 1115,    0, 1115, 1115,    0, 1116, 1115,
-        0,    0,    0, 1117,    0,    0, 1118,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0, 1119, 1113, 1113, 1113,    0,    0, 1120,    0,    0,
-     1115, 1115, 1115,    0,    0,    0, 1116,    0, 1116,    0,
-     1117, 1117, 1117, 1118, 1119, 1118, 1118,    0, 1116,    0,
-
-        0, 1116, 1117,    0,    0,    0,    0, 1119,    0,    0,
-     1116, 1116, 1116, 1116, 1121,    0, 1116, 1116,    0, 1117,
-        0, 1117, 1116,    0,    0, 1116,    0, 1116, 1117, 1117,
-     1116,    0, 1116, 1116, 1116,    0, 1116, 1121,    0,    0,
-     1173, 1117,    0, 1117,    0,    0, 1117, 1117,    0,    0,
-     1121, 1116,    0, 1119,    0,    0, 1117,    0, 1176, 1118,
-        0,    0,    0, 1173,    0,    0, 1120,    0,    0,    0,
-     1120, 1120,    0,    0, 1120, 1120, 1173,    0,    0,    0,
-     1120, 1176, 1116, 1116, 1116,    0,    0, 1117, 1117, 1117,
-     1118, 1118, 1118,    0, 1176,    0, 1121,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1119,
-        0, 1120, 1120, 1120, 1119, 1119, 1174, 1119,    0,    0,
-        0,    0, 1173, 1119,    0, 1119, 1119, 1119,    0, 1119,
-        0, 1119,    0, 1119,    0,    0,    0, 1119,    0, 1174,
-     1176,    0,    0,    0,    0, 1175,    0,    0,    0, 1121,
-     1121, 1121, 1174,    0,    0, 1121, 1119,    0,    0,    0,
-     1121,    0, 1121, 1121, 1122, 1122,    0,    0, 1175, 1122,
-     1122, 1122, 1122, 1122,    0, 1122, 1122, 1122, 1122,    0,
-        0, 1175,    0,    0,    0, 1173,    0, 1119, 1119, 1119,
-     1122,    0,    0,    0, 1122,    0,    0,    0, 1174, 1121,
-
-        0,    0,    0, 1123, 1123,    0,    0,    0, 1123, 1123,
-     1123, 1123, 1123,    0, 1123, 1123, 1123, 1123,    0,    0,
-        0,    0, 1122, 1122, 1122, 1173, 1122, 1175,    0, 1123,
-     1121, 1121, 1121, 1123,    0, 1174, 1174,    0,    0,    0,
-     1124, 1124,    0, 1176,    0, 1124, 1124, 1124, 1124, 1124,
-        0, 1124, 1124, 1124, 1124,    0, 1173, 1173, 1173,    0,
-     1177, 1123, 1123, 1123, 1175, 1123, 1124,    0,    0,    0,
-     1124,    0,    0,    0, 1176, 1176, 1176,    0,    0,    0,
-        0, 1125, 1125, 1177,    0,    0, 1125, 1125, 1125, 1125,
-     1125,    0, 1125, 1125, 1125, 1125, 1177,    0, 1124, 1124,
-
-     1124, 1174, 1124,    0,    0,    0,    0, 1125,    0,    0,
-        0, 1125,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0, 1122,    0,    0,    0,    0,
-     1175,    0, 1174, 1174, 1174,    0, 1122, 1122,    0, 1125,
-     1125, 1125, 1177, 1125, 1122, 1122, 1122, 1122, 1122,    0,
-     1122, 1122,    0,    0, 1122, 1122, 1122, 1122, 1122,    0,
-        0, 1175, 1175, 1175, 1123, 1122,    0,    0,    0,    0,
-     1122, 1122,    0,    0,    0, 1123, 1123,    0,    0, 1177,
-        0,    0,    0, 1123, 1123, 1123, 1123, 1123,    0, 1123,
-     1123,    0,    0, 1123, 1123, 1123, 1123, 1123,    0,    0,
-
-        0, 1124, 1178,    0, 1123,    0,    0,    0,    0, 1123,
-     1123,    0, 1124, 1124,    0,    0,    0,    0,    0,    0,
-     1124, 1124, 1124, 1124, 1124, 1178, 1124, 1124,    0,    0,
-     1124, 1124, 1124, 1124, 1124,    0,    0,    0, 1178,    0,
-        0, 1124, 1125,    0,    0, 1177, 1124, 1124,    0,    0,
-        0,    0,    0, 1125, 1125,    0,    0,    0,    0,    0,
-        0, 1125, 1125, 1125, 1125, 1125,    0, 1125, 1125,    0,
-        0, 1125, 1125, 1125, 1125, 1125, 1177, 1177, 1177,    0,
-        0,    0, 1125,    0, 1178,    0,    0, 1125, 1125, 1148,
-     1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148,
-
-     1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148,
-     1148, 1148, 1179,    0,    0, 1180,    0,    0, 1181,    0,
-        0, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-     1178, 1178,    0, 1182,    0, 1179,    0,    0, 1180,    0,
-        0, 1181,    0,    0,    0,    0,    0,    0, 1179,    0,
-        0, 1180,    0, 1183, 1181,    0, 1182, 1181, 1181, 1181,
-     1181, 1181, 1181, 1181, 1181, 1181, 1181, 1184, 1178, 1182,
-     1185,    0,    0, 1186,    0,    0, 1183,    0, 1187,    0,
-        0,    0,    0,    0,    0,    0,    0, 1178, 1188, 1183,
-     1184,    0,    0, 1185, 1179,    0, 1186, 1180,    0,    0,
-
-     1181, 1187,    0, 1184,    0,    0, 1185,    0, 1189, 1186,
-        0, 1188,    0,    0, 1187, 1182,    0,    0, 1178, 1178,
-     1178,    0,    0,    0, 1188,    0,    0, 1192,    0,    0,
-        0, 1189,    0, 1190, 1180, 1183,    0,    0,    0,    0,
-        0,    0,    0,    0, 1189,    0,    0,    0,    0, 1184,
-     1192,    0, 1185,    0,    0, 1186, 1190,    0,    0,    0,
-     1187,    0, 1179, 1192,    0,    0,    0,    0,    0, 1190,
-     1188,    0, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
-     1190, 1190,    0,    0, 1182,    0, 1184, 1184,    0, 1185,
-     1189,    0,    0,    0,    0,    0,    0, 1179, 1183,    0,
-
-     1180,    0,    0, 1181,    0,    0,    0, 1188, 1188, 1192,
-        0,    0,    0,    0,    0, 1190,    0, 1196, 1182,    0,
-        0, 1194,    0, 1187, 1186, 1199,    0, 1189, 1179, 1179,
-     1179, 1180, 1180, 1180, 1181, 1181, 1181,    0, 1183, 1193,
-     1196,    0,    0,    0, 1194,    0, 1192,    0, 1199, 1182,
-     1182, 1182, 1184, 1196,    0, 1185,    0, 1194, 1186,    0,
-        0, 1199, 1193, 1187,    0,    0,    0,    0,    0, 1183,
-     1183, 1183,    0, 1188, 1195, 1193,    0,    0,    0,    0,
-        0,    0,    0, 1184, 1184, 1184, 1185, 1185, 1185, 1186,
-     1186, 1186, 1191, 1189, 1187, 1187, 1187, 1195,    0, 1196,
-
-        0,    0,    0, 1194, 1188, 1188, 1188, 1199,    0,    0,
-     1195,    0, 1192,    0,    0, 1191,    0,    0, 1190,    0,
-        0, 1193,    0,    0, 1189, 1189, 1189,    0, 1191,    0,
-        0, 1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-     1191,    0,    0, 1192, 1192, 1192, 1197,    0,    0, 1190,
-     1190, 1190,    0,    0, 1200,    0, 1195,    0, 1193, 1193,
-     1193, 1193, 1193, 1193, 1193, 1193, 1193, 1193, 1193, 1197,
-        0, 1194, 1202,    0, 1191, 1199, 1198, 1200,    0,    0,
-     1203,    0, 1197,    0, 1206,    0,    0,    0,    0,    0,
-     1200,    0,    0, 1195,    0, 1202, 1204,    0,    0, 1198,
-
-        0,    0, 1196, 1203,    0, 1193, 1194, 1206, 1202,    0,
-     1199,    0, 1198,    0,    0,    0, 1203,    0,    0, 1204,
-     1206, 1206, 1206,    0, 1193, 1205,    0,    0, 1197,    0,
-        0,    0, 1204, 1196, 1196, 1196, 1200, 1194, 1194, 1194,
-     1201, 1199, 1199, 1199,    0,    0,    0,    0, 1205,    0,
-        0,    0,    0,    0, 1202, 1193, 1193, 1193, 1198, 1195,
-        0, 1205, 1203, 1201,    0, 1197, 1206,    0,    0,    0,
-     1209,    0,    0, 1200,    0,    0, 1201, 1191, 1204, 1201,
-     1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201,    0,
-     1195, 1195, 1195, 1209,    0, 1198, 1198, 1198, 1198, 1198,
-
-     1198, 1198, 1198, 1198, 1198, 1198, 1209, 1205, 1191, 1191,
-     1191,    0,    0, 1207,    0, 1204, 1204, 1210,    0,    0,
-        0,    0, 1201, 1202, 1211, 1203,    0,    0,    0,    0,
-        0, 1197,    0,    0,    0,    0, 1207,    0,    0, 1200,
-     1210,    0, 1198,    0, 1205,    0,    0, 1211,    0, 1207,
-        0, 1208, 1209, 1210,    0,    0,    0, 1202,    0,    0,
-     1211, 1198, 1197, 1197, 1197, 1203,    0,    0,    0, 1206,
-     1200, 1200, 1200,    0, 1208,    0,    0,    0,    0,    0,
-     1212, 1204,    0,    0,    0,    0, 1215, 1208, 1202, 1202,
-     1202,    0, 1198, 1198, 1198, 1207, 1203, 1203, 1203, 1210,
-
-     1206, 1206, 1206, 1212,    0,    0, 1211,    0, 1214, 1215,
-     1205,    0, 1204, 1204, 1204, 1216, 1212,    0,    0,    0,
-     1209,    0, 1215,    0, 1213, 1201,    0,    0,    0, 1217,
-        0, 1214, 1207, 1208,    0,    0, 1210,    0, 1216,    0,
-        0, 1205, 1205, 1205, 1214,    0,    0, 1213,    0,    0,
-        0, 1216, 1217,    0,    0, 1209, 1201, 1201, 1201,    0,
-     1213,    0, 1212,    0,    0, 1217,    0,    0, 1215,    0,
-     1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208,
-     1208,    0,    0,    0,    0,    0, 1209, 1209, 1209,    0,
-     1214, 1218,    0,    0,    0,    0, 1219, 1216, 1207, 1212,
-
-        0, 1221, 1210,    0,    0, 1215, 1213,    0,    0, 1211,
-        0, 1217,    0,    0, 1218,    0,    0, 1208,    0, 1219,
-        0,    0,    0,    0, 1221,    0,    0, 1218,    0, 1207,
-     1207, 1207, 1219, 1210, 1210, 1210, 1208, 1221,    0, 1225,
-     1211, 1211, 1211, 1213, 1213, 1213, 1213, 1213, 1213, 1213,
-     1213, 1213, 1213, 1213,    0,    0,    0,    0, 1214,    0,
-        0,    0, 1225,    0,    0, 1212, 1216, 1208, 1208, 1208,
-        0, 1215,    0, 1218, 1217, 1225,    0,    0, 1219,    0,
-        0,    0, 1224, 1221,    0,    0,    0,    0,    0,    0,
-     1213,    0,    0, 1214,    0,    0, 1212, 1212, 1212,    0,
-
-     1216,    0, 1215, 1215, 1215, 1224,    0, 1222,    0, 1213,
-     1218, 1218, 1220,    0, 1217, 1219,    0,    0, 1224,    0,
-     1221, 1225,    0,    0, 1214, 1214, 1214,    0,    0,    0,
-     1222, 1216, 1216, 1216,    0, 1220,    0,    0,    0,    0,
-     1213, 1213, 1213, 1222,    0, 1217, 1217, 1217, 1220,    0,
-        0, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220,
-     1220, 1223,    0,    0, 1224,    0,    0, 1226,    0,    0,
-     1229,    0,    0,    0,    0,    0, 1218,    0,    0,    0,
-        0, 1219,    0,    0, 1223,    0, 1221,    0,    0, 1222,
-     1226,    0,    0, 1229, 1220,    0,    0, 1223,    0,    0,
-
-        0, 1224,    0, 1226,    0,    0, 1229, 1218, 1218, 1218,
-        0,    0, 1219, 1219, 1219,    0,    0, 1221, 1221, 1221,
-        0,    0, 1228,    0, 1225,    0, 1222, 1222, 1222, 1222,
-     1222, 1222, 1222, 1222, 1222, 1222, 1222,    0, 1227,    0,
-        0,    0,    0, 1223,    0, 1228,    0,    0,    0, 1226,
-        0,    0, 1229,    0,    0, 1225, 1225, 1225, 1228, 1230,
-        0, 1227,    0,    0,    0,    0,    0, 1224,    0,    0,
-        0,    0,    0, 1222, 1227,    0,    0,    0,    0,    0,
-        0,    0, 1230,    0,    0,    0, 1226,    0,    0, 1229,
-        0,    0, 1222,    0,    0, 1230,    0, 1220, 1224, 1224,
-
-     1224,    0,    0,    0, 1228,    0,    0,    0, 1231,    0,
-        0, 1223, 1232,    0,    0, 1233,    0,    0,    0,    0,
-     1227,    0,    0, 1222, 1222, 1222,    0,    0, 1220, 1220,
-     1220, 1231,    0, 1235,    0, 1232,    0,    0, 1233,    0,
-        0, 1230,    0,    0, 1231,    0, 1223,    0, 1232,    0,
-        0, 1233, 1226, 1237,    0, 1229, 1235, 1227, 1227, 1227,
-     1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227,    0, 1235,
-        0,    0, 1228,    0,    0,    0, 1237, 1223, 1223, 1223,
-        0,    0,    0, 1226, 1226, 1226, 1229, 1229, 1229, 1237,
-     1231,    0,    0,    0, 1232,    0,    0, 1233,    0,    0,
-
-        0,    0,    0,    0, 1227,    0,    0, 1228,    0,    0,
-     1230,    0,    0,    0,    0, 1235,    0,    0,    0,    0,
-        0,    0, 1234, 1227,    0,    0,    0,    0,    0,    0,
-        0, 1232, 1232,    0, 1233, 1237,    0, 1236, 1228, 1228,
-     1228,    0,    0,    0, 1230, 1234,    0,    0,    0,    0,
-        0,    0, 1235, 1231, 1227, 1227, 1227,    0, 1234, 1238,
-     1236, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234,
-     1234,    0,    0, 1236,    0, 1230, 1230, 1230,    0,    0,
-        0,    0, 1238,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0, 1231,    0, 1238,    0, 1232,    0,    0,
-
-     1233,    0,    0, 1237, 1234,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0, 1244,    0, 1235, 1236,
-        0,    0,    0,    0, 1231, 1231, 1231,    0, 1232, 1232,
-     1232, 1233, 1233, 1233,    0,    0,    0,    0, 1237, 1244,
-        0, 1238,    0,    0, 1239,    0,    0,    0,    0, 1235,
-     1235, 1235, 1244,    0,    0,    0, 1236, 1236, 1236, 1236,
-     1236, 1236, 1236, 1236, 1236, 1236, 1236, 1239,    0, 1237,
-     1237, 1237,    0,    0,    0,    0,    0,    0, 1238,    0,
-     1239,    0,    0, 1239, 1239, 1239, 1239, 1239, 1239, 1239,
-     1239, 1239, 1239,    0,    0,    0, 1242,    0, 1244,    0,
-
-        0,    0,    0, 1236,    0,    0,    0, 1234,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1242,
-     1240,    0, 1236,    0,    0,    0, 1239,    0,    0,    0,
-        0,    0, 1242,    0, 1243, 1244, 1244,    0, 1234, 1234,
-     1234,    0,    0, 1240, 1238,    0, 1241,    0,    0,    0,
-        0,    0,    0, 1236, 1236, 1236, 1240, 1243,    0, 1240,
-     1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1241,
-     1243,    0, 1245,    0,    0, 1238, 1238, 1238, 1242,    0,
-        0,    0, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
-     1241, 1241, 1241, 1241, 1241, 1245,    0,    0,    0,    0,
-
-        0, 1244, 1240,    0,    0,    0,    0, 1247, 1245,    0,
-        0,    0,    0,    0,    0,    0, 1243,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0, 1246, 1241, 1239,
-     1247,    0, 1244, 1244, 1244,    0,    0,    0,    0,    0,
-        0,    0,    0, 1247,    0,    0,    0, 1242,    0,    0,
-     1246,    0,    0,    0, 1245,    0,    0, 1249,    0,    0,
-     1239, 1239, 1239, 1246, 1246, 1246, 1246, 1246, 1246, 1246,
-     1246, 1246, 1246, 1246, 1246, 1246,    0,    0,    0, 1243,
-     1249, 1242,    0,    0, 1250,    0,    0, 1293,    0, 1247,
-        0, 1245,    0, 1249,    0,    0,    0,    0,    0, 1251,
-
-        0,    0,    0, 1251,    0, 1240,    0, 1250,    0, 1246,
-     1293, 1248, 1242, 1242, 1242,    0,    0,    0,    0, 1243,
-     1250,    0, 1251, 1293,    0, 1251, 1247, 1251,    0,    0,
-        0, 1241,    0,    0, 1248, 1251, 1240, 1240, 1240, 1249,
-        0,    0,    0,    0,    0,    0,    0, 1248,    0,    0,
-     1243, 1243, 1243,    0, 1251,    0,    0, 1245,    0,    0,
-        0,    0, 1241, 1241, 1241,    0, 1250,    0,    0, 1293,
-        0,    0,    0, 1252,    0,    0,    0, 1252,    0,    0,
-        0, 1251,    0, 1294,    0,    0,    0,    0, 1245, 1245,
-     1245,    0, 1247, 1248,    0,    0, 1252,    0,    0, 1252,
-
-        0, 1252,    0, 1250,    0,    0, 1294, 1249,    0, 1252,
-        0,    0, 1246, 1251,    0, 1251, 1251,    0,    0, 1294,
-        0,    0,    0, 1247, 1247, 1247,    0,    0, 1252,    0,
-     1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248,
-     1248,    0, 1249, 1246, 1246, 1246,    0,    0,    0,    0,
-     1251,    0,    0,    0,    0, 1252,    0, 1253,    0,    0,
-        0, 1253,    0,    0,    0, 1294,    0,    0,    0, 1250,
-        0, 1295, 1293, 1249, 1249, 1249,    0, 1248,    0,    0,
-     1253,    0,    0, 1253, 1251, 1253,    0, 1252,    0, 1252,
-     1252,    0,    0, 1253, 1295,    0, 1248,    0,    0,    0,
-
-     1250, 1250, 1250, 1293, 1293, 1293,    0, 1295,    0,    0,
-     1254,    0, 1253,    0, 1254, 1251, 1251, 1251, 1252,    0,
-        0,    0,    0,    0, 1298,    0,    0, 1248, 1248, 1248,
-        0, 1255, 1255, 1254, 1294, 1255, 1254,    0, 1254, 1253,
-        0,    0,    0,    0,    0,    0, 1254, 1298,    0,    0,
-        0,    0, 1256, 1295, 1255,    0, 1256, 1255, 1252, 1255,
-     1298,    0,    0,    0,    0, 1254,    0, 1255, 1294,    0,
-        0, 1253,    0, 1253, 1253, 1256, 1253, 1253, 1256,    0,
-     1256,    0,    0,    0,    0,    0, 1255,    0, 1256, 1252,
-     1252, 1252, 1254,    0, 1257,    0,    0,    0, 1257, 1294,
-
-     1294, 1294,    0,    0,    0,    0, 1298, 1256,    0,    0,
-        0,    0,    0, 1255,    0, 1260, 1295, 1257,    0, 1260,
-     1257,    0, 1257,    0, 1254,    0, 1254, 1254,    0, 1254,
-     1257,    0,    0,    0, 1256,    0, 1258,    0, 1260,    0,
-     1258, 1260, 1253, 1260,    0, 1255,    0, 1255, 1255, 1257,
-        0, 1260,    0,    0,    0,    0, 1295, 1259,    0, 1258,
-        0, 1259, 1258,    0, 1258,    0, 1256,    0, 1256, 1256,
-     1260,    0, 1258, 1253, 1253, 1253, 1257,    0,    0,    0,
-     1259,    0,    0, 1259,    0, 1259,    0, 1295, 1295, 1295,
-        0, 1258,    0, 1259,    0, 1254,    0, 1260,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0, 1257, 1298,
-     1257, 1257, 1259, 1257,    0,    0, 1255,    0, 1258,    0,
-        0,    0,    0,    0,    0,    0, 1254, 1254, 1254, 1260,
-        0, 1260, 1260,    0, 1260,    0,    0, 1256,    0, 1259,
-     1298, 1298, 1298,    0,    0,    0,    0, 1255, 1255, 1255,
-     1258,    0, 1258, 1258,    0, 1258, 1258, 1258, 1258, 1258,
-     1258, 1258, 1258, 1258, 1258, 1258,    0,    0, 1256, 1256,
-     1256, 1259,    0, 1259, 1259,    0,    0,    0,    0, 1257,
-     1261, 1261,    0,    0, 1261,    0,    0,    0,    0,    0,
-     1297,    0,    0,    0, 1263,    0,    0,    0, 1263,    0,
-
-     1260,    0, 1258, 1261,    0,    0, 1261, 1259, 1261,    0,
-     1257, 1257, 1257, 1297,    0,    0, 1261, 1263,    0,    0,
-     1263, 1258, 1263,    0,    0,    0, 1297,    0,    0, 1261,
-     1263, 1260, 1260, 1260,    0, 1261,    0,    0,    0,    0,
-        0,    0, 1259, 1265, 1265,    0,    0, 1265,    0, 1263,
-        0,    0, 1258, 1258, 1258,    0,    0, 1266, 1266,    0,
-        0, 1266, 1261,    0,    0,    0, 1265,    0,    0, 1265,
-        0, 1265, 1297, 1259, 1259, 1259, 1263,    0,    0, 1265,
-     1266,    0,    0, 1266,    0, 1266,    0,    0,    0,    0,
-        0,    0, 1265, 1266, 1261,    0, 1261, 1261, 1265,    0,
-
-     1267, 1267,    0,    0, 1267,    0, 1266,    0, 1263, 1297,
-     1263, 1263, 1266,    0,    0,    0,    0, 1268, 1268,    0,
-        0, 1268,    0, 1267,    0, 1265, 1267,    0, 1267,    0,
-        0,    0,    0,    0,    0,    0, 1267,    0,    0, 1266,
-     1268,    0,    0, 1268,    0, 1268,    0,    0,    0, 1267,
-        0,    0,    0, 1268,    0, 1267,    0, 1265,    0, 1265,
-     1265,    0,    0,    0,    0, 1261, 1268, 1296,    0,    0,
-        0, 1266, 1268, 1266, 1266, 1297,    0,    0,    0, 1263,
-        0,    0, 1267,    0,    0,    0,    0,    0,    0,    0,
-     1296,    0,    0,    0, 1265,    0, 1261, 1261, 1261, 1268,
-
-        0, 1301, 1266, 1296,    0,    0, 1297, 1297, 1297,    0,
-     1263, 1263, 1263,    0, 1267,    0, 1267, 1267,    0, 1267,
-     1267,    0, 1269, 1269, 1301,    0, 1269,    0, 1265,    0,
-        0, 1268,    0, 1268, 1268,    0, 1268, 1301,    0,    0,
-     1270, 1270, 1266,    0, 1270, 1269,    0,    0, 1269, 1296,
-     1269,    0,    0,    0,    0,    0,    0,    0, 1269, 1265,
-     1265, 1265,    0, 1270,    0,    0, 1270,    0, 1270,    0,
-        0, 1269,    0, 1266, 1266, 1266, 1270, 1269, 1299,    0,
-        0,    0,    0, 1301,    0, 1267, 1296, 1296,    0, 1270,
-     1300,    0,    0,    0,    0, 1270,    0,    0,    0,    0,
-
-        0, 1299, 1268,    0, 1269,    0,    0,    0,    0,    0,
-        0,    0,    0, 1300, 1299,    0, 1267, 1267, 1267,    0,
-     1301, 1301, 1270,    0,    0,    0, 1300, 1272, 1272,    0,
-        0, 1272,    0, 1268, 1268, 1268, 1269,    0, 1269, 1269,
-        0, 1302,    0,    0,    0, 1271, 1271,    0,    0, 1271,
-     1272,    0, 1296, 1272, 1270, 1272, 1270, 1270,    0, 1270,
-     1299,    0,    0, 1272, 1302, 1273, 1273,    0, 1271, 1273,
-        0, 1271, 1300, 1271,    0,    0, 1272, 1302,    0,    0,
-        0, 1271, 1272, 1296, 1296, 1296, 1301,    0, 1273,    0,
-        0, 1273,    0, 1273, 1271,    0,    0,    0,    0,    0,
-
-     1271, 1273,    0,    0,    0,    0,    0, 1269,    0, 1272,
-        0,    0,    0,    0, 1273,    0,    0, 1301, 1301, 1301,
-     1273,    0,    0, 1302,    0, 1270,    0, 1271,    0, 1299,
-        0,    0,    0,    0,    0, 1300,    0,    0, 1269, 1269,
-     1269, 1272,    0, 1272, 1272,    0,    0, 1273,    0,    0,
-        0,    0,    0, 1309,    0,    0, 1270, 1270, 1270, 1271,
-     1302, 1271, 1271, 1299, 1271, 1271, 1271, 1271, 1271, 1271,
-     1271, 1271, 1271, 1271, 1271, 1300, 1309, 1272,    0, 1273,
-        0, 1273, 1273,    0, 1273,    0,    0, 1274,    0, 1309,
-        0, 1274,    0, 1277, 1299, 1299, 1299, 1277,    0,    0,
-
-        0,    0,    0,    0,    0, 1278, 1300, 1300, 1300, 1278,
-     1274, 1271, 1272, 1274,    0, 1274, 1277,    0,    0, 1277,
-        0, 1277,    0, 1274,    0,    0, 1302,    0, 1278, 1277,
-     1271, 1278,    0, 1278,    0, 1309,    0,    0,    0,    0,
-        0, 1278, 1274, 1272, 1272, 1272,    0,    0, 1277,    0,
-     1273,    0,    0,    0,    0,    0,    0, 1302, 1302, 1302,
-     1278, 1271, 1271, 1271,    0,    0,    0,    0,    0, 1274,
-        0,    0, 1279,    0,    0, 1277, 1279,    0,    0,    0,
-        0, 1273, 1273, 1273,    0,    0,    0, 1278,    0,    0,
-        0,    0,    0,    0,    0, 1279,    0,    0, 1279,    0,
-
-     1279, 1274,    0, 1274, 1274,    0,    0, 1277, 1279, 1277,
-     1277, 1280,    0,    0,    0, 1280,    0,    0,    0, 1278,
-     1304, 1278, 1278,    0,    0, 1281, 1281, 1279,    0, 1281,
-        0,    0, 1282,    0, 1280,    0, 1282, 1280, 1309, 1280,
-        0,    0,    0, 1304, 1277,    0,    0, 1280, 1281,    0,
-     1278, 1281,    0, 1281, 1279, 1282, 1304,    0, 1282,    0,
-     1282, 1281,    0,    0,    0,    0, 1280,    0, 1282, 1309,
-     1309, 1309, 1274,    0,    0,    0,    0,    0, 1277,    0,
-     1281,    0,    0,    0,    0,    0, 1279, 1282, 1279, 1279,
-     1278, 1279, 1279, 1280,    0,    0,    0,    0,    0,    0,
-
-        0,    0, 1304, 1274, 1274, 1274,    0, 1281,    0, 1277,
-     1277, 1277,    0,    0, 1282,    0,    0,    0,    0,    0,
-        0, 1278, 1278, 1278,    0, 1280,    0, 1280, 1280, 1324,
-     1280,    0,    0,    0,    0,    0,    0,    0,    0, 1281,
-     1283, 1281, 1281,    0, 1283,    0, 1282,    0, 1282, 1282,
-        0, 1284, 1324,    0,    0, 1284,    0, 1279,    0,    0,
-        0,    0,    0, 1283,    0, 1324, 1283,    0, 1283,    0,
-        0, 1304,    0,    0, 1284,    0, 1283, 1284, 1306, 1284,
-        0,    0,    0,    0,    0,    0,    0, 1284, 1279, 1279,
-     1279,    0,    0,    0,    0, 1283, 1280,    0,    0,    0,
-
-        0, 1306,    0, 1305,    0, 1304, 1284,    0,    0,    0,
-     1281, 1324,    0,    0, 1306,    0,    0, 1282,    0,    0,
-        0,    0, 1283,    0,    0,    0, 1305, 1280, 1280, 1280,
-     1307,    0,    0, 1284,    0,    0, 1304, 1304, 1304, 1305,
-        0, 1281, 1281, 1281,    0,    0,    0,    0, 1282, 1282,
-     1282,    0,    0, 1307, 1283,    0, 1283, 1283, 1285, 1283,
-     1306,    0, 1285,    0,    0, 1284, 1307, 1284, 1284,    0,
-     1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284,
-     1284, 1285,    0, 1286, 1285, 1305, 1285, 1286,    0,    0,
-        0,    0,    0,    0, 1285, 1287, 1287, 1306, 1306, 1287,
-
-        0,    0,    0,    0,    0, 1310, 1286,    0,    0, 1286,
-        0, 1286, 1307, 1285, 1324,    0,    0, 1284, 1287, 1286,
-        0, 1287,    0, 1287,    0, 1283,    0,    0, 1310,    0,
-        0, 1287,    0,    0,    0,    0, 1284,    0, 1286,    0,
-     1285, 1310,    0, 1312, 1287, 1324, 1324, 1324, 1305, 1307,
-     1287,    0,    0,    0,    0, 1288, 1283, 1283, 1283, 1288,
-        0,    0,    0, 1306,    0, 1286, 1312, 1284, 1284, 1284,
-        0,    0, 1285,    0, 1285, 1285,    0, 1287, 1288, 1312,
-        0, 1288,    0, 1288,    0,    0,    0, 1310, 1305,    0,
-        0, 1288,    0,    0, 1306, 1306, 1306, 1286,    0, 1286,
-
-     1286,    0, 1286, 1289, 1289,    0,    0, 1289, 1285, 1287,
-     1288, 1287, 1287,    0,    0, 1307,    0,    0,    0, 1305,
-     1305, 1305,    0,    0, 1310, 1312, 1289,    0,    0, 1289,
-        0, 1289,    0,    0,    0,    0,    0, 1288,    0, 1289,
-        0,    0,    0, 1285,    0,    0, 1307, 1307, 1307,    0,
-        0,    0, 1289,    0,    0,    0,    0,    0, 1289,    0,
-     1290, 1290,    0,    0, 1290,    0,    0,    0, 1286, 1288,
-        0, 1288, 1288,    0, 1285, 1285, 1285,    0,    0,    0,
-     1287,    0,    0, 1290,    0, 1289, 1290,    0, 1290,    0,
-     1310,    0,    0, 1312,    0,    0, 1290,    0,    0, 1286,
-
-     1286, 1286,    0,    0,    0,    0,    0,    0,    0, 1290,
-        0, 1287, 1287, 1287,    0, 1290,    0, 1289,    0, 1289,
-     1289, 1310, 1310, 1310,    0,    0,    0,    0, 1312,    0,
-     1291, 1291,    0,    0, 1291,    0,    0,    0,    0,    0,
-     1288,    0, 1290,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0, 1291, 1289,    0, 1291,    0, 1291, 1312,
-     1312, 1312,    0,    0,    0,    0, 1291,    0,    0,    0,
-        0, 1288, 1288, 1288, 1290,    0, 1290, 1290,    0, 1291,
-     1292, 1292,    0,    0, 1292, 1291,    0,    0, 1289,    0,
+        0,    0,   84,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-     1303, 1303,    0, 1292, 1303, 1290, 1292, 1311, 1292,    0,
-        0,    0, 1291,    0,    0,    0, 1292,    0, 1313, 1289,
-     1289, 1289,    0, 1303,    0,    0, 1303,    0, 1303, 1292,
-     1311,    0,    0,    0,    0, 1292, 1303,    0,    0,    0,
-        0, 1313,    0, 1311, 1291, 1290, 1291, 1291,    0, 1291,
-     1291,    0,    0,    0, 1313, 1303,    0,    0,    0,    0,
-     1308, 1308, 1292,    0,    0, 1308, 1308, 1308, 1308, 1308,
-     1316, 1308, 1308, 1308, 1308, 1315, 1290, 1290, 1290,    0,
-        0,    0, 1303,    0,    0, 1318, 1308,    0,    0, 1311,
-     1308,    0,    0, 1316, 1292,    0, 1292, 1292, 1315, 1292,
-
-     1313,    0,    0,    0,    0,    0, 1316,    0, 1318,    0,
-        0, 1315,    0,    0, 1303, 1291, 1303, 1303, 1308, 1308,
-     1308, 1318, 1308,    0,    0,    0, 1311, 1311, 1311, 1311,
-     1311, 1311, 1311, 1311, 1311, 1311, 1311, 1313, 1317,    0,
-        0,    0,    0,    0,    0, 1320, 1291, 1291, 1291,    0,
-        0,    0, 1316,    0,    0, 1321,    0, 1315,    0,    0,
-        0, 1317,    0,    0,    0, 1292, 1314, 1318, 1320,    0,
-        0,    0,    0, 1311, 1317,    0,    0,    0, 1321,    0,
-        0, 1320,    0,    0,    0, 1303,    0,    0,    0, 1314,
-        0, 1321, 1311,    0,    0,    0, 1292, 1292, 1292,    0,
-
-        0,    0, 1314, 1313, 1318, 1314, 1314, 1314, 1314, 1314,
-     1314, 1314, 1314, 1314, 1314, 1316, 1303, 1303, 1303,    0,
-     1317, 1308,    0, 1311, 1311, 1311, 1315, 1320,    0,    0,
-        0,    0, 1308, 1308, 1313, 1313, 1313, 1321,    0,    0,
-     1308, 1308, 1308, 1308, 1308,    0, 1308, 1308, 1314, 1322,
-     1308, 1308, 1308, 1308, 1308, 1316,    0, 1317, 1317,    0,
-     1315, 1308,    0,    0, 1320,    0, 1308, 1308,    0,    0,
-     1318, 1319, 1322,    0, 1321, 1321, 1321, 1321, 1321, 1321,
-     1321, 1321, 1321, 1321, 1321, 1322, 1316, 1316, 1316,    0,
-        0, 1315, 1315, 1315, 1319,    0,    0, 1323,    0,    0,
-
-        0, 1318, 1318, 1318,    0, 1325,    0, 1319,    0,    0,
-     1319, 1319, 1319, 1319, 1319, 1319, 1319, 1319, 1319, 1319,
-     1323, 1321, 1327, 1317,    0,    0,    0,    0, 1325,    0,
-     1320, 1322,    0, 1323,    0,    0,    0,    0,    0,    0,
-     1321, 1325,    0,    0,    0, 1327,    0,    0,    0,    0,
-        0, 1314,    0, 1319, 1317, 1317, 1317, 1328, 1327,    0,
-        0, 1320, 1320, 1320,    0, 1329,    0,    0,    0, 1336,
-        0, 1321, 1321, 1321,    0, 1326,    0,    0,    0, 1323,
-     1328,    0, 1314, 1314, 1314,    0, 1330, 1325, 1329,    0,
-        0, 1331, 1336, 1328,    0,    0,    0,    0, 1326, 1322,
-
-        0, 1329,    0,    0, 1327, 1336,    0,    0,    0, 1330,
-     1332, 1326,    0,    0, 1331,    0, 1323,    0,    0,    0,
-        0,    0, 1330,    0, 1325,    0, 1334, 1331,    0,    0,
-        0,    0,    0, 1332, 1322,    0,    0,    0,    0, 1328,
-        0,    0,    0,    0,    0,    0, 1332, 1329,    0, 1334,
-        0, 1336,    0,    0,    0,    0, 1319, 1326,    0,    0,
-        0,    0, 1334,    0,    0, 1322, 1322, 1322, 1330,    0,
-     1337,    0, 1327, 1331,    0,    0, 1328,    0,    0,    0,
-        0,    0, 1323,    0,    0,    0,    0, 1319, 1319, 1319,
-     1325,    0, 1332, 1337, 1326, 1326, 1326, 1326, 1326, 1326,
-
-     1326, 1326, 1326, 1326, 1326,    0, 1337, 1327, 1334,    0,
-     1331, 1331, 1335, 1323, 1323, 1323, 1329,    0,    0, 1336,
-        0, 1325, 1325, 1325,    0,    0,    0,    0, 1339, 1332,
-        0, 1330, 1341,    0,    0, 1335,    0,    0, 1327, 1327,
-     1327, 1326, 1328,    0,    0, 1334,    0,    0, 1335,    0,
-     1329, 1339, 1337,    0, 1336, 1341,    0,    0,    0,    0,
-     1326,    0,    0,    0, 1339,    0,    0,    0, 1341,    0,
-        0, 1330,    0, 1328, 1328, 1328, 1331, 1333,    0,    0,
-        0, 1329, 1329, 1329,    0, 1336, 1336, 1336,    0, 1337,
-        0, 1326, 1326, 1326, 1335, 1332,    0,    0,    0,    0,
-
-     1333,    0, 1330, 1330, 1330,    0,    0, 1331, 1331, 1331,
-     1339, 1334,    0, 1333, 1341,    0, 1333, 1333, 1333, 1333,
-     1333, 1333, 1333, 1333, 1333, 1333, 1332, 1332, 1332, 1338,
-        0, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335,
-     1335, 1335, 1334, 1334, 1334,    0,    0, 1339,    0,    0,
-        0,    0, 1338,    0,    0, 1337, 1340,    0,    0, 1333,
-        0,    0,    0,    0,    0, 1338,    0,    0, 1338, 1338,
-     1338, 1338, 1338, 1338, 1338, 1338, 1338, 1338, 1335, 1340,
-        0,    0, 1341, 1342,    0,    0, 1337, 1337, 1337,    0,
-        0,    0, 1340,    0,    0,    0,    0, 1335,    0,    0,
-
-        0,    0,    0,    0,    0,    0, 1342,    0,    0,    0,
-        0, 1338,    0, 1339,    0,    0,    0, 1341, 1344, 1342,
-        0,    0,    0,    0, 1347,    0,    0,    0, 1335, 1335,
-     1335,    0,    0, 1346,    0,    0, 1345,    0, 1340,    0,
-        0, 1344,    0,    0, 1339, 1339, 1339, 1347, 1341, 1341,
-     1341,    0,    0,    0, 1344,    0, 1346,    0,    0, 1345,
-     1347,    0, 1333,    0,    0, 1342,    0,    0,    0, 1346,
-        0,    0, 1345,    0,    0, 1340, 1340, 1340, 1340, 1340,
-     1340, 1340, 1340, 1340, 1340, 1340,    0, 1343,    0,    0,
-        0,    0,    0, 1333, 1333, 1333,    0,    0,    0,    0,
-
-     1344,    0, 1342,    0,    0,    0, 1347,    0,    0,    0,
-     1343,    0,    0, 1348, 1338, 1346,    0,    0, 1345,    0,
-        0,    0, 1340, 1343,    0,    0, 1343, 1343, 1343, 1343,
-     1343, 1343, 1343, 1343, 1343, 1343, 1348, 1344,    0,    0,
-        0, 1340,    0, 1347,    0, 1338, 1338, 1338,    0, 1348,
-        0,    0,    0,    0,    0, 1345, 1345, 1345, 1345, 1345,
-     1345, 1345, 1345, 1345, 1345, 1345,    0,    0, 1342, 1343,
-        0,    0, 1340, 1340, 1340, 1351,    0,    0,    0,    0,
-        0, 1354,    0, 1346, 1349,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0, 1348,    0,    0, 1351, 1342,
-
-     1342, 1342, 1345, 1344, 1354,    0,    0, 1349,    0, 1347,
-        0, 1351,    0,    0,    0,    0,    0, 1354, 1346,    0,
-     1349, 1345,    0, 1349, 1349, 1349, 1349, 1349, 1349, 1349,
-     1349, 1349, 1349, 1353, 1344, 1344, 1344, 1350,    0,    0,
-     1347, 1347, 1347,    0,    0,    0,    0,    0,    0, 1346,
-     1346, 1346, 1345, 1345, 1345,    0, 1353, 1351,    0,    0,
-     1350,    0,    0, 1354,    0,    0, 1349,    0,    0, 1353,
-        0,    0, 1343, 1350, 1350, 1350, 1350, 1350, 1350, 1350,
-     1350, 1350, 1350, 1350, 1350, 1350, 1352,    0,    0,    0,
-        0, 1382,    0,    0, 1351,    0,    0,    0, 1348,    0,
-
-     1354,    0,    0, 1343, 1343, 1343,    0,    0,    0, 1352,
-        0,    0, 1355,    0, 1382, 1353, 1355,    0,    0, 1350,
-        0, 1356, 1352,    0,    0, 1356,    0, 1382,    0, 1348,
-     1348, 1348,    0,    0,    0, 1355,    0,    0, 1355,    0,
-     1355,    0,    0,    0, 1356,    0,    0, 1356, 1355, 1356,
-        0,    0,    0,    0,    0,    0,    0, 1356,    0,    0,
-     1351,    0,    0,    0,    0,    0, 1354, 1355, 1352, 1349,
-        0,    0,    0, 1382,    0,    0, 1356,    0,    0,    0,
-        0,    0,    0, 1353,    0,    0,    0,    0,    0,    0,
-        0, 1351, 1351, 1351, 1355,    0,    0, 1354, 1354, 1354,
-
-     1349, 1349, 1349, 1356,    0, 1352, 1352, 1352, 1352, 1352,
-     1352, 1352, 1352, 1352, 1352, 1352,    0,    0, 1353,    0,
-        0,    0, 1350,    0,    0,    0, 1355,    0, 1355, 1355,
-        0,    0,    0, 1383,    0, 1356,    0, 1356, 1356, 1357,
-     1356,    0,    0, 1357,    0,    0,    0,    0,    0, 1353,
-     1353, 1353, 1352, 1350, 1350, 1350, 1383,    0,    0, 1358,
-        0,    0, 1357, 1358,    0, 1357,    0, 1357,    0, 1383,
-        0, 1352,    0,    0,    0, 1357, 1382,    0,    0,    0,
-        0,    0, 1358,    0,    0, 1358,    0, 1358,    0,    0,
-        0,    0,    0,    0, 1357, 1358, 1359, 1355,    0,    0,
-
-     1359,    0, 1352, 1352, 1352,    0, 1356, 1382, 1382, 1382,
-        0,    0,    0,    0, 1358, 1383,    0,    0,    0, 1359,
-        0, 1357, 1359,    0, 1359,    0,    0,    0, 1355, 1355,
-     1355,    0, 1359,    0,    0,    0,    0, 1356, 1356, 1356,
-        0, 1358,    0,    0,    0,    0, 1360,    0,    0,    0,
-     1360, 1359,    0, 1357, 1386, 1357, 1357,    0, 1357, 1357,
-     1357, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1360,
-        0,    0, 1360, 1358, 1360, 1358, 1358, 1386, 1359,    0,
-        0,    0, 1360,    0,    0,    0,    0,    0,    0,    0,
-     1386, 1361,    0,    0,    0, 1361,    0,    0,    0,    0,
-
-        0, 1360,    0, 1362,    0, 1357,    0, 1362,    0, 1358,
-     1359,    0, 1359, 1359, 1361, 1359,    0, 1361, 1383, 1361,
-        0,    0,    0,    0, 1357,    0, 1362, 1361, 1360, 1362,
-        0, 1362,    0,    0,    0,    0, 1386,    0,    0, 1362,
-        0,    0,    0,    0, 1358,    0, 1361,    0,    0, 1383,
-     1383, 1383,    0,    0,    0, 1357, 1357, 1357, 1362,    0,
-     1360, 1363, 1360, 1360,    0, 1363,    0,    0, 1364,    0,
-        0,    0, 1364, 1361,    0, 1358, 1358, 1358,    0,    0,
-        0, 1359,    0,    0, 1363, 1362,    0, 1363,    0, 1363,
-        0, 1364,    0,    0, 1364,    0, 1364, 1363,    0, 1386,
-
-        0,    0,    0,    0, 1364, 1361,    0, 1361, 1361,    0,
-     1385,    0, 1359, 1359, 1359,    0, 1363, 1362,    0, 1362,
-     1362,    0,    0, 1364, 1392,    0,    0,    0,    0,    0,
-        0, 1360,    0, 1385,    0,    0,    0,    0,    0, 1386,
-        0,    0, 1361, 1363,    0,    0, 1385, 1392, 1362,    0,
-     1364,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-     1392,    0, 1360, 1360, 1360,    0,    0,    0,    0,    0,
-     1386, 1386, 1386,    0,    0, 1363, 1361, 1363, 1363,    0,
-     1363, 1363, 1364,    0, 1364, 1364,    0, 1364, 1362, 1365,
-     1365,    0, 1385, 1365,    0,    0,    0,    0,    0,    0,
-
-     1366, 1366,    0,    0, 1366,    0, 1392, 1361, 1361, 1361,
-        0,    0, 1365,    0,    0, 1365,    0, 1365,    0, 1362,
-     1362, 1362,    0, 1366,    0, 1365, 1366,    0, 1366,    0,
-        0,    0,    0,    0,    0,    0, 1366,    0, 1365, 1367,
-     1367,    0,    0, 1367, 1365,    0, 1363,    0,    0, 1366,
-        0,    0,    0, 1364,    0, 1366,    0,    0,    0,    0,
-        0, 1385, 1367,    0,    0, 1367,    0, 1367,    0,    0,
-        0, 1365,    0,    0, 1392, 1367,    0, 1363, 1363, 1363,
-        0,    0, 1366,    0, 1364, 1364, 1364,    0, 1367,    0,
-        0,    0,    0,    0, 1367, 1385, 1369, 1369,    0,    0,
-
-     1369,    0,    0, 1365,    0, 1365, 1365,    0,    0, 1392,
-        0, 1368, 1368,    0, 1366, 1368, 1366, 1366,    0, 1369,
-        0, 1367, 1369,    0, 1369,    0, 1385, 1385, 1385,    0,
-        0,    0, 1369,    0, 1368,    0,    0, 1368,    0, 1368,
-     1392, 1392, 1392,    0,    0, 1369,    0, 1368,    0,    0,
-        0, 1369,    0, 1367,    0, 1367, 1367,    0, 1367,    0,
-     1368,    0,    0,    0,    0,    0, 1368,    0, 1371, 1371,
-        0,    0, 1371,    0, 1365,    0,    0,    0, 1369,    0,
-        0,    0,    0,    0,    0, 1366,    0,    0,    0,    0,
-        0, 1371,    0, 1368, 1371,    0, 1371,    0,    0,    0,
-
-        0,    0,    0,    0, 1371, 1365, 1365, 1365,    0,    0,
-     1369,    0, 1369, 1369,    0,    0, 1366, 1366, 1366,    0,
-        0,    0, 1387, 1371, 1367, 1368,    0, 1368, 1368,    0,
-     1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368,
-     1368,    0,    0, 1370, 1370, 1387, 1369, 1370,    0,    0,
-     1371,    0,    0,    0,    0, 1367, 1367, 1367, 1387,    0,
-        0,    0,    0, 1372,    0,    0, 1370, 1372,    0, 1370,
-        0, 1370,    0,    0,    0,    0,    0, 1368,    0, 1370,
-        0, 1369, 1371, 1373, 1371, 1371, 1372, 1373,    0, 1372,
-        0, 1372, 1370,    0,    0,    0, 1368,    0, 1370, 1372,
-
-        0,    0,    0,    0, 1387,    0, 1373,    0,    0, 1373,
-        0, 1373, 1369, 1369, 1369,    0,    0,    0, 1372, 1373,
-        0,    0,    0,    0,    0, 1370,    0, 1368, 1368, 1368,
-        0,    0,    0,    0,    0,    0,    0,    0, 1373,    0,
-        0, 1387, 1387,    0,    0, 1372,    0,    0,    0,    0,
-        0,    0,    0, 1371,    0,    0,    0, 1370,    0, 1370,
-     1370,    0, 1370,    0,    0, 1373,    0,    0, 1374,    0,
-        0,    0, 1374,    0,    0,    0,    0, 1372,    0, 1372,
-     1372,    0,    0,    0, 1371, 1371, 1371,    0, 1375,    0,
-        0, 1374, 1375,    0, 1374, 1388, 1374, 1373,    0, 1373,
-
-     1373,    0, 1373,    0, 1374,    0,    0, 1387,    0,    0,
-        0, 1375,    0,    0, 1375,    0, 1375,    0, 1388,    0,
-        0,    0,    0, 1374, 1375,    0,    0,    0, 1370,    0,
-        0, 1388,    0,    0,    0,    0,    0,    0, 1387, 1387,
-     1387,    0,    0, 1375,    0,    0,    0,    0, 1372,    0,
-     1374,    0,    0,    0,    0,    0,    0,    0,    0, 1370,
-     1370, 1370,    0,    0,    0,    0,    0,    0, 1373,    0,
-     1375,    0,    0,    0,    0,    0,    0, 1388,    0, 1372,
-     1372, 1372, 1374,    0, 1374, 1374,    0, 1374, 1374, 1374,
-     1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374,    0, 1373,
-
-     1373, 1373, 1375,    0, 1375, 1375,    0, 1376,    0,    0,
-        0, 1376,    0, 1377, 1388,    0,    0, 1377,    0, 1378,
-        0,    0,    0, 1378,    0,    0,    0,    0, 1379,    0,
-     1376,    0, 1379, 1376, 1374, 1376, 1377,    0, 1375, 1377,
-        0, 1377, 1378, 1376,    0, 1378,    0, 1378,    0, 1377,
-        0, 1379,    0, 1374, 1379, 1378, 1379,    0,    0,    0,
-        0,    0, 1376,    0, 1379,    0,    0,    0, 1377,    0,
-        0,    0,    0, 1375, 1378,    0,    0,    0,    0,    0,
-     1388,    0,    0, 1379, 1374, 1374, 1374,    0,    0, 1376,
-        0,    0, 1380,    0,    0, 1377, 1380,    0,    0,    0,
-
-        0, 1378,    0,    0, 1375, 1375, 1375,    0,    0,    0,
-     1379, 1388, 1388, 1388, 1390, 1380,    0,    0, 1380,    0,
-     1380, 1376,    0, 1376, 1376,    0, 1376, 1377, 1380, 1377,
-     1377,    0,    0, 1378,    0, 1378, 1378, 1390,    0, 1381,
-        0,    0, 1379, 1381, 1379, 1379,    0, 1380,    0,    0,
-     1390,    0,    0,    0,    0,    0,    0,    0,    0, 1384,
-     1384,    0, 1381, 1384,    0, 1381,    0, 1381,    0,    0,
-     1378,    0,    0, 1379, 1380, 1381,    0,    0,    0,    0,
-        0,    0, 1384,    0,    0, 1384,    0, 1384,    0,    0,
-        0,    0, 1376,    0, 1381, 1384, 1390,    0, 1377,    0,
-
-        0,    0,    0,    0, 1378,    0, 1380,    0, 1380, 1380,
-        0, 1380, 1380, 1379, 1384, 1393,    0,    0,    0,    0,
-        0, 1381,    0, 1376, 1376, 1376,    0,    0,    0, 1377,
-     1377, 1377,    0, 1390, 1395, 1378, 1378, 1378, 1393,    0,
-        0, 1384,    0, 1389, 1379, 1379, 1379,    0,    0,    0,
-        0, 1393,    0, 1381,    0, 1381, 1381, 1395, 1381,    0,
-        0,    0,    0,    0,    0,    0, 1389,    0,    0, 1391,
-     1395,    0,    0, 1384,    0, 1384, 1384, 1380,    0, 1389,
-        0,    0, 1389, 1389, 1389, 1389, 1389, 1389, 1389, 1389,
-     1389, 1389, 1391,    0,    0,    0,    0, 1393,    0, 1390,
-
-        0,    0,    0, 1397,    0, 1391,    0,    0, 1380, 1380,
-     1380,    0,    0,    0,    0,    0, 1395,    0,    0,    0,
-        0,    0, 1394,    0, 1381, 1389, 1397,    0,    0,    0,
-     1390, 1390, 1390,    0, 1393,    0,    0,    0,    0, 1397,
-        0,    0,    0,    0, 1384, 1394,    0,    0, 1396,    0,
-        0, 1391,    0, 1395,    0, 1381, 1381, 1381, 1394,    0,
-        0, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394,
-     1394, 1396,    0,    0,    0, 1384, 1384, 1384,    0,    0,
-        0,    0, 1398,    0, 1396, 1397,    0,    0, 1391, 1391,
-     1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391,    0,
-
-     1393,    0,    0,    0, 1394, 1398,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0, 1398, 1395,
-        0,    0,    0,    0,    0,    0,    0,    0, 1389,    0,
-     1396, 1393, 1393, 1393,    0, 1391,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-     1395, 1395, 1395, 1397, 1391,    0,    0,    0,    0, 1389,
-     1389, 1389,    0,    0, 1398,    0,    0, 1396, 1396, 1396,
-     1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396,    0,    0,
-     1399, 1399,    0,    0, 1399, 1391, 1391, 1391, 1397, 1400,
-        0,    0,    0, 1400,    0,    0,    0,    0,    0,    0,
-
-        0, 1398,    0, 1399,    0,    0, 1399, 1394, 1399,    0,
-        0,    0, 1400,    0, 1396, 1400, 1399, 1400,    0, 1397,
-     1397, 1397,    0,    0,    0, 1400,    0, 1401, 1401, 1399,
-        0, 1401,    0, 1396,    0, 1399,    0,    0, 1394, 1394,
-     1394,    0,    0,    0, 1400,    0,    0,    0,    0,    0,
-     1401,    0,    0, 1401,    0, 1401,    0,    0,    0,    0,
-        0,    0, 1399, 1401, 1396, 1396, 1396, 1398,    0,    0,
-        0, 1400,    0,    0,    0,    0, 1401,    0,    0,    0,
-        0,    0, 1401,    0,    0, 1402, 1402,    0,    0, 1402,
-        0,    0,    0,    0, 1399,    0, 1399, 1399, 1398, 1398,
-
-     1398,    0,    0, 1400,    0, 1400, 1400,    0, 1402, 1401,
-        0, 1402,    0, 1402,    0,    0,    0,    0,    0,    0,
-        0, 1402, 1403, 1403,    0,    0, 1403,    0,    0,    0,
-        0,    0,    0,    0, 1402,    0,    0,    0,    0,    0,
-     1402, 1401,    0, 1401, 1401, 1403,    0,    0, 1403,    0,
-     1403,    0,    0,    0,    0,    0,    0,    0, 1403,    0,
-        0,    0,    0,    0, 1405, 1399,    0, 1402, 1405,    0,
-        0, 1403,    0,    0, 1400,    0,    0, 1403, 1401,    0,
-        0,    0,    0,    0,    0,    0,    0, 1405,    0,    0,
-     1405,    0, 1405,    0,    0,    0, 1399, 1399, 1399, 1402,
-
-     1405, 1402, 1402,    0, 1403, 1400, 1400, 1400,    0,    0,
-        0,    0, 1401,    0,    0,    0,    0,    0,    0, 1405,
-        0,    0,    0,    0,    0,    0,    0, 1404, 1404,    0,
-     1402, 1404,    0,    0,    0,    0, 1403,    0, 1403, 1403,
-        0, 1403, 1403, 1401, 1401, 1401, 1405,    0,    0,    0,
-     1404,    0,    0, 1404,    0, 1404,    0,    0,    0,    0,
-        0,    0,    0, 1404,    0,    0,    0,    0,    0, 1406,
-     1402,    0,    0, 1406,    0,    0, 1404,    0, 1405,    0,
-     1405, 1405, 1404,    0,    0,    0,    0, 1407,    0,    0,
-        0, 1407, 1406,    0,    0, 1406,    0, 1406,    0,    0,
-
-        0, 1402, 1402, 1402,    0, 1406,    0, 1403,    0, 1404,
-     1407,    0,    0, 1407,    0, 1407,    0,    0,    0,    0,
-        0,    0,    0, 1407, 1406,    0,    0,    0,    0,    0,
-        0,    0, 1408,    0,    0,    0, 1408,    0, 1403, 1403,
-     1403, 1404, 1407, 1404, 1404,    0, 1404,    0,    0, 1405,
-        0, 1406,    0,    0,    0, 1408,    0,    0, 1408,    0,
-     1408,    0,    0,    0,    0,    0,    0,    0, 1408, 1407,
-        0,    0,    0,    0, 1409,    0,    0,    0, 1409,    0,
-     1405, 1405, 1405, 1406,    0, 1406, 1406, 1408,    0,    0,
-        0,    0,    0,    0,    0,    0,    0, 1409,    0,    0,
-
-     1409, 1407, 1409, 1407, 1407,    0,    0,    0,    0,    0,
-     1409,    0, 1404,    0, 1408,    0,    0,    0,    0,    0,
-     1406,    0,    0,    0,    0,    0,    0,    0,    0, 1409,
-        0,    0, 1407,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0, 1404, 1404, 1404, 1408,    0, 1408, 1408,
-        0, 1408, 1408,    0, 1406,    0, 1409,    0,    0,    0,
+        0,    0,    0,    0,   84,    0,   84,   84,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,    0,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  111,    0,    0,  111,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0, 1407,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0, 1406, 1406, 1406, 1409,    0,
-     1409, 1409,    0, 1409,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  111,    0,
 
-        0,    0,    0, 1407, 1407, 1407,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0, 1408,    0,    0,
+      111,    0,    0,    0,    0,    0,    0,    0,  111,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  111,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0, 1408, 1408,
-     1408,    0,    0,    0,    0,    0,    0,    0,    0, 1409,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  111,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-     1409, 1409, 1409, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1411, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412,    0, 1412, 1412,
-        0, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412,    0, 1412,    0, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412,    0, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-        0, 1412,    0,    0, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-     1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412,
-
-     1412, 1412, 1412, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413,    0, 1413, 1413,    0, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413,    0, 1413,    0,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413,    0, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413,    0, 1413, 1413,    0, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414,    0, 1414, 1414,
-        0, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414,    0, 1414,    0, 1414, 1414, 1414, 1414, 1414,
-
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414,    0, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-        0, 1414,    0,    0, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-
-     1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415,    0, 1415, 1415,    0, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415,    0, 1415,    0,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415,    0, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415,    0, 1415,    0,    0, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416,    0, 1416, 1416,
-        0, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-
-     1416, 1416,    0, 1416,    0, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416,    0, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-        0, 1416,    0,    0, 1416, 1416, 1416, 1416, 1416, 1416,
-
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
-     1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417,    0, 1417, 1417,    0, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417,    0, 1417,    0,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417,    0, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417,    0, 1417,    0,    0, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418,    0, 1418, 1418,
-        0, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418,    0, 1418,    0, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418,    0, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-
-        0, 1418,    0,    0, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418,
-     1418, 1418, 1418, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419,    0, 1419, 1419,    0, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419,    0, 1419,    0,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419,    0, 1419, 1419, 1419,
-
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419,    0, 1419,    0,    0, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420,    0, 1420, 1420,
-
-        0, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420,    0, 1420,    0, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420,    0, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-        0, 1420,    0,    0, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420,
-     1420, 1420, 1420, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421,    0, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1422, 1422,
-
-     1422, 1422, 1422, 1422, 1422, 1422, 1422,    0, 1422, 1422,
-        0, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422,    0, 1422,    0, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422,    0, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-        0, 1422,    0,    0, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422,
-     1422, 1422, 1422, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423,    0, 1423, 1423,    0, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423,    0, 1423,    0,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423,    0, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423,    0, 1423,    0,    0, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
-
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
-     1424, 1424, 1424, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425,    0,    0, 1425, 1425,    0, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425,    0, 1425, 1425,    0, 1425,    0,
-
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425,    0, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425,    0, 1425,    0,    0, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-     1426, 1426, 1426, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427,    0, 1427, 1427,    0, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-
-     1427, 1427, 1427, 1427, 1427, 1427, 1427,    0, 1427,    0,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427,    0, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427,    0, 1427,    0,    0, 1427,
-
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428,    0, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-     1428, 1428, 1428, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
-     1430, 1430, 1430, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-
-     1431, 1431,    0, 1431, 1431,    0, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431,    0, 1431,    0,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431,    0, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431,    0, 1431,    0,    0, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432,    0, 1432, 1432,
-        0, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432,    0, 1432,    0, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432,    0, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-        0, 1432,    0,    0, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-     1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
-
-     1432, 1432, 1432, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433,    0, 1433, 1433,    0, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433,    0, 1433,    0,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433,    0, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433,    0, 1433,    0,    0, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-
-     1434, 1434,    0, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-
-     1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
-     1434, 1434, 1434, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436,    0, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
-     1436, 1436, 1436, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437,    0, 1437, 1437,    0, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437,    0, 1437,    0,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437,    0, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437,    0, 1437,    0,    0, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438,    0, 1438, 1438,
-        0, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438,    0, 1438,    0, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438,    0, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-
-        0, 1438,    0,    0, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
-     1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
-     1440, 1440, 1440, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1442, 1442,
-
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443,    0, 1443, 1443,    0, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443,    0, 1443,    0,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443,    0, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443,    0, 1443,    0,    0, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
-
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444,    0, 1444, 1444,
-        0, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444,    0, 1444,    0, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444,    0, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-        0, 1444,    0,    0, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
-     1444, 1444, 1444, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446,    0, 1446, 1446,
-        0, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446,    0, 1446,    0, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446,    0, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-        0, 1446,    0,    0, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
-     1446, 1446, 1446, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448,    0, 1448, 1448,
-        0, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448,    0, 1448,    0, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448,    0, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-        0, 1448,    0,    0, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
-     1448, 1448, 1448, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450,    0,    0, 1450, 1450,
-        0, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,    0,
-     1450, 1450,    0, 1450,    0, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-
-     1450,    0, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-        0, 1450,    0,    0, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
-     1450, 1450, 1450, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-
-     1451, 1451,    0, 1451, 1451,    0, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451,    0, 1451,    0,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451,    0, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451,    0, 1451,    0,    0, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452,    0, 1452, 1452,
-        0, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452,    0, 1452,    0, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452,    0, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-        0, 1452,    0,    0, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-
-     1452, 1452, 1452, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453,    0, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-
-     1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
-     1454, 1454, 1454, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455,    0, 1455, 1455,    0, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455,    0, 1455,    0,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455,    0, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455,    0, 1455,    0,    0, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
-     1456, 1456, 1456, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457,    0, 1457, 1457,    0, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457,    0, 1457,    0,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457,    0, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457,    0, 1457,    0,    0, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458,    0, 1458, 1458,
-        0, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458,    0, 1458,    0, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458,    0, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-
-        0, 1458,    0,    0, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
-     1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459,    0, 1459, 1459,    0, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459,    0, 1459,    0,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459,    0, 1459, 1459, 1459,
-
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459,    0, 1459,    0,    0, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460,    0, 1460, 1460,
-
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460,
-     1460, 1460, 1460, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1462, 1462,
-
-     1462, 1462, 1462, 1462, 1462, 1462, 1462,    0, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
-     1462, 1462, 1462, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463,    0, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
-
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
-     1464, 1464, 1464, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466,    0,    0, 1466, 1466,
-        0, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,    0,
-     1466, 1466,    0, 1466,    0, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466,    0, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-        0, 1466,    0,    0, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
-     1466, 1466, 1466, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467,    0, 1467, 1467,    0, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-
-     1467, 1467, 1467, 1467, 1467, 1467, 1467,    0, 1467,    0,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467,    0, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467,    0, 1467,    0,    0, 1467,
-
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
-     1468, 1468, 1468, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469,    0, 1469, 1469,    0, 1469, 1469, 1469, 1469,
-
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469,    0, 1469,    0,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469,    0, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-
-     1469, 1469, 1469, 1469, 1469,    0, 1469,    0,    0, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470,    0, 1470, 1470,
-        0, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470,    0, 1470,    0, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-
-     1470,    0, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-        0, 1470,    0,    0, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
-     1470, 1470, 1470, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-
-     1471, 1471,    0, 1471, 1471,    0, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471,    0, 1471,    0,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471,    0, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471,    0, 1471,    0,    0, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-     1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472,
-
-     1472, 1472, 1472, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473,    0, 1473, 1473,    0, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473,    0, 1473,    0,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473,    0, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473,    0, 1473,    0,    0, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474,    0, 1474, 1474,
-        0, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474,    0, 1474,    0, 1474, 1474, 1474, 1474, 1474,
-
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474,    0, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-        0, 1474,    0,    0, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-
-     1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
-     1474, 1474, 1474, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476,    0, 1476, 1476,
-        0, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-
-     1476, 1476,    0, 1476,    0, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476,    0, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-        0, 1476,    0,    0, 1476, 1476, 1476, 1476, 1476, 1476,
-
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
-     1476, 1476, 1476, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477,    0, 1477, 1477,    0, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477,    0, 1477,    0,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477,    0, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477,    0, 1477,    0,    0, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478,    0, 1478, 1478,
-        0, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478,    0, 1478,    0, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478,    0, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-
-        0, 1478,    0,    0, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
-     1478, 1478, 1478, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479,    0, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480,    0, 1480, 1480,
-
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
-     1480, 1480, 1480, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481,    0, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1482, 1482,
-
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
-     1482, 1482, 1482, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
-
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484,    0, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
-     1484, 1484, 1484, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
-     1486, 1486, 1486, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487,    0, 1487, 1487,    0, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-
-     1487, 1487, 1487, 1487, 1487, 1487, 1487,    0, 1487,    0,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487,    0, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487,    0, 1487,    0,    0, 1487,
-
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-     1488, 1488, 1488, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489,    0, 1489, 1489,    0, 1489, 1489, 1489, 1489,
-
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489,    0, 1489,    0,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489,    0, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-
-     1489, 1489, 1489, 1489, 1489,    0, 1489,    0,    0, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
-     1490, 1490, 1490, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-
-     1491, 1491,    0, 1491, 1491,    0, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491,    0, 1491,    0,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491,    0, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491,    0, 1491,    0,    0, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492,    0, 1492, 1492,
-        0, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492,    0, 1492,    0, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492,    0, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-        0, 1492,    0,    0, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
-
-     1492, 1492, 1492, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493,    0, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494,    0, 1494, 1494,
-        0, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494,    0, 1494,    0, 1494, 1494, 1494, 1494, 1494,
-
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494,    0, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-        0, 1494,    0,    0, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-
-     1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
-     1494, 1494, 1494, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495,    0, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
-     1496, 1496, 1496, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497,    0, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
-     1498, 1498, 1498, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499,    0, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
-     1500, 1500, 1500, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1502, 1502,
-
-     1502, 1502, 1502, 1502, 1502, 1502, 1502,    0, 1502, 1502,
-        0, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502,    0, 1502,    0, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502,    0, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-        0, 1502,    0,    0, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
-     1502, 1502, 1502, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503,    0, 1503, 1503,    0, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503,    0, 1503,    0,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503,    0, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503,    0, 1503,    0,    0, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,
-
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505,    0, 1505, 1505,    0, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505,    0, 1505,    0,
-
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505,    0, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505,    0, 1505,    0,    0, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506,    0, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
-     1506, 1506, 1506, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
-     1508, 1508, 1508, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510,    0, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
-     1510, 1510, 1510, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-
-     1511, 1511,    0, 1511, 1511,    0, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511,    0, 1511,    0,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511,    0, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511,    0, 1511,    0,    0, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-     1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
-
-     1512, 1512, 1512, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513,    0, 1513, 1513,    0, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513,    0, 1513,    0,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513,    0, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513,    0, 1513,    0,    0, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
-     1410, 1410, 1410, 1410, 1410
-    } ;
-
-static yy_state_type yy_last_accepting_state;
-static char *yy_last_accepting_cpos;
+        0,    0,    0,    0,    0,    0,  111,    0,  111,  111,
+      112,  112,  112,  112,  112,  112,  112,  112,    0,    0,
+
+      112,  112,    0,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,    0,  112,  112,    0,  112,    0,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,    0,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,    0,  112,    0,    0,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,    0,  114,  114,    0,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,    0,
+      114,    0,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+
+      114,  114,  114,  114,  114,  114,  114,  114,    0,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,    0,  114,    0,
+        0,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+
+      130,  130,    0,    0,  130,  132,    0,    0,  132,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  130,    0,    0,  130,    0,  130,    0,
+      132,    0,  132,    0,    0,    0,  130,    0,    0,    0,
+      132,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  130,    0,    0,    0,  132,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  130,    0,    0,    0,  132,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-static const yy_state_type yy_NUL_trans[1410] =
-    {   0,
-        4,    4,    0,   37,   45,    0,   37,   54,   62,   45,
-       37,   37,   37,   95,   45,    0,    0,    0,   37,   37,
-       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
-       37,   37,   37,   37,   37,   37,  182,  190,   37,   37,
-      182,  182,  182,  182,   37,   45,   45,   45,    0,   37,
-       37,   37,   37,   54,   54,   54,   54,   54,   54,   54,
-       54,  213,   62,  213,   62,   62,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  319,  190,  182,  182,  182,  182,
-      182,  182,  182,  348,   95,   95,   95,   95,   95,   95,
-
-       95,   95,  363,    0,    0,    0,    0,    0,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  432,  182,  182,  182,  182,  182,  182,  432,
-      190,  190,  432,  432,  432,  432,  456,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  463,   54,   54,   54,
-       54,   54,  464,  472,  213,  213,  464,  464,  464,  464,
-      464,  213,  213,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,    0,  213,  213,  213,  213,  603,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  319,  432,
-      432,  432,  432,  432,  432,  182,  182,  432,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  432,
-      182,  182,  182,  182,  182,  182,  182,  348,  734,  350,
-      348,  348,  348,  348,  348,  348,  749,   95,   95,   95,
-       95,   95,  182,   37,  750,  182,  182,  182,  182,    0,
-        0,    0,    0,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182,  432,  432,  432,  432,  432,  432,  432,  768,  182,
-      182,  182,  182,  182,  773,  432,  432,  432,  432,  785,
-      432,  432,  432,  432,  432,  182,  182,  768,  182,  182,
-      182,  182,   54,  464,  792,  464,  464,  464,  464,  464,
-      464,  792,  472,  472,  792,  792,  792,  792,  816,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  816,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  464,  464,
-
-      464,  464,  464,  213,  464,  926,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      432,  432,  773,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  182,  182,  182,  182,  182,
-
-      432,  432,  432,  432,  432,  182,  182,  182,  182,  182,
-      182,  182,  182,  182,  182,  432,  182,  182,  182,  182,
-      432,  432,  432,  432,  432,  432,  432,  182,  182,  182,
-      182,  182, 1028,  734,  734, 1042,  734,  734,  734,  734,
-      734, 1030, 1056,  348,  348,  348,  348,  348,   95,  182,
-      182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
-      182, 1062,  432,  432,  432,  432,  432,  182,  182,  182,
-      182,  182,  773,  773,  773,  773,  773,  773,  773,  432,
-      432,  432,  432,  432,  432,  432, 1062,  432,  432,  432,
-      432,  792,  792,  792,  792,  792,  792,  792, 1079,  464,
-
-      464,  464,  464,  464, 1084,  792,  792,  792,  792, 1096,
-      792,  792,  792,  792,  792,  464,  464, 1079,  464,  464,
-      464,  464,  464,  464,  464,  464, 1079,  464,  464,  464,
-      464,  464,  464,  464,  464,  464, 1079,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  130,    0,  130,  130,  132,    0,
+      132,  132,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  773,  432,  432,  432,  432,  432,  773,  773,
-      773,  773,  773,  773,  773,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  182,  182,  182,  182,  182,  432,  182,
-      182,  182,  182,  432,  432,  432,  432,  432,  432,  432,
-
-      432,  432,  182,  182,  182,  182,  182,  432,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,  773,  432,  432,
-      432,  432,  432,  432,  432,  432,  432, 1028, 1042, 1030,
-     1028, 1028, 1028, 1028, 1028, 1028, 1261,  734,  734,  734,
-      734, 1042, 1274, 1042, 1042, 1042, 1042, 1042, 1042, 1287,
-      734,  734,  734,  734,  734,  348, 1028,  348,  348,  348,
-      348,  432,  432,  432,  432,  432, 1293,  773,  773,  773,
-      773,  773, 1298,  792,  792,  792,  792,  792,  464,  464,
-      464,  464,  464,  792, 1084, 1084,  792,  792,  792,  792,
-      792,  792,  792,  792,  792,  792,  792, 1298,  792,  792,
-
-      792,  792,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,  464,  464,  464,  464,  464,  464,  464,  464,  464,
-      464,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  773,  773,  773,  773,  432,  432,  432,  432,  432,
-      773,  432,  432,  432,  432,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  773,  432,  432,  432,  432,  432,
-
-      773,  432,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  432,  432,  182,
-      182,  182,  182,  182,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  182,  182,  182,  182,  182,  773,  773,
-      773,  773,  773,  773,  773,  432,  432,  432,  432,  432,
-     1042, 1042, 1042, 1042, 1360, 1028, 1028, 1028, 1028, 1028,
-     1261, 1261, 1274, 1261, 1261, 1261, 1261, 1261,  734,  734,
-      734,  734,  734, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
-     1377, 1042, 1042, 1042, 1042, 1042,  734, 1042,  734,  734,
-      734,  734,  773,  773,  773,  773,  773,  792,  792,  792,
-
-      792,  792, 1382,  792,  792,  792,  792,    0,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773,  432,  432,
-      432,  432,  432,  773,  773,  773,  773,  773,  773,  773,
-      773,  773,  432,  432,  432,  432,  432,  432,  432,  432,
-      432,  432,  432,  432,  432,  432,  432,  773,  773,  773,
-      773,  773,  773,  773, 1042, 1042, 1042, 1042, 1042, 1028,
-     1028, 1028, 1028, 1028, 1399, 1261, 1261, 1261, 1261, 1261,
-     1405, 1274, 1274, 1274, 1274, 1274, 1042, 1042, 1042, 1042,
-     1042,  792,  792, 1298,  792,  792,  792,  792,  773,  773,
-      773,  773,  773,  773,  773,  773,  773,  773, 1261, 1274,
-
-     1261, 1261, 1261, 1261, 1274, 1274, 1274, 1274, 1274
+        0,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+
+      145,  145,  145,  145,  145,  145,  145,    0
     } ;
 
-extern int yy_flex_debug;
-int yy_flex_debug = 0;
+static const yy_state_type yy_NUL_trans[145] =
+    {   0,
+        4,    4,    0,   19,    4,    0,   25,   30,    4,   19,
+       19,   19,   43,    4,    0,    0,    0,   19,   19,   51,
+       19,   19,    4,    4,   25,   25,   25,   25,   25,   57,
+       57,   30,   30,   57,   57,   69,   51,   19,   19,   19,
+       19,   81,   43,   43,   43,   43,   43,   19,    0,   19,
+       51,   51,   51,   19,   25,   25,   57,   57,   57,   57,
+       57,   57,   57,   57,    0,   57,   57,   57,   69,   51,
+       51,   51,   19,   19,   19,   19,   19,   19,   51,   19,
+       81,   82,   83,   81,   81,   43,   43,    0,   19,   19,
+       51,   57,   57,    0,   57,   57,   51,   51,   51,   51,
+
+       51,   51,   19,   19,   19,   19,   19,   51,   19,  127,
+       82,  128,   82,  129,   81,    0,   51,   51,   51,   51,
+       51,   19,   19,   19,   19,   51,  127,  128,  129,  127,
+      127,  128,  128,   82,   51,   51,   51,   51,   19,   19,
+      127,  128,   51,   51
+    } ;
 
 /* The intent behind this definition is that it'll catch
  * any uses of REJECT which flex missed.
@@ -14271,20 +1567,36 @@ int yy_flex_debug = 0;
 #define yymore() yymore_used_but_not_detected
 #define YY_MORE_ADJ 0
 #define YY_RESTORE_YY_MORE_OFFSET
-char *yytext;
 #line 1 "src/Cooklang.l"
-#line 4 "src/Cooklang.l"
+#line 5 "src/Cooklang.l"
   #include "Cooklang.tab.h"
   #include <stdlib.h>
+  #include <string.h>
+  #ifdef __SSE2__
+  #include <emmintrin.h>
+  #endif
   void showError();
-#line 14280 "parserFiles/lex.yy.c"
+
+  // tokens are matched in the class stream but their spans point at the same
+  // bytes of the source, which is the scanner's extra data
+  #define SOURCE_SPAN(text, length) \
+    ((Span){ yyextra + ((text) - YY_CURRENT_BUFFER_LVALUE->yy_ch_buf), (length) })
+
+  // matches a run of plain text without the DFA, defined at the bottom
+  static size_t matchPlainRun( const char * start, const char * limit, int * token );
+#line 1587 "parserFiles/lex.yy.c"
+/*
+multi-byte characters reach the scanner as their class from CharClassLib.h,
+the first byte is the class symbol and the rest are continuation symbols:
+  \x81 space, \x82 new line, \x83 punctuation, \x84 continuation
+*/
 /*
 a word can be composed of:
   * not cooklang char
   * "[" not followed by "-" (else comment)
   * "-" not followed by a second "-" (else comment)
 */
-#line 14287 "parserFiles/lex.yy.c"
+#line 1599 "parserFiles/lex.yy.c"
 
 #define INITIAL 0
 
@@ -14296,40 +1608,90 @@ a word can be composed of:
 #include <unistd.h>
 #endif
 
-#ifndef YY_EXTRA_TYPE
-#define YY_EXTRA_TYPE void *
-#endif
+#define YY_EXTRA_TYPE const char *
+
+/* Holds the entire state of the reentrant scanner. */
+struct yyguts_t
+    {
+
+    /* User-defined. Not touched by flex. */
+    YY_EXTRA_TYPE yyextra_r;
+
+    /* The rest are the same as the globals declared in the non-reentrant scanner. */
+    FILE *yyin_r, *yyout_r;
+    size_t yy_buffer_stack_top; /**< index of top of stack. */
+    size_t yy_buffer_stack_max; /**< capacity of stack. */
+    YY_BUFFER_STATE * yy_buffer_stack; /**< Stack as an array. */
+    char yy_hold_char;
+    int yy_n_chars;
+    int yyleng_r;
+    char *yy_c_buf_p;
+    int yy_init;
+    int yy_start;
+    int yy_did_buffer_switch_on_eof;
+    int yy_start_stack_ptr;
+    int yy_start_stack_depth;
+    int *yy_start_stack;
+    yy_state_type yy_last_accepting_state;
+    char* yy_last_accepting_cpos;
+
+    int yylineno_r;
+    int yy_flex_debug_r;
 
-static int yy_init_globals ( void );
+    char *yytext_r;
+    int yy_more_flag;
+    int yy_more_len;
+
+    YYSTYPE * yylval_r;
+
+    }; /* end struct yyguts_t */
+
+static int yy_init_globals ( yyscan_t yyscanner );
+
+    /* This must go here because YYSTYPE and YYLTYPE are included
+     * from bison output in section 1.*/
+    #    define yylval yyg->yylval_r
+    
+int yylex_init (yyscan_t* scanner);
+
+int yylex_init_extra ( YY_EXTRA_TYPE user_defined, yyscan_t* scanner);
 
 /* Accessor methods to globals.
    These are made visible to non-reentrant scanners for convenience. */
 
-int yylex_destroy ( void );
+int yylex_destroy ( yyscan_t yyscanner );
+
+int yyget_debug ( yyscan_t yyscanner );
 
-int yyget_debug ( void );
+void yyset_debug ( int debug_flag , yyscan_t yyscanner );
 
-void yyset_debug ( int debug_flag  );
+YY_EXTRA_TYPE yyget_extra ( yyscan_t yyscanner );
 
-YY_EXTRA_TYPE yyget_extra ( void );
+void yyset_extra ( YY_EXTRA_TYPE user_defined , yyscan_t yyscanner );
 
-void yyset_extra ( YY_EXTRA_TYPE user_defined  );
+FILE *yyget_in ( yyscan_t yyscanner );
 
-FILE *yyget_in ( void );
+void yyset_in  ( FILE * _in_str , yyscan_t yyscanner );
 
-void yyset_in  ( FILE * _in_str  );
+FILE *yyget_out ( yyscan_t yyscanner );
 
-FILE *yyget_out ( void );
+void yyset_out  ( FILE * _out_str , yyscan_t yyscanner );
 
-void yyset_out  ( FILE * _out_str  );
+			int yyget_leng ( yyscan_t yyscanner );
 
-			int yyget_leng ( void );
+char *yyget_text ( yyscan_t yyscanner );
 
-char *yyget_text ( void );
+int yyget_lineno ( yyscan_t yyscanner );
 
-int yyget_lineno ( void );
+void yyset_lineno ( int _line_number , yyscan_t yyscanner );
 
-void yyset_lineno ( int _line_number  );
+int yyget_column  ( yyscan_t yyscanner );
+
+void yyset_column ( int _column_no , yyscan_t yyscanner );
+
+YYSTYPE * yyget_lval ( yyscan_t yyscanner );
+
+void yyset_lval ( YYSTYPE * yylval_param , yyscan_t yyscanner );
 
 /* Macros after this point can all be overridden by user definitions in
  * section 1.
@@ -14337,31 +1699,31 @@ void yyset_lineno ( int _line_number  );
 
 #ifndef YY_SKIP_YYWRAP
 #ifdef __cplusplus
-extern "C" int yywrap ( void );
+extern "C" int yywrap ( yyscan_t yyscanner );
 #else
-extern int yywrap ( void );
+extern int yywrap ( yyscan_t yyscanner );
 #endif
 #endif
 
 #ifndef YY_NO_UNPUT
 
-    static void yyunput ( int c, char *buf_ptr  );
+    static void yyunput ( int c, char *buf_ptr  , yyscan_t yyscanner);
 
 #endif
 
 #ifndef yytext_ptr
-static void yy_flex_strncpy ( char *, const char *, int );
+static void yy_flex_strncpy ( char *, const char *, int , yyscan_t yyscanner);
 #endif
 
 #ifdef YY_NEED_STRLEN
-static int yy_flex_strlen ( const char * );
+static int yy_flex_strlen ( const char * , yyscan_t yyscanner);
 #endif
 
 #ifndef YY_NO_INPUT
 #ifdef __cplusplus
-static int yyinput ( void );
+static int yyinput ( yyscan_t yyscanner );
 #else
-static int input ( void );
+static int input ( yyscan_t yyscanner );
 #endif
 
 #endif
@@ -14435,7 +1797,7 @@ static int input ( void );
 
 /* Report a fatal error. */
 #ifndef YY_FATAL_ERROR
-#define YY_FATAL_ERROR(msg) yy_fatal_error( msg )
+#define YY_FATAL_ERROR(msg) yy_fatal_error( msg , yyscanner)
 #endif
 
 /* end tables serialization structures and prototypes */
@@ -14446,9 +1808,11 @@ static int input ( void );
 #ifndef YY_DECL
 #define YY_DECL_IS_OURS 1
 
-extern int yylex (void);
+extern int yylex \
+               (YYSTYPE * yylval_param , yyscan_t yyscanner);
 
-#define YY_DECL int yylex (void)
+#define YY_DECL int yylex \
+               (YYSTYPE * yylval_param , yyscan_t yyscanner)
 #endif /* !YY_DECL */
 
 /* Code executed at the beginning of each rule, after yytext and yyleng
@@ -14473,17 +1837,20 @@ YY_DECL
 	yy_state_type yy_current_state;
 	char *yy_cp, *yy_bp;
 	int yy_act;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 
-	if ( !(yy_init) )
+    yylval = yylval_param;
+
+	if ( !yyg->yy_init )
 		{
-		(yy_init) = 1;
+		yyg->yy_init = 1;
 
 #ifdef YY_USER_INIT
 		YY_USER_INIT;
 #endif
 
-		if ( ! (yy_start) )
-			(yy_start) = 1;	/* first start state */
+		if ( ! yyg->yy_start )
+			yyg->yy_start = 1;	/* first start state */
 
 		if ( ! yyin )
 			yyin = stdin;
@@ -14492,42 +1859,63 @@ YY_DECL
 			yyout = stdout;
 
 		if ( ! YY_CURRENT_BUFFER ) {
-			yyensure_buffer_stack ();
+			yyensure_buffer_stack (yyscanner);
 			YY_CURRENT_BUFFER_LVALUE =
-				yy_create_buffer( yyin, YY_BUF_SIZE );
+				yy_create_buffer( yyin, YY_BUF_SIZE , yyscanner);
 		}
 
-		yy_load_buffer_state(  );
+		yy_load_buffer_state( yyscanner );
 		}
 
 	{
-#line 53 "src/Cooklang.l"
+#line 67 "src/Cooklang.l"
+
 
+  #ifndef COOKLANG_DFA_ONLY
+  // most of a recipe is plain prose, so a run of it is matched in one go
+  // here instead of walking the DFA a byte at a time - matchPlainRun only
+  // answers when the result is the same token the DFA would have found
+  {
+    int plainToken = 0;
 
+    yy_bp = yyg->yy_c_buf_p;
+    *yy_bp = yyg->yy_hold_char;
 
-#line 14508 "parserFiles/lex.yy.c"
+    size_t plainLength = matchPlainRun(yy_bp,
+        YY_CURRENT_BUFFER_LVALUE->yy_ch_buf + yyg->yy_n_chars, &plainToken);
+
+    if( plainLength > 0 ){
+      yy_cp = yy_bp + plainLength;
+      YY_DO_BEFORE_ACTION;
+      yylval->span = SOURCE_SPAN(yytext, yyleng);
+      return plainToken;
+    }
+  }
+  #endif
+
+#line 1896 "parserFiles/lex.yy.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
-		yy_cp = (yy_c_buf_p);
+		yy_cp = yyg->yy_c_buf_p;
 
 		/* Support of yytext. */
-		*yy_cp = (yy_hold_char);
+		*yy_cp = yyg->yy_hold_char;
 
 		/* yy_bp points to the position in yy_ch_buf of the start of
 		 * the current run.
 		 */
 		yy_bp = yy_cp;
 
-		yy_current_state = (yy_start);
+		yy_current_state = yyg->yy_start;
 yy_match:
 		do
 			{
 			YY_CHAR yy_c = YY_SC_TO_UI(*yy_cp);
 			if ( yy_accept[yy_current_state] )
 				{
-				(yy_last_accepting_state) = yy_current_state;
-				(yy_last_accepting_cpos) = yy_cp;
+				yyg->yy_last_accepting_state = yy_current_state;
+				yyg->yy_last_accepting_cpos = yy_cp;
 				}
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
@@ -14536,14 +1924,14 @@ yy_match:
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 59859 );
+		while ( yy_base[yy_current_state] != 4852 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
 		if ( yy_act == 0 )
 			{ /* have to back up */
-			yy_cp = (yy_last_accepting_cpos);
-			yy_current_state = (yy_last_accepting_state);
+			yy_cp = yyg->yy_last_accepting_cpos;
+			yy_current_state = yyg->yy_last_accepting_state;
 			yy_act = yy_accept[yy_current_state];
 			}
 
@@ -14555,152 +1943,153 @@ do_action:	/* This label is used only to access EOF actions. */
 	{ /* beginning of action switch */
 			case 0: /* must back up */
 			/* undo the effects of YY_DO_BEFORE_ACTION */
-			*yy_cp = (yy_hold_char);
-			yy_cp = (yy_last_accepting_cpos);
-			yy_current_state = (yy_last_accepting_state);
+			*yy_cp = yyg->yy_hold_char;
+			yy_cp = yyg->yy_last_accepting_cpos;
+			yy_current_state = yyg->yy_last_accepting_state;
 			goto yy_find_action;
 
 case 1:
 YY_RULE_SETUP
-#line 56 "src/Cooklang.l"
+#line 93 "src/Cooklang.l"
 {return LCURL;}
 	YY_BREAK
 case 2:
 YY_RULE_SETUP
-#line 57 "src/Cooklang.l"
+#line 94 "src/Cooklang.l"
 {return RCURL;}
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 58 "src/Cooklang.l"
+#line 95 "src/Cooklang.l"
 {return TILDE;}
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 59 "src/Cooklang.l"
+#line 96 "src/Cooklang.l"
 {return COMMENT;}
 	YY_BREAK
 case 5:
 /* rule 5 can match eol */
 YY_RULE_SETUP
-#line 61 "src/Cooklang.l"
-{ yytext++;
-                        yylval.string = strdup(yytext);
+#line 98 "src/Cooklang.l"
+{ // the name starts after the '@'
+                        yylval->span = SOURCE_SPAN(yytext + 1, yyleng - 1);
                         return ATWORD;
 }
 	YY_BREAK
 case 6:
 /* rule 6 can match eol */
 YY_RULE_SETUP
-#line 66 "src/Cooklang.l"
-{ yytext++;
-                        yylval.string = strdup(yytext);
+#line 103 "src/Cooklang.l"
+{ // the name starts after the '#'
+                        yylval->span = SOURCE_SPAN(yytext + 1, yyleng - 1);
                         return HWORD;
                       }
 	YY_BREAK
 case 7:
 /* rule 7 can match eol */
 YY_RULE_SETUP
-#line 72 "src/Cooklang.l"
-{ yylval.string = strdup(yytext);
+#line 109 "src/Cooklang.l"
+{ yylval->span = SOURCE_SPAN(yytext, yyleng);
                         return UNIT;}
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 75 "src/Cooklang.l"
-{ yylval.number = strtod(yytext, NULL); return NUMBER;}
+#line 112 "src/Cooklang.l"
+{ yylval->number = strtod(yytext, NULL); return NUMBER;}
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 76 "src/Cooklang.l"
-{ yylval.number = strtod(yytext, NULL); return NUMBER;}
+#line 113 "src/Cooklang.l"
+{ yylval->number = strtod(yytext, NULL); return NUMBER;}
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 77 "src/Cooklang.l"
-{ yylval.number = strtod(yytext, NULL); return NUMBER;}
+#line 114 "src/Cooklang.l"
+{ yylval->number = strtod(yytext, NULL); return NUMBER;}
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 78 "src/Cooklang.l"
-{ char * tok = strtok(yytext, "/");
+#line 115 "src/Cooklang.l"
+{ char * end = NULL;
 
-                        double first = strtod(tok, NULL);
+                        double first = strtod(yytext, &end);
 
-                        tok = strtok(NULL, "/");
+                        // skip past the '/' to the denominator
+                        end = strchr(end, '/') + 1;
 
-                        double second = strtod(tok, NULL);
+                        double second = strtod(end, NULL);
 
                         double final = first/second;
 
-                        yylval.number = final;
+                        yylval->number = final;
 
                         return NUMBER;}
 	YY_BREAK
 case 12:
 /* rule 12 can match eol */
 YY_RULE_SETUP
-#line 92 "src/Cooklang.l"
-{ yylval.string = strdup(yytext);
+#line 130 "src/Cooklang.l"
+{ yylval->span = SOURCE_SPAN(yytext, yyleng);
                         return METADATA;
                       }
 	YY_BREAK
 case 13:
 /* rule 13 can match eol */
 YY_RULE_SETUP
-#line 96 "src/Cooklang.l"
-{ yylval.string = strdup(yytext);
+#line 134 "src/Cooklang.l"
+{ yylval->span = SOURCE_SPAN(yytext, yyleng);
                         return WORD;
                       }
 	YY_BREAK
 case 14:
 /* rule 14 can match eol */
 YY_RULE_SETUP
-#line 99 "src/Cooklang.l"
-{ yylval.string = strdup(yytext);
+#line 137 "src/Cooklang.l"
+{ yylval->span = SOURCE_SPAN(yytext, yyleng);
                         return MULTIWORD;
                       }
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 103 "src/Cooklang.l"
-{ yylval.string = strdup(yytext);
+#line 141 "src/Cooklang.l"
+{ yylval->span = SOURCE_SPAN(yytext, yyleng);
                         return PUNC_CHAR; }
 	YY_BREAK
 case 16:
 /* rule 16 can match eol */
 YY_RULE_SETUP
-#line 106 "src/Cooklang.l"
+#line 144 "src/Cooklang.l"
 {return NL;}
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
-#line 108 "src/Cooklang.l"
+#line 146 "src/Cooklang.l"
 
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 110 "src/Cooklang.l"
-{ yylval.string = strdup(yytext);
+#line 148 "src/Cooklang.l"
+{ yylval->span = SOURCE_SPAN(yytext, yyleng);
                         return WHTS;
                       }
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 114 "src/Cooklang.l"
+#line 152 "src/Cooklang.l"
 ECHO;
 	YY_BREAK
-#line 14693 "parserFiles/lex.yy.c"
+#line 2082 "parserFiles/lex.yy.c"
 case YY_STATE_EOF(INITIAL):
 	yyterminate();
 
 	case YY_END_OF_BUFFER:
 		{
 		/* Amount of text matched not including the EOB char. */
-		int yy_amount_of_matched_text = (int) (yy_cp - (yytext_ptr)) - 1;
+		int yy_amount_of_matched_text = (int) (yy_cp - yyg->yytext_ptr) - 1;
 
 		/* Undo the effects of YY_DO_BEFORE_ACTION. */
-		*yy_cp = (yy_hold_char);
+		*yy_cp = yyg->yy_hold_char;
 		YY_RESTORE_YY_MORE_OFFSET
 
 		if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_NEW )
@@ -14714,7 +2103,7 @@ case YY_STATE_EOF(INITIAL):
 			 * this is the first action (other than possibly a
 			 * back-up) that will match for the new input source.
 			 */
-			(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
+			yyg->yy_n_chars = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
 			YY_CURRENT_BUFFER_LVALUE->yy_input_file = yyin;
 			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status = YY_BUFFER_NORMAL;
 			}
@@ -14726,13 +2115,13 @@ case YY_STATE_EOF(INITIAL):
 		 * end-of-buffer state).  Contrast this with the test
 		 * in input().
 		 */
-		if ( (yy_c_buf_p) <= &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
+		if ( yyg->yy_c_buf_p <= &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars] )
 			{ /* This was really a NUL. */
 			yy_state_type yy_next_state;
 
-			(yy_c_buf_p) = (yytext_ptr) + yy_amount_of_matched_text;
+			yyg->yy_c_buf_p = yyg->yytext_ptr + yy_amount_of_matched_text;
 
-			yy_current_state = yy_get_previous_state(  );
+			yy_current_state = yy_get_previous_state( yyscanner );
 
 			/* Okay, we're now positioned to make the NUL
 			 * transition.  We couldn't have
@@ -14743,32 +2132,32 @@ case YY_STATE_EOF(INITIAL):
 			 * will run more slowly).
 			 */
 
-			yy_next_state = yy_try_NUL_trans( yy_current_state );
+			yy_next_state = yy_try_NUL_trans( yy_current_state , yyscanner);
 
-			yy_bp = (yytext_ptr) + YY_MORE_ADJ;
+			yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
 
 			if ( yy_next_state )
 				{
 				/* Consume the NUL. */
-				yy_cp = ++(yy_c_buf_p);
+				yy_cp = ++yyg->yy_c_buf_p;
 				yy_current_state = yy_next_state;
 				goto yy_match;
 				}
 
 			else
 				{
-				yy_cp = (yy_c_buf_p);
+				yy_cp = yyg->yy_c_buf_p;
 				goto yy_find_action;
 				}
 			}
 
-		else switch ( yy_get_next_buffer(  ) )
+		else switch ( yy_get_next_buffer( yyscanner ) )
 			{
 			case EOB_ACT_END_OF_FILE:
 				{
-				(yy_did_buffer_switch_on_eof) = 0;
+				yyg->yy_did_buffer_switch_on_eof = 0;
 
-				if ( yywrap(  ) )
+				if ( yywrap( yyscanner ) )
 					{
 					/* Note: because we've taken care in
 					 * yy_get_next_buffer() to have set up
@@ -14779,7 +2168,7 @@ case YY_STATE_EOF(INITIAL):
 					 * YY_NULL, it'll still work - another
 					 * YY_NULL will get returned.
 					 */
-					(yy_c_buf_p) = (yytext_ptr) + YY_MORE_ADJ;
+					yyg->yy_c_buf_p = yyg->yytext_ptr + YY_MORE_ADJ;
 
 					yy_act = YY_STATE_EOF(YY_START);
 					goto do_action;
@@ -14787,30 +2176,30 @@ case YY_STATE_EOF(INITIAL):
 
 				else
 					{
-					if ( ! (yy_did_buffer_switch_on_eof) )
+					if ( ! yyg->yy_did_buffer_switch_on_eof )
 						YY_NEW_FILE;
 					}
 				break;
 				}
 
 			case EOB_ACT_CONTINUE_SCAN:
-				(yy_c_buf_p) =
-					(yytext_ptr) + yy_amount_of_matched_text;
+				yyg->yy_c_buf_p =
+					yyg->yytext_ptr + yy_amount_of_matched_text;
 
-				yy_current_state = yy_get_previous_state(  );
+				yy_current_state = yy_get_previous_state( yyscanner );
 
-				yy_cp = (yy_c_buf_p);
-				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
+				yy_cp = yyg->yy_c_buf_p;
+				yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
 				goto yy_match;
 
 			case EOB_ACT_LAST_MATCH:
-				(yy_c_buf_p) =
-				&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)];
+				yyg->yy_c_buf_p =
+				&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars];
 
-				yy_current_state = yy_get_previous_state(  );
+				yy_current_state = yy_get_previous_state( yyscanner );
 
-				yy_cp = (yy_c_buf_p);
-				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
+				yy_cp = yyg->yy_c_buf_p;
+				yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
 				goto yy_find_action;
 			}
 		break;
@@ -14831,20 +2220,21 @@ case YY_STATE_EOF(INITIAL):
  *	EOB_ACT_CONTINUE_SCAN - continue scanning from current position
  *	EOB_ACT_END_OF_FILE - end of file
  */
-static int yy_get_next_buffer (void)
+static int yy_get_next_buffer (yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
     	char *dest = YY_CURRENT_BUFFER_LVALUE->yy_ch_buf;
-	char *source = (yytext_ptr);
+	char *source = yyg->yytext_ptr;
 	int number_to_move, i;
 	int ret_val;
 
-	if ( (yy_c_buf_p) > &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] )
+	if ( yyg->yy_c_buf_p > &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars + 1] )
 		YY_FATAL_ERROR(
 		"fatal flex scanner internal error--end of buffer missed" );
 
 	if ( YY_CURRENT_BUFFER_LVALUE->yy_fill_buffer == 0 )
 		{ /* Don't try to fill the buffer, so this is an EOF. */
-		if ( (yy_c_buf_p) - (yytext_ptr) - YY_MORE_ADJ == 1 )
+		if ( yyg->yy_c_buf_p - yyg->yytext_ptr - YY_MORE_ADJ == 1 )
 			{
 			/* We matched a single character, the EOB, so
 			 * treat this as a final EOF.
@@ -14864,7 +2254,7 @@ static int yy_get_next_buffer (void)
 	/* Try to read more data. */
 
 	/* First move last chars to start of buffer. */
-	number_to_move = (int) ((yy_c_buf_p) - (yytext_ptr) - 1);
+	number_to_move = (int) (yyg->yy_c_buf_p - yyg->yytext_ptr - 1);
 
 	for ( i = 0; i < number_to_move; ++i )
 		*(dest++) = *(source++);
@@ -14873,7 +2263,7 @@ static int yy_get_next_buffer (void)
 		/* don't do the read, it's not guaranteed to return an EOF,
 		 * just force an EOF
 		 */
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars) = 0;
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars = 0;
 
 	else
 		{
@@ -14887,7 +2277,7 @@ static int yy_get_next_buffer (void)
 			YY_BUFFER_STATE b = YY_CURRENT_BUFFER_LVALUE;
 
 			int yy_c_buf_p_offset =
-				(int) ((yy_c_buf_p) - b->yy_ch_buf);
+				(int) (yyg->yy_c_buf_p - b->yy_ch_buf);
 
 			if ( b->yy_is_our_buffer )
 				{
@@ -14901,7 +2291,7 @@ static int yy_get_next_buffer (void)
 				b->yy_ch_buf = (char *)
 					/* Include room in for 2 EOB chars. */
 					yyrealloc( (void *) b->yy_ch_buf,
-							 (yy_size_t) (b->yy_buf_size + 2)  );
+							 (yy_size_t) (b->yy_buf_size + 2) , yyscanner );
 				}
 			else
 				/* Can't grow it, we don't own it. */
@@ -14911,7 +2301,7 @@ static int yy_get_next_buffer (void)
 				YY_FATAL_ERROR(
 				"fatal error - scanner input buffer overflow" );
 
-			(yy_c_buf_p) = &b->yy_ch_buf[yy_c_buf_p_offset];
+			yyg->yy_c_buf_p = &b->yy_ch_buf[yy_c_buf_p_offset];
 
 			num_to_read = YY_CURRENT_BUFFER_LVALUE->yy_buf_size -
 						number_to_move - 1;
@@ -14923,17 +2313,17 @@ static int yy_get_next_buffer (void)
 
 		/* Read in more data. */
 		YY_INPUT( (&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[number_to_move]),
-			(yy_n_chars), num_to_read );
+			yyg->yy_n_chars, num_to_read );
 
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
 		}
 
-	if ( (yy_n_chars) == 0 )
+	if ( yyg->yy_n_chars == 0 )
 		{
 		if ( number_to_move == YY_MORE_ADJ )
 			{
 			ret_val = EOB_ACT_END_OF_FILE;
-			yyrestart( yyin  );
+			yyrestart( yyin , yyscanner);
 			}
 
 		else
@@ -14947,49 +2337,50 @@ static int yy_get_next_buffer (void)
 	else
 		ret_val = EOB_ACT_CONTINUE_SCAN;
 
-	if (((yy_n_chars) + number_to_move) > YY_CURRENT_BUFFER_LVALUE->yy_buf_size) {
+	if ((yyg->yy_n_chars + number_to_move) > YY_CURRENT_BUFFER_LVALUE->yy_buf_size) {
 		/* Extend the array by 50%, plus the number we really need. */
-		int new_size = (yy_n_chars) + number_to_move + ((yy_n_chars) >> 1);
+		int new_size = yyg->yy_n_chars + number_to_move + (yyg->yy_n_chars >> 1);
 		YY_CURRENT_BUFFER_LVALUE->yy_ch_buf = (char *) yyrealloc(
-			(void *) YY_CURRENT_BUFFER_LVALUE->yy_ch_buf, (yy_size_t) new_size  );
+			(void *) YY_CURRENT_BUFFER_LVALUE->yy_ch_buf, (yy_size_t) new_size , yyscanner );
 		if ( ! YY_CURRENT_BUFFER_LVALUE->yy_ch_buf )
 			YY_FATAL_ERROR( "out of dynamic memory in yy_get_next_buffer()" );
 		/* "- 2" to take care of EOB's */
 		YY_CURRENT_BUFFER_LVALUE->yy_buf_size = (int) (new_size - 2);
 	}
 
-	(yy_n_chars) += number_to_move;
-	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] = YY_END_OF_BUFFER_CHAR;
-	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] = YY_END_OF_BUFFER_CHAR;
+	yyg->yy_n_chars += number_to_move;
+	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars] = YY_END_OF_BUFFER_CHAR;
+	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars + 1] = YY_END_OF_BUFFER_CHAR;
 
-	(yytext_ptr) = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[0];
+	yyg->yytext_ptr = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[0];
 
 	return ret_val;
 }
 
 /* yy_get_previous_state - get the state just before the EOB char was reached */
 
-    static yy_state_type yy_get_previous_state (void)
+    static yy_state_type yy_get_previous_state (yyscan_t yyscanner)
 {
 	yy_state_type yy_current_state;
 	char *yy_cp;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 
-	yy_current_state = (yy_start);
+	yy_current_state = yyg->yy_start;
 
-	for ( yy_cp = (yytext_ptr) + YY_MORE_ADJ; yy_cp < (yy_c_buf_p); ++yy_cp )
+	for ( yy_cp = yyg->yytext_ptr + YY_MORE_ADJ; yy_cp < yyg->yy_c_buf_p; ++yy_cp )
 		{
 		if ( yy_accept[yy_current_state] )
 			{
-			(yy_last_accepting_state) = yy_current_state;
-			(yy_last_accepting_cpos) = yy_cp;
+			yyg->yy_last_accepting_state = yy_current_state;
+			yyg->yy_last_accepting_cpos = yy_cp;
 			}
 		if ( *yy_cp )
 			{
 			YY_CHAR yy_c = YY_SC_TO_UI(*yy_cp);
 			if ( yy_accept[yy_current_state] )
 				{
-				(yy_last_accepting_state) = yy_current_state;
-				(yy_last_accepting_cpos) = yy_cp;
+				yyg->yy_last_accepting_state = yy_current_state;
+				yyg->yy_last_accepting_cpos = yy_cp;
 				}
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
@@ -15009,31 +2400,34 @@ static int yy_get_next_buffer (void)
  * synopsis
  *	next_state = yy_try_NUL_trans( current_state );
  */
-    static yy_state_type yy_try_NUL_trans  (yy_state_type yy_current_state )
+    static yy_state_type yy_try_NUL_trans  (yy_state_type yy_current_state , yyscan_t yyscanner)
 {
 	int yy_is_jam;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner; /* This var may be unused depending upon options. */
 
 	yy_current_state = yy_NUL_trans[yy_current_state];
 	yy_is_jam = (yy_current_state == 0);
 
-		return yy_is_jam ? 0 : yy_current_state;
+	(void)yyg;
+	return yy_is_jam ? 0 : yy_current_state;
 }
 
 #ifndef YY_NO_UNPUT
 
-    static void yyunput (int c, char * yy_bp )
+    static void yyunput (int c, char * yy_bp , yyscan_t yyscanner)
 {
 	char *yy_cp;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 
-    yy_cp = (yy_c_buf_p);
+    yy_cp = yyg->yy_c_buf_p;
 
 	/* undo effects of setting up yytext */
-	*yy_cp = (yy_hold_char);
+	*yy_cp = yyg->yy_hold_char;
 
 	if ( yy_cp < YY_CURRENT_BUFFER_LVALUE->yy_ch_buf + 2 )
 		{ /* need to shift things up to make room */
 		/* +2 for EOB chars. */
-		int number_to_move = (yy_n_chars) + 2;
+		int number_to_move = yyg->yy_n_chars + 2;
 		char *dest = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[
 					YY_CURRENT_BUFFER_LVALUE->yy_buf_size + 2];
 		char *source =
@@ -15045,7 +2439,7 @@ static int yy_get_next_buffer (void)
 		yy_cp += (int) (dest - source);
 		yy_bp += (int) (dest - source);
 		YY_CURRENT_BUFFER_LVALUE->yy_n_chars =
-			(yy_n_chars) = (int) YY_CURRENT_BUFFER_LVALUE->yy_buf_size;
+			yyg->yy_n_chars = (int) YY_CURRENT_BUFFER_LVALUE->yy_buf_size;
 
 		if ( yy_cp < YY_CURRENT_BUFFER_LVALUE->yy_ch_buf + 2 )
 			YY_FATAL_ERROR( "flex scanner push-back overflow" );
@@ -15053,41 +2447,42 @@ static int yy_get_next_buffer (void)
 
 	*--yy_cp = (char) c;
 
-	(yytext_ptr) = yy_bp;
-	(yy_hold_char) = *yy_cp;
-	(yy_c_buf_p) = yy_cp;
+	yyg->yytext_ptr = yy_bp;
+	yyg->yy_hold_char = *yy_cp;
+	yyg->yy_c_buf_p = yy_cp;
 }
 
 #endif
 
 #ifndef YY_NO_INPUT
 #ifdef __cplusplus
-    static int yyinput (void)
+    static int yyinput (yyscan_t yyscanner)
 #else
-    static int input  (void)
+    static int input  (yyscan_t yyscanner)
 #endif
 
 {
 	int c;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 
-	*(yy_c_buf_p) = (yy_hold_char);
+	*yyg->yy_c_buf_p = yyg->yy_hold_char;
 
-	if ( *(yy_c_buf_p) == YY_END_OF_BUFFER_CHAR )
+	if ( *yyg->yy_c_buf_p == YY_END_OF_BUFFER_CHAR )
 		{
 		/* yy_c_buf_p now points to the character we want to return.
 		 * If this occurs *before* the EOB characters, then it's a
 		 * valid NUL; if not, then we've hit the end of the buffer.
 		 */
-		if ( (yy_c_buf_p) < &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
+		if ( yyg->yy_c_buf_p < &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars] )
 			/* This was really a NUL. */
-			*(yy_c_buf_p) = '\0';
+			*yyg->yy_c_buf_p = '\0';
 
 		else
 			{ /* need more input */
-			int offset = (int) ((yy_c_buf_p) - (yytext_ptr));
-			++(yy_c_buf_p);
+			int offset = (int) (yyg->yy_c_buf_p - yyg->yytext_ptr);
+			++yyg->yy_c_buf_p;
 
-			switch ( yy_get_next_buffer(  ) )
+			switch ( yy_get_next_buffer( yyscanner ) )
 				{
 				case EOB_ACT_LAST_MATCH:
 					/* This happens because yy_g_n_b()
@@ -15101,34 +2496,34 @@ static int yy_get_next_buffer (void)
 					 */
 
 					/* Reset buffer status. */
-					yyrestart( yyin );
+					yyrestart( yyin , yyscanner);
 
 					/*FALLTHROUGH*/
 
 				case EOB_ACT_END_OF_FILE:
 					{
-					if ( yywrap(  ) )
+					if ( yywrap( yyscanner ) )
 						return 0;
 
-					if ( ! (yy_did_buffer_switch_on_eof) )
+					if ( ! yyg->yy_did_buffer_switch_on_eof )
 						YY_NEW_FILE;
 #ifdef __cplusplus
-					return yyinput();
+					return yyinput(yyscanner);
 #else
-					return input();
+					return input(yyscanner);
 #endif
 					}
 
 				case EOB_ACT_CONTINUE_SCAN:
-					(yy_c_buf_p) = (yytext_ptr) + offset;
+					yyg->yy_c_buf_p = yyg->yytext_ptr + offset;
 					break;
 				}
 			}
 		}
 
-	c = *(unsigned char *) (yy_c_buf_p);	/* cast for 8-bit char's */
-	*(yy_c_buf_p) = '\0';	/* preserve yytext */
-	(yy_hold_char) = *++(yy_c_buf_p);
+	c = *(unsigned char *) yyg->yy_c_buf_p;	/* cast for 8-bit char's */
+	*yyg->yy_c_buf_p = '\0';	/* preserve yytext */
+	yyg->yy_hold_char = *++yyg->yy_c_buf_p;
 
 	return c;
 }
@@ -15139,60 +2534,63 @@ static int yy_get_next_buffer (void)
  *
  * @note This function does not reset the start condition to @c INITIAL .
  */
-    void yyrestart  (FILE * input_file )
+    void yyrestart  (FILE * input_file , yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 
 	if ( ! YY_CURRENT_BUFFER ){
-        yyensure_buffer_stack ();
+        yyensure_buffer_stack (yyscanner);
 		YY_CURRENT_BUFFER_LVALUE =
-            yy_create_buffer( yyin, YY_BUF_SIZE );
+            yy_create_buffer( yyin, YY_BUF_SIZE , yyscanner);
 	}
 
-	yy_init_buffer( YY_CURRENT_BUFFER, input_file );
-	yy_load_buffer_state(  );
+	yy_init_buffer( YY_CURRENT_BUFFER, input_file , yyscanner);
+	yy_load_buffer_state( yyscanner );
 }
 
 /** Switch to a different input buffer.
  * @param new_buffer The new input buffer.
  *
  */
-    void yy_switch_to_buffer  (YY_BUFFER_STATE  new_buffer )
+    void yy_switch_to_buffer  (YY_BUFFER_STATE  new_buffer , yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 
 	/* TODO. We should be able to replace this entire function body
 	 * with
 	 *		yypop_buffer_state();
 	 *		yypush_buffer_state(new_buffer);
      */
-	yyensure_buffer_stack ();
+	yyensure_buffer_stack (yyscanner);
 	if ( YY_CURRENT_BUFFER == new_buffer )
 		return;
 
 	if ( YY_CURRENT_BUFFER )
 		{
 		/* Flush out information for old buffer. */
-		*(yy_c_buf_p) = (yy_hold_char);
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
+		*yyg->yy_c_buf_p = yyg->yy_hold_char;
+		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = yyg->yy_c_buf_p;
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
 		}
 
 	YY_CURRENT_BUFFER_LVALUE = new_buffer;
-	yy_load_buffer_state(  );
+	yy_load_buffer_state( yyscanner );
 
 	/* We don't actually know whether we did this switch during
 	 * EOF (yywrap()) processing, but the only time this flag
 	 * is looked at is after yywrap() is called, so it's safe
 	 * to go ahead and always set it.
 	 */
-	(yy_did_buffer_switch_on_eof) = 1;
+	yyg->yy_did_buffer_switch_on_eof = 1;
 }
 
-static void yy_load_buffer_state  (void)
+static void yy_load_buffer_state  (yyscan_t yyscanner)
 {
-    	(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
-	(yytext_ptr) = (yy_c_buf_p) = YY_CURRENT_BUFFER_LVALUE->yy_buf_pos;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	yyg->yy_n_chars = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
+	yyg->yytext_ptr = yyg->yy_c_buf_p = YY_CURRENT_BUFFER_LVALUE->yy_buf_pos;
 	yyin = YY_CURRENT_BUFFER_LVALUE->yy_input_file;
-	(yy_hold_char) = *(yy_c_buf_p);
+	yyg->yy_hold_char = *yyg->yy_c_buf_p;
 }
 
 /** Allocate and initialize an input buffer state.
@@ -15201,11 +2599,12 @@ static void yy_load_buffer_state  (void)
  *
  * @return the allocated buffer state.
  */
-    YY_BUFFER_STATE yy_create_buffer  (FILE * file, int  size )
+    YY_BUFFER_STATE yy_create_buffer  (FILE * file, int  size , yyscan_t yyscanner)
 {
 	YY_BUFFER_STATE b;
+    
 
-	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state )  );
+	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state ) , yyscanner );
 	if ( ! b )
 		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
 
@@ -15214,13 +2613,13 @@ static void yy_load_buffer_state  (void)
 	/* yy_ch_buf has to be 2 characters longer than the size given because
 	 * we need to put in 2 end-of-buffer characters.
 	 */
-	b->yy_ch_buf = (char *) yyalloc( (yy_size_t) (b->yy_buf_size + 2)  );
+	b->yy_ch_buf = (char *) yyalloc( (yy_size_t) (b->yy_buf_size + 2) , yyscanner );
 	if ( ! b->yy_ch_buf )
 		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
 
 	b->yy_is_our_buffer = 1;
 
-	yy_init_buffer( b, file );
+	yy_init_buffer( b, file , yyscanner);
 
 	return b;
 }
@@ -15229,8 +2628,9 @@ static void yy_load_buffer_state  (void)
  * @param b a buffer created with yy_create_buffer()
  *
  */
-    void yy_delete_buffer (YY_BUFFER_STATE  b )
+    void yy_delete_buffer (YY_BUFFER_STATE  b , yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 
 	if ( ! b )
 		return;
@@ -15239,21 +2639,22 @@ static void yy_load_buffer_state  (void)
 		YY_CURRENT_BUFFER_LVALUE = (YY_BUFFER_STATE) 0;
 
 	if ( b->yy_is_our_buffer )
-		yyfree( (void *) b->yy_ch_buf  );
+		yyfree( (void *) b->yy_ch_buf , yyscanner );
 
-	yyfree( (void *) b  );
+	yyfree( (void *) b , yyscanner );
 }
 
 /* Initializes or reinitializes a buffer.
  * This function is sometimes called more than once on the same buffer,
  * such as during a yyrestart() or at EOF.
  */
-    static void yy_init_buffer  (YY_BUFFER_STATE  b, FILE * file )
+    static void yy_init_buffer  (YY_BUFFER_STATE  b, FILE * file , yyscan_t yyscanner)
 
 {
 	int oerrno = errno;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 
-	yy_flush_buffer( b );
+	yy_flush_buffer( b , yyscanner);
 
 	b->yy_input_file = file;
 	b->yy_fill_buffer = 1;
@@ -15276,9 +2677,10 @@ static void yy_load_buffer_state  (void)
  * @param b the buffer state to be flushed, usually @c YY_CURRENT_BUFFER.
  *
  */
-    void yy_flush_buffer (YY_BUFFER_STATE  b )
+    void yy_flush_buffer (YY_BUFFER_STATE  b , yyscan_t yyscanner)
 {
-    	if ( ! b )
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	if ( ! b )
 		return;
 
 	b->yy_n_chars = 0;
@@ -15296,7 +2698,7 @@ static void yy_load_buffer_state  (void)
 	b->yy_buffer_status = YY_BUFFER_NEW;
 
 	if ( b == YY_CURRENT_BUFFER )
-		yy_load_buffer_state(  );
+		yy_load_buffer_state( yyscanner );
 }
 
 /** Pushes the new state onto the stack. The new state becomes
@@ -15305,95 +2707,98 @@ static void yy_load_buffer_state  (void)
  *  @param new_buffer The new state.
  *
  */
-void yypush_buffer_state (YY_BUFFER_STATE new_buffer )
+void yypush_buffer_state (YY_BUFFER_STATE new_buffer , yyscan_t yyscanner)
 {
-    	if (new_buffer == NULL)
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	if (new_buffer == NULL)
 		return;
 
-	yyensure_buffer_stack();
+	yyensure_buffer_stack(yyscanner);
 
 	/* This block is copied from yy_switch_to_buffer. */
 	if ( YY_CURRENT_BUFFER )
 		{
 		/* Flush out information for old buffer. */
-		*(yy_c_buf_p) = (yy_hold_char);
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
+		*yyg->yy_c_buf_p = yyg->yy_hold_char;
+		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = yyg->yy_c_buf_p;
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
 		}
 
 	/* Only push if top exists. Otherwise, replace top. */
 	if (YY_CURRENT_BUFFER)
-		(yy_buffer_stack_top)++;
+		yyg->yy_buffer_stack_top++;
 	YY_CURRENT_BUFFER_LVALUE = new_buffer;
 
 	/* copied from yy_switch_to_buffer. */
-	yy_load_buffer_state(  );
-	(yy_did_buffer_switch_on_eof) = 1;
+	yy_load_buffer_state( yyscanner );
+	yyg->yy_did_buffer_switch_on_eof = 1;
 }
 
 /** Removes and deletes the top of the stack, if present.
  *  The next element becomes the new top.
  *
  */
-void yypop_buffer_state (void)
+void yypop_buffer_state (yyscan_t yyscanner)
 {
-    	if (!YY_CURRENT_BUFFER)
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	if (!YY_CURRENT_BUFFER)
 		return;
 
-	yy_delete_buffer(YY_CURRENT_BUFFER );
+	yy_delete_buffer(YY_CURRENT_BUFFER , yyscanner);
 	YY_CURRENT_BUFFER_LVALUE = NULL;
-	if ((yy_buffer_stack_top) > 0)
-		--(yy_buffer_stack_top);
+	if (yyg->yy_buffer_stack_top > 0)
+		--yyg->yy_buffer_stack_top;
 
 	if (YY_CURRENT_BUFFER) {
-		yy_load_buffer_state(  );
-		(yy_did_buffer_switch_on_eof) = 1;
+		yy_load_buffer_state( yyscanner );
+		yyg->yy_did_buffer_switch_on_eof = 1;
 	}
 }
 
 /* Allocates the stack if it does not exist.
  *  Guarantees space for at least one push.
  */
-static void yyensure_buffer_stack (void)
+static void yyensure_buffer_stack (yyscan_t yyscanner)
 {
 	yy_size_t num_to_alloc;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 
-	if (!(yy_buffer_stack)) {
+	if (!yyg->yy_buffer_stack) {
 
 		/* First allocation is just for 2 elements, since we don't know if this
 		 * scanner will even need a stack. We use 2 instead of 1 to avoid an
 		 * immediate realloc on the next call.
          */
       num_to_alloc = 1; /* After all that talk, this was set to 1 anyways... */
-		(yy_buffer_stack) = (struct yy_buffer_state**)yyalloc
+		yyg->yy_buffer_stack = (struct yy_buffer_state**)yyalloc
 								(num_to_alloc * sizeof(struct yy_buffer_state*)
-								);
-		if ( ! (yy_buffer_stack) )
+								, yyscanner);
+		if ( ! yyg->yy_buffer_stack )
 			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
 
-		memset((yy_buffer_stack), 0, num_to_alloc * sizeof(struct yy_buffer_state*));
+		memset(yyg->yy_buffer_stack, 0, num_to_alloc * sizeof(struct yy_buffer_state*));
 
-		(yy_buffer_stack_max) = num_to_alloc;
-		(yy_buffer_stack_top) = 0;
+		yyg->yy_buffer_stack_max = num_to_alloc;
+		yyg->yy_buffer_stack_top = 0;
 		return;
 	}
 
-	if ((yy_buffer_stack_top) >= ((yy_buffer_stack_max)) - 1){
+	if (yyg->yy_buffer_stack_top >= (yyg->yy_buffer_stack_max) - 1){
 
 		/* Increase the buffer to prepare for a possible push. */
 		yy_size_t grow_size = 8 /* arbitrary grow size */;
 
-		num_to_alloc = (yy_buffer_stack_max) + grow_size;
-		(yy_buffer_stack) = (struct yy_buffer_state**)yyrealloc
-								((yy_buffer_stack),
+		num_to_alloc = yyg->yy_buffer_stack_max + grow_size;
+		yyg->yy_buffer_stack = (struct yy_buffer_state**)yyrealloc
+								(yyg->yy_buffer_stack,
 								num_to_alloc * sizeof(struct yy_buffer_state*)
-								);
-		if ( ! (yy_buffer_stack) )
+								, yyscanner);
+		if ( ! yyg->yy_buffer_stack )
 			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
 
 		/* zero only the new slots.*/
-		memset((yy_buffer_stack) + (yy_buffer_stack_max), 0, grow_size * sizeof(struct yy_buffer_state*));
-		(yy_buffer_stack_max) = num_to_alloc;
+		memset(yyg->yy_buffer_stack + yyg->yy_buffer_stack_max, 0, grow_size * sizeof(struct yy_buffer_state*));
+		yyg->yy_buffer_stack_max = num_to_alloc;
 	}
 }
 
@@ -15403,7 +2808,7 @@ static void yyensure_buffer_stack (void)
  *
  * @return the newly allocated buffer state object.
  */
-YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size )
+YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size , yyscan_t yyscanner)
 {
 	YY_BUFFER_STATE b;
 
@@ -15413,7 +2818,7 @@ YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size )
 		/* They forgot to leave room for the EOB's. */
 		return NULL;
 
-	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state )  );
+	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state ) , yyscanner );
 	if ( ! b )
 		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_buffer()" );
 
@@ -15427,7 +2832,7 @@ YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size )
 	b->yy_fill_buffer = 0;
 	b->yy_buffer_status = YY_BUFFER_NEW;
 
-	yy_switch_to_buffer( b  );
+	yy_switch_to_buffer( b , yyscanner );
 
 	return b;
 }
@@ -15440,10 +2845,10 @@ YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size )
  * @note If you want to scan bytes that may contain NUL values, then use
  *       yy_scan_bytes() instead.
  */
-YY_BUFFER_STATE yy_scan_string (const char * yystr )
+YY_BUFFER_STATE yy_scan_string (const char * yystr , yyscan_t yyscanner)
 {
 
-	return yy_scan_bytes( yystr, (int) strlen(yystr) );
+	return yy_scan_bytes( yystr, (int) strlen(yystr) , yyscanner);
 }
 
 /** Setup the input buffer state to scan the given bytes. The next call to yylex() will
@@ -15453,7 +2858,7 @@ YY_BUFFER_STATE yy_scan_string (const char * yystr )
  *
  * @return the newly allocated buffer state object.
  */
-YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, int  _yybytes_len )
+YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, int  _yybytes_len , yyscan_t yyscanner)
 {
 	YY_BUFFER_STATE b;
 	char *buf;
@@ -15462,7 +2867,7 @@ YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, int  _yybytes_len )
 
 	/* Get memory for full buffer, including space for trailing EOB's. */
 	n = (yy_size_t) (_yybytes_len + 2);
-	buf = (char *) yyalloc( n  );
+	buf = (char *) yyalloc( n , yyscanner );
 	if ( ! buf )
 		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_bytes()" );
 
@@ -15471,7 +2876,7 @@ YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, int  _yybytes_len )
 
 	buf[_yybytes_len] = buf[_yybytes_len+1] = YY_END_OF_BUFFER_CHAR;
 
-	b = yy_scan_buffer( buf, n );
+	b = yy_scan_buffer( buf, n , yyscanner);
 	if ( ! b )
 		YY_FATAL_ERROR( "bad buffer in yy_scan_bytes()" );
 
@@ -15487,9 +2892,11 @@ YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, int  _yybytes_len )
 #define YY_EXIT_FAILURE 2
 #endif
 
-static void yynoreturn yy_fatal_error (const char* msg )
+static void yynoreturn yy_fatal_error (const char* msg , yyscan_t yyscanner)
 {
-			fprintf( stderr, "%s\n", msg );
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+	fprintf( stderr, "%s\n", msg );
 	exit( YY_EXIT_FAILURE );
 }
 
@@ -15502,106 +2909,249 @@ static void yynoreturn yy_fatal_error (const char* msg )
 		/* Undo effects of setting up yytext. */ \
         int yyless_macro_arg = (n); \
         YY_LESS_LINENO(yyless_macro_arg);\
-		yytext[yyleng] = (yy_hold_char); \
-		(yy_c_buf_p) = yytext + yyless_macro_arg; \
-		(yy_hold_char) = *(yy_c_buf_p); \
-		*(yy_c_buf_p) = '\0'; \
+		yytext[yyleng] = yyg->yy_hold_char; \
+		yyg->yy_c_buf_p = yytext + yyless_macro_arg; \
+		yyg->yy_hold_char = *yyg->yy_c_buf_p; \
+		*yyg->yy_c_buf_p = '\0'; \
 		yyleng = yyless_macro_arg; \
 		} \
 	while ( 0 )
 
 /* Accessor  methods (get/set functions) to struct members. */
 
+/** Get the user-defined data for this scanner.
+ * @param yyscanner The scanner object.
+ */
+YY_EXTRA_TYPE yyget_extra  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyextra;
+}
+
 /** Get the current line number.
- *
+ * @param yyscanner The scanner object.
  */
-int yyget_lineno  (void)
+int yyget_lineno  (yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 
+        if (! YY_CURRENT_BUFFER)
+            return 0;
+    
     return yylineno;
 }
 
+/** Get the current column number.
+ * @param yyscanner The scanner object.
+ */
+int yyget_column  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        if (! YY_CURRENT_BUFFER)
+            return 0;
+    
+    return yycolumn;
+}
+
 /** Get the input stream.
- *
+ * @param yyscanner The scanner object.
  */
-FILE *yyget_in  (void)
+FILE *yyget_in  (yyscan_t yyscanner)
 {
-        return yyin;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyin;
 }
 
 /** Get the output stream.
- *
+ * @param yyscanner The scanner object.
  */
-FILE *yyget_out  (void)
+FILE *yyget_out  (yyscan_t yyscanner)
 {
-        return yyout;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyout;
 }
 
 /** Get the length of the current token.
- *
+ * @param yyscanner The scanner object.
  */
-int yyget_leng  (void)
+int yyget_leng  (yyscan_t yyscanner)
 {
-        return yyleng;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyleng;
 }
 
 /** Get the current token.
- *
+ * @param yyscanner The scanner object.
  */
 
-char *yyget_text  (void)
+char *yyget_text  (yyscan_t yyscanner)
 {
-        return yytext;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yytext;
+}
+
+/** Set the user-defined data. This data is never touched by the scanner.
+ * @param user_defined The data to be associated with this scanner.
+ * @param yyscanner The scanner object.
+ */
+void yyset_extra (YY_EXTRA_TYPE  user_defined , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yyextra = user_defined ;
 }
 
 /** Set the current line number.
  * @param _line_number line number
- *
+ * @param yyscanner The scanner object.
  */
-void yyset_lineno (int  _line_number )
+void yyset_lineno (int  _line_number , yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 
+        /* lineno is only valid if an input buffer exists. */
+        if (! YY_CURRENT_BUFFER )
+           YY_FATAL_ERROR( "yyset_lineno called with no buffer" );
+    
     yylineno = _line_number;
 }
 
+/** Set the current column.
+ * @param _column_no column number
+ * @param yyscanner The scanner object.
+ */
+void yyset_column (int  _column_no , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        /* column is only valid if an input buffer exists. */
+        if (! YY_CURRENT_BUFFER )
+           YY_FATAL_ERROR( "yyset_column called with no buffer" );
+    
+    yycolumn = _column_no;
+}
+
 /** Set the input stream. This does not discard the current
  * input buffer.
  * @param _in_str A readable stream.
- *
+ * @param yyscanner The scanner object.
  * @see yy_switch_to_buffer
  */
-void yyset_in (FILE *  _in_str )
+void yyset_in (FILE *  _in_str , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yyin = _in_str ;
+}
+
+void yyset_out (FILE *  _out_str , yyscan_t yyscanner)
 {
-        yyin = _in_str ;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yyout = _out_str ;
 }
 
-void yyset_out (FILE *  _out_str )
+int yyget_debug  (yyscan_t yyscanner)
 {
-        yyout = _out_str ;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yy_flex_debug;
 }
 
-int yyget_debug  (void)
+void yyset_debug (int  _bdebug , yyscan_t yyscanner)
 {
-        return yy_flex_debug;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yy_flex_debug = _bdebug ;
 }
 
-void yyset_debug (int  _bdebug )
+/* Accessor methods for yylval and yylloc */
+
+YYSTYPE * yyget_lval  (yyscan_t yyscanner)
 {
-        yy_flex_debug = _bdebug ;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yylval;
 }
 
-static int yy_init_globals (void)
+void yyset_lval (YYSTYPE *  yylval_param , yyscan_t yyscanner)
 {
-        /* Initialization is the same as for the non-reentrant scanner.
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yylval = yylval_param;
+}
+
+/* User-visible API */
+
+/* yylex_init is special because it creates the scanner itself, so it is
+ * the ONLY reentrant function that doesn't take the scanner as the last argument.
+ * That's why we explicitly handle the declaration, instead of using our macros.
+ */
+int yylex_init(yyscan_t* ptr_yy_globals)
+{
+    if (ptr_yy_globals == NULL){
+        errno = EINVAL;
+        return 1;
+    }
+
+    *ptr_yy_globals = (yyscan_t) yyalloc ( sizeof( struct yyguts_t ), NULL );
+
+    if (*ptr_yy_globals == NULL){
+        errno = ENOMEM;
+        return 1;
+    }
+
+    /* By setting to 0xAA, we expose bugs in yy_init_globals. Leave at 0x00 for releases. */
+    memset(*ptr_yy_globals,0x00,sizeof(struct yyguts_t));
+
+    return yy_init_globals ( *ptr_yy_globals );
+}
+
+/* yylex_init_extra has the same functionality as yylex_init, but follows the
+ * convention of taking the scanner as the last argument. Note however, that
+ * this is a *pointer* to a scanner, as it will be allocated by this call (and
+ * is the reason, too, why this function also must handle its own declaration).
+ * The user defined value in the first argument will be available to yyalloc in
+ * the yyextra field.
+ */
+int yylex_init_extra( YY_EXTRA_TYPE yy_user_defined, yyscan_t* ptr_yy_globals )
+{
+    struct yyguts_t dummy_yyguts;
+
+    yyset_extra (yy_user_defined, &dummy_yyguts);
+
+    if (ptr_yy_globals == NULL){
+        errno = EINVAL;
+        return 1;
+    }
+
+    *ptr_yy_globals = (yyscan_t) yyalloc ( sizeof( struct yyguts_t ), &dummy_yyguts );
+
+    if (*ptr_yy_globals == NULL){
+        errno = ENOMEM;
+        return 1;
+    }
+
+    /* By setting to 0xAA, we expose bugs in
+    yy_init_globals. Leave at 0x00 for releases. */
+    memset(*ptr_yy_globals,0x00,sizeof(struct yyguts_t));
+
+    yyset_extra (yy_user_defined, *ptr_yy_globals);
+
+    return yy_init_globals ( *ptr_yy_globals );
+}
+
+static int yy_init_globals (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    /* Initialization is the same as for the non-reentrant scanner.
      * This function is called from yylex_destroy(), so don't allocate here.
      */
 
-    (yy_buffer_stack) = NULL;
-    (yy_buffer_stack_top) = 0;
-    (yy_buffer_stack_max) = 0;
-    (yy_c_buf_p) = NULL;
-    (yy_init) = 0;
-    (yy_start) = 0;
+    yyg->yy_buffer_stack = NULL;
+    yyg->yy_buffer_stack_top = 0;
+    yyg->yy_buffer_stack_max = 0;
+    yyg->yy_c_buf_p = NULL;
+    yyg->yy_init = 0;
+    yyg->yy_start = 0;
+
+    yyg->yy_start_stack_ptr = 0;
+    yyg->yy_start_stack_depth = 0;
+    yyg->yy_start_stack =  NULL;
 
 /* Defined in main.c */
 #ifdef YY_STDINIT
@@ -15619,24 +3169,32 @@ static int yy_init_globals (void)
 }
 
 /* yylex_destroy is for both reentrant and non-reentrant scanners. */
-int yylex_destroy  (void)
+int yylex_destroy  (yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 
     /* Pop the buffer stack, destroying each element. */
 	while(YY_CURRENT_BUFFER){
-		yy_delete_buffer( YY_CURRENT_BUFFER  );
+		yy_delete_buffer( YY_CURRENT_BUFFER , yyscanner );
 		YY_CURRENT_BUFFER_LVALUE = NULL;
-		yypop_buffer_state();
+		yypop_buffer_state(yyscanner);
 	}
 
 	/* Destroy the stack itself. */
-	yyfree((yy_buffer_stack) );
-	(yy_buffer_stack) = NULL;
+	yyfree(yyg->yy_buffer_stack , yyscanner);
+	yyg->yy_buffer_stack = NULL;
+
+    /* Destroy the start condition stack. */
+        yyfree( yyg->yy_start_stack , yyscanner );
+        yyg->yy_start_stack = NULL;
 
     /* Reset the globals. This is important in a non-reentrant scanner so the next time
      * yylex() is called, initialization will occur. */
-    yy_init_globals( );
+    yy_init_globals( yyscanner);
 
+    /* Destroy the main struct (reentrant only). */
+    yyfree ( yyscanner , yyscanner );
+    yyscanner = NULL;
     return 0;
 }
 
@@ -15645,8 +3203,10 @@ int yylex_destroy  (void)
  */
 
 #ifndef yytext_ptr
-static void yy_flex_strncpy (char* s1, const char * s2, int n )
+static void yy_flex_strncpy (char* s1, const char * s2, int n , yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
 
 	int i;
 	for ( i = 0; i < n; ++i )
@@ -15655,7 +3215,7 @@ static void yy_flex_strncpy (char* s1, const char * s2, int n )
 #endif
 
 #ifdef YY_NEED_STRLEN
-static int yy_flex_strlen (const char * s )
+static int yy_flex_strlen (const char * s , yyscan_t yyscanner)
 {
 	int n;
 	for ( n = 0; s[n]; ++n )
@@ -15665,13 +3225,17 @@ static int yy_flex_strlen (const char * s )
 }
 #endif
 
-void *yyalloc (yy_size_t  size )
+void *yyalloc (yy_size_t  size , yyscan_t yyscanner)
 {
-			return malloc(size);
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+	return malloc(size);
 }
 
-void *yyrealloc  (void * ptr, yy_size_t  size )
+void *yyrealloc  (void * ptr, yy_size_t  size , yyscan_t yyscanner)
 {
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
 
 	/* The cast to (char *) in the following accommodates both
 	 * implementations that use char* generic pointers, and those
@@ -15683,15 +3247,121 @@ void *yyrealloc  (void * ptr, yy_size_t  size )
 	return realloc(ptr, size);
 }
 
-void yyfree (void * ptr )
+void yyfree (void * ptr , yyscan_t yyscanner)
 {
-			free( (char *) ptr );	/* see yyrealloc() for (char *) cast */
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+	free( (char *) ptr );	/* see yyrealloc() for (char *) cast */
 }
 
 #define YYTABLES_NAME "yytables"
 
-#line 114 "src/Cooklang.l"
+#line 152 "src/Cooklang.l"
+
+
+
+
+// true for the bytes a plain run is made of - printable ASCII other than the
+// characters that start or break up Cooklang syntax, and ASCII white space
+static int isPlainByte( unsigned char c ){
+  switch( c ){
+    case '[': case '-': case '~': case '@':
+    case '#': case '{': case '}': case '%':
+      return 0;
+    case '\t':
+      return 1;
+    default:
+      return c >= 0x20 && c < 0x7f;
+  }
+}
+
+// finds the first byte at or after start that is not plain, or limit
+static const char * findPlainEnd( const char * start, const char * limit ){
+  const char * current = start;
+
+#ifdef __SSE2__
+  // check 16 bytes at a time, the signed compare also catches every byte
+  // above 0x7f
+  const __m128i space = _mm_set1_epi8(0x20);
+  const __m128i tab = _mm_set1_epi8('\t');
+  const __m128i del = _mm_set1_epi8(0x7f);
+  const char sigils[] = { '[', '-', '~', '@', '#', '{', '}', '%' };
+
+  while( limit - current >= 16 ){
+    __m128i bytes = _mm_loadu_si128((const __m128i *)current);
+
+    __m128i stop = _mm_or_si128(_mm_cmplt_epi8(bytes, space),
+                                _mm_cmpeq_epi8(bytes, del));
+    stop = _mm_andnot_si128(_mm_cmpeq_epi8(bytes, tab), stop);
+
+    for( int i = 0; i < 8; i++ ){
+      stop = _mm_or_si128(stop,
+                          _mm_cmpeq_epi8(bytes, _mm_set1_epi8(sigils[i])));
+    }
+
+    int mask = _mm_movemask_epi8(stop);
+    if( mask != 0 ){
+      return current + __builtin_ctz(mask);
+    }
+
+    current += 16;
+  }
+#endif
+
+  while( current < limit && isPlainByte((unsigned char)*current) ){
+    current++;
+  }
+
+  return current;
+}
+
+// matches the WORD or MULTIWORD at start if it is all plain ASCII and ends
+// at something that cannot carry it on, returns its length and sets token,
+// or returns 0 to leave the input to the DFA
+static size_t matchPlainRun( const char * start, const char * limit, int * token ){
+  // only a letter is sure to start a word and nothing else
+  if( !((*start >= 'a' && *start <= 'z') || (*start >= 'A' && *start <= 'Z')) ){
+    return 0;
+  }
+
+  const char * end = findPlainEnd(start, limit);
+
+  // anything but a sigil or a new line after the run could still be part of
+  // the word, or the run hit the end of the buffer
+  if( end == limit || *end == '\0' || strchr("~@#{}%\n\r", *end) == NULL ){
+    return 0;
+  }
+
+  // the first word runs up to the first white space
+  const char * wordEnd = start;
+  while( wordEnd < end && *wordEnd != ' ' && *wordEnd != '\t' ){
+    wordEnd++;
+  }
 
+  // with no white space WORD and MULTIWORD tie, and WORD comes first
+  if( wordEnd == end ){
+    *token = WORD;
+    return end - start;
+  }
+
+  // a MULTIWORD needs at least two word characters, so a lone letter
+  // followed only by white space is a WORD on its own
+  if( wordEnd - start == 1 ){
+    const char * next = wordEnd;
+    while( next < end && (*next == ' ' || *next == '\t') ){
+      next++;
+    }
+
+    if( next == end ){
+      *token = WORD;
+      return 1;
+    }
+  }
+
+  // otherwise the whole run, trailing white space included, is a MULTIWORD
+  *token = MULTIWORD;
+  return end - start;
+}
 
 
 
@@ -15703,9 +3373,7 @@ char * testFile( char * fileName ){
 
   if( fileName != NULL ){
     file = fopen(fileName, "r");
-    if( file != NULL ){
-      yyin = file;
-    } else {
+    if( file == NULL ){
       return "NULL";
     }
   } else {
@@ -15717,17 +3385,14 @@ char * testFile( char * fileName ){
   FILE * outputFile = fopen("test_output.txt", "w");
 
   if(outputFile != NULL ){
-    // setup the recipe
-    Recipe * finalRecipe = createRecipe();
-    // create the first step and insert into back of list
-    Step * currentStep = createStep();
-    insertBack(finalRecipe->stepList, currentStep);
-
     // run the parser on input file
-    yyparse(finalRecipe);
+    Recipe * finalRecipe = parseRecipeStream(file);
+    if( finalRecipe == NULL ){
+      return "NULL";
+    }
 
     // get steps
-    char * stepListString = toString(finalRecipe->stepList);
+    char * stepListString = vectorToString(&finalRecipe->steps);
 
     // get metadata
     char * metaDataString = toString(finalRecipe->metaData);
@@ -15741,9 +3406,7 @@ char * testFile( char * fileName ){
 
 
     // free everything
-    freeList(finalRecipe->metaData);
-    freeList(finalRecipe->stepList);
-    free(finalRecipe);
+    deleteRecipe(finalRecipe);
 
     return returnString;
   } else {
@@ -15762,24 +3425,18 @@ int runFile( char * fileName ){
 
   if( fileName != NULL ){
     file = fopen(fileName, "r");
-    if( file != NULL ){
-      yyin = file;
-    } else {
+    if( file == NULL ){
       return 1;
     }
   } else {
     return 1;
   }
 
-  // setup the recipe
-  Recipe * finalRecipe = createRecipe();
-
-  // create the first step
-  Step * currentStep = createStep();
-
-  insertBack(finalRecipe->stepList, currentStep);
-
-  yyparse(finalRecipe);
+  Recipe * finalRecipe = parseRecipeStream(file);
+  if( finalRecipe == NULL ){
+    fclose(file);
+    return 1;
+  }
 
   char * metaDataString = toString(finalRecipe->metaData);
 
@@ -15789,16 +3446,14 @@ int runFile( char * fileName ){
 
 
   // printf out the step steps
-  char * stepListString = toString(finalRecipe->stepList);
+  char * stepListString = vectorToString(&finalRecipe->steps);
 
   printf("%s\n", stepListString);
 
   free(stepListString);
 
 
-  freeList(finalRecipe->metaData);
-  freeList(finalRecipe->stepList);
-  free(finalRecipe);
+  deleteRecipe(finalRecipe);
 
   fclose(file);
 
@@ -15821,20 +3476,16 @@ int main( int argc, char ** argv ){
 
   if( argc > 0 ){
     file = fopen(argv[0], "r");
-    yyin = file;
-  } else {
-    yyin  = stdin;
   }
 
-  // setup the recipe
-  Recipe * finalRecipe = createRecipe();
-
-  // create the first step
-  Step * currentStep = createStep();
-
-  insertBack(finalRecipe->stepList, currentStep);
-
-  yyparse(finalRecipe);
+  // read from stdin when there is no file to read
+  Recipe * finalRecipe = parseRecipeStream(file != NULL ? file : stdin);
+  if( finalRecipe == NULL ){
+    if( file != NULL ){
+      fclose(file);
+    }
+    return 1;
+  }
 
   char * metaDataString = toString(finalRecipe->metaData);
 
@@ -15844,16 +3495,14 @@ int main( int argc, char ** argv ){
 
 
   // printf out the step steps
-  char * stepListString = toString(finalRecipe->stepList);
+  char * stepListString = vectorToString(&finalRecipe->steps);
 
   printf("%s\n", stepListString);
 
   free(stepListString);
 
 
-  freeList(finalRecipe->metaData);
-  freeList(finalRecipe->stepList);
-  free(finalRecipe);
+  deleteRecipe(finalRecipe);
 
   if( file != NULL ){
     fclose(file);
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""Writes src/CharClassTable.h, the two level table behind charClass().
+
+The classes are taken from the Unicode character database that ships with
+Python, so rerun this with a newer Python to pick up a newer Unicode version:
+
+  space       - tab and the space separators (Zs)
+  new line    - line feed, carriage return, next line and the line and
+                paragraph separators (Zl, Zp)
+  punctuation - every punctuation category (P*) except the marks Cooklang
+                uses for its own syntax
+
+usage: python3 scripts/CharClassTable.py > src/CharClassTable.h
+"""
+
+import unicodedata
+
+# must match the CharClass enum in include/CharClassLib.h
+OTHER, SPACE, NEW_LINE, PUNCTUATION = range(4)
+
+# code points per block, a block is the unit the first level points at
+BLOCK_SHIFT = 6
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+
+# classes are two bits each, four to a byte
+PER_BYTE = 4
+
+COOKLANG_MARKS = "#%:@{}"
+
+
+def char_class(codepoint):
+    category = unicodedata.category(chr(codepoint))
+
+    if codepoint == 0x09 or category == "Zs":
+        return SPACE
+
+    if codepoint in (0x0A, 0x0D, 0x85) or category in ("Zl", "Zp"):
+        return NEW_LINE
+
+    if category.startswith("P") and chr(codepoint) not in COOKLANG_MARKS:
+        return PUNCTUATION
+
+    return OTHER
+
+
+def main():
+    classes = [char_class(codepoint) for codepoint in range(0x110000)]
+
+    # everything past the last classified code point is plain text
+    limit = max(codepoint for codepoint, value in enumerate(classes) if value)
+    limit = (limit // BLOCK_SIZE + 1) * BLOCK_SIZE
+
+    blocks = []
+    block_index = {}
+    first_level = []
+
+    for start in range(0, limit, BLOCK_SIZE):
+        packed = []
+        for offset in range(0, BLOCK_SIZE, PER_BYTE):
+            byte = 0
+            for shift in range(PER_BYTE):
+                byte |= classes[start + offset + shift] << (shift * 2)
+            packed.append(byte)
+
+        packed = tuple(packed)
+        if packed not in block_index:
+            block_index[packed] = len(blocks)
+            blocks.append(packed)
+
+        first_level.append(block_index[packed])
+
+    assert len(blocks) <= 256, "block numbers must fit in a byte"
+
+    print("// generated by scripts/CharClassTable.py from the Unicode %s "
+          "character" % unicodedata.unidata_version)
+    print("// database, do not edit")
+    print()
+    print("#define CHAR_CLASS_LIMIT 0x%X" % limit)
+    print("#define CHAR_CLASS_BLOCK_SHIFT %d" % BLOCK_SHIFT)
+    print()
+    print("// the block of each run of %d code points" % BLOCK_SIZE)
+    print("static const unsigned char charClassBlocks[%d] = {"
+          % len(first_level))
+    for row in range(0, len(first_level), 12):
+        values = first_level[row:row + 12]
+        print("    " + ", ".join("%3d" % value for value in values) + ",")
+    print("};")
+    print()
+    print("// the class of every code point in a block, two bits each with the "
+          "lowest")
+    print("// code point in the lowest bits")
+    print("static const unsigned char charClassEntries[%d][%d] = {"
+          % (len(blocks), BLOCK_SIZE // PER_BYTE))
+    for block in blocks:
+        half = len(block) // 2
+        low = ", ".join("0x%02X" % value for value in block[:half])
+        high = ", ".join("0x%02X" % value for value in block[half:])
+        print("    {" + low + ",")
+        print("     " + high + "},")
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
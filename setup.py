@@ -11,9 +11,16 @@ setup(
                 "src/CooklangParser.c",
                 "parserFiles/Cooklang.tab.c",
                 "src/LinkedListLib.c",
+                "src/ArenaLib.c",
+                "src/VectorLib.c",
+                "src/StringBuilderLib.c",
+                "src/CharClassLib.c",
                 "src/CooklangRecipe.c",
                 "src/ShoppingListParser.c",
+                "src/ShoppingPlan.c",
             ],
+            extra_compile_args=["-pthread"],
+            extra_link_args=["-pthread"],
         )
     ],
 )
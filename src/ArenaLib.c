@@ -0,0 +1,168 @@
+#include "../include/ArenaLib.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// every allocation is aligned to this, enough for any of the recipe structs
+#define ARENA_ALIGNMENT 16
+
+// blocks stop doubling in size once they reach this
+#define ARENA_MAX_BLOCK_SIZE (1024 * 1024)
+
+// size of the block header, rounded up so block data starts aligned
+#define ARENA_HEADER_SIZE \
+  ((sizeof(ArenaBlock) + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1))
+
+static ArenaBlock* createBlock(size_t size) {
+  ArenaBlock* block = malloc(ARENA_HEADER_SIZE + size);
+
+  if (block == NULL) {
+    printf("error, malloc failed - createBlock\n");
+    return NULL;
+  }
+
+  block->next = NULL;
+  block->size = size;
+  block->used = 0;
+
+  return block;
+}
+
+Arena* createArena(size_t initialSize) {
+  Arena* arena = malloc(sizeof(Arena));
+
+  if (arena == NULL) {
+    printf("error, malloc failed - createArena\n");
+    return NULL;
+  }
+
+  if (initialSize < ARENA_ALIGNMENT) {
+    initialSize = ARENA_ALIGNMENT;
+  }
+
+  arena->blockSize = initialSize;
+  arena->current = createBlock(initialSize);
+
+  if (arena->current == NULL) {
+    free(arena);
+    return NULL;
+  }
+
+  return arena;
+}
+
+void deleteArena(Arena* arena) {
+  ArenaBlock* block;
+  ArenaBlock* next;
+
+  if (arena == NULL) {
+    return;
+  }
+
+  block = arena->current;
+
+  while (block != NULL) {
+    next = block->next;
+    free(block);
+    block = next;
+  }
+
+  free(arena);
+}
+
+void* arenaAlloc(Arena* arena, size_t size) {
+  ArenaBlock* block = arena->current;
+  size_t blockSize;
+
+  // round the request up so the next allocation stays aligned
+  size = (size + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+
+  if (block->size - block->used < size) {
+    // large requests get a block of their own behind the current one, so the
+    // space left in the current block is still used by later allocations
+    if (size > arena->blockSize / 2) {
+      block = createBlock(size);
+      if (block == NULL) {
+        return NULL;
+      }
+
+      block->next = arena->current->next;
+      arena->current->next = block;
+      block->used = size;
+
+      return (char*)block + ARENA_HEADER_SIZE;
+    }
+
+    // grow the blocks geometrically so a recipe needs only a few of them
+    if (arena->blockSize < ARENA_MAX_BLOCK_SIZE) {
+      arena->blockSize *= 2;
+    }
+    blockSize = arena->blockSize;
+
+    block = createBlock(blockSize);
+    if (block == NULL) {
+      return NULL;
+    }
+
+    block->next = arena->current;
+    arena->current = block;
+  }
+
+  void* result = (char*)block + ARENA_HEADER_SIZE + block->used;
+  block->used += size;
+
+  return result;
+}
+
+char* arenaStrndup(Arena* arena, const char* string, size_t length) {
+  if (string == NULL) {
+    return NULL;
+  }
+
+  char* copy = arenaAlloc(arena, length + 1);
+
+  if (copy == NULL) {
+    return NULL;
+  }
+
+  memcpy(copy, string, length);
+  copy[length] = '\0';
+
+  return copy;
+}
+
+char* arenaStrdup(Arena* arena, const char* string) {
+  if (string == NULL) {
+    return NULL;
+  }
+
+  return arenaStrndup(arena, string, strlen(string));
+}
+
+char* arenaSprintf(Arena* arena, const char* format, ...) {
+  va_list args;
+  int length;
+
+  // measure first, then format straight into the arena
+  va_start(args, format);
+  length = vsnprintf(NULL, 0, format, args);
+  va_end(args);
+
+  if (length < 0) {
+    return NULL;
+  }
+
+  char* result = arenaAlloc(arena, (size_t)length + 1);
+
+  if (result == NULL) {
+    return NULL;
+  }
+
+  va_start(args, format);
+  vsnprintf(result, (size_t)length + 1, format, args);
+  va_end(args);
+
+  return result;
+}
@@ -0,0 +1,153 @@
+#include "../include/CharClassLib.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "CharClassTable.h"
+
+// code points in a block, and the classes packed into each table byte
+#define CHAR_CLASS_BLOCK_MASK ((1 << CHAR_CLASS_BLOCK_SHIFT) - 1)
+#define CHAR_CLASS_PER_BYTE 4
+
+CharClass charClass(uint32_t codepoint) {
+  if (codepoint >= CHAR_CLASS_LIMIT) {
+    return CHAR_CLASS_OTHER;
+  }
+
+  // the first level finds the block, which is shared by every run of code
+  // points with the same classes, the second holds two bits per code point
+  unsigned char block = charClassBlocks[codepoint >> CHAR_CLASS_BLOCK_SHIFT];
+  uint32_t offset = codepoint & CHAR_CLASS_BLOCK_MASK;
+  unsigned char entry = charClassEntries[block][offset / CHAR_CLASS_PER_BYTE];
+
+  return (CharClass)((entry >> (offset % CHAR_CLASS_PER_BYTE * 2)) & 3);
+}
+
+size_t decodeCharacter(const char* text, const char* limit,
+                       uint32_t* codepoint) {
+  const unsigned char* bytes = (const unsigned char*)text;
+
+  if (text >= limit) {
+    return 0;
+  }
+
+  if (bytes[0] < 0x80) {
+    *codepoint = bytes[0];
+    return 1;
+  }
+
+  // the lead byte gives the length, and the range of the second byte rules
+  // out overlong encodings, surrogates and anything past U+10FFFF
+  size_t length = 0;
+  uint32_t value = 0;
+  unsigned char low = 0x80;
+  unsigned char high = 0xbf;
+
+  if (bytes[0] >= 0xc2 && bytes[0] <= 0xdf) {
+    length = 2;
+    value = bytes[0] & 0x1f;
+  } else if (bytes[0] >= 0xe0 && bytes[0] <= 0xef) {
+    length = 3;
+    value = bytes[0] & 0x0f;
+    low = bytes[0] == 0xe0 ? 0xa0 : low;
+    high = bytes[0] == 0xed ? 0x9f : high;
+  } else if (bytes[0] >= 0xf0 && bytes[0] <= 0xf4) {
+    length = 4;
+    value = bytes[0] & 0x07;
+    low = bytes[0] == 0xf0 ? 0x90 : low;
+    high = bytes[0] == 0xf4 ? 0x8f : high;
+  } else {
+    return 0;
+  }
+
+  if ((size_t)(limit - text) < length) {
+    return 0;
+  }
+
+  for (size_t i = 1; i < length; i++) {
+    if (bytes[i] < low || bytes[i] > high) {
+      return 0;
+    }
+
+    value = (value << 6) | (bytes[i] & 0x3f);
+
+    // only the second byte has a narrower range
+    low = 0x80;
+    high = 0xbf;
+  }
+
+  *codepoint = value;
+  return length;
+}
+
+// the number of ASCII bytes at the start of text
+static size_t asciiRunLength(const unsigned char* text, size_t size) {
+  size_t length = 0;
+
+#ifdef __SSE2__
+  // the top bit of each byte marks everything that is not ASCII
+  while (size - length >= 16) {
+    __m128i bytes = _mm_loadu_si128((const __m128i*)(text + length));
+    int mask = _mm_movemask_epi8(bytes);
+
+    if (mask != 0) {
+      return length + __builtin_ctz(mask);
+    }
+
+    length += 16;
+  }
+#endif
+
+  while (length < size && text[length] < 0x80) {
+    length++;
+  }
+
+  return length;
+}
+
+char* classifySource(char* source, size_t size) {
+  const unsigned char* text = (const unsigned char*)source;
+  size_t position = asciiRunLength(text, size);
+
+  // most recipes are plain ASCII and the scanner can read them as they are
+  if (position == size) {
+    return source;
+  }
+
+  unsigned char* symbols = malloc(sizeof(char) * size);
+  if (symbols == NULL) {
+    printf("Error, malloc failed");
+    return NULL;
+  }
+
+  memcpy(symbols, text, position);
+
+  while (position < size) {
+    if (text[position] < 0x80) {
+      size_t length = asciiRunLength(text + position, size - position);
+      memcpy(symbols + position, text + position, length);
+      position += length;
+      continue;
+    }
+
+    uint32_t codepoint = 0;
+    size_t length =
+        decodeCharacter(source + position, source + size, &codepoint);
+
+    // a byte that does not start a valid character stands on its own
+    if (length == 0) {
+      symbols[position++] = CHAR_CLASS_SYMBOL(CHAR_CLASS_OTHER);
+      continue;
+    }
+
+    symbols[position] = CHAR_CLASS_SYMBOL(charClass(codepoint));
+    memset(symbols + position + 1, CHAR_CLASS_CONTINUATION, length - 1);
+    position += length;
+  }
+
+  return (char*)symbols;
+}
@@ -9,30 +9,39 @@
 
 #define YYDEBUG 1
 
-int yylex();
-
-
-int yyerror ( Recipe * recipe, const char * s);
-
-extern void yyrestart( FILE * input_file );
-
+// a direction part that is not there at all, and one that is there but empty
+#define NO_SPAN ((Span){NULL, 0})
+#define EMPTY_SPAN ((Span){"", 0})
 
+%}
 
+%code requires {
+  // the scanner state, every parse gets its own so recipes can be parsed from many threads
+  #ifndef YY_TYPEDEF_YY_SCANNER_T
+  #define YY_TYPEDEF_YY_SCANNER_T
+  typedef void * yyscan_t;
+  #endif
+}
 
+%code {
+  int yylex ( YYSTYPE * yylval_param, yyscan_t scanner );
 
+  int yyerror ( yyscan_t scanner, Recipe * recipe, const char * s );
+}
 
-%}
+%define api.pure full
 
 %define parse.error verbose
 
 %expect 18
 
 
+%param {yyscan_t scanner}
 %parse-param {Recipe * recipe}
 
 
 %union{
-  char * string;
+  Span span;
   char character;
   double number;
 }
@@ -40,17 +49,20 @@ extern void yyrestart( FILE * input_file );
 %token WORD MULTIWORD UNIT NUMBER LCURL RCURL PUNC_CHAR NL TILDE HWORD ATWORD METADATA COMMENT WHTS
 
 %type <character> LCURL RCURL NL
-%type <string> WORD MULTIWORD UNIT HWORD ATWORD METADATA PUNC_CHAR WHTS
+%type <span> WORD MULTIWORD UNIT HWORD ATWORD METADATA PUNC_CHAR WHTS
 %type <number> NUMBER
 
-%type <string> text_item ingredient cookware timer amount
-%type <string> input line step direction
+%type <span> text_item amount
 
-%type <string> cookware_amount
+%type <span> cookware_amount
 
 
 %%
 
+// tokens are spans into the source, so text that sits next to each other is
+// joined without copying - only numbers, which get reformatted, are built in
+// the recipe's arena, and nothing is freed here
+
 input:
   %empty
   | input line
@@ -60,74 +72,44 @@ input:
 line:
     NL      {}
   | step NL {
-      // after a step has been finished by a new line, have to add the step to the steplist
-      // and make a new step to accept directions
-      Step * newStep = createStep();
-
-      insertBack(recipe->stepList, newStep);
-      free($1);
+      // after a step has been finished by a new line, make a new step at the
+      // back of the recipe to accept directions
+      addStep(recipe);
     }
   | METADATA NL {
       // add metadata to the recipe
       addMetaData(recipe, $1);
-      free($1);
     }
   ;
 
 
 step:
-    direction {
-        $$ = strdup($1);
-        free($1);
-      }
-  | step direction {
-      $$ = malloc(strlen($1) + strlen($2) + 5);
-      sprintf($$, "%s %s", $1, $2);
-      free($1);
-      free($2);
-    }
+    direction
+  | step direction
   | step WHTS {
-      $$ = malloc(strlen($1) + strlen($2) + 5);
-      sprintf($$, "%s %s", $1, $2);
-
-      addDirection(recipe, "text", $2, NULL);
-
-      free($1);
-      free($2);
+      addDirection(recipe, DIRECTION_TEXT, $2, NO_SPAN);
     }
   ;
 
 
 direction:
     text_item {
-      $$ = strdup($1);
-      addDirection(recipe, "text", $1, NULL);
-      free($1);
+      addDirection(recipe, DIRECTION_TEXT, $1, NO_SPAN);
     }
   | timer
   | cookware
   | ingredient
   | HWORD text_item   {
-      $$ = addTwoStrings($1, $2);
-      addDirection(recipe, "cookware", $1, NULL);
-      addDirection(recipe, "text", $2, NULL);
-      free($1);
-      free($2);
+      addDirection(recipe, DIRECTION_COOKWARE, $1, NO_SPAN);
+      addDirection(recipe, DIRECTION_TEXT, $2, NO_SPAN);
     }
   | ATWORD text_item  {
-      $$ = addTwoStrings($1, $2);
-      addDirection(recipe, "ingredient", $1, NULL);
-      addDirection(recipe, "text", $2, NULL);
-      free($1);
-      free($2);
+      addDirection(recipe, DIRECTION_INGREDIENT, $1, NO_SPAN);
+      addDirection(recipe, DIRECTION_TEXT, $2, NO_SPAN);
     }
   | text_item WHTS {
-    $$ = addTwoStrings($1, $2);
-    char * tempString = addTwoStrings($1, $2);
-    addDirection(recipe, "text", tempString, NULL);
-    free(tempString);
-    free($1);
-    free($2);
+    Span tempSpan = joinSpans(recipe->arena, $1, $2);
+    addDirection(recipe, DIRECTION_TEXT, tempSpan, NO_SPAN);
   }
   ;
 
@@ -135,32 +117,24 @@ text_item:
     WORD
   | MULTIWORD
   | NUMBER  {
-      $$ = malloc(10);
-      sprintf($$, "%.3f", $1);
+      $$ = stringToSpan(arenaSprintf(recipe->arena, "%.3f", $1));
     }
   | PUNC_CHAR
   | text_item WORD  {
-      $$ = addTwoStrings($1, $2);
-      free($1);
-      free($2);
+      $$ = joinSpans(recipe->arena, $1, $2);
     }
 
   | text_item MULTIWORD  {
-      $$ = addTwoStrings($1, $2);
-      free($1);
-      free($2);
+      $$ = joinSpans(recipe->arena, $1, $2);
     }
 
   | text_item NUMBER  {
-      $$ = malloc(strlen($1) + 15);
-      sprintf($$, "%s %.3f", $1, $2);
-      free($1);
+      $$ = stringToSpan(arenaSprintf(recipe->arena, "%.*s %.3f",
+                                     (int)$1.length, $1.start, $2));
     }
 
   | text_item METADATA {
-      $$ = addTwoStrings($1, $2);
-      free($1);
-      free($2);
+      $$ = joinSpans(recipe->arena, $1, $2);
     }
   ;
 
@@ -168,24 +142,20 @@ text_item:
 amount:
     // an empty amount - for one word timers
     LCURL RCURL {
-      $$ = malloc(5);
-      strcpy($$, "\0");
+      $$ = EMPTY_SPAN;
     }
   | LCURL WHTS RCURL {
-    $$ = malloc(5);
-    strcpy($$, "\0");
+    $$ = EMPTY_SPAN;
   }
 
   | LCURL NUMBER RCURL  {
       // get string for amount
-      $$ = malloc(100);
-      sprintf($$, "%.3lf", $2);
+      $$ = stringToSpan(arenaSprintf(recipe->arena, "%.3lf", $2));
     }
 
   | LCURL NUMBER UNIT RCURL {
-      $$ = malloc(strlen($3) + 20);
-      sprintf($$, "%.3f %s", $2, $3);
-      free($3);
+      $$ = stringToSpan(arenaSprintf(recipe->arena, "%.3f %.*s", $2,
+                                     (int)$3.length, $3.start));
     }
 
   | LCURL WORD RCURL  {
@@ -193,9 +163,7 @@ amount:
     }
 
   | LCURL WORD UNIT RCURL {
-      $$ = addTwoStrings($2, $3);
-      free($2);
-      free($3);
+      $$ = joinSpans(recipe->arena, $2, $3);
     }
 
   | LCURL MULTIWORD RCURL {
@@ -203,27 +171,22 @@ amount:
     }
 
   | LCURL MULTIWORD UNIT RCURL {
-      $$ = addTwoStrings($2, $3);
-      free($2);
-      free($3);
+      $$ = joinSpans(recipe->arena, $2, $3);
     }
   ;
 
 
 cookware_amount:
     LCURL RCURL {
-        $$ = malloc(5);
-        strcpy($$, "\0");
+        $$ = EMPTY_SPAN;
       }
 
   | LCURL WHTS RCURL {
-        $$ = malloc(5);
-        strcpy($$, "\0");
+        $$ = EMPTY_SPAN;
       }
 
   | LCURL NUMBER RCURL  {
-        $$ = malloc(100);
-        sprintf($$, "%.3f", $2);
+        $$ = stringToSpan(arenaSprintf(recipe->arena, "%.3f", $2));
       }
 
   | LCURL WORD RCURL  {
@@ -237,36 +200,21 @@ cookware_amount:
 
 cookware:
   HWORD {
-      $$ = strdup($1);
-      addDirection(recipe, "cookware", $1, NULL);
-      free($1);
+      addDirection(recipe, DIRECTION_COOKWARE, $1, NO_SPAN);
     }
 
   | HWORD cookware_amount  {
-      $$ = addTwoStrings($1, $2);
-      addDirection(recipe, "cookware", $1, $2);
-      free($1);
-      free($2);
+      addDirection(recipe, DIRECTION_COOKWARE, $1, $2);
     }
 
   | HWORD WORD cookware_amount {
-      $$ = addThreeStrings($1, $2, $3);
-      char * valueString = addTwoStrings($1, $2);
-      addDirection(recipe, "cookware", valueString, $3);
-      free(valueString);
-      free($1);
-      free($2);
-      free($3);
+      Span valueSpan = joinSpans(recipe->arena, $1, $2);
+      addDirection(recipe, DIRECTION_COOKWARE, valueSpan, $3);
     }
 
   | HWORD MULTIWORD cookware_amount {
-      $$ = addThreeStrings($1, $2, $3);
-      char * valueString = addTwoStrings($1, $2);
-      addDirection(recipe, "cookware", valueString, $3);
-      free(valueString);
-      free($1);
-      free($2);
-      free($3);
+      Span valueSpan = joinSpans(recipe->arena, $1, $2);
+      addDirection(recipe, DIRECTION_COOKWARE, valueSpan, $3);
     }
   ;
 
@@ -274,63 +222,38 @@ cookware:
 
 ingredient:
     ATWORD  {
-      $$ = strdup($1);
-      addDirection(recipe, "ingredient", $1, NULL);
-      free($1);
+      addDirection(recipe, DIRECTION_INGREDIENT, $1, NO_SPAN);
     }
 
   | ATWORD amount {
-      $$ = addTwoStrings($1, $2);
-      addDirection(recipe, "ingredient", $1, $2);
-      free($1);
-      free($2);
+      addDirection(recipe, DIRECTION_INGREDIENT, $1, $2);
     }
 
   | ATWORD WORD amount  {
-      $$ = addThreeStrings($1, $2, $3);
-      char * valueString = addTwoStrings($1, $2);
-      addDirection(recipe, "ingredient", valueString, $3);
-      free(valueString);
-      free($1);
-      free($2);
-      free($3);
+      Span valueSpan = joinSpans(recipe->arena, $1, $2);
+      addDirection(recipe, DIRECTION_INGREDIENT, valueSpan, $3);
     }
 
   | ATWORD MULTIWORD amount  {
-      $$ = addThreeStrings($1, $2, $3);
-      char * valueString = addTwoStrings($1, $2);
-      addDirection(recipe, "ingredient", valueString, $3);
-      free(valueString);
-      free($1);
-      free($2);
-      free($3);
+      Span valueSpan = joinSpans(recipe->arena, $1, $2);
+      addDirection(recipe, DIRECTION_INGREDIENT, valueSpan, $3);
     }
   ;
 
 
 timer:
     TILDE amount  {
-        $$ = strdup($2);
-        addDirection(recipe, "timer", NULL, $2);
-        free($2);
+        addDirection(recipe, DIRECTION_TIMER, NO_SPAN, $2);
       }
   | TILDE WORD {
-        $$ = strdup($2);
-        addDirection(recipe, "timer", $2, NULL);
-        free($2);
+        addDirection(recipe, DIRECTION_TIMER, $2, NO_SPAN);
       }
   | TILDE WORD amount {
-        $$ = addTwoStrings($2, $3);
-        addDirection(recipe, "timer", $2, $3);
-        free($2);
-        free($3);
+        addDirection(recipe, DIRECTION_TIMER, $2, $3);
       }
 
   | TILDE MULTIWORD amount  {
-        $$ = addTwoStrings($2, $3);
-        addDirection(recipe, "timer", $2, $3);
-        free($2);
-        free($3);
+        addDirection(recipe, DIRECTION_TIMER, $2, $3);
       }
   ;
 
@@ -344,7 +267,7 @@ timer:
 
 
 
-int yyerror( Recipe * recipe, const char * s){
+int yyerror( yyscan_t scanner, Recipe * recipe, const char * s){
   printf("\nError\n%s", s);
   return 1;
 }
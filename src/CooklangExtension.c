@@ -1,11 +1,200 @@
 #include <Python.h>
+#include <pthread.h>
+#include <unistd.h>
 
+#include "../include/CharClassLib.h"
 #include "../include/CooklangParser.h"
 #include "../include/ShoppingListParser.h"
+#include "../include/ShoppingPlan.h"
+
+// the strings the conversion puts in every dict, interned once when the
+// module is loaded so building a recipe never has to create or hash them
+typedef enum {
+  KEY_TYPE,
+  KEY_VALUE,
+  KEY_NAME,
+  KEY_QUANTITY,
+  KEY_UNITS,
+  KEY_METADATA,
+  KEY_INGREDIENTS,
+  KEY_COOKWARE,
+  KEY_STEPS,
+  KEY_CATEGORY,
+  KEY_ITEMS,
+  KEY_SYNONYMS,
+  KEY_RECIPE,
+  KEY_NAMES,
+  KEY_NAME_OFFSETS,
+  KEY_UNIT_OFFSETS,
+  STRING_EMPTY,
+  STRING_COUNT
+} StringId;
+
+static const char *stringValues[STRING_COUNT] = {
+    "type",
+    "value",
+    "name",
+    "quantity",
+    "units",
+    "metadata",
+    "ingredients",
+    "cookware",
+    "steps",
+    "category",
+    "items",
+    "synonyms",
+    "recipe",
+    "names",
+    "name_offsets",
+    "unit_offsets",
+    "",
+};
+
+#define DIRECTION_KIND_COUNT (DIRECTION_TIMER + 1)
+
+typedef struct {
+  PyObject *strings[STRING_COUNT];
+
+  // the type of each kind of direction, indexed by DirectionKind
+  PyObject *kindNames[DIRECTION_KIND_COUNT];
+
+  PyTypeObject *recipeType;
+  PyTypeObject *parseIterType;
+  PyTypeObject *shoppingIndexType;
+} CooklangState;
+
+// critical sections only exist from python 3.13, before that the GIL is
+// always there
+#ifndef Py_BEGIN_CRITICAL_SECTION
+#define Py_BEGIN_CRITICAL_SECTION(object) {
+#define Py_END_CRITICAL_SECTION() }
+#endif
+
+// picks the arguments of a fastcall out of the positional and keyword ones,
+// in the order of names, leaving any that weren't given NULL - returns -1
+// with an exception set if they don't fit
+static int unpackArguments(const char *function, PyObject *const *args,
+                           Py_ssize_t nargs, PyObject *kwnames,
+                           const char *const *names, Py_ssize_t count,
+                           Py_ssize_t required, PyObject **values) {
+  if (nargs > count) {
+    PyErr_Format(PyExc_TypeError,
+                 "%s() takes at most %zd arguments (%zd given)", function,
+                 count, nargs);
+    return -1;
+  }
+
+  for (Py_ssize_t i = 0; i < count; i++) {
+    values[i] = i < nargs ? args[i] : NULL;
+  }
+
+  Py_ssize_t kwcount = kwnames == NULL ? 0 : PyTuple_GET_SIZE(kwnames);
+
+  for (Py_ssize_t k = 0; k < kwcount; k++) {
+    PyObject *kwname = PyTuple_GET_ITEM(kwnames, k);
+    Py_ssize_t i = 0;
+
+    while (i < count &&
+           PyUnicode_CompareWithASCIIString(kwname, names[i]) != 0) {
+      i++;
+    }
+
+    if (i == count) {
+      PyErr_Format(PyExc_TypeError,
+                   "%s() got an unexpected keyword argument '%U'", function,
+                   kwname);
+      return -1;
+    }
+
+    if (values[i] != NULL) {
+      PyErr_Format(PyExc_TypeError,
+                   "%s() got multiple values for argument '%s'", function,
+                   names[i]);
+      return -1;
+    }
+
+    values[i] = args[nargs + k];
+  }
+
+  for (Py_ssize_t i = 0; i < required; i++) {
+    if (values[i] == NULL) {
+      PyErr_Format(PyExc_TypeError, "%s() missing required argument '%s'",
+                   function, names[i]);
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+// the utf-8 text of a str argument, like the "s" format - no embedded null
+// code points
+static const char *textArgument(PyObject *argument) {
+  Py_ssize_t size;
+
+  if (!PyUnicode_Check(argument)) {
+    PyErr_Format(PyExc_TypeError, "argument must be str, not %.200s",
+                 Py_TYPE(argument)->tp_name);
+    return NULL;
+  }
+
+  const char *text = PyUnicode_AsUTF8AndSize(argument, &size);
+
+  if (text != NULL && (Py_ssize_t)strlen(text) != size) {
+    PyErr_SetString(PyExc_ValueError, "embedded null character");
+    return NULL;
+  }
+
+  return text;
+}
+
+// the bytes of a recipe argument, the utf-8 text of a str or the contents of
+// any object with the buffer protocol such as bytes, bytearray, memoryview or
+// mmap - view holds on to a buffer until it is given to PyBuffer_Release,
+// which has nothing to do for a str
+static int sourceArgument(PyObject *argument, Py_buffer *view,
+                          const char **source, Py_ssize_t *length) {
+  view->obj = NULL;
+
+  if (PyUnicode_Check(argument)) {
+    *source = textArgument(argument);
+    *length = *source != NULL ? (Py_ssize_t)strlen(*source) : 0;
+    return *source != NULL ? 0 : -1;
+  }
+
+  if (!PyObject_CheckBuffer(argument)) {
+    PyErr_Format(PyExc_TypeError,
+                 "recipe must be str or a bytes-like object, not %.200s",
+                 Py_TYPE(argument)->tp_name);
+    return -1;
+  }
+
+  if (PyObject_GetBuffer(argument, view, PyBUF_SIMPLE) == -1) {
+    return -1;
+  }
+
+  *source = view->buf;
+  *length = view->len;
+
+  return 0;
+}
 
 // python wrapper methods
 
-static PyObject *methodPrintRecipe(PyObject *self, PyObject *args) {
+// the utf-8 text of the string at key in a dict, owned by the string - NULL
+// with an exception set if it is missing or not a string
+static const char *itemText(PyObject *dict, const char *key) {
+  PyObject *item = PyDict_GetItemString(dict, key);
+
+  if (item == NULL) {
+    PyErr_Format(PyExc_KeyError, "recipe has no '%s'", key);
+    return NULL;
+  }
+
+  return PyUnicode_AsUTF8(item);
+}
+
+static PyObject *printRecipeDict(PyObject *recipe) {
   Py_ssize_t i;
   Py_ssize_t j;
   Py_ssize_t length;
@@ -21,8 +210,6 @@ static PyObject *methodPrintRecipe(PyObject *self, PyObject *args) {
 
   PyObject *key;
   PyObject *value;
-  PyObject *str;
-  PyObject *attr;
   PyObject *metas;
   PyObject *ingredient;
   PyObject *ingredients;
@@ -31,23 +218,21 @@ static PyObject *methodPrintRecipe(PyObject *self, PyObject *args) {
   PyObject *direction;
   PyObject *step;
   PyObject *steps;
-  PyObject *recipe;
-
-  if (!PyArg_ParseTuple(args, "O", &recipe)) {
-    printf("Error printing recipe - argument could not be read\n");
-    return NULL;
-  }
 
   // print metadata
   printf("Metadata:\n");
 
   metas = PyDict_GetItemString(recipe, "metadata");
   while (PyDict_Next(metas, &pos, &key, &value)) {
-    str = PyUnicode_AsEncodedString(key, "utf-8", "~E~");
-    keyStr = PyBytes_AS_STRING(str);
+    keyStr = PyUnicode_AsUTF8(key);
+    if (keyStr == NULL) {
+      return NULL;
+    }
 
-    str = PyUnicode_AsEncodedString(value, "utf-8", "~E~");
-    valStr = PyBytes_AS_STRING(str);
+    valStr = PyUnicode_AsUTF8(value);
+    if (valStr == NULL) {
+      return NULL;
+    }
 
     printf("  - %s: %s \n", keyStr, valStr);
   }
@@ -64,19 +249,22 @@ static PyObject *methodPrintRecipe(PyObject *self, PyObject *args) {
       ingredient = PyList_GetItem(ingredients, i);
 
       // name
-      attr = PyDict_GetItemString(ingredient, "name");
-      str = PyUnicode_AsEncodedString(attr, "utf-8", "~E~");
-      nameStr = PyBytes_AS_STRING(str);
+      nameStr = itemText(ingredient, "name");
+      if (nameStr == NULL) {
+        return NULL;
+      }
 
       // quanitty
-      attr = PyDict_GetItemString(ingredient, "quantity");
-      str = PyUnicode_AsEncodedString(attr, "utf-8", "~E~");
-      quanStr = PyBytes_AS_STRING(str);
+      quanStr = itemText(ingredient, "quantity");
+      if (quanStr == NULL) {
+        return NULL;
+      }
 
       // units
-      attr = PyDict_GetItemString(ingredient, "units");
-      str = PyUnicode_AsEncodedString(attr, "utf-8", "~E~");
-      unitStr = PyBytes_AS_STRING(str);
+      unitStr = itemText(ingredient, "units");
+      if (unitStr == NULL) {
+        return NULL;
+      }
 
       printf("  - %s, %s %s\n", nameStr, quanStr, unitStr);
 
@@ -101,14 +289,16 @@ static PyObject *methodPrintRecipe(PyObject *self, PyObject *args) {
       cookware = PyList_GetItem(cookwares, i);
 
       // name
-      attr = PyDict_GetItemString(cookware, "name");
-      str = PyUnicode_AsEncodedString(attr, "utf-8", "~E~");
-      nameStr = PyBytes_AS_STRING(str);
+      nameStr = itemText(cookware, "name");
+      if (nameStr == NULL) {
+        return NULL;
+      }
 
       // quanitty
-      attr = PyDict_GetItemString(cookware, "quantity");
-      str = PyUnicode_AsEncodedString(attr, "utf-8", "~E~");
-      quanStr = PyBytes_AS_STRING(str);
+      quanStr = itemText(cookware, "quantity");
+      if (quanStr == NULL) {
+        return NULL;
+      }
 
       printf("  - %s %s\n", quanStr, nameStr);
 
@@ -144,17 +334,19 @@ static PyObject *methodPrintRecipe(PyObject *self, PyObject *args) {
         printf("    - Direction %ld:\n", (j + 1));
 
         // get type
-        attr = PyDict_GetItemString(direction, "type");
-        str = PyUnicode_AsEncodedString(attr, "utf-8", "~E~");
-        typeStr = PyBytes_AS_STRING(str);
+        typeStr = itemText(direction, "type");
+        if (typeStr == NULL) {
+          return NULL;
+        }
 
         if (strcmp(typeStr, "text") == 0) {
           printf("      - type: %s\n", typeStr);
 
           // get value
-          attr = PyDict_GetItemString(direction, "value");
-          str = PyUnicode_AsEncodedString(attr, "utf-8", "~E~");
-          valStr = PyBytes_AS_STRING(str);
+          valStr = itemText(direction, "value");
+          if (valStr == NULL) {
+            return NULL;
+          }
 
           printf("      - %s\n", valStr);
 
@@ -162,24 +354,27 @@ static PyObject *methodPrintRecipe(PyObject *self, PyObject *args) {
           printf("      - type:     %s\n", typeStr);
 
           // print value
-          attr = PyDict_GetItemString(direction, "name");
-          str = PyUnicode_AsEncodedString(attr, "utf-8", "~E~");
-          nameStr = PyBytes_AS_STRING(str);
+          nameStr = itemText(direction, "name");
+          if (nameStr == NULL) {
+            return NULL;
+          }
 
           printf("      - name:     %s\n", nameStr);
 
           // print quan
-          attr = PyDict_GetItemString(direction, "quantity");
-          str = PyUnicode_AsEncodedString(attr, "utf-8", "~E~");
-          quanStr = PyBytes_AS_STRING(str);
+          quanStr = itemText(direction, "quantity");
+          if (quanStr == NULL) {
+            return NULL;
+          }
 
           printf("      - quantity: %s\n", quanStr);
 
           // print units
           if (strcmp(typeStr, "cookware") != 0) {
-            attr = PyDict_GetItemString(direction, "units");
-            str = PyUnicode_AsEncodedString(attr, "utf-8", "~E~");
-            unitStr = PyBytes_AS_STRING(str);
+            unitStr = itemText(direction, "units");
+            if (unitStr == NULL) {
+              return NULL;
+            }
 
             printf("      - units:    %s\n", unitStr);
           }
@@ -198,353 +393,2087 @@ static PyObject *methodPrintRecipe(PyObject *self, PyObject *args) {
   return Py_None;
 }
 
-// parse a recipe
-static PyObject *methodParseRecipe(PyObject *self, PyObject *args) {
-  int check;
-  int dirLength;
-  char *recipeString;
+// prints a recipe dict, or a Recipe object through its dict
+static PyObject *methodPrintRecipe(PyObject *self, PyObject *recipe) {
+  CooklangState *state = PyModule_GetState(self);
 
-  ListIterator stepIter;
-  Step *curStep;
-  ListIterator dirIter;
-  Direction *curDir;
-  ListIterator metaIter;
-  Metadata *curMeta;
+  if (PyDict_Check(recipe)) {
+    PyObject *result = printRecipeDict(recipe);
+    fflush(stdout);
+    return result;
+  }
 
-  PyObject *metaListObject;
+  if (!PyObject_TypeCheck(recipe, state->recipeType)) {
+    PyErr_Format(PyExc_TypeError,
+                 "recipe must be a dict or a cooklang.Recipe, not %.200s",
+                 Py_TYPE(recipe)->tp_name);
+    return NULL;
+  }
 
-  PyObject *stepListObject;
-  PyObject *stepObject;
-  PyObject *directionObject;
+  PyObject *dict = PyObject_CallMethod(recipe, "to_dict", NULL);
+  if (dict == NULL) {
+    return NULL;
+  }
 
-  PyObject *ingredientListObject;
-  PyObject *cookwareListObject;
+  PyObject *result = printRecipeDict(dict);
+  Py_DECREF(dict);
+  fflush(stdout);
 
-  // get args - no embedded null code points
-  if (!PyArg_ParseTuple(args, "s", &recipeString)) {
+  return result;
+}
+
+// adds a value to a dict and drops the reference to it, so a new object can
+// be passed straight in - fails if the value is NULL
+static int setItemStealing(PyObject *dict, PyObject *key, PyObject *value) {
+  if (value == NULL) {
+    return -1;
+  }
+
+  int check = PyDict_SetItem(dict, key, value);
+  Py_DECREF(value);
+
+  return check;
+}
+
+// appends a value to a list and drops the reference to it, the same way
+static int appendStealing(PyObject *list, PyObject *value) {
+  if (value == NULL) {
+    return -1;
+  }
+
+  int check = PyList_Append(list, value);
+  Py_DECREF(value);
+
+  return check;
+}
+
+// build the python object for one direction
+static PyObject *directionToPyObject(CooklangState *state, Direction *curDir) {
+  PyObject **strings = state->strings;
+
+  PyObject *directionObject = PyDict_New();
+  if (directionObject == NULL) {
     return NULL;
   }
 
-  // parse the recipe recipe
-  Recipe *parsedRecipe = parseRecipeString(recipeString);
+  // type
+  if (setItemStealing(directionObject, strings[KEY_TYPE],
+                      Py_NewRef(state->kindNames[curDir->kind])) == -1) {
+    goto error;
+  }
 
-  // build a python object to represent the recipe
-  PyObject *recipeObject = PyDict_New();
+  // text directions only have their value
+  if (curDir->kind == DIRECTION_TEXT) {
+    if (setItemStealing(directionObject, strings[KEY_VALUE],
+                        PyUnicode_FromString(curDir->value)) == -1) {
+      goto error;
+    }
 
-  // add all the metadata
+    return directionObject;
+  }
 
-  // loop through each metadata
-  metaIter = createIterator(parsedRecipe->metaData);
-  curMeta = nextElement(&metaIter);
+  // value
+  PyObject *name = curDir->value != NULL ? PyUnicode_FromString(curDir->value)
+                                         : Py_NewRef(strings[STRING_EMPTY]);
+
+  if (setItemStealing(directionObject, strings[KEY_NAME], name) == -1) {
+    goto error;
+  }
+
+  // quantity, a string, a number or empty when there is none
+  PyObject *quantity;
+  if (curDir->quantityString != NULL) {
+    quantity = PyUnicode_FromString(curDir->quantityString);
+  } else if (curDir->quantity != -1) {
+    quantity = PyFloat_FromDouble(curDir->quantity);
+  } else {
+    quantity = Py_NewRef(strings[STRING_EMPTY]);
+  }
+
+  if (setItemStealing(directionObject, strings[KEY_QUANTITY], quantity) ==
+      -1) {
+    goto error;
+  }
+
+  // unit
+  if (curDir->kind != DIRECTION_COOKWARE) {
+    PyObject *unit = curDir->unit != NULL ? PyUnicode_FromString(curDir->unit)
+                                          : Py_NewRef(strings[STRING_EMPTY]);
+
+    if (setItemStealing(directionObject, strings[KEY_UNITS], unit) == -1) {
+      goto error;
+    }
+  }
+
+  return directionObject;
+
+error:
+  Py_DECREF(directionObject);
+  return NULL;
+}
+
+// build the python dict of a recipe's metadata
+static PyObject *metadataToPyObject(Recipe *parsedRecipe) {
+  PyObject *metaListObject = PyDict_New();
+  if (metaListObject == NULL) {
+    return NULL;
+  }
 
-  metaListObject = PyDict_New();
+  // loop through each metadata
+  ListIterator metaIter = createIterator(parsedRecipe->metaData);
+  Metadata *curMeta = nextElement(&metaIter);
 
   while (curMeta != NULL) {
-    // add it to the list
-    check = PyDict_SetItemString(metaListObject, curMeta->identifier,
-                                 PyUnicode_FromString(curMeta->content));
+    PyObject *content = PyUnicode_FromString(curMeta->content);
+    int check = content == NULL ? -1
+                                : PyDict_SetItemString(metaListObject,
+                                                       curMeta->identifier,
+                                                       content);
+    Py_XDECREF(content);
+
     if (check == -1) {
-      printf("Error adding new meta data to list\n");
+      Py_DECREF(metaListObject);
+      return NULL;
     }
 
-    // get the next one
     curMeta = nextElement(&metaIter);
   }
 
-  // add the whole list to the final object
-  check = PyDict_SetItemString(recipeObject, "metadata", metaListObject);
-  if (check == -1) {
-    printf("Error adding meta data list to recipe object\n");
+  return metaListObject;
+}
+
+// build the python lists of steps, ingredients and cookware - each step is a
+// list of its directions, and every ingredient or piece of cookware is the
+// same object as in its step, in recipe order. empty steps are left out.
+// returns -1 with an exception set if it fails
+static int directionListsToPyObjects(CooklangState *state,
+                                     Recipe *parsedRecipe, PyObject **steps,
+                                     PyObject **ingredients,
+                                     PyObject **cookware) {
+  PyObject *stepListObject = PyList_New(0);
+  PyObject *ingredientListObject = PyList_New(0);
+  PyObject *cookwareListObject = PyList_New(0);
+
+  if (stepListObject == NULL || ingredientListObject == NULL ||
+      cookwareListObject == NULL) {
+    goto error;
   }
 
-  // add all the steps/ingredients/cookware
+  size_t stepCount = getStepCount(parsedRecipe);
 
-  // the lists to store steps/ingredients/cookware
-  stepListObject = PyList_New(0);
-  ingredientListObject = PyList_New(0);
-  cookwareListObject = PyList_New(0);
+  for (size_t i = 0; i < stepCount; i++) {
+    Step *curStep = getStep(parsedRecipe, i);
+    size_t dirCount = getDirectionCount(curStep);
 
-  // loop through every step
-  stepIter = createIterator(parsedRecipe->stepList);
-  curStep = nextElement(&stepIter);
+    if (dirCount == 0) {
+      continue;
+    }
 
-  while (curStep != NULL) {
-    // only add non-empty steps
-    dirLength = getLength(curStep->directions);
+    // the list of directions is owned by the step list from here on
+    PyObject *stepObject = PyList_New(dirCount);
+    if (appendStealing(stepListObject, stepObject) == -1) {
+      goto error;
+    }
 
-    if (dirLength > 0) {
-      // loop through every direction
-      dirIter = createIterator(curStep->directions);
-      curDir = nextElement(&dirIter);
+    for (size_t j = 0; j < dirCount; j++) {
+      Direction *curDir = getDirection(curStep, j);
+      PyObject *directionObject = directionToPyObject(state, curDir);
+      if (directionObject == NULL) {
+        goto error;
+      }
 
-      // create a new list of directions
-      stepObject = PyList_New(0);
+      // the step takes the direction over, the other lists share it
+      PyList_SET_ITEM(stepObject, j, directionObject);
 
-      while (curDir != NULL) {
-        // build a pyobject out of its values
+      if (curDir->kind == DIRECTION_INGREDIENT &&
+          PyList_Append(ingredientListObject, directionObject) == -1) {
+        goto error;
+      }
 
-        // if its a text direction
-        if (strcmp(curDir->type, "text") == 0) {
-          directionObject = Py_BuildValue("{s:s, s:s}", "type", "text", "value",
-                                          curDir->value);
+      if (curDir->kind == DIRECTION_COOKWARE &&
+          PyList_Append(cookwareListObject, directionObject) == -1) {
+        goto error;
+      }
+    }
+  }
 
-          // other kinds
-        } else {
-          directionObject = PyDict_New();
-          // add each attribute of the direction to the pyobject
-
-          // type
-          check = PyDict_SetItemString(directionObject, "type",
-                                       PyUnicode_FromString(curDir->type));
-          if (check == -1) {
-            printf("Error adding type to new direction object\n");
-          }
+  *steps = stepListObject;
+  *ingredients = ingredientListObject;
+  *cookware = cookwareListObject;
 
-          // value
-          if (curDir->value != NULL) {
-            check = PyDict_SetItemString(directionObject, "name",
-                                         PyUnicode_FromString(curDir->value));
-            if (check == -1) {
-              printf("Error adding name to new direction object\n");
-            }
-          } else {
-            check = PyDict_SetItemString(directionObject, "name",
-                                         PyUnicode_FromString(""));
-            if (check == -1) {
-              printf("Error adding name to new direction object\n");
-            }
-          }
+  return 0;
 
-          // quantity
-          if (curDir->quantityString == NULL) {
-            if (curDir->quantity != -1) {
-              check =
-                  PyDict_SetItemString(directionObject, "quantity",
-                                       PyFloat_FromDouble(curDir->quantity));
-              if (check == -1) {
-                printf(
-                    "Error adding quantity double to new direction object\n");
-              }
-            } else {
-              check = PyDict_SetItemString(directionObject, "quantity",
-                                           PyUnicode_FromString(""));
-              if (check == -1) {
-                printf("Error adding empty quantity to new direction object\n");
-              }
-            }
-          } else {
-            check = PyDict_SetItemString(
-                directionObject, "quantity",
-                PyUnicode_FromString(curDir->quantityString));
-            if (check == -1) {
-              printf("Error adding quantity string to new direction object\n");
-            }
-          }
+error:
+  Py_XDECREF(stepListObject);
+  Py_XDECREF(ingredientListObject);
+  Py_XDECREF(cookwareListObject);
+  return -1;
+}
 
-          // unit
-          if (strcmp(curDir->type, "cookware") != 0) {
-            if (curDir->unit != NULL) {
-              check = PyDict_SetItemString(directionObject, "units",
-                                           PyUnicode_FromString(curDir->unit));
-              if (check == -1) {
-                printf("Error adding units to new direction object\n");
-              }
-            } else {
-              check = PyDict_SetItemString(directionObject, "units",
-                                           PyUnicode_FromString(""));
-              if (check == -1) {
-                printf("Error adding units to new direction object\n");
-              }
-            }
-          }
-        }
+// build the python object for a parsed recipe
+static PyObject *recipeToPyObject(CooklangState *state, Recipe *parsedRecipe) {
+  PyObject *stepListObject;
+  PyObject *ingredientListObject;
+  PyObject *cookwareListObject;
 
-        // add it to the step
-        check = PyList_Append(stepObject, directionObject);
-        if (check == -1) {
-          printf("Error adding new direction to direction list\n");
-        }
+  PyObject *recipeObject = PyDict_New();
+  if (recipeObject == NULL) {
+    return NULL;
+  }
 
-        // if its an ingredient add it to the ingredient list
-        if (strcmp(curDir->type, "ingredient") == 0) {
-          check = PyList_Append(ingredientListObject, directionObject);
+  // add all the metadata
+  if (setItemStealing(recipeObject, state->strings[KEY_METADATA],
+                      metadataToPyObject(parsedRecipe)) == -1) {
+    Py_DECREF(recipeObject);
+    return NULL;
+  }
 
-          if (check == -1) {
-            printf("Error adding new direction to direction list\n");
-          }
-        }
+  if (directionListsToPyObjects(state, parsedRecipe, &stepListObject,
+                                &ingredientListObject,
+                                &cookwareListObject) == -1) {
+    Py_DECREF(recipeObject);
+    return NULL;
+  }
 
-        // if its a cookware add it to the cookware list
-        if (strcmp(curDir->type, "cookware") == 0) {
-          check = PyList_Append(cookwareListObject, directionObject);
+  // the recipe takes over the lists
+  if (setItemStealing(recipeObject, state->strings[KEY_INGREDIENTS],
+                      ingredientListObject) == -1) {
+    Py_DECREF(stepListObject);
+    Py_DECREF(cookwareListObject);
+    Py_DECREF(recipeObject);
+    return NULL;
+  }
 
-          if (check == -1) {
-            printf("Error adding new direction to direction list\n");
-          }
-        }
+  if (setItemStealing(recipeObject, state->strings[KEY_COOKWARE],
+                      cookwareListObject) == -1) {
+    Py_DECREF(stepListObject);
+    Py_DECREF(recipeObject);
+    return NULL;
+  }
 
-        // get the next direction
-        curDir = nextElement(&dirIter);
-      }
-      check = PyList_Append(stepListObject, stepObject);
-      if (check == -1) {
-        printf("Error adding step to step list\n");
-      }
-    }
+  if (setItemStealing(recipeObject, state->strings[KEY_STEPS],
+                      stepListObject) == -1) {
+    Py_DECREF(recipeObject);
+    return NULL;
+  }
+
+  return recipeObject;
+}
+
+// the parts of a recipe object that are built on first access, each getter
+// has its part as its closure
+typedef enum {
+  PART_METADATA,
+  PART_INGREDIENTS,
+  PART_COOKWARE,
+  PART_STEPS,
+  PART_COUNT
+} RecipePart;
+
+// python recipe type, it owns the native recipe and frees it when the object
+// is deallocated - the python views of its parts are only built the first
+// time they are asked for, then kept
+typedef struct {
+  PyObject_HEAD Recipe *recipe;
+  PyObject *parts[PART_COUNT];
+} RecipeObject;
+
+// wraps a parsed recipe in a python recipe, which takes it over
+static PyObject *recipeObjectFromRecipe(PyTypeObject *type,
+                                        Recipe *parsedRecipe) {
+  RecipeObject *self = (RecipeObject *)type->tp_alloc(type, 0);
+  if (self == NULL) {
+    deleteRecipe(parsedRecipe);
+    return NULL;
+  }
+
+  self->recipe = parsedRecipe;
+
+  return (PyObject *)self;
+}
 
-    // get the next step
-    curStep = nextElement(&stepIter);
+static PyObject *recipeNew(PyTypeObject *type, PyObject *args,
+                           PyObject *kwargs) {
+  static char *kwlist[] = {"source", NULL};
+  PyObject *sourceObject;
+  Py_buffer view;
+  const char *source;
+  Py_ssize_t length;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O", kwlist,
+                                   &sourceObject)) {
+    return NULL;
   }
 
-  // add ingredient list to the recipe
-  check =
-      PyDict_SetItemString(recipeObject, "ingredients", ingredientListObject);
-  if (check == -1) {
-    printf("Error adding step list to recipe\n");
+  if (sourceArgument(sourceObject, &view, &source, &length) == -1) {
+    return NULL;
   }
 
-  // add cookware list to the recipe
-  check = PyDict_SetItemString(recipeObject, "cookware", cookwareListObject);
-  if (check == -1) {
-    printf("Error adding step list to recipe\n");
+  // a str's text lives as long as the borrowed str and a buffer is held on
+  // to by the view, so either is parsed without the GIL
+  Recipe *parsedRecipe;
+
+  Py_BEGIN_ALLOW_THREADS;
+  parsedRecipe = parseRecipeBuffer(source, length);
+  Py_END_ALLOW_THREADS;
+
+  PyBuffer_Release(&view);
+
+  if (parsedRecipe == NULL) {
+    return PyErr_NoMemory();
   }
 
-  // add steps to the recipe
-  check = PyDict_SetItemString(recipeObject, "steps", stepListObject);
-  if (check == -1) {
-    printf("Error adding step list to recipe\n");
+  return recipeObjectFromRecipe(type, parsedRecipe);
+}
+
+static int recipeTraverse(RecipeObject *self, visitproc visit, void *arg) {
+  Py_VISIT(Py_TYPE(self));
+
+  for (int i = 0; i < PART_COUNT; i++) {
+    Py_VISIT(self->parts[i]);
   }
 
-  // return
-  return (PyObject *)recipeObject;
+  return 0;
 }
 
-static PyObject *methodParseShoppingList(PyObject *self, PyObject *args) {
-  int check;
-  int synCount = 0;
+static int recipeClear(RecipeObject *self) {
+  for (int i = 0; i < PART_COUNT; i++) {
+    Py_CLEAR(self->parts[i]);
+  }
 
-  char *fileName;
+  return 0;
+}
 
-  List *shoppingLists;
+static void recipeDealloc(RecipeObject *self) {
+  PyTypeObject *type = Py_TYPE(self);
 
-  ListIterator sListIter;
-  ShoppingList *curList;
-  ListIterator itemIter;
-  ShoppingItem *curItem;
+  PyObject_GC_UnTrack(self);
+  recipeClear(self);
+  deleteRecipe(self->recipe);
+  type->tp_free((PyObject *)self);
+  Py_DECREF(type);
+}
 
-  PyObject *shopItemObject;
-  PyObject *synListObject;
-  PyObject *itemListObject;
-  PyObject *shopListObject;
+static PyObject *recipeToDict(RecipeObject *self, PyObject *unused) {
+  return recipeToPyObject(PyType_GetModuleState(Py_TYPE(self)), self->recipe);
+}
 
-  PyObject *shopListList;
+// the compact binary form of the recipe, written straight into the bytes
+static PyObject *recipeToBytes(RecipeObject *self, PyObject *unused) {
+  size_t size = serializedRecipeSize(self->recipe);
+  PyObject *data = PyBytes_FromStringAndSize(NULL, (Py_ssize_t)size);
 
-  // get args - no embedded null code points
-  if (!PyArg_ParseTuple(args, "s", &fileName)) {
+  if (data != NULL) {
+    serializeRecipe(self->recipe, PyBytes_AS_STRING(data));
+  }
+
+  return data;
+}
+
+// rebuilds a lazy recipe from the output of to_bytes
+static PyObject *recipeFromBytes(PyTypeObject *type, PyObject *argument) {
+  Py_buffer view;
+
+  if (PyObject_GetBuffer(argument, &view, PyBUF_SIMPLE) == -1) {
     return NULL;
   }
 
-  // parse the shopping list
-  shoppingLists = parseShoppingLists(fileName);
+  Recipe *parsedRecipe = deserializeRecipe(view.buf, (size_t)view.len);
+  PyBuffer_Release(&view);
 
-  // convert to python object - a list of lists
-  shopListList = PyList_New(0);
+  if (parsedRecipe == NULL) {
+    PyErr_SetString(PyExc_ValueError, "not a serialized recipe");
+    return NULL;
+  }
 
-  // loop through each shopping list
-  sListIter = createIterator(shoppingLists);
-  curList = nextElement(&sListIter);
+  return recipeObjectFromRecipe(type, parsedRecipe);
+}
 
-  while (curList != NULL) {
-    // create a new pyobject for the list
-    shopListObject = PyDict_New();
+// pickles the recipe as its binary form instead of its python objects
+static PyObject *recipeReduce(RecipeObject *self, PyObject *unused) {
+  PyObject *fromBytes =
+      PyObject_GetAttrString((PyObject *)Py_TYPE(self), "from_bytes");
+  if (fromBytes == NULL) {
+    return NULL;
+  }
 
-    // add the category
-    check = PyDict_SetItemString(shopListObject, "category",
-                                 PyUnicode_FromString(curList->category));
-    if (check == -1) {
-      printf("Error adding name to item object\n");
+  PyObject *data = recipeToBytes(self, NULL);
+  if (data == NULL) {
+    Py_DECREF(fromBytes);
+    return NULL;
+  }
+
+  return Py_BuildValue("(N(N))", fromBytes, data);
+}
+
+// returns a part of the recipe, building and keeping it on first access
+static PyObject *recipeGetPart(RecipeObject *self, void *closure) {
+  CooklangState *state = PyType_GetModuleState(Py_TYPE(self));
+  RecipePart part = (RecipePart)(intptr_t)closure;
+  PyObject *result;
+
+  // without a GIL two threads could build the same part at once
+  Py_BEGIN_CRITICAL_SECTION(self);
+
+  if (self->parts[part] == NULL) {
+    if (part == PART_METADATA) {
+      self->parts[part] = metadataToPyObject(self->recipe);
+    } else {
+      // the steps, ingredients and cookware share their direction objects
+      // the way they do in to_dict, so they are built together
+      directionListsToPyObjects(state, self->recipe,
+                                &self->parts[PART_STEPS],
+                                &self->parts[PART_INGREDIENTS],
+                                &self->parts[PART_COOKWARE]);
     }
+  }
 
-    // add each shopping item to the list
-    itemListObject = PyList_New(0);
-    // loop through each shopping item
-    itemIter = createIterator(curList->shoppingItems);
-    curItem = nextElement(&itemIter);
+  result = Py_XNewRef(self->parts[part]);
 
-    while (curItem != NULL) {
-      // make new pyobject for item
-      shopItemObject = PyDict_New();
-      check = PyDict_SetItemString(shopItemObject, "name",
-                                   PyUnicode_FromString(curItem->name));
-      if (check == -1) {
-        printf("Error adding name to item object\n");
-      }
+  Py_END_CRITICAL_SECTION();
 
-      // loop through each synonym
-      synListObject = PyList_New(0);
-      if (curItem->synonyms != NULL) {
-        while (curItem->synonyms[synCount] != NULL) {
-          check = PyList_Append(
-              synListObject, PyUnicode_FromString(curItem->synonyms[synCount]));
-          if (check == -1) {
-            printf("Error adding new synonym to synonym list\n");
-          }
+  return result;
+}
 
-          synCount++;
-        }
-      }
+static PyMethodDef recipeMethods[] = {
+    {"to_dict", (PyCFunction)recipeToDict, METH_NOARGS,
+     "Returns the recipe as the dictionary parseRecipe produces."},
+    {"to_bytes", (PyCFunction)recipeToBytes, METH_NOARGS,
+     "Returns the recipe in a compact binary form for from_bytes."},
+    {"from_bytes", (PyCFunction)recipeFromBytes, METH_O | METH_CLASS,
+     "Rebuilds a recipe from the bytes to_bytes returned."},
+    {"__reduce__", (PyCFunction)recipeReduce, METH_NOARGS,
+     "Pickles the recipe in its binary form."},
+    {NULL, NULL, 0, NULL}};
 
-      // add the synonyms to the item
-      check = PyDict_SetItemString(shopItemObject, "synonyms", synListObject);
-      if (check == -1) {
-        printf("Error adding synonyms to item\n");
-      }
+static PyGetSetDef recipeGetSet[] = {
+    {"metadata", (getter)recipeGetPart, NULL,
+     "The metadata of the recipe as a dict.", (void *)PART_METADATA},
+    {"ingredients", (getter)recipeGetPart, NULL,
+     "Every ingredient in the recipe, in order.", (void *)PART_INGREDIENTS},
+    {"cookware", (getter)recipeGetPart, NULL,
+     "Every piece of cookware in the recipe, in order.",
+     (void *)PART_COOKWARE},
+    {"steps", (getter)recipeGetPart, NULL,
+     "The steps of the recipe, each a list of its directions.",
+     (void *)PART_STEPS},
+    {NULL, NULL, NULL, NULL, NULL}};
+
+static PyType_Slot recipeSlots[] = {
+    {Py_tp_doc,
+     "A recipe parsed from a string written in the cooklang language "
+     "specification. Its parts are built on first access."},
+    {Py_tp_new, recipeNew},
+    {Py_tp_dealloc, recipeDealloc},
+    {Py_tp_traverse, recipeTraverse},
+    {Py_tp_clear, recipeClear},
+    {Py_tp_methods, recipeMethods},
+    {Py_tp_getset, recipeGetSet},
+    {0, NULL}};
+
+static PyType_Spec recipeSpec = {
+    .name = "cooklang.Recipe",
+    .basicsize = sizeof(RecipeObject),
+    .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_IMMUTABLETYPE,
+    .slots = recipeSlots};
+
+// parse a recipe, into a dict or a lazy recipe object
+static PyObject *methodParseRecipe(PyObject *self, PyObject *const *args,
+                                   Py_ssize_t nargs, PyObject *kwnames) {
+  static const char *const names[] = {"source", "lazy"};
+  PyObject *values[2];
+  int lazy = 0;
+
+  if (unpackArguments("parseRecipe", args, nargs, kwnames, names, 2, 1,
+                      values) == -1) {
+    return NULL;
+  }
 
-      // add the item to the list of items for the shopping list
-      check = PyList_Append(itemListObject, shopItemObject);
-      if (check == -1) {
-        printf("Error adding new shopping item to shopping list\n");
-      }
+  if (values[1] != NULL && (lazy = PyObject_IsTrue(values[1])) == -1) {
+    return NULL;
+  }
 
-      curItem = nextElement(&itemIter);
-    }
+  Py_buffer view;
+  const char *source;
+  Py_ssize_t length;
 
-    // add the list of shopping items to the shopping list
-    check = PyDict_SetItemString(shopListObject, "items", itemListObject);
-    if (check == -1) {
-      printf("Error adding list of items to shopping list\n");
+  if (sourceArgument(values[0], &view, &source, &length) == -1) {
+    return NULL;
+  }
+
+  // a str's text lives as long as the borrowed str and a buffer is held on
+  // to by the view, so either is parsed without the GIL
+  Recipe *parsedRecipe;
+
+  Py_BEGIN_ALLOW_THREADS;
+  parsedRecipe = parseRecipeBuffer(source, length);
+  Py_END_ALLOW_THREADS;
+
+  PyBuffer_Release(&view);
+
+  if (parsedRecipe == NULL) {
+    return PyErr_NoMemory();
+  }
+
+  CooklangState *state = PyModule_GetState(self);
+
+  if (lazy) {
+    return recipeObjectFromRecipe(state->recipeType, parsedRecipe);
+  }
+
+  PyObject *recipeObject = recipeToPyObject(state, parsedRecipe);
+
+  deleteRecipe(parsedRecipe);
+
+  return recipeObject;
+}
+
+// the offset of the first byte of the text that isn't valid UTF-8, -1 if it
+// is all valid
+static Py_ssize_t invalidUtf8Offset(const char *text, size_t length) {
+  const char *limit = text + length;
+  const char *next = text;
+  uint32_t codepoint;
+
+  while (next < limit) {
+    if ((unsigned char)*next < 0x80) {
+      next++;
+      continue;
     }
 
-    // add the shopping list to the list of lists
-    check = PyList_Append(shopListList, shopListObject);
-    if (check == -1) {
-      printf("Error adding new shopping list to list of shopping lists\n");
+    size_t size = decodeCharacter(next, limit, &codepoint);
+    if (size == 0) {
+      return next - text;
     }
 
-    curList = nextElement(&sListIter);
+    next += size;
   }
 
-  return (PyObject *)shopListList;
+  return -1;
 }
 
-// python module methods array
-static PyMethodDef cooklangMethods[] = {
-    {"parseRecipe", methodParseRecipe, METH_VARARGS,
-     "Python wrapper function that parses recipes written in the cooklang "
-     "language specification."},
-    {"parseShoppingList", methodParseShoppingList, METH_VARARGS,
-     "Python wrapper function that parses shopping lists written in the "
-     "cooklang language specification."},
-    {"printRecipe", methodPrintRecipe, METH_VARARGS,
-     "Python wrapper function for printing the contents of a recipe."},
-    {NULL, NULL, 0, NULL}};
+// parses a recipe and writes it as JSON, NULL if malloc fails - invalid is
+// set to the offset of the first byte of the JSON that isn't UTF-8, or -1
+static char *parseRecipeJson(const char *source, Py_ssize_t length,
+                             size_t *jsonLength, Py_ssize_t *invalid) {
+  Recipe *parsedRecipe = parseRecipeBuffer(source, length);
+  if (parsedRecipe == NULL) {
+    return NULL;
+  }
 
-// define the module
-static PyModuleDef cooklang = {
-    PyModuleDef_HEAD_INIT, .m_name = "cooklang",
-    .m_doc =
-        "A python module that uses C to parse recipe files using cooklang.",
-    .m_size = -1, cooklangMethods};
+  StringBuilder builder;
+  initializeStringBuilder(&builder);
+
+  appendRecipeJson(&builder, parsedRecipe);
+  deleteRecipe(parsedRecipe);
+
+  *jsonLength = builder.length;
+
+  char *json = finishStringBuilder(&builder);
+
+  // only the text that ends up in the recipe is checked, the same as when
+  // parseRecipe decodes it
+  if (json != NULL) {
+    *invalid = invalidUtf8Offset(json, *jsonLength);
+  }
+
+  return json;
+}
+
+static PyObject *methodParseToJsonBytes(PyObject *self, PyObject *argument) {
+  Py_buffer view;
+  const char *source;
+  Py_ssize_t length;
+  size_t jsonLength;
+  Py_ssize_t invalid;
+  char *json;
+
+  if (sourceArgument(argument, &view, &source, &length) == -1) {
+    return NULL;
+  }
+
+  // a str's text lives as long as the borrowed str and a buffer is held on
+  // to by the view, so either is parsed without the GIL
+  Py_BEGIN_ALLOW_THREADS;
+  json = parseRecipeJson(source, length, &jsonLength, &invalid);
+  Py_END_ALLOW_THREADS;
+
+  PyBuffer_Release(&view);
 
-// initialization function
-PyMODINIT_FUNC PyInit_cooklang(void) { return PyModule_Create(&cooklang); }
+  if (json == NULL) {
+    return PyErr_NoMemory();
+  }
+
+  // bytes that aren't UTF-8 fail the way they do in parseRecipe, rather than
+  // being passed on into the JSON
+  if (invalid != -1) {
+    PyObject *error = PyUnicodeDecodeError_Create(
+        "utf-8", json, jsonLength, invalid, invalid + 1, "invalid utf-8");
+    free(json);
+
+    if (error != NULL) {
+      PyErr_SetObject(PyExc_UnicodeDecodeError, error);
+      Py_DECREF(error);
+    }
+
+    return NULL;
+  }
+
+  PyObject *result = PyBytes_FromStringAndSize(json, jsonLength);
+  free(json);
+
+  return result;
+}
+
+// the j-th ingredient of a step
+static Direction *stepIngredient(Step *curStep, size_t j) {
+  size_t *index = vectorGet(&curStep->ingredients, j);
+
+  return getDirection(curStep, *index);
+}
+
+// the text of a direction's name or unit as it goes in a column
+static const char *columnText(const char *text) {
+  return text != NULL ? text : "";
+}
+
+// adds a string to a column of strings, its offsets are int32 like arrow's
+// so the column is limited to 2GB of text
+static void appendColumnText(char *data, int32_t *offsets, Py_ssize_t row,
+                             const char *text) {
+  size_t length = strlen(text);
+
+  memcpy(data + offsets[row], text, length);
+  offsets[row + 1] = offsets[row] + (int32_t)length;
+}
+
+// makes an array of the given type code with room for count items and opens
+// its memory for writing, the items are filled in place - the view has to be
+// released before the array is used
+static PyObject *columnArray(PyObject *arrayType, const char *typeCode,
+                             Py_ssize_t count, Py_buffer *view) {
+  PyObject *item = PyObject_CallFunction(arrayType, "s(i)", typeCode, 0);
+  if (item == NULL) {
+    return NULL;
+  }
+
+  // repeating one item allocates the array at its final size at once
+  PyObject *array = PySequence_Repeat(item, count);
+  Py_DECREF(item);
+
+  if (array == NULL) {
+    return NULL;
+  }
+
+  if (PyObject_GetBuffer(array, view, PyBUF_WRITABLE) == -1) {
+    Py_DECREF(array);
+    return NULL;
+  }
+
+  return array;
+}
+
+// the columns ingredient_columns returns, in the order they are put in the
+// dict
+typedef enum {
+  COLUMN_RECIPE,
+  COLUMN_QUANTITY,
+  COLUMN_NAME_OFFSETS,
+  COLUMN_NAMES,
+  COLUMN_UNIT_OFFSETS,
+  COLUMN_UNITS,
+  COLUMN_COUNT
+} Column;
+
+// export the ingredients of many recipes as packed columns, one row per
+// ingredient, read straight from the native recipes - only the columns
+// themselves become python objects
+static PyObject *methodIngredientColumns(PyObject *self, PyObject *recipes) {
+  _Static_assert(sizeof(int) == sizeof(int32_t),
+                 "the 'i' array type code has to be 32 bits");
+
+  CooklangState *state = PyModule_GetState(self);
+
+  PyObject *items = PySequence_Fast(recipes, "recipes must be a sequence");
+  if (items == NULL) {
+    return NULL;
+  }
+
+  Py_ssize_t recipeCount = PySequence_Fast_GET_SIZE(items);
+  PyObject **recipeObjects = PySequence_Fast_ITEMS(items);
+
+  // count the rows and the text first so every column is allocated once
+  Py_ssize_t rowCount = 0;
+  size_t nameSize = 0;
+  size_t unitSize = 0;
+
+  for (Py_ssize_t r = 0; r < recipeCount; r++) {
+    if (!PyObject_TypeCheck(recipeObjects[r], state->recipeType)) {
+      PyErr_Format(PyExc_TypeError,
+                   "recipes must be cooklang.Recipe objects, not %.200s",
+                   Py_TYPE(recipeObjects[r])->tp_name);
+      Py_DECREF(items);
+      return NULL;
+    }
+
+    Recipe *parsedRecipe = ((RecipeObject *)recipeObjects[r])->recipe;
+
+    for (size_t i = 0; i < getStepCount(parsedRecipe); i++) {
+      Step *curStep = getStep(parsedRecipe, i);
+
+      for (size_t j = 0; j < vectorLength(&curStep->ingredients); j++) {
+        Direction *curDir = stepIngredient(curStep, j);
+
+        nameSize += strlen(columnText(curDir->value));
+        unitSize += strlen(columnText(curDir->unit));
+        rowCount++;
+      }
+    }
+  }
+
+  if (nameSize > INT32_MAX || unitSize > INT32_MAX) {
+    Py_DECREF(items);
+    return PyErr_Format(PyExc_OverflowError,
+                        "ingredient text does not fit in int32 offsets");
+  }
+
+  PyObject **strings = state->strings;
+  PyObject *result = NULL;
+  PyObject *arrayType = NULL;
+  PyObject *columns[COLUMN_COUNT] = {NULL};
+  Py_buffer views[COLUMN_COUNT];
+  bool opened[COLUMN_COUNT] = {false};
+
+  PyObject *arrayModule = PyImport_ImportModule("array");
+  if (arrayModule == NULL) {
+    goto done;
+  }
+
+  arrayType = PyObject_GetAttrString(arrayModule, "array");
+  Py_DECREF(arrayModule);
+
+  if (arrayType == NULL) {
+    goto done;
+  }
+
+  // every column is made at its final size and the rows are written straight
+  // into it, the text columns are bytes and the rest are arrays
+  static const char *const typeCodes[COLUMN_COUNT] = {"i", "d", "i",
+                                                      NULL, "i", NULL};
+  Py_ssize_t counts[COLUMN_COUNT] = {rowCount,     rowCount,
+                                     rowCount + 1, (Py_ssize_t)nameSize,
+                                     rowCount + 1, (Py_ssize_t)unitSize};
+
+  for (int c = 0; c < COLUMN_COUNT; c++) {
+    if (typeCodes[c] == NULL) {
+      columns[c] = PyBytes_FromStringAndSize(NULL, counts[c]);
+    } else {
+      columns[c] = columnArray(arrayType, typeCodes[c], counts[c], &views[c]);
+      opened[c] = columns[c] != NULL;
+    }
+
+    if (columns[c] == NULL) {
+      goto done;
+    }
+  }
+
+  int32_t *recipeIndex = views[COLUMN_RECIPE].buf;
+  double *quantities = views[COLUMN_QUANTITY].buf;
+  int32_t *nameOffsets = views[COLUMN_NAME_OFFSETS].buf;
+  int32_t *unitOffsets = views[COLUMN_UNIT_OFFSETS].buf;
+  char *names = PyBytes_AS_STRING(columns[COLUMN_NAMES]);
+  char *units = PyBytes_AS_STRING(columns[COLUMN_UNITS]);
+
+  // fill in every column
+  Py_ssize_t row = 0;
+  nameOffsets[0] = 0;
+  unitOffsets[0] = 0;
+
+  for (Py_ssize_t r = 0; r < recipeCount; r++) {
+    Recipe *parsedRecipe = ((RecipeObject *)recipeObjects[r])->recipe;
+
+    for (size_t i = 0; i < getStepCount(parsedRecipe); i++) {
+      Step *curStep = getStep(parsedRecipe, i);
+
+      for (size_t j = 0; j < vectorLength(&curStep->ingredients); j++) {
+        Direction *curDir = stepIngredient(curStep, j);
+
+        recipeIndex[row] = (int32_t)r;
+        quantities[row] = directionQuantity(curDir);
+        appendColumnText(names, nameOffsets, row, columnText(curDir->value));
+        appendColumnText(units, unitOffsets, row, columnText(curDir->unit));
+        row++;
+      }
+    }
+  }
+
+  // the arrays can only be handed out once nothing is writing to them
+  for (int c = 0; c < COLUMN_COUNT; c++) {
+    if (opened[c]) {
+      PyBuffer_Release(&views[c]);
+      opened[c] = false;
+    }
+  }
+
+  static const StringId columnKeys[COLUMN_COUNT] = {
+      KEY_RECIPE, KEY_QUANTITY,     KEY_NAME_OFFSETS,
+      KEY_NAMES,  KEY_UNIT_OFFSETS, KEY_UNITS};
+
+  result = PyDict_New();
+  if (result == NULL) {
+    goto done;
+  }
+
+  for (int c = 0; c < COLUMN_COUNT; c++) {
+    if (PyDict_SetItem(result, strings[columnKeys[c]], columns[c]) == -1) {
+      Py_CLEAR(result);
+      break;
+    }
+  }
+
+done:
+  for (int c = 0; c < COLUMN_COUNT; c++) {
+    if (opened[c]) {
+      PyBuffer_Release(&views[c]);
+    }
+
+    Py_XDECREF(columns[c]);
+  }
+
+  Py_XDECREF(arrayType);
+  Py_DECREF(items);
+
+  return result;
+}
+
+// parse a recipe file, it is read and parsed without holding the GIL so only
+// building the result needs it
+static PyObject *methodParseRecipeFile(PyObject *self, PyObject *const *args,
+                                       Py_ssize_t nargs, PyObject *kwnames) {
+  static const char *const names[] = {"path", "lazy"};
+  PyObject *values[2];
+  PyObject *path;
+  int lazy = 0;
+
+  if (unpackArguments("parseRecipeFile", args, nargs, kwnames, names, 2, 1,
+                      values) == -1) {
+    return NULL;
+  }
+
+  if (values[1] != NULL && (lazy = PyObject_IsTrue(values[1])) == -1) {
+    return NULL;
+  }
+
+  // accepts str, bytes and path-like objects
+  if (!PyUnicode_FSConverter(values[0], &path)) {
+    return NULL;
+  }
+
+  Recipe *parsedRecipe;
+  int error;
+
+  Py_BEGIN_ALLOW_THREADS;
+  errno = 0;
+  parsedRecipe = parseRecipe(PyBytes_AS_STRING(path));
+  error = errno;
+  Py_END_ALLOW_THREADS;
+
+  if (parsedRecipe == NULL) {
+    if (error != 0) {
+      errno = error;
+      PyErr_SetFromErrnoWithFilenameObject(PyExc_OSError, values[0]);
+    } else {
+      PyErr_Format(PyExc_OSError, "could not read recipe file '%s'",
+                   PyBytes_AS_STRING(path));
+    }
+    Py_DECREF(path);
+    return NULL;
+  }
+
+  Py_DECREF(path);
+
+  CooklangState *state = PyModule_GetState(self);
+
+  if (lazy) {
+    return recipeObjectFromRecipe(state->recipeType, parsedRecipe);
+  }
+
+  PyObject *recipeObject = recipeToPyObject(state, parsedRecipe);
+
+  deleteRecipe(parsedRecipe);
+
+  return recipeObject;
+}
+
+// the number of processors, the default number of workers
+static int processorCount(void) {
+  long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+  return count < 1 ? 1 : (int)count;
+}
+
+// reads a worker count argument, 0 when it isn't given
+static int workersArgument(PyObject *argument) {
+  if (argument == NULL) {
+    return 0;
+  }
+
+  long count = PyLong_AsLong(argument);
+  if (count == -1 && PyErr_Occurred()) {
+    return -1;
+  }
+
+  if (count < 0) {
+    PyErr_SetString(PyExc_ValueError, "workers must not be negative");
+    return -1;
+  }
+
+  if (count > INT_MAX) {
+    PyErr_SetString(PyExc_OverflowError, "workers is too large");
+    return -1;
+  }
+
+  return (int)count;
+}
+
+// work shared between the threads of a parse_many call, each worker takes
+// the next unparsed input until there are none left
+typedef struct {
+  const char **inputs;
+  Py_ssize_t *lengths;
+  Recipe **results;
+  // the errno of each file that couldn't be read
+  int *errors;
+  Py_ssize_t count;
+  Py_ssize_t next;
+  int isPath;
+  pthread_mutex_t lock;
+} ParseBatch;
+
+static void *parseBatchWorker(void *data) {
+  ParseBatch *batch = data;
+  Py_ssize_t i;
+
+  while (1) {
+    pthread_mutex_lock(&batch->lock);
+    i = batch->next++;
+    pthread_mutex_unlock(&batch->lock);
+
+    if (i >= batch->count) {
+      break;
+    }
+
+    if (batch->isPath) {
+      errno = 0;
+      batch->results[i] = parseRecipe((char *)batch->inputs[i]);
+      batch->errors[i] = errno;
+    } else {
+      batch->results[i] =
+          parseRecipeBuffer(batch->inputs[i], batch->lengths[i]);
+    }
+  }
+
+  return NULL;
+}
+
+// parse a list of recipes on native threads, the GIL is only held to read
+// the inputs and to build the python objects once every recipe is parsed
+static PyObject *methodParseMany(PyObject *self, PyObject *const *args,
+                                 Py_ssize_t nargs, PyObject *kwnames) {
+  static const char *const names[] = {"recipes", "workers", "paths", "lazy"};
+  PyObject *values[4];
+  CooklangState *state = PyModule_GetState(self);
+
+  PyObject *recipes;
+  int workers = 0;
+  int isPath = 0;
+  int lazy = 0;
+
+  Py_ssize_t i;
+  Py_ssize_t length;
+  int threadCount = 0;
+
+  PyObject *items;
+  PyObject *item;
+  PyObject **converted;
+  Py_buffer *views;
+  PyObject *resultList = NULL;
+  PyObject *recipeObject;
+
+  ParseBatch batch;
+  pthread_t *threads;
+
+  if (unpackArguments("parse_many", args, nargs, kwnames, names, 4, 1,
+                      values) == -1) {
+    return NULL;
+  }
+
+  recipes = values[0];
+
+  if ((workers = workersArgument(values[1])) == -1) {
+    return NULL;
+  }
+
+  if (values[2] != NULL && (isPath = PyObject_IsTrue(values[2])) == -1) {
+    return NULL;
+  }
+
+  if (values[3] != NULL && (lazy = PyObject_IsTrue(values[3])) == -1) {
+    return NULL;
+  }
+
+  // take a tuple copy so the inputs can't change while the GIL is released
+  items = PySequence_Tuple(recipes);
+  if (items == NULL) {
+    return NULL;
+  }
+
+  length = PyTuple_GET_SIZE(items);
+
+  batch.inputs = PyMem_Calloc(length + 1, sizeof(char *));
+  batch.lengths = PyMem_Calloc(length + 1, sizeof(Py_ssize_t));
+  batch.results = PyMem_Calloc(length + 1, sizeof(Recipe *));
+  batch.errors = PyMem_Calloc(length + 1, sizeof(int));
+  converted = PyMem_Calloc(length + 1, sizeof(PyObject *));
+  views = PyMem_Calloc(length + 1, sizeof(Py_buffer));
+
+  if (batch.inputs == NULL || batch.lengths == NULL || batch.results == NULL ||
+      batch.errors == NULL || converted == NULL || views == NULL) {
+    PyErr_NoMemory();
+    goto done;
+  }
+
+  // get the bytes of every input before letting go of the GIL, buffers are
+  // held until the end so they can't be resized in the meantime
+  for (i = 0; i < length; i++) {
+    item = PyTuple_GET_ITEM(items, i);
+
+    if (isPath) {
+      if (!PyUnicode_FSConverter(item, &converted[i])) {
+        goto done;
+      }
+      batch.inputs[i] = PyBytes_AS_STRING(converted[i]);
+    } else if (sourceArgument(item, &views[i], &batch.inputs[i],
+                              &batch.lengths[i]) == -1) {
+      goto done;
+    }
+  }
+
+  batch.count = length;
+  batch.next = 0;
+  batch.isPath = isPath;
+
+  // default to one worker per processor
+  if (workers == 0) {
+    workers = processorCount();
+  }
+
+  if (workers > length) {
+    workers = (int)length;
+  }
+
+  pthread_mutex_init(&batch.lock, NULL);
+
+  Py_BEGIN_ALLOW_THREADS;
+
+  // the calling thread works too, so only start the extra workers
+  threads = NULL;
+  if (workers > 1) {
+    threads = malloc(sizeof(pthread_t) * (workers - 1));
+  }
+
+  if (threads != NULL) {
+    for (threadCount = 0; threadCount < workers - 1; threadCount++) {
+      if (pthread_create(&threads[threadCount], NULL, parseBatchWorker,
+                         &batch) != 0) {
+        break;
+      }
+    }
+  }
+
+  parseBatchWorker(&batch);
+
+  for (i = 0; i < threadCount; i++) {
+    pthread_join(threads[i], NULL);
+  }
+
+  free(threads);
+
+  Py_END_ALLOW_THREADS;
+
+  pthread_mutex_destroy(&batch.lock);
+
+  // build the python objects, in input order
+  for (i = 0; i < length; i++) {
+    if (batch.results[i] == NULL) {
+      // a path fails when the file can't be read, the same way
+      // parseRecipeFile does, text only when malloc does
+      if (isPath && batch.errors[i] != 0) {
+        errno = batch.errors[i];
+        PyErr_SetFromErrnoWithFilenameObject(PyExc_OSError,
+                                             PyTuple_GET_ITEM(items, i));
+      } else if (isPath) {
+        PyErr_Format(PyExc_OSError, "could not read recipe file '%s'",
+                     batch.inputs[i]);
+      } else {
+        PyErr_NoMemory();
+      }
+      goto done;
+    }
+  }
+
+  resultList = PyList_New(length);
+  if (resultList == NULL) {
+    goto done;
+  }
+
+  for (i = 0; i < length; i++) {
+    if (lazy) {
+      // the recipe object takes the parsed recipe over
+      recipeObject =
+          recipeObjectFromRecipe(state->recipeType, batch.results[i]);
+      batch.results[i] = NULL;
+    } else {
+      recipeObject = recipeToPyObject(state, batch.results[i]);
+    }
+
+    if (recipeObject == NULL) {
+      Py_CLEAR(resultList);
+      goto done;
+    }
+    PyList_SET_ITEM(resultList, i, recipeObject);
+  }
+
+done:
+  if (batch.results != NULL) {
+    for (i = 0; i < length; i++) {
+      deleteRecipe(batch.results[i]);
+    }
+  }
+
+  if (converted != NULL) {
+    for (i = 0; i < length; i++) {
+      Py_XDECREF(converted[i]);
+    }
+  }
+
+  if (views != NULL) {
+    for (i = 0; i < length; i++) {
+      PyBuffer_Release(&views[i]);
+    }
+  }
+
+  PyMem_Free(batch.inputs);
+  PyMem_Free(batch.lengths);
+  PyMem_Free(batch.results);
+  PyMem_Free(batch.errors);
+  PyMem_Free(converted);
+  PyMem_Free(views);
+  Py_DECREF(items);
+
+  return resultList;
+}
+
+// a parsed file waiting in an iter_parse queue
+typedef struct {
+  Py_ssize_t index;
+  Recipe *recipe;
+  int error;
+  int ready;
+} ParseSlot;
+
+// an iter_parse call - native workers parse the files into a bounded queue
+// and the python iterator takes the results out as they are ready, so only
+// capacity recipes are ever waiting at once
+typedef struct {
+  PyObject_HEAD PyObject *paths;
+  PyObject **converted;
+  Py_ssize_t count;
+  int lazy;
+  int ordered;
+
+  pthread_t *threads;
+  int threadCount;
+
+  // everything below is shared with the workers and guarded by lock
+  pthread_mutex_t lock;
+  pthread_cond_t changed;
+
+  // results are stored in the slots in the order they are taken out, which
+  // is the input order or the order they were parsed in
+  ParseSlot *slots;
+  Py_ssize_t capacity;
+
+  // the next input to parse, the results stored and the results taken
+  Py_ssize_t claimed;
+  Py_ssize_t produced;
+  Py_ssize_t consumed;
+
+  int stopping;
+} ParseIterObject;
+
+static void *parseIterWorker(void *data) {
+  ParseIterObject *self = data;
+
+  pthread_mutex_lock(&self->lock);
+
+  while (1) {
+    // only start on a file once there is room for its result
+    while (!self->stopping && self->claimed < self->count &&
+           self->claimed - self->consumed >= self->capacity) {
+      pthread_cond_wait(&self->changed, &self->lock);
+    }
+
+    if (self->stopping || self->claimed >= self->count) {
+      break;
+    }
+
+    Py_ssize_t index = self->claimed++;
+
+    pthread_mutex_unlock(&self->lock);
+
+    errno = 0;
+    Recipe *recipe = parseRecipe(PyBytes_AS_STRING(self->converted[index]));
+    int error = errno;
+
+    pthread_mutex_lock(&self->lock);
+
+    // in order every input has its own slot, otherwise results queue up
+    ParseSlot *slot =
+        &self->slots[(self->ordered ? index : self->produced) % self->capacity];
+    self->produced++;
+
+    slot->index = index;
+    slot->recipe = recipe;
+    slot->error = error;
+    slot->ready = 1;
+
+    pthread_cond_broadcast(&self->changed);
+  }
+
+  pthread_mutex_unlock(&self->lock);
+
+  return NULL;
+}
+
+// stops the workers, waiting for any file they are in the middle of
+static void parseIterStop(ParseIterObject *self) {
+  if (self->threads == NULL) {
+    return;
+  }
+
+  pthread_mutex_lock(&self->lock);
+  self->stopping = 1;
+  pthread_cond_broadcast(&self->changed);
+  pthread_mutex_unlock(&self->lock);
+
+  Py_BEGIN_ALLOW_THREADS;
+  for (int i = 0; i < self->threadCount; i++) {
+    pthread_join(self->threads[i], NULL);
+  }
+  Py_END_ALLOW_THREADS;
+
+  free(self->threads);
+  self->threads = NULL;
+}
+
+static void parseIterDealloc(ParseIterObject *self) {
+  parseIterStop(self);
+
+  // free any results that were never taken out
+  if (self->slots != NULL) {
+    for (Py_ssize_t i = 0; i < self->capacity; i++) {
+      if (self->slots[i].ready) {
+        deleteRecipe(self->slots[i].recipe);
+      }
+    }
+  }
+
+  pthread_mutex_destroy(&self->lock);
+  pthread_cond_destroy(&self->changed);
+
+  if (self->converted != NULL) {
+    for (Py_ssize_t i = 0; i < self->count; i++) {
+      Py_XDECREF(self->converted[i]);
+    }
+  }
+
+  PyTypeObject *type = Py_TYPE(self);
+
+  PyMem_Free(self->converted);
+  PyMem_Free(self->slots);
+  Py_XDECREF(self->paths);
+  type->tp_free((PyObject *)self);
+  Py_DECREF(type);
+}
+
+// the next (path, recipe) pair, waiting for it without the GIL
+static PyObject *parseIterNext(ParseIterObject *self) {
+  ParseSlot result = {0, NULL, 0, 0};
+
+  Py_BEGIN_ALLOW_THREADS;
+  pthread_mutex_lock(&self->lock);
+
+  if (self->consumed < self->count) {
+    ParseSlot *slot = &self->slots[self->consumed % self->capacity];
+
+    while (!slot->ready) {
+      pthread_cond_wait(&self->changed, &self->lock);
+      slot = &self->slots[self->consumed % self->capacity];
+    }
+
+    result = *slot;
+    slot->ready = 0;
+    self->consumed++;
+
+    pthread_cond_broadcast(&self->changed);
+  }
+
+  pthread_mutex_unlock(&self->lock);
+  Py_END_ALLOW_THREADS;
+
+  // every file has been handed out
+  if (!result.ready) {
+    return NULL;
+  }
+
+  PyObject *path = PyTuple_GET_ITEM(self->paths, result.index);
+
+  if (result.recipe == NULL) {
+    if (result.error != 0) {
+      errno = result.error;
+      return PyErr_SetFromErrnoWithFilenameObject(PyExc_OSError, path);
+    }
+
+    return PyErr_Format(PyExc_OSError, "could not read recipe file '%s'",
+                        PyBytes_AS_STRING(self->converted[result.index]));
+  }
+
+  PyObject *recipeObject;
+
+  CooklangState *state = PyType_GetModuleState(Py_TYPE(self));
+
+  if (self->lazy) {
+    recipeObject = recipeObjectFromRecipe(state->recipeType, result.recipe);
+  } else {
+    recipeObject = recipeToPyObject(state, result.recipe);
+    deleteRecipe(result.recipe);
+  }
+
+  if (recipeObject == NULL) {
+    return NULL;
+  }
+
+  return Py_BuildValue("(ON)", path, recipeObject);
+}
+
+static PyType_Slot parseIterSlots[] = {
+    {Py_tp_doc, "Iterator over the recipe files of an iter_parse call."},
+    {Py_tp_dealloc, parseIterDealloc},
+    {Py_tp_iter, PyObject_SelfIter},
+    {Py_tp_iternext, parseIterNext},
+    {0, NULL}};
+
+static PyType_Spec parseIterSpec = {
+    .name = "cooklang.ParseIterator",
+    .basicsize = sizeof(ParseIterObject),
+    .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_IMMUTABLETYPE |
+             Py_TPFLAGS_DISALLOW_INSTANTIATION,
+    .slots = parseIterSlots};
+
+// parse recipe files on native threads, yielding each as it is ready
+static PyObject *methodIterParse(PyObject *self, PyObject *const *args,
+                                 Py_ssize_t nargs, PyObject *kwnames) {
+  static const char *const names[] = {"paths", "workers", "ordered", "lazy"};
+  PyObject *values[4];
+  int workers;
+  int ordered = 0;
+  int lazy = 0;
+
+  if (unpackArguments("iter_parse", args, nargs, kwnames, names, 4, 1,
+                      values) == -1) {
+    return NULL;
+  }
+
+  if ((workers = workersArgument(values[1])) == -1) {
+    return NULL;
+  }
+
+  if (values[2] != NULL && (ordered = PyObject_IsTrue(values[2])) == -1) {
+    return NULL;
+  }
+
+  if (values[3] != NULL && (lazy = PyObject_IsTrue(values[3])) == -1) {
+    return NULL;
+  }
+
+  CooklangState *state = PyModule_GetState(self);
+  ParseIterObject *iterator =
+      PyObject_New(ParseIterObject, state->parseIterType);
+  if (iterator == NULL) {
+    return NULL;
+  }
+
+  iterator->converted = NULL;
+  iterator->slots = NULL;
+  iterator->threads = NULL;
+  iterator->threadCount = 0;
+  iterator->lazy = lazy;
+  iterator->ordered = ordered;
+  iterator->claimed = 0;
+  iterator->produced = 0;
+  iterator->consumed = 0;
+  iterator->stopping = 0;
+
+  pthread_mutex_init(&iterator->lock, NULL);
+  pthread_cond_init(&iterator->changed, NULL);
+
+  // take a tuple copy so the paths can't change while the workers run
+  iterator->paths = PySequence_Tuple(values[0]);
+  if (iterator->paths == NULL) {
+    iterator->count = 0;
+    goto error;
+  }
+
+  iterator->count = PyTuple_GET_SIZE(iterator->paths);
+
+  iterator->converted = PyMem_Calloc(iterator->count + 1, sizeof(PyObject *));
+  if (iterator->converted == NULL) {
+    PyErr_NoMemory();
+    goto error;
+  }
+
+  for (Py_ssize_t i = 0; i < iterator->count; i++) {
+    if (!PyUnicode_FSConverter(PyTuple_GET_ITEM(iterator->paths, i),
+                               &iterator->converted[i])) {
+      goto error;
+    }
+  }
+
+  // default to one worker per processor, each with room for two results
+  if (workers == 0) {
+    workers = processorCount();
+  }
+
+  if (workers > iterator->count) {
+    workers = (int)iterator->count;
+  }
+
+  iterator->capacity = workers * 2 > 0 ? workers * 2 : 1;
+
+  iterator->slots = PyMem_Calloc(iterator->capacity, sizeof(ParseSlot));
+  iterator->threads = malloc(sizeof(pthread_t) * (workers + 1));
+  if (iterator->slots == NULL || iterator->threads == NULL) {
+    PyErr_NoMemory();
+    goto error;
+  }
+
+  for (int i = 0; i < workers; i++) {
+    if (pthread_create(&iterator->threads[iterator->threadCount], NULL,
+                       parseIterWorker, iterator) != 0) {
+      break;
+    }
+    iterator->threadCount++;
+  }
+
+  if (workers > 0 && iterator->threadCount == 0) {
+    PyErr_SetString(PyExc_RuntimeError, "could not start any workers");
+    goto error;
+  }
+
+  return (PyObject *)iterator;
+
+error:
+  Py_DECREF(iterator);
+  return NULL;
+}
+
+// build the python object for a shopping item
+static PyObject *shoppingItemToPyObject(CooklangState *state,
+                                        ShoppingItem *curItem) {
+  PyObject *shopItemObject = PyDict_New();
+  PyObject *synListObject = PyList_New(0);
+
+  if (shopItemObject == NULL || synListObject == NULL) {
+    goto error;
+  }
+
+  if (setItemStealing(shopItemObject, state->strings[KEY_NAME],
+                      PyUnicode_FromString(curItem->name)) == -1) {
+    goto error;
+  }
+
+  // loop through each synonym
+  if (curItem->synonyms != NULL) {
+    for (int synCount = 0; curItem->synonyms[synCount] != NULL; synCount++) {
+      if (appendStealing(synListObject, PyUnicode_FromString(
+                                            curItem->synonyms[synCount])) ==
+          -1) {
+        goto error;
+      }
+    }
+  }
+
+  // add the synonyms to the item
+  if (setItemStealing(shopItemObject, state->strings[KEY_SYNONYMS],
+                      synListObject) == -1) {
+    synListObject = NULL;
+    goto error;
+  }
+
+  return shopItemObject;
+
+error:
+  Py_XDECREF(shopItemObject);
+  Py_XDECREF(synListObject);
+  return NULL;
+}
+
+// build the python object for a shopping list
+static PyObject *shoppingListToPyObject(CooklangState *state,
+                                        ShoppingList *curList) {
+  PyObject *shopListObject = PyDict_New();
+  PyObject *itemListObject = PyList_New(0);
+
+  if (shopListObject == NULL || itemListObject == NULL) {
+    goto error;
+  }
+
+  // add the category
+  if (setItemStealing(shopListObject, state->strings[KEY_CATEGORY],
+                      PyUnicode_FromString(curList->category)) == -1) {
+    goto error;
+  }
+
+  // add each shopping item to the list
+  ListIterator itemIter = createIterator(curList->shoppingItems);
+  ShoppingItem *curItem = nextElement(&itemIter);
+
+  while (curItem != NULL) {
+    if (appendStealing(itemListObject,
+                       shoppingItemToPyObject(state, curItem)) == -1) {
+      goto error;
+    }
+
+    curItem = nextElement(&itemIter);
+  }
+
+  // add the list of shopping items to the shopping list
+  if (setItemStealing(shopListObject, state->strings[KEY_ITEMS],
+                      itemListObject) == -1) {
+    itemListObject = NULL;
+    goto error;
+  }
+
+  return shopListObject;
+
+error:
+  Py_XDECREF(shopListObject);
+  Py_XDECREF(itemListObject);
+  return NULL;
+}
+
+// build the python list of shopping lists, then free the shopping lists
+static PyObject *shoppingListsToPyObject(CooklangState *state,
+                                         List *shoppingLists) {
+  // convert to python object - a list of lists
+  PyObject *shopListList = PyList_New(0);
+
+  // loop through each shopping list
+  ListIterator sListIter = createIterator(shoppingLists);
+  ShoppingList *curList = nextElement(&sListIter);
+
+  while (shopListList != NULL && curList != NULL) {
+    if (appendStealing(shopListList, shoppingListToPyObject(state, curList)) ==
+        -1) {
+      Py_CLEAR(shopListList);
+    }
+
+    curList = nextElement(&sListIter);
+  }
+
+  freeList(shoppingLists);
+
+  return shopListList;
+}
+
+static PyObject *methodParseShoppingList(PyObject *self, PyObject *argument) {
+  // get args - no embedded null code points
+  const char *fileName = textArgument(argument);
+  if (fileName == NULL) {
+    return NULL;
+  }
+
+  // parse the shopping list
+  List *shoppingLists = parseShoppingLists((char *)fileName);
+  if (shoppingLists == NULL) {
+    return PyErr_Format(PyExc_OSError, "could not open shopping list file '%s'",
+                        fileName);
+  }
+
+  return shoppingListsToPyObject(PyModule_GetState(self), shoppingLists);
+}
+
+// parses the shopping lists held in a str or bytes-like object, the text
+// is taken with its length so it needs no NUL terminator
+static List *shoppingListsFromSource(PyObject *argument) {
+  Py_buffer view;
+  const char *source;
+  Py_ssize_t length;
+  List *shoppingLists;
+
+  if (sourceArgument(argument, &view, &source, &length) == -1) {
+    return NULL;
+  }
+
+  // a str's text lives as long as the borrowed str and a buffer is held on
+  // to by the view, so either is parsed without the GIL
+  Py_BEGIN_ALLOW_THREADS;
+  shoppingLists = parseShoppingListsBuffer(source, length);
+  Py_END_ALLOW_THREADS;
+
+  PyBuffer_Release(&view);
+
+  if (shoppingLists == NULL) {
+    PyErr_NoMemory();
+  }
+
+  return shoppingLists;
+}
+
+static PyObject *methodParseShoppingListBuffer(PyObject *self,
+                                               PyObject *argument) {
+  List *shoppingLists = shoppingListsFromSource(argument);
+  if (shoppingLists == NULL) {
+    return NULL;
+  }
+
+  return shoppingListsToPyObject(PyModule_GetState(self), shoppingLists);
+}
+
+// python shopping index type, it owns the parsed shopping lists and a hash
+// index over every name and synonym in them
+typedef struct {
+  PyObject_HEAD List *shoppingLists;
+  ShoppingIndex *index;
+} ShoppingIndexObject;
+
+// wraps parsed shopping lists in a python shopping index, which takes them
+// over and indexes them
+static PyObject *shoppingIndexFromLists(PyTypeObject *type,
+                                        List *shoppingLists) {
+  ShoppingIndexObject *self = (ShoppingIndexObject *)type->tp_alloc(type, 0);
+  if (self == NULL) {
+    freeList(shoppingLists);
+    return NULL;
+  }
+
+  self->shoppingLists = shoppingLists;
+
+  self->index = createShoppingIndex(self->shoppingLists);
+  if (self->index == NULL) {
+    Py_DECREF(self);
+    return PyErr_NoMemory();
+  }
+
+  return (PyObject *)self;
+}
+
+static PyObject *shoppingIndexNew(PyTypeObject *type, PyObject *args,
+                                  PyObject *kwargs) {
+  static char *kwlist[] = {"path", NULL};
+  PyObject *pathObject;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O", kwlist, &pathObject)) {
+    return NULL;
+  }
+
+  const char *fileName = textArgument(pathObject);
+  if (fileName == NULL) {
+    return NULL;
+  }
+
+  List *shoppingLists = parseShoppingLists((char *)fileName);
+  if (shoppingLists == NULL) {
+    return PyErr_Format(PyExc_OSError, "could not open shopping list file '%s'",
+                        fileName);
+  }
+
+  return shoppingIndexFromLists(type, shoppingLists);
+}
+
+// builds a shopping index from the text of a shopping list file
+static PyObject *shoppingIndexFromBuffer(PyTypeObject *type,
+                                         PyObject *argument) {
+  List *shoppingLists = shoppingListsFromSource(argument);
+  if (shoppingLists == NULL) {
+    return NULL;
+  }
+
+  return shoppingIndexFromLists(type, shoppingLists);
+}
+
+static void shoppingIndexDealloc(ShoppingIndexObject *self) {
+  PyTypeObject *type = Py_TYPE(self);
+
+  deleteShoppingIndex(self->index);
+  if (self->shoppingLists != NULL) {
+    freeList(self->shoppingLists);
+  }
+  type->tp_free((PyObject *)self);
+  Py_DECREF(type);
+}
+
+// looks up the category and item of a name or synonym, None if there is none
+static PyObject *shoppingIndexFind(ShoppingIndexObject *self,
+                                   PyObject *argument) {
+  Py_ssize_t length;
+  const char *name = PyUnicode_AsUTF8AndSize(argument, &length);
+  if (name == NULL) {
+    return NULL;
+  }
+
+  ShoppingIndexEntry *entry = findShoppingItem(self->index, name, length);
+
+  if (entry == NULL) {
+    Py_RETURN_NONE;
+  }
+
+  return Py_BuildValue("(ss)", entry->list->category, entry->item->name);
+}
+
+static Py_ssize_t shoppingIndexLength(ShoppingIndexObject *self) {
+  return (Py_ssize_t)self->index->count;
+}
+
+static PyMethodDef shoppingIndexMethods[] = {
+    {"from_buffer", (PyCFunction)shoppingIndexFromBuffer, METH_O | METH_CLASS,
+     "Builds an index from the text of a shopping list file, as a str or "
+     "bytes-like object."},
+    {"find", (PyCFunction)shoppingIndexFind, METH_O,
+     "Returns the (category, item name) of a name or synonym, or None. "
+     "Surrounding whitespace and ascii case are ignored."},
+    {NULL, NULL, 0, NULL}};
+
+static PyType_Slot shoppingIndexSlots[] = {
+    {Py_tp_doc,
+     "The shopping lists of a file, indexed by every item name and synonym."},
+    {Py_tp_new, shoppingIndexNew},
+    {Py_tp_dealloc, shoppingIndexDealloc},
+    {Py_tp_methods, shoppingIndexMethods},
+    {Py_mp_length, shoppingIndexLength},
+    {0, NULL}};
+
+static PyType_Spec shoppingIndexSpec = {
+    .name = "cooklang.ShoppingIndex",
+    .basicsize = sizeof(ShoppingIndexObject),
+    .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_IMMUTABLETYPE,
+    .slots = shoppingIndexSlots};
+
+// build the python object for one line of a shopping plan
+static PyObject *shoppingPlanItemToPyObject(CooklangState *state,
+                                            ShoppingPlanItem *item) {
+  PyObject **strings = state->strings;
+
+  PyObject *itemObject = PyDict_New();
+  if (itemObject == NULL) {
+    return NULL;
+  }
+
+  PyObject *quantity = item->quantityText != NULL
+                           ? PyUnicode_FromString(item->quantityText)
+                           : PyFloat_FromDouble(item->quantity);
+
+  if (setItemStealing(itemObject, strings[KEY_NAME],
+                      PyUnicode_FromString(item->name)) == -1 ||
+      setItemStealing(itemObject, strings[KEY_QUANTITY], quantity) == -1 ||
+      setItemStealing(itemObject, strings[KEY_UNITS],
+                      PyUnicode_FromString(item->unit)) == -1) {
+    Py_DECREF(itemObject);
+    return NULL;
+  }
+
+  return itemObject;
+}
+
+// build the python list of a shopping plan, one dict for each shopping list
+// it uses in file order - the lines on no list come last with no category
+static PyObject *shoppingPlanToPyObject(CooklangState *state,
+                                        ShoppingPlan *plan) {
+  PyObject *planObject = PyList_New(0);
+  PyObject *itemListObject = NULL;
+
+  if (planObject == NULL) {
+    return NULL;
+  }
+
+  for (size_t i = 0; i < vectorLength(&plan->items); i++) {
+    ShoppingPlanItem *item = vectorGet(&plan->items, i);
+    ShoppingPlanItem *previous = i > 0 ? vectorGet(&plan->items, i - 1) : NULL;
+
+    // the lines are grouped, so a new list starts a new group
+    if (previous == NULL || previous->list != item->list) {
+      PyObject *groupObject = PyDict_New();
+      PyObject *category = item->list != NULL
+                               ? PyUnicode_FromString(item->list->category)
+                               : Py_NewRef(Py_None);
+
+      if (groupObject == NULL || category == NULL) {
+        Py_XDECREF(groupObject);
+        Py_XDECREF(category);
+        goto error;
+      }
+
+      if (appendStealing(planObject, groupObject) == -1 ||
+          setItemStealing(groupObject, state->strings[KEY_CATEGORY],
+                          category) == -1) {
+        goto error;
+      }
+
+      itemListObject = PyList_New(0);
+      if (setItemStealing(groupObject, state->strings[KEY_ITEMS],
+                          Py_XNewRef(itemListObject)) == -1) {
+        goto error;
+      }
+      Py_DECREF(itemListObject);
+    }
+
+    if (appendStealing(itemListObject,
+                       shoppingPlanItemToPyObject(state, item)) == -1) {
+      goto error;
+    }
+  }
+
+  return planObject;
+
+error:
+  Py_DECREF(planObject);
+  return NULL;
+}
+
+// merge the ingredients of some recipes into a shopping list grouped by the
+// shopping lists of an index
+static PyObject *methodBuildShoppingList(PyObject *self, PyObject *const *args,
+                                         Py_ssize_t nargs, PyObject *kwnames) {
+  static const char *const names[] = {"recipes", "index"};
+  PyObject *values[2];
+  CooklangState *state = PyModule_GetState(self);
+  ShoppingIndex *index = NULL;
+
+  if (unpackArguments("build_shopping_list", args, nargs, kwnames, names, 2,
+                      1, values) == -1) {
+    return NULL;
+  }
+
+  if (values[1] != NULL && values[1] != Py_None) {
+    if (!PyObject_TypeCheck(values[1], state->shoppingIndexType)) {
+      return PyErr_Format(PyExc_TypeError,
+                          "index must be a cooklang.ShoppingIndex, not %.200s",
+                          Py_TYPE(values[1])->tp_name);
+    }
+    index = ((ShoppingIndexObject *)values[1])->index;
+  }
+
+  PyObject *items = PySequence_Fast(values[0], "recipes must be a sequence");
+  if (items == NULL) {
+    return NULL;
+  }
+
+  Py_ssize_t recipeCount = PySequence_Fast_GET_SIZE(items);
+  PyObject **recipeObjects = PySequence_Fast_ITEMS(items);
+  Recipe **recipes = PyMem_Malloc(sizeof(Recipe *) * (recipeCount + 1));
+
+  if (recipes == NULL) {
+    Py_DECREF(items);
+    return PyErr_NoMemory();
+  }
+
+  for (Py_ssize_t r = 0; r < recipeCount; r++) {
+    if (!PyObject_TypeCheck(recipeObjects[r], state->recipeType)) {
+      PyErr_Format(PyExc_TypeError,
+                   "recipes must be cooklang.Recipe objects, not %.200s",
+                   Py_TYPE(recipeObjects[r])->tp_name);
+      PyMem_Free(recipes);
+      Py_DECREF(items);
+      return NULL;
+    }
+
+    recipes[r] = ((RecipeObject *)recipeObjects[r])->recipe;
+  }
+
+  ShoppingPlan *plan = createShoppingPlan(recipes, recipeCount, index);
+
+  PyMem_Free(recipes);
+  Py_DECREF(items);
+
+  if (plan == NULL) {
+    return PyErr_NoMemory();
+  }
+
+  PyObject *planObject = shoppingPlanToPyObject(state, plan);
+  deleteShoppingPlan(plan);
+
+  return planObject;
+}
+
+// python module methods array
+static PyMethodDef cooklangMethods[] = {
+    {"parseRecipe", (PyCFunction)(void (*)(void))methodParseRecipe,
+     METH_FASTCALL | METH_KEYWORDS,
+     "Python wrapper function that parses recipes written in the cooklang "
+     "language specification. The recipe can be a str or any bytes-like "
+     "object holding UTF-8 text. With lazy=True it returns a Recipe whose "
+     "parts are only built when they are first read."},
+    {"parse_to_json_bytes", methodParseToJsonBytes, METH_O,
+     "Parses a recipe, as a str or bytes-like object, and returns the "
+     "recipe parseRecipe would give as UTF-8 JSON bytes."},
+    {"parse_shopping_list_buffer", methodParseShoppingListBuffer, METH_O,
+     "Parses the text of a shopping list file, as a str or bytes-like "
+     "object, into the same lists as parseShoppingList."},
+    {"build_shopping_list",
+     (PyCFunction)(void (*)(void))methodBuildShoppingList,
+     METH_FASTCALL | METH_KEYWORDS,
+     "Merges the ingredients of a list of Recipe objects by name, unit and "
+     "kind of quantity, and groups them by the shopping lists of an "
+     "optional ShoppingIndex."},
+    {"parseRecipeFile", (PyCFunction)(void (*)(void))methodParseRecipeFile,
+     METH_FASTCALL | METH_KEYWORDS,
+     "Parses the recipe file at path. The file is read and parsed without "
+     "holding the GIL, and takes the same lazy argument as parseRecipe."},
+    {"parse_many", (PyCFunction)(void (*)(void))methodParseMany,
+     METH_FASTCALL | METH_KEYWORDS,
+     "Parses a list of recipe strings or bytes-like objects, or recipe files "
+     "when paths is True, on "
+     "a pool of native threads with the GIL released. workers defaults to "
+     "the number of processors. Returns the parsed recipes in input order, "
+     "as Recipe objects when lazy is True."},
+    {"ingredient_columns", methodIngredientColumns, METH_O,
+     "Exports the ingredients of a sequence of Recipe objects as packed "
+     "columns, one row per ingredient: recipe (array of int32 recipe "
+     "indices), quantity (array of doubles, NaN when it isn't a number), "
+     "names and units (UTF-8 bytes) with name_offsets and unit_offsets "
+     "(arrays of int32 offsets with one more entry than there are rows)."},
+    {"iter_parse", (PyCFunction)(void (*)(void))methodIterParse,
+     METH_FASTCALL | METH_KEYWORDS,
+     "Parses recipe files on a pool of native threads and yields a "
+     "(path, recipe) pair for each as soon as it is ready. At most two "
+     "results per worker wait to be taken, so memory stays flat however many "
+     "paths there are. workers defaults to the number of processors, "
+     "ordered=True yields in input order and lazy=True yields Recipe "
+     "objects."},
+    {"parseShoppingList", methodParseShoppingList, METH_O,
+     "Python wrapper function that parses shopping lists written in the "
+     "cooklang language specification."},
+    {"printRecipe", methodPrintRecipe, METH_O,
+     "Python wrapper function for printing the contents of a recipe."},
+    {NULL, NULL, 0, NULL}};
+
+static int cooklangTraverse(PyObject *module, visitproc visit, void *arg) {
+  CooklangState *state = PyModule_GetState(module);
+
+  for (int i = 0; i < STRING_COUNT; i++) {
+    Py_VISIT(state->strings[i]);
+  }
+
+  for (int i = 0; i < DIRECTION_KIND_COUNT; i++) {
+    Py_VISIT(state->kindNames[i]);
+  }
+
+  Py_VISIT(state->recipeType);
+  Py_VISIT(state->parseIterType);
+  Py_VISIT(state->shoppingIndexType);
+
+  return 0;
+}
+
+static int cooklangClear(PyObject *module) {
+  CooklangState *state = PyModule_GetState(module);
+
+  for (int i = 0; i < STRING_COUNT; i++) {
+    Py_CLEAR(state->strings[i]);
+  }
+
+  for (int i = 0; i < DIRECTION_KIND_COUNT; i++) {
+    Py_CLEAR(state->kindNames[i]);
+  }
+
+  Py_CLEAR(state->recipeType);
+  Py_CLEAR(state->parseIterType);
+  Py_CLEAR(state->shoppingIndexType);
+
+  return 0;
+}
+
+static void cooklangFree(void *module) { cooklangClear(module); }
+
+// fills in the state of a new module, there is one per interpreter that
+// imports it
+static int cooklangExec(PyObject *module) {
+  CooklangState *state = PyModule_GetState(module);
+
+  // intern the strings every conversion uses
+  for (int i = 0; i < STRING_COUNT; i++) {
+    state->strings[i] = PyUnicode_InternFromString(stringValues[i]);
+    if (state->strings[i] == NULL) {
+      return -1;
+    }
+  }
+
+  for (int i = 0; i < DIRECTION_KIND_COUNT; i++) {
+    state->kindNames[i] = PyUnicode_InternFromString(directionKindName(i));
+    if (state->kindNames[i] == NULL) {
+      return -1;
+    }
+  }
+
+  // the types belong to the module so their objects can find its state
+  state->recipeType = (PyTypeObject *)PyType_FromModuleAndSpec(
+      module, &recipeSpec, NULL);
+  if (state->recipeType == NULL) {
+    return -1;
+  }
+
+  state->parseIterType = (PyTypeObject *)PyType_FromModuleAndSpec(
+      module, &parseIterSpec, NULL);
+  if (state->parseIterType == NULL) {
+    return -1;
+  }
+
+  state->shoppingIndexType = (PyTypeObject *)PyType_FromModuleAndSpec(
+      module, &shoppingIndexSpec, NULL);
+  if (state->shoppingIndexType == NULL) {
+    return -1;
+  }
+
+  if (PyModule_AddType(module, state->recipeType) == -1) {
+    return -1;
+  }
+
+  return PyModule_AddType(module, state->shoppingIndexType);
+}
+
+static PyModuleDef_Slot cooklangSlots[] = {
+    {Py_mod_exec, cooklangExec},
+#ifdef Py_mod_multiple_interpreters
+    {Py_mod_multiple_interpreters, Py_MOD_PER_INTERPRETER_GIL_SUPPORTED},
+#endif
+#ifdef Py_mod_gil
+    {Py_mod_gil, Py_MOD_GIL_NOT_USED},
+#endif
+    {0, NULL}};
+
+// define the module
+static PyModuleDef cooklang = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "cooklang",
+    .m_doc =
+        "A python module that uses C to parse recipe files using cooklang.",
+    .m_size = sizeof(CooklangState),
+    .m_methods = cooklangMethods,
+    .m_slots = cooklangSlots,
+    .m_traverse = cooklangTraverse,
+    .m_clear = cooklangClear,
+    .m_free = cooklangFree};
+
+// initialization function, the module is created in cooklangExec
+PyMODINIT_FUNC PyInit_cooklang(void) { return PyModuleDef_Init(&cooklang); }
@@ -1,162 +1,454 @@
 
 #include "../include/CooklangParser.h"
 
+#include <fcntl.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
+#include "../include/CharClassLib.h"
 #include "../parserFiles/Cooklang.tab.h"
 
-extern FILE* yyin;
+// the scanner runs directly over the source buffer, which has to end in two
+// NUL bytes that mark the end of the input
+#define SOURCE_PADDING 2
+
+// first read size for recipe files, doubled until the whole file fits
+#define SOURCE_READ_SIZE 4096
+
+// recipe files smaller than this are read with a single pread, anything
+// bigger is mapped instead
+#define SOURCE_MAP_THRESHOLD (64 * 1024)
+
+// a padded source buffer read from a file, either on the heap or mapped in
+// which case mappedLength is the length to unmap
+typedef struct {
+  char* data;
+  size_t size;
+  size_t mappedLength;
+} FileSource;
+
+// reentrant scanner interface, every parse owns its own scanner so recipes
+// can be parsed on several threads at once
 typedef struct yy_buffer_state* YY_BUFFER_STATE;
-extern YY_BUFFER_STATE yy_scan_string(char* str);
-extern void yy_delete_buffer(YY_BUFFER_STATE buffer);
+extern int yylex_init_extra(const char* source, yyscan_t* scanner);
+extern int yylex_destroy(yyscan_t scanner);
+extern YY_BUFFER_STATE yy_scan_buffer(char* base, size_t size,
+                                      yyscan_t scanner);
+extern void yy_delete_buffer(YY_BUFFER_STATE buffer, yyscan_t scanner);
+
+// creates an empty recipe with its first step ready to accept directions
+static Recipe* startRecipe() {
+  Recipe* finalRecipe = createRecipe();
+  if (finalRecipe == NULL) {
+    return NULL;
+  }
+
+  addStep(finalRecipe);
+
+  return finalRecipe;
+}
+
+// runs the parser over a source buffer of the given size, padding included
+// tokens are spans into the buffer so it only has to live until this returns
+static void parseSource(Recipe* recipe, char* source, size_t size) {
+  // the scanner matches each multi-byte character by its class, which is the
+  // source itself when there are none
+  char* symbols = classifySource(source, size);
+  if (symbols == NULL) {
+    return;
+  }
+
+  // setup a scanner for this parse only, it maps tokens back to the source
+  yyscan_t scanner;
+  if (yylex_init_extra(source, &scanner) != 0) {
+    printf("Error, could not create scanner");
+  } else {
+    // the scanner reads the buffer in place rather than copying it
+    YY_BUFFER_STATE buffer = yy_scan_buffer(symbols, size, scanner);
+    if (buffer != NULL) {
+      yyparse(scanner, recipe);
+      yy_delete_buffer(buffer, scanner);
+    }
+
+    yylex_destroy(scanner);
+  }
+
+  if (symbols != source) {
+    free(symbols);
+  }
+}
+
+// reads the rest of a file into a padded source buffer, NULL if it fails
+static char* readSource(FILE* file, size_t* size) {
+  size_t capacity = SOURCE_READ_SIZE;
+  size_t length = 0;
+  size_t read = 0;
+
+  char* source = malloc(capacity);
+  if (source == NULL) {
+    return NULL;
+  }
+
+  while ((read = fread(source + length, 1, capacity - length - SOURCE_PADDING,
+                       file)) > 0) {
+    length += read;
+
+    // keep room for the padding and at least one more byte
+    if (capacity - length <= SOURCE_PADDING) {
+      char* grown = realloc(source, capacity * 2);
+      if (grown == NULL) {
+        free(source);
+        return NULL;
+      }
+      source = grown;
+      capacity *= 2;
+    }
+  }
+
+  if (ferror(file)) {
+    free(source);
+    return NULL;
+  }
+
+  memset(source + length, '\0', SOURCE_PADDING);
+  *size = length + SOURCE_PADDING;
+
+  return source;
+}
 
 // wrapper functions
+// this function will parse the recipe from a buffer of the given length, which
+// doesn't have to be NUL terminated
+Recipe* parseRecipeBuffer(const char* buffer, size_t length) {
+  // setup the recipe
+  Recipe* finalRecipe = startRecipe();
+  if (finalRecipe == NULL) {
+    return NULL;
+  }
+
+  // add a newline at the end of the text to prevent errors in the parser,
+  // followed by the padding the scanner needs
+  char* source = malloc(sizeof(char) * (length + 1 + SOURCE_PADDING));
+  if (source == NULL) {
+    deleteRecipe(finalRecipe);
+    return NULL;
+  }
+
+  memcpy(source, buffer, length);
+  source[length] = '\n';
+  memset(source + length + 1, '\0', SOURCE_PADDING);
+
+  parseSource(finalRecipe, source, length + 1 + SOURCE_PADDING);
+
+  free(source);
+
+  return finalRecipe;
+}
+
 // this function will parse the recipe from a string
 Recipe* parseRecipeString(char* inputRecipeString) {
-  // setup the recipe
-  Recipe* finalRecipe = createRecipe();
+  return parseRecipeBuffer(inputRecipeString, strlen(inputRecipeString));
+}
 
-  // create the first step
-  Step* currentStep = createStep();
-  insertBack(finalRecipe->stepList, currentStep);
+// this function will parse the recipe from the rest of an open file
+Recipe* parseRecipeStream(FILE* file) {
+  size_t size = 0;
+  char* source = readSource(file, &size);
+  if (source == NULL) {
+    return NULL;
+  }
 
-  // add a newline at the end of the string to prevent errors in the parser
-  char* newInputString =
-      malloc(sizeof(char) * (strlen(inputRecipeString) + 20));
-  sprintf(newInputString, "%s\n", inputRecipeString);
+  // setup the recipe
+  Recipe* finalRecipe = startRecipe();
+  if (finalRecipe != NULL) {
+    parseSource(finalRecipe, source, size);
+  }
 
-  // feed input to lexer
-  YY_BUFFER_STATE buffer = yy_scan_string(newInputString);
-  // parser
-  yyparse(finalRecipe);
-  yy_delete_buffer(buffer);
+  free(source);
 
   return finalRecipe;
 }
 
-Recipe* parseRecipe(char* fileName) {
-  FILE* file;
+// reads a whole regular file of the given length into a padded buffer with
+// as few reads as it takes, false if it fails
+static bool readFileSource(int fd, size_t length, FileSource* source) {
+  source->data = malloc(length + SOURCE_PADDING);
+  if (source->data == NULL) {
+    return false;
+  }
 
-  if (fileName != NULL) {
-    file = fopen(fileName, "r");
-    if (file != NULL) {
-      yyin = file;
-    } else {
-      return NULL;
+  size_t done = 0;
+  while (done < length) {
+    ssize_t count = pread(fd, source->data + done, length - done, done);
+    if (count <= 0) {
+      free(source->data);
+      return false;
     }
+    done += count;
+  }
+
+  memset(source->data + length, '\0', SOURCE_PADDING);
+  source->size = length + SOURCE_PADDING;
+  source->mappedLength = 0;
+
+  return true;
+}
+
+// maps a whole regular file of the given length, false if it can't be mapped
+// the scanner pads the end of its input with NUL bytes, and a mapping is
+// zero filled after the end of the file up to the end of its last page, so
+// the file can only be mapped when the padding fits in that last page
+static bool mapFileSource(int fd, size_t length, FileSource* source) {
+  long pageSize = sysconf(_SC_PAGESIZE);
+
+  if (pageSize <= 0 || length % pageSize == 0 ||
+      pageSize - length % pageSize < SOURCE_PADDING) {
+    return false;
+  }
+
+  // private and writable, the scanner marks the end of each token in place
+  // and that must never reach the file
+  void* mapped = mmap(NULL, length + SOURCE_PADDING, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE, fd, 0);
+  if (mapped == MAP_FAILED) {
+    return false;
+  }
+
+  source->data = mapped;
+  source->size = length + SOURCE_PADDING;
+  source->mappedLength = length + SOURCE_PADDING;
+
+  return true;
+}
+
+// releases a source buffer from mapFileSource or readFileSource
+static void releaseFileSource(FileSource* source) {
+  if (source->mappedLength > 0) {
+    munmap(source->data, source->mappedLength);
   } else {
+    free(source->data);
+  }
+}
+
+Recipe* parseRecipe(char* fileName) {
+  if (fileName == NULL) {
     return NULL;
   }
 
-  // setup the recipe
-  Recipe* finalRecipe = createRecipe();
+  int fd = open(fileName, O_RDONLY);
+  if (fd == -1) {
+    return NULL;
+  }
+
+  struct stat info;
+  if (fstat(fd, &info) == -1) {
+    close(fd);
+    return NULL;
+  }
+
+  // pipes and other files with no fixed size are read like a stream
+  if (!S_ISREG(info.st_mode)) {
+    FILE* file = fdopen(fd, "r");
+    if (file == NULL) {
+      close(fd);
+      return NULL;
+    }
+
+    Recipe* finalRecipe = parseRecipeStream(file);
+    fclose(file);
+
+    return finalRecipe;
+  }
+
+  // small files are cheaper to read than to map, and files whose padding
+  // doesn't fit after the end of the mapping are read as well
+  size_t length = info.st_size;
+  FileSource source;
+  bool loaded = false;
 
-  // create the first step
-  Step* currentStep = createStep();
-  insertBack(finalRecipe->stepList, currentStep);
+  if (length >= SOURCE_MAP_THRESHOLD) {
+    loaded = mapFileSource(fd, length, &source);
+  }
+
+  if (!loaded) {
+    loaded = readFileSource(fd, length, &source);
+  }
+
+  close(fd);
 
-  yyparse(finalRecipe);
+  if (!loaded) {
+    return NULL;
+  }
+
+  // setup the recipe
+  Recipe* finalRecipe = startRecipe();
+  if (finalRecipe != NULL) {
+    parseSource(finalRecipe, source.data, source.size);
+  }
 
-  fclose(file);
+  releaseFileSource(&source);
 
-  // // initialize the iterators on the recipe
-  // if( finalRecipe->stepList != NULL ){
-  //   finalRecipe->stepIter = createIterator(finalRecipe->stepList);
-  // } else {
-  //   finalRecipe->stepIter = NULL;
-  // }
   return finalRecipe;
 }
 
-// function to get the i-th step in a recipe
+// function to get the i-th step in a recipe, NULL if there is none
+Step* getStep(Recipe* recipe, size_t index) {
+  return vectorGet(&recipe->steps, index);
+}
 
-// function to get the i-th direction in a step
+// function to get the i-th direction in a step, NULL if there is none
+Direction* getDirection(Step* step, size_t index) {
+  return vectorGet(&step->directions, index);
+}
 
 // function to return the number of steps in a recipe
+size_t getStepCount(Recipe* recipe) { return vectorLength(&recipe->steps); }
 
 // function to return the number of direction in a step
+size_t getDirectionCount(Step* step) {
+  return vectorLength(&step->directions);
+}
 
 // function to nicely print the step data
 
 // function to nicely print the direction data
 
-char* addTwoStrings(char* first, char* second) {
-  char* result = NULL;
-  int length = 0;
+// wraps a whole string as a span
+Span stringToSpan(char* string) {
+  Span span = {string, 0};
 
-  if (first == NULL || second == NULL) {
-    return NULL;
+  if (string != NULL) {
+    span.length = strlen(string);
+  }
+
+  return span;
+}
+
+// joins two spans, tokens that sit next to each other in the source are
+// merged without copying, anything else is copied into the arena
+Span joinSpans(Arena* arena, Span first, Span second) {
+  if (first.start == NULL) {
+    return second;
   }
 
-  length += strlen(first);
-  length += strlen(second);
-  length += 5;
+  if (second.start == NULL || first.start + first.length == second.start) {
+    first.length += second.length;
+    return first;
+  }
 
-  result = malloc(sizeof(char) * length);
+  char* result = arenaAlloc(arena, first.length + second.length + 1);
 
   if (result == NULL) {
     printf("Error, malloc failed");
-    return NULL;
+    return first;
   }
 
-  sprintf(result, "%s%s", first, second);
+  memcpy(result, first.start, first.length);
+  memcpy(result + first.length, second.start, second.length);
+  result[first.length + second.length] = '\0';
 
-  return result;
+  return (Span){result, first.length + second.length};
 }
 
-char* addThreeStrings(char* first, char* second, char* third) {
-  char* result = NULL;
-  int length = 0;
-
-  if (first == NULL || second == NULL || third == NULL) {
+// copies the text of a span into the arena, NULL for a span with no text
+char* spanToString(Arena* arena, Span span) {
+  if (span.start == NULL) {
     return NULL;
   }
 
-  length += strlen(first);
-  length += strlen(second);
-  length += strlen(third);
-  length += 5;
+  return arenaStrndup(arena, span.start, span.length);
+}
+
+// copies the text of a span to the heap so it can be edited in place, the
+// caller frees it
+static char* spanToTempString(Span span) {
+  if (span.start == NULL) {
+    return NULL;
+  }
 
-  result = malloc(sizeof(char) * length);
+  char* result = malloc(sizeof(char) * (span.length + 1));
 
   if (result == NULL) {
     printf("Error, malloc failed");
     return NULL;
   }
 
-  sprintf(result, "%s%s%s", first, second, third);
+  memcpy(result, span.start, span.length);
+  result[span.length] = '\0';
 
   return result;
 }
 
-// adds the new direction corresponding to arguments 2-6, to the recipe in
+// adds the new direction corresponding to arguments 2-4, to the recipe in
 // argument 1 always adds to the last step in the list
-void addDirection(Recipe* recipe, char* type, char* value, char* amountString) {
-  // create a direction then add it to the direction list
-  Direction* tempDir = createDirection(type, value, amountString);
+void addDirection(Recipe* recipe, DirectionKind kind, Span value,
+                  Span amount) {
+  // the value is the only text kept as is, so it is copied once into the
+  // arena, the amount gets split up and is only needed for a moment
+  char* valueString = spanToString(recipe->arena, value);
+  char* amountString = spanToTempString(amount);
+
+  // fill in a direction then add it to the back of the last step
+  Direction tempDir;
+  bool valid = initializeDirection(&tempDir, recipe->arena, kind, valueString,
+                                   amountString);
+
+  free(amountString);
+
+  Step* step = vectorBack(&recipe->steps);
+
+  if (!valid || step == NULL) {
+    return;
+  }
+
+  Direction* newDir = vectorPush(&step->directions);
+  if (newDir == NULL) {
+    return;
+  }
+  *newDir = tempDir;
 
-  Step* step = getFromBack(recipe->stepList);
+  // if cookware/ingredient, add its index to the appropriate lists
+  size_t* index = NULL;
 
-  if (tempDir != NULL) {
-    insertBack(step->directions, tempDir);
+  if (kind == DIRECTION_COOKWARE) {
+    index = vectorPush(&step->equipment);
   }
 
-  // if cookware/ingredient, add to the appropriate lists
-  if (strcmp(type, "Cookware") == 0) {
-    insertBack(step->equipmentList, tempDir);
+  if (kind == DIRECTION_INGREDIENT) {
+    index = vectorPush(&step->ingredients);
   }
 
-  if (strcmp(type, "Ingredient") == 0) {
-    insertBack(step->ingredientList, tempDir);
+  if (index != NULL) {
+    *index = vectorLength(&step->directions) - 1;
   }
 }
 
-void addMetaData(Recipe* recipe, char* metaDataString) {
+// starts a new empty step at the back of the recipe
+void addStep(Recipe* recipe) {
+  Step* newStep = vectorPush(&recipe->steps);
+
+  if (newStep != NULL) {
+    initializeStep(newStep, recipe->arena);
+  }
+}
+
+void addMetaData(Recipe* recipe, Span metaData) {
+  // the metadata line is split up in place, so give it a copy
+  char* metaDataString = spanToTempString(metaData);
+
+  if (metaDataString == NULL) {
+    return;
+  }
+
   // create a new metadata and add it to the list at the back
-  Metadata* tempMeta = createMetadata(metaDataString);
+  Metadata* tempMeta = createMetadata(recipe->arena, metaDataString);
 
   if (tempMeta != NULL) {
     insertBack(recipe->metaData, tempMeta);
   }
+
+  free(metaDataString);
 }
@@ -1,17 +1,22 @@
 #include "../include/CooklangRecipe.h"
 
 #include <ctype.h>
+#include <math.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+// size of the first arena block for a recipe, enough for most short recipes
+#define RECIPE_ARENA_SIZE 4096
+
 void test2() { printf("Test working\n"); }
 
 // * * * * * * * * * * * * * * * * * * * *
 // ******** Metadata Functions ***********
 // * * * * * * * * * * * * * * * * * * * *
 
-Metadata *createMetadata(char *metaString) {
+Metadata *createMetadata(Arena *arena, char *metaString) {
   // parse the metadata first
   char **results = parseMetaString(metaString);
 
@@ -23,7 +28,7 @@ Metadata *createMetadata(char *metaString) {
     return NULL;
   }
 
-  Metadata *tempMeta = malloc(sizeof(Metadata));
+  Metadata *tempMeta = arenaAlloc(arena, sizeof(Metadata));
 
   if (tempMeta == NULL) {
     printf("error, malloc failed - createMetadata1\n");
@@ -31,8 +36,8 @@ Metadata *createMetadata(char *metaString) {
   }
 
   // create space for and copy in the input strings
-  tempMeta->identifier = strdup(identifier);
-  tempMeta->content = strdup(content);
+  tempMeta->identifier = arenaStrdup(arena, identifier);
+  tempMeta->content = arenaStrdup(arena, content);
 
   free(results[0]);
   free(results[1]);
@@ -44,11 +49,7 @@ Metadata *createMetadata(char *metaString) {
 // parse meta data function
 
 void deleteMetadata(void *data) {
-  Metadata *meta = data;
-
-  free(meta->content);
-  free(meta->identifier);
-  free(meta);
+  // metadata is released with the recipe's arena
 }
 
 char *metadataToString(void *data) {
@@ -69,25 +70,22 @@ int compareMetadata(const void *first, const void *second) { return 0; }
 // ******** Direction Functions **********
 // * * * * * * * * * * * * * * * * * * * *
 
-Direction *createDirection(char *type, char *value, char *amountString) {
+// fills in a direction, usually a new slot in a step - value is kept as given
+// rather than copied, so it has to come from the same arena as the step
+bool initializeDirection(Direction *direction, Arena *arena, DirectionKind kind,
+                         char *value, char *amountString) {
   char **amountResults = NULL;
   char *quantityString;
   char *unit;
   double quantity;
 
   // default amount value if there is none given
-  char *defaultAmountString = malloc(20);
-  sprintf(defaultAmountString, "some");
-
-  // check input - must be a type
-  if (type == NULL) {
-    return NULL;
-  }
+  const char *defaultAmountString = "some";
 
-  // value can only be null if the type is a timer, this case comes from a no
+  // value can only be null if the kind is a timer, this case comes from a no
   // name timer
-  if (strcmp(type, "timer") != 0 && value == NULL) {
-    return NULL;
+  if (kind != DIRECTION_TIMER && value == NULL) {
+    return false;
   }
 
   // parse amountString
@@ -125,30 +123,19 @@ Direction *createDirection(char *type, char *value, char *amountString) {
     quantity = -1;
   }
 
-  Direction *tempDir = malloc(sizeof(Direction));
-
-  if (tempDir == NULL) {
-    printf("error, malloc failed - createDirection 1\n");
-    return NULL;
-  }
+  direction->kind = kind;
 
-  tempDir->type = strdup(type);
-
-  if (value != NULL) {
-    tempDir->value = strdup(value);
-  } else {
-    tempDir->value = NULL;
-  }
+  direction->value = value;
 
   // there is no quantity and the direction is done
   if (quantity == -1 && quantityString == NULL) {
-    if (strcmp(type, "ingredient") == 0) {
-      tempDir->quantityString = strdup(defaultAmountString);
+    if (kind == DIRECTION_INGREDIENT) {
+      direction->quantityString = arenaStrdup(arena, defaultAmountString);
     } else {
-      tempDir->quantityString = NULL;
+      direction->quantityString = NULL;
     }
-    tempDir->quantity = -1;
-    tempDir->unit = NULL;
+    direction->quantity = -1;
+    direction->unit = NULL;
 
     if (amountResults != NULL) {
       free(amountResults[0]);
@@ -156,28 +143,24 @@ Direction *createDirection(char *type, char *value, char *amountString) {
       free(amountResults);
     }
 
-    if (defaultAmountString != NULL) {
-      free(defaultAmountString);
-    }
-
-    return tempDir;
+    return true;
   }
 
   if (quantity == -1) {
     // quantity must be a string
-    tempDir->quantityString = strdup(quantityString);
-    tempDir->quantity = -1;
+    direction->quantityString = arenaStrdup(arena, quantityString);
+    direction->quantity = -1;
   } else {
     // must be a double
-    tempDir->quantity = quantity;
-    tempDir->quantityString = NULL;
+    direction->quantity = quantity;
+    direction->quantityString = NULL;
   }
 
   // if unit input, set, else, set null
   if (unit != NULL) {
-    tempDir->unit = strdup(unit);
+    direction->unit = arenaStrdup(arena, unit);
   } else {
-    tempDir->unit = NULL;
+    direction->unit = NULL;
   }
 
   if (amountResults != NULL) {
@@ -186,337 +169,833 @@ Direction *createDirection(char *type, char *value, char *amountString) {
     free(amountResults);
   }
 
-  if (defaultAmountString != NULL) {
-    free(defaultAmountString);
+  return true;
+}
+
+// the name of a kind of direction as it appears in the output
+const char *directionKindName(DirectionKind kind) {
+  switch (kind) {
+    case DIRECTION_TEXT:
+      return "text";
+    case DIRECTION_INGREDIENT:
+      return "ingredient";
+    case DIRECTION_COOKWARE:
+      return "cookware";
+    case DIRECTION_TIMER:
+      return "timer";
   }
 
-  return tempDir;
+  return "unknown";
 }
 
-void deleteDirection(void *data) {
-  Direction *dir = data;
+// the number a quantity stands for, NAN if it isn't a finite one - quantities
+// written as numbers can reach the recipe as text like "0.500"
+double directionQuantity(Direction *direction) {
+  if (direction->quantity != -1) {
+    return direction->quantity;
+  }
 
-  // free all the strings
-  free(dir->type);
-  free(dir->value);
-  free(dir->quantityString);
-  free(dir->unit);
+  if (direction->quantityString != NULL &&
+      direction->quantityString[0] != '\0') {
+    char *end;
+    double quantity = strtod(direction->quantityString, &end);
 
-  free(dir);
-}
+    if (*end == '\0' && isfinite(quantity)) {
+      return quantity;
+    }
+  }
 
-void dummyDeleteDirection(void *data) {
-  // does nothing
+  return NAN;
 }
 
-char *directionToString(void *data) {
+// appends the output form of a direction to the builder
+void appendDirection(StringBuilder *builder, void *data) {
   Direction *dir = data;
 
-  char *tempString = NULL;
+  const char *kindName = directionKindName(dir->kind);
 
-  int length = 0;
+  // make an output string based on what kind it is
 
-  if (dir->type != NULL) {
-    length += strlen(dir->type);
+  // if its a text iten use value instead of name
+  if (dir->kind == DIRECTION_TEXT) {
+    appendFormat(builder, "      - type: text\n      - value: \"%s\"\n",
+                 dir->value);
+    return;
   }
 
+  // timers, cookware, and ingredients
+  // name and value
   if (dir->value != NULL) {
-    length += strlen(dir->value);
+    appendFormat(builder, "      - type: %s\n      - name: \"%s\"\n", kindName,
+                 dir->value);
   } else {
-    length += 50;
+    appendFormat(builder, "      - type: %s\n      - name: \"\"\n", kindName);
   }
 
+  // quantity, string format
   if (dir->quantityString != NULL) {
-    length += strlen(dir->quantityString);
+    appendFormat(builder, "      - quantity: \"%s\"\n", dir->quantityString);
+    // quantity, double format
+  } else if (dir->quantity != -1) {
+    appendFormat(builder, "      - quantity: %.3f\n", dir->quantity);
+    // no quantity - end of string
+  } else {
+    appendString(builder, "      - quantity: \"\"\n");
+    return;
   }
 
-  if (dir->unit != NULL) {
-    length += strlen(dir->unit);
-  } else {
-    length += 50;
+  // add the unit if there is one, else add empty units
+  // only ingredients/timers
+  if (dir->kind != DIRECTION_COOKWARE) {
+    if (dir->unit != NULL) {
+      appendFormat(builder, "      - units: \"%s\"\n", dir->unit);
+    } else {
+      appendString(builder, "      - units: \"\"\n");
+    }
   }
+}
 
-  length += 100;
+char *directionToString(void *data) {
+  StringBuilder builder;
+  initializeStringBuilder(&builder);
 
-  if (length != 15) {
-    tempString = malloc(sizeof(char) * length);
-  } else {
+  appendDirection(&builder, data);
+
+  return finishStringBuilder(&builder);
+}
+
+// * * * * * * * * * * * * * * * * * * * *
+// *********  Step Functions  ************
+// * * * * * * * * * * * * * * * * * * * *
+
+// sets up an empty step whose directions are allocated from the arena
+void initializeStep(Step *step, Arena *arena) {
+  initializeVector(&step->directions, arena, sizeof(Direction),
+                   appendDirection);
+
+  // the ingredients and cookware are indices into the directions
+  initializeVector(&step->ingredients, arena, sizeof(size_t), NULL);
+  initializeVector(&step->equipment, arena, sizeof(size_t), NULL);
+}
+
+// appends the output form of a step and all of its directions to the builder
+void appendStep(StringBuilder *builder, void *data) {
+  Step *step = data;
+
+  if (vectorLength(&step->directions) == 0) {
+    appendString(builder, "Empty step}\n");
+    return;
+  }
+
+  appendVectorDelim(builder, &step->directions, "    - Direction");
+  appendString(builder, "\n");
+}
+
+char *stepToString(void *data) {
+  StringBuilder builder;
+  initializeStringBuilder(&builder);
+
+  appendStep(&builder, data);
+
+  return finishStringBuilder(&builder);
+}
+
+// * * * * * * * * * * * * * * * * * * * *
+// ********  Recipe Functions  ***********
+// * * * * * * * * * * * * * * * * * * * *
+
+// creation functions
+
+Recipe *createRecipe() {
+  // everything the recipe holds is allocated from its own arena
+  Arena *arena = createArena(RECIPE_ARENA_SIZE);
+
+  if (arena == NULL) {
     return NULL;
   }
 
-  if (tempString == NULL) {
-    printf("error, malloc failed - directionToString1\n");
+  // make a new recipe
+  Recipe *tempRec = arenaAlloc(arena, sizeof(Recipe));
+
+  if (tempRec == NULL) {
+    deleteArena(arena);
     return NULL;
   }
 
-  // make an output string based on what kind it is
+  tempRec->arena = arena;
 
-  // if its a text iten use value instead of name
-  if (strcmp(dir->type, "text") == 0) {
-    sprintf(tempString, "      - type: text\n      - value: \"%s\"\n",
-            dir->value);
+  // steps
+  initializeVector(&tempRec->steps, arena, sizeof(Step), appendStep);
 
-    // timers, cookware, and ingredients
-  } else {
-    // name and value
-    if (dir->value != NULL) {
-      sprintf(tempString, "      - type: %s\n      - name: \"%s\"\n", dir->type,
-              dir->value);
-    } else {
-      sprintf(tempString, "      - type: %s\n      - name: \"\"\n", dir->type);
-    }
+  // metadata
+  List *metaDataList = initializeListInArena(arena, metadataToString,
+                                             deleteMetadata, compareMetadata);
 
-    // quantity, string format
-    if (dir->quantityString != NULL) {
-      char *tempQuanString =
-          malloc(sizeof(char) * strlen(dir->quantityString) + 30);
-      sprintf(tempQuanString, "      - quantity: \"%s\"\n",
-              dir->quantityString);
-
-      strcat(tempString, tempQuanString);
-      free(tempQuanString);
-      // quantity, double format
-    } else if (dir->quantity != -1) {
-      char *tempQuanString = malloc(sizeof(char) * 30);
-      sprintf(tempQuanString, "      - quantity: %.3f\n", dir->quantity);
-
-      strcat(tempString, tempQuanString);
-      free(tempQuanString);
-      // no quantity - end of string
-    } else {
-      char *tempQuanString = malloc(sizeof(char) * 30);
-      sprintf(tempQuanString, "      - quantity: \"\"\n");
+  if (metaDataList == NULL) {
+    deleteArena(arena);
+    return NULL;
+  }
 
-      strcat(tempString, tempQuanString);
-      free(tempQuanString);
-      return tempString;
-    }
+  tempRec->metaData = metaDataList;
 
-    // add the unit if there is one, else add empty units
-    // only ingredients/timers
-    if (strcmp(dir->type, "cookware") != 0) {
-      if (dir->unit != NULL) {
-        char *unitString = malloc(sizeof(dir->unit) + 20);
-        sprintf(unitString, "      - units: \"%s\"\n", dir->unit);
+  return tempRec;
+}
 
-        strcat(tempString, unitString);
-        free(unitString);
-      } else {
-        char *unitString = malloc(sizeof(char) * 50);
-        strcpy(unitString, "      - units: \"\"\n");
+void deleteRecipe(void *data) {
+  Recipe *recipe = data;
 
-        strcat(tempString, unitString);
-        free(unitString);
-      }
-    }
+  if (recipe == NULL) {
+    return;
   }
 
-  return tempString;
+  // the recipe lives in its arena, so this frees everything at once
+  deleteArena(recipe->arena);
 }
 
-int compareDirections(const void *first, const void *second) { return 0; }
+char *recipeToString(void *data) { return "empty recipe\n"; }
 
 // * * * * * * * * * * * * * * * * * * * *
-// *********  Step Functions  ************
+// *****  Serialization Functions  *******
 // * * * * * * * * * * * * * * * * * * * *
 
-Step *createStep() {
-  // initalize a list of directions
-  Step *tempStep = malloc(sizeof(Step));
+// a serialized recipe is the magic, the metadata count and the step count,
+// then every metadata as two strings and every step as its direction count
+// followed by its directions. A direction is its kind, a byte saying which of
+// its strings are present, the quantity and then those strings. Integers are
+// little endian, strings are a 32 bit length and their bytes without a NUL
+static const char serializedMagic[4] = {'C', 'K', 'R', 1};
 
-  List *dirList =
-      initializeList(directionToString, deleteDirection, compareDirections);
-  tempStep->directions = dirList;
+// which strings of a direction are present in its serialized form
+#define SERIALIZED_VALUE 1
+#define SERIALIZED_QUANTITY_STRING 2
+#define SERIALIZED_UNIT 4
 
-  List *ingredientList = initializeList(
-      ingredientToString, dummyDeleteDirection, compareDirections);
-  tempStep->ingredientList = ingredientList;
+// the fixed part of a serialized direction - kind, flags and quantity
+#define SERIALIZED_DIRECTION_SIZE 10
 
-  List *equipmentList = initializeList(ingredientToString, dummyDeleteDirection,
-                                       compareDirections);
-  tempStep->equipmentList = equipmentList;
+static size_t serializedStringSize(const char *string) {
+  return string == NULL ? 0 : 4 + strlen(string);
+}
 
-  return tempStep;
+static char *writeUint32(char *out, uint32_t value) {
+  for (int i = 0; i < 4; i++) {
+    out[i] = (char)(value >> (8 * i));
+  }
+  return out + 4;
 }
 
-void deleteStep(void *data) {
-  Step *step = data;
+static char *writeString(char *out, const char *string) {
+  size_t length = strlen(string);
 
-  freeList(step->directions);
-  freeList(step->ingredientList);
-  freeList(step->equipmentList);
-  free(step);
-}
+  out = writeUint32(out, (uint32_t)length);
+  memcpy(out, string, length);
 
-char *stepToString(void *data) {
-  Step *step = data;
+  return out + length;
+}
 
-  char *stepString;
-  char *dirString;
-  char *ingredientString;
-  char *equipmentString;
+// returns the number of bytes serializeRecipe writes for the recipe
+size_t serializedRecipeSize(Recipe *recipe) {
+  size_t size = sizeof(serializedMagic) + 8;
 
-  int length = 0;
+  ListIterator iter = createIterator(recipe->metaData);
+  Metadata *meta;
 
-  // get the directions string
-  if (getLength(step->directions) != 0) {
-    dirString = toStringDelim(step->directions, "    - Direction");
-  } else {
-    stepString = malloc(sizeof(char) * 20);
-    sprintf(stepString, "Empty step}\n");
-    return stepString;
+  while ((meta = nextElement(&iter)) != NULL) {
+    size += serializedStringSize(meta->identifier) +
+            serializedStringSize(meta->content);
   }
 
-  // get the ingredients string
-  if (getLength(step->ingredientList) != 0) {
-    ingredientString = toString(step->ingredientList);
-  } else {
-    ingredientString = malloc(20);
-    sprintf(ingredientString, " ");
+  for (size_t i = 0; i < vectorLength(&recipe->steps); i++) {
+    Step *step = vectorGet(&recipe->steps, i);
+
+    size += 4;
+
+    for (size_t j = 0; j < vectorLength(&step->directions); j++) {
+      Direction *dir = vectorGet(&step->directions, j);
+
+      size += SERIALIZED_DIRECTION_SIZE + serializedStringSize(dir->value) +
+              serializedStringSize(dir->quantityString) +
+              serializedStringSize(dir->unit);
+    }
   }
 
-  // get the equipment string
-  if (getLength(step->equipmentList) != 0) {
-    equipmentString = toString(step->equipmentList);
-  } else {
-    equipmentString = malloc(20);
-    sprintf(equipmentString, " ");
+  return size;
+}
+
+// writes the recipe into out, which must hold serializedRecipeSize bytes
+void serializeRecipe(Recipe *recipe, char *out) {
+  memcpy(out, serializedMagic, sizeof(serializedMagic));
+  out += sizeof(serializedMagic);
+
+  out = writeUint32(out, (uint32_t)getLength(recipe->metaData));
+  out = writeUint32(out, (uint32_t)vectorLength(&recipe->steps));
+
+  ListIterator iter = createIterator(recipe->metaData);
+  Metadata *meta;
+
+  while ((meta = nextElement(&iter)) != NULL) {
+    out = writeString(out, meta->identifier);
+    out = writeString(out, meta->content);
   }
 
-  // find the length the string should be
-  length += strlen(dirString);
-  length += strlen(ingredientString);
-  length += strlen(equipmentString);
-  length += 50;
+  for (size_t i = 0; i < vectorLength(&recipe->steps); i++) {
+    Step *step = vectorGet(&recipe->steps, i);
 
-  // make the string
-  stepString = malloc(sizeof(char) * length);
+    out = writeUint32(out, (uint32_t)vectorLength(&step->directions));
 
-  sprintf(stepString, "%s\n", dirString);
+    for (size_t j = 0; j < vectorLength(&step->directions); j++) {
+      Direction *dir = vectorGet(&step->directions, j);
+      uint64_t quantity;
 
-  free(dirString);
-  free(ingredientString);
-  free(equipmentString);
+      *out++ = (char)dir->kind;
+      *out++ = (char)((dir->value != NULL ? SERIALIZED_VALUE : 0) |
+                      (dir->quantityString != NULL ? SERIALIZED_QUANTITY_STRING
+                                                   : 0) |
+                      (dir->unit != NULL ? SERIALIZED_UNIT : 0));
 
-  return stepString;
+      memcpy(&quantity, &dir->quantity, sizeof(quantity));
+      out = writeUint32(out, (uint32_t)quantity);
+      out = writeUint32(out, (uint32_t)(quantity >> 32));
+
+      if (dir->value != NULL) {
+        out = writeString(out, dir->value);
+      }
+      if (dir->quantityString != NULL) {
+        out = writeString(out, dir->quantityString);
+      }
+      if (dir->unit != NULL) {
+        out = writeString(out, dir->unit);
+      }
+    }
+  }
 }
 
-int compareSteps(const void *first, const void *second) { return 0; }
+// reads serialized data back, keeping track of how much is left
+typedef struct {
+  const unsigned char *next;
+  size_t left;
+} SerializedReader;
 
-// * * * * * * * * * * * * * * * * * * * *
-// ********  Recipe Functions  ***********
-// * * * * * * * * * * * * * * * * * * * *
+static bool readUint32(SerializedReader *reader, uint32_t *value) {
+  if (reader->left < 4) {
+    return false;
+  }
 
-// creation functions
+  *value = 0;
+  for (int i = 0; i < 4; i++) {
+    *value |= (uint32_t)reader->next[i] << (8 * i);
+  }
 
-Recipe *createRecipe() {
-  // make a new recipe
-  Recipe *tempRec = malloc(sizeof(Recipe));
+  reader->next += 4;
+  reader->left -= 4;
 
-  // steps
-  List *stepList = initializeList(stepToString, deleteStep, compareSteps);
-  tempRec->stepList = stepList;
+  return true;
+}
 
-  // metadata
-  List *metaDataList =
-      initializeList(metadataToString, deleteMetadata, compareMetadata);
-  tempRec->metaData = metaDataList;
+// copies the next string into the arena
+static bool readString(SerializedReader *reader, Arena *arena, char **string) {
+  uint32_t length;
 
-  return tempRec;
+  if (!readUint32(reader, &length) || reader->left < length) {
+    return false;
+  }
+
+  *string = arenaStrndup(arena, (const char *)reader->next, length);
+  reader->next += length;
+  reader->left -= length;
+
+  return *string != NULL;
 }
 
-void deleteRecipe(void *data) {
-  // free all the lists
+static bool readDirection(SerializedReader *reader, Arena *arena,
+                          Direction *dir) {
+  if (reader->left < SERIALIZED_DIRECTION_SIZE) {
+    return false;
+  }
+
+  unsigned char kind = reader->next[0];
+  unsigned char flags = reader->next[1];
+  uint32_t low, high;
+
+  reader->next += 2;
+  reader->left -= 2;
+
+  // only timers can be without a name, every other kind is written with one
+  if (kind > DIRECTION_TIMER ||
+      (flags & ~(SERIALIZED_VALUE | SERIALIZED_QUANTITY_STRING |
+                 SERIALIZED_UNIT)) != 0 ||
+      (kind != DIRECTION_TIMER && !(flags & SERIALIZED_VALUE))) {
+    return false;
+  }
+
+  if (!readUint32(reader, &low) || !readUint32(reader, &high)) {
+    return false;
+  }
+
+  uint64_t quantity = (uint64_t)high << 32 | low;
+
+  dir->kind = kind;
+  memcpy(&dir->quantity, &quantity, sizeof(quantity));
+  dir->value = NULL;
+  dir->quantityString = NULL;
+  dir->unit = NULL;
+
+  return (!(flags & SERIALIZED_VALUE) ||
+          readString(reader, arena, &dir->value)) &&
+         (!(flags & SERIALIZED_QUANTITY_STRING) ||
+          readString(reader, arena, &dir->quantityString)) &&
+         (!(flags & SERIALIZED_UNIT) || readString(reader, arena, &dir->unit));
 }
 
-char *recipeToString(void *data) { return "empty recipe\n"; }
+// rebuilds a recipe from the output of serializeRecipe
+// returns NULL if the data is not a serialized recipe or malloc fails
+Recipe *deserializeRecipe(const char *data, size_t length) {
+  SerializedReader reader = {(const unsigned char *)data, length};
+  uint32_t metaCount, stepCount;
+
+  if (length < sizeof(serializedMagic) ||
+      memcmp(data, serializedMagic, sizeof(serializedMagic)) != 0) {
+    return NULL;
+  }
+
+  reader.next += sizeof(serializedMagic);
+  reader.left -= sizeof(serializedMagic);
+
+  if (!readUint32(&reader, &metaCount) || !readUint32(&reader, &stepCount)) {
+    return NULL;
+  }
+
+  Recipe *recipe = createRecipe();
+
+  if (recipe == NULL) {
+    return NULL;
+  }
+
+  for (uint32_t i = 0; i < metaCount; i++) {
+    Metadata *meta = arenaAlloc(recipe->arena, sizeof(Metadata));
+
+    if (meta == NULL ||
+        !readString(&reader, recipe->arena, &meta->identifier) ||
+        !readString(&reader, recipe->arena, &meta->content)) {
+      goto error;
+    }
+
+    insertBack(recipe->metaData, meta);
+  }
+
+  for (uint32_t i = 0; i < stepCount; i++) {
+    Step *step = vectorPush(&recipe->steps);
+    uint32_t directionCount;
+
+    if (step == NULL || !readUint32(&reader, &directionCount)) {
+      goto error;
+    }
+
+    initializeStep(step, recipe->arena);
+
+    for (uint32_t j = 0; j < directionCount; j++) {
+      Direction *dir = vectorPush(&step->directions);
+
+      if (dir == NULL || !readDirection(&reader, recipe->arena, dir)) {
+        goto error;
+      }
+
+      // the ingredient and cookware indices are rebuilt like the parser does
+      Vector *indices = NULL;
+
+      if (dir->kind == DIRECTION_INGREDIENT) {
+        indices = &step->ingredients;
+      } else if (dir->kind == DIRECTION_COOKWARE) {
+        indices = &step->equipment;
+      }
+
+      if (indices != NULL) {
+        size_t *index = vectorPush(indices);
+        if (index == NULL) {
+          goto error;
+        }
+        *index = j;
+      }
+    }
+  }
+
+  if (reader.left != 0) {
+    goto error;
+  }
+
+  return recipe;
+
+error:
+  deleteRecipe(recipe);
+  return NULL;
+}
 
 // * * * * * * * * * * * * * * * * * * * *
-// ********   Other Functions  ***********
+// ********   JSON Functions   ***********
 // * * * * * * * * * * * * * * * * * * * *
 
-// print ingredient - used for the ingredient list instead of a the usual
-// direction printing function also works for cookware
-char *ingredientToString(void *data) {
-  Direction *ingredient = data;
+// appends a string as a JSON string, text is kept as UTF-8 and only quotes,
+// backslashes and control characters are escaped
+static void appendJsonString(StringBuilder *builder, const char *string) {
+  const char *run = string;
 
-  if (ingredient == NULL) {
-    return NULL;
+  appendBytes(builder, "\"", 1);
+
+  for (; *string != '\0'; string++) {
+    unsigned char c = *string;
+
+    if (c >= 0x20 && c != '"' && c != '\\') {
+      continue;
+    }
+
+    appendBytes(builder, run, string - run);
+    run = string + 1;
+
+    switch (c) {
+      case '"':
+        appendBytes(builder, "\\\"", 2);
+        break;
+      case '\\':
+        appendBytes(builder, "\\\\", 2);
+        break;
+      case '\n':
+        appendBytes(builder, "\\n", 2);
+        break;
+      case '\r':
+        appendBytes(builder, "\\r", 2);
+        break;
+      case '\t':
+        appendBytes(builder, "\\t", 2);
+        break;
+      case '\b':
+        appendBytes(builder, "\\b", 2);
+        break;
+      case '\f':
+        appendBytes(builder, "\\f", 2);
+        break;
+      default:
+        appendFormat(builder, "\\u%04x", c);
+        break;
+    }
   }
 
-  int length = 0;
-  char *ingrString = NULL;
-  char *quanString = NULL;
-  char *unitString = NULL;
+  appendBytes(builder, run, string - run);
+  appendBytes(builder, "\"", 1);
+}
 
-  // need value, quantity and unit if any
-  length += strlen(ingredient->value);
+// appends a quantity the way python's repr writes a float, which is what
+// json.dumps uses - the fewest digits that read back as the same number, in
+// exponent form below 1e-4 and from 1e16 up
+static void appendJsonNumber(StringBuilder *builder, double number) {
+  if (isnan(number)) {
+    appendString(builder, "NaN");
+    return;
+  }
 
-  // if uses double  type
-  if (ingredient->quantity != -1) {
-    length += 10;
+  if (isinf(number)) {
+    appendString(builder, number > 0 ? "Infinity" : "-Infinity");
+    return;
   }
 
-  // if uses string type
-  if (ingredient->quantityString != NULL) {
-    length += strlen(ingredient->quantityString);
+  if (number == 0) {
+    appendString(builder, signbit(number) ? "-0.0" : "0.0");
+    return;
   }
 
-  // check for unit
-  if (ingredient->unit != NULL) {
-    length += strlen(ingredient->unit);
+  // 17 significant digits always read back the same
+  char scientific[32];
+
+  for (int precision = 0; precision < 17; precision++) {
+    snprintf(scientific, sizeof(scientific), "%.*e", precision, number);
+
+    if (strtod(scientific, NULL) == number) {
+      break;
+    }
   }
 
-  length += 50;
+  // split the "-d.ddde+xx" form into its digits and exponent
+  const char *c = scientific;
+  char digits[20];
+  int count = 0;
+
+  if (*c == '-') {
+    appendBytes(builder, "-", 1);
+    c++;
+  }
 
-  // start making string
-  ingrString = malloc(sizeof(char) * length);
+  for (; *c != 'e'; c++) {
+    if (*c != '.') {
+      digits[count++] = *c;
+    }
+  }
 
-  if (ingrString == NULL) {
-    printf("error, malloc failed - ingredientToString11\n");
-    return NULL;
+  while (count > 1 && digits[count - 1] == '0') {
+    count--;
   }
 
-  sprintf(ingrString, "%s", ingredient->value);
+  int exponent = atoi(c + 1);
 
-  // add quantity string
-  if (ingredient->quantity == -1) {
-    if (ingredient->quantityString != NULL) {
-      quanString =
-          malloc(sizeof(char) * strlen(ingredient->quantityString) + 20);
-      sprintf(quanString, ": %s", ingredient->quantityString);
+  // the number of digits before the decimal point
+  int point = exponent + 1;
+
+  if (point <= -4 || point > 16) {
+    appendBytes(builder, digits, 1);
+
+    if (count > 1) {
+      appendBytes(builder, ".", 1);
+      appendBytes(builder, digits + 1, count - 1);
+    }
+
+    appendFormat(builder, "e%c%02d", exponent < 0 ? '-' : '+', abs(exponent));
+  } else if (point <= 0) {
+    appendString(builder, "0.");
+
+    for (int i = point; i < 0; i++) {
+      appendBytes(builder, "0", 1);
+    }
+
+    appendBytes(builder, digits, count);
+  } else if (point >= count) {
+    appendBytes(builder, digits, count);
+
+    for (int i = count; i < point; i++) {
+      appendBytes(builder, "0", 1);
     }
+
+    appendString(builder, ".0");
   } else {
-    quanString = malloc(sizeof(char) * 20);
-    sprintf(quanString, ": %.3f", ingredient->quantity);
+    appendBytes(builder, digits, point);
+    appendBytes(builder, ".", 1);
+    appendBytes(builder, digits + point, count - point);
+  }
+}
+
+// appends a direction as a JSON object with the keys parseRecipe gives it
+static void appendDirectionJson(StringBuilder *builder, Direction *dir) {
+  appendString(builder, "{\"type\":\"");
+  appendString(builder, directionKindName(dir->kind));
+
+  // text directions only have their value
+  if (dir->kind == DIRECTION_TEXT) {
+    appendString(builder, "\",\"value\":");
+    appendJsonString(builder, dir->value);
+    appendBytes(builder, "}", 1);
+    return;
   }
 
-  // there is no quantity and no quantity string, therefore no units
-  if (quanString == NULL) {
-    return ingrString;
+  appendString(builder, "\",\"name\":");
+  appendJsonString(builder, dir->value != NULL ? dir->value : "");
+
+  appendString(builder, ",\"quantity\":");
+  if (dir->quantityString != NULL) {
+    appendJsonString(builder, dir->quantityString);
+  } else if (dir->quantity != -1) {
+    appendJsonNumber(builder, dir->quantity);
   } else {
-    strcat(ingrString, quanString);
+    appendString(builder, "\"\"");
   }
 
-  // add the unit string if there is one
-  // if there isnt
-  if (ingredient->unit == NULL) {
-    free(unitString);
-    free(quanString);
-    return ingrString;
+  if (dir->kind != DIRECTION_COOKWARE) {
+    appendString(builder, ",\"units\":");
+    appendJsonString(builder, dir->unit != NULL ? dir->unit : "");
+  }
+
+  appendBytes(builder, "}", 1);
+}
+
+// appends every ingredient or every piece of cookware as a JSON array
+static void appendDirectionsOfKindJson(StringBuilder *builder, Recipe *recipe,
+                                       DirectionKind kind) {
+  bool first = true;
+
+  appendBytes(builder, "[", 1);
+
+  for (size_t i = 0; i < vectorLength(&recipe->steps); i++) {
+    Step *step = vectorGet(&recipe->steps, i);
+    Vector *indices =
+        kind == DIRECTION_INGREDIENT ? &step->ingredients : &step->equipment;
 
-    // if there is
+    for (size_t j = 0; j < vectorLength(indices); j++) {
+      size_t *index = vectorGet(indices, j);
+
+      if (!first) {
+        appendBytes(builder, ",", 1);
+      }
+      first = false;
+
+      appendDirectionJson(builder, vectorGet(&step->directions, *index));
+    }
+  }
+
+  appendBytes(builder, "]", 1);
+}
+
+// a slot of the table repeated metadata identifiers are merged with
+typedef struct {
+  // NULL for an empty slot
+  Metadata *first;
+  Metadata *last;
+  uint64_t hash;
+} MetadataSlot;
+
+// FNV-1a over an identifier
+static uint64_t hashIdentifier(const char *identifier) {
+  uint64_t hash = 14695981039346656037ULL;
+
+  for (; *identifier != '\0'; identifier++) {
+    hash ^= (unsigned char)*identifier;
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+// appends the metadata as a JSON object - like a dict, a repeated identifier
+// keeps its first place and takes its last content
+static void appendMetadataJson(StringBuilder *builder, Recipe *recipe) {
+  size_t count = getLength(recipe->metaData);
+  size_t capacity = 16;
+
+  while (capacity < count * 2) {
+    capacity *= 2;
+  }
+
+  // the identifiers are merged in one pass, the slots are kept in order of
+  // first use so they can be written out in that order
+  MetadataSlot *slots = calloc(capacity, sizeof(MetadataSlot));
+  MetadataSlot **order = malloc(sizeof(MetadataSlot *) * (count + 1));
+  size_t used = 0;
+
+  if (slots == NULL || order == NULL) {
+    builder->failed = true;
+    free(slots);
+    free(order);
+    return;
+  }
+
+  ListIterator iter = createIterator(recipe->metaData);
+  Metadata *meta;
+  size_t mask = capacity - 1;
+
+  while ((meta = nextElement(&iter)) != NULL) {
+    uint64_t hash = hashIdentifier(meta->identifier);
+    MetadataSlot *slot = &slots[hash & mask];
+
+    while (slot->first != NULL &&
+           (slot->hash != hash ||
+            strcmp(slot->first->identifier, meta->identifier) != 0)) {
+      slot = &slots[(slot - slots + 1) & mask];
+    }
+
+    if (slot->first == NULL) {
+      slot->first = meta;
+      slot->hash = hash;
+      order[used++] = slot;
+    }
+
+    slot->last = meta;
+  }
+
+  appendBytes(builder, "{", 1);
+
+  for (size_t i = 0; i < used; i++) {
+    if (i > 0) {
+      appendBytes(builder, ",", 1);
+    }
+
+    appendJsonString(builder, order[i]->first->identifier);
+    appendBytes(builder, ":", 1);
+    appendJsonString(builder, order[i]->last->content);
+  }
+
+  appendBytes(builder, "}", 1);
+
+  free(slots);
+  free(order);
+}
+
+// appends the recipe as compact JSON in the shape of the dict parseRecipe
+// returns, empty steps are left out the same way
+void appendRecipeJson(StringBuilder *builder, Recipe *recipe) {
+  bool first = true;
+
+  appendString(builder, "{\"metadata\":");
+  appendMetadataJson(builder, recipe);
+
+  appendString(builder, ",\"ingredients\":");
+  appendDirectionsOfKindJson(builder, recipe, DIRECTION_INGREDIENT);
+
+  appendString(builder, ",\"cookware\":");
+  appendDirectionsOfKindJson(builder, recipe, DIRECTION_COOKWARE);
+
+  appendString(builder, ",\"steps\":[");
+
+  for (size_t i = 0; i < vectorLength(&recipe->steps); i++) {
+    Step *step = vectorGet(&recipe->steps, i);
+
+    if (vectorLength(&step->directions) == 0) {
+      continue;
+    }
+
+    if (!first) {
+      appendBytes(builder, ",", 1);
+    }
+    first = false;
+
+    appendBytes(builder, "[", 1);
+
+    for (size_t j = 0; j < vectorLength(&step->directions); j++) {
+      if (j > 0) {
+        appendBytes(builder, ",", 1);
+      }
+      appendDirectionJson(builder, vectorGet(&step->directions, j));
+    }
+
+    appendBytes(builder, "]", 1);
+  }
+
+  appendString(builder, "]}");
+}
+
+// * * * * * * * * * * * * * * * * * * * *
+// ********   Other Functions  ***********
+// * * * * * * * * * * * * * * * * * * * *
+
+// print ingredient - used for the ingredient list instead of a the usual
+// direction printing function also works for cookware
+void appendIngredient(StringBuilder *builder, void *data) {
+  Direction *ingredient = data;
+
+  appendString(builder, ingredient->value);
+
+  // add quantity string
+  if (ingredient->quantity == -1) {
+    // there is no quantity and no quantity string, therefore no units
+    if (ingredient->quantityString == NULL) {
+      return;
+    }
+    appendFormat(builder, ": %s", ingredient->quantityString);
   } else {
-    unitString = malloc(sizeof(char) * strlen(ingredient->unit) + 20);
-    sprintf(unitString, " %s", ingredient->unit);
+    appendFormat(builder, ": %.3f", ingredient->quantity);
+  }
+
+  // add the unit string if there is one
+  if (ingredient->unit != NULL) {
+    appendFormat(builder, " %s", ingredient->unit);
+  }
+}
+
+char *ingredientToString(void *data) {
+  if (data == NULL) {
+    return NULL;
   }
 
-  strcat(ingrString, unitString);
+  StringBuilder builder;
+  initializeStringBuilder(&builder);
 
-  free(unitString);
-  free(quanString);
+  appendIngredient(&builder, data);
 
-  return ingrString;
+  return finishStringBuilder(&builder);
 }
 
 // print cookware - used for the ingredient list instead of a the usual
@@ -543,7 +1022,8 @@ char **parseAmountString(char *amountString) {
   }
 
   // all other cases either string or string + unit string
-  char *token = strtok(amountString, "%");
+  char *savePtr = NULL;
+  char *token = strtok_r(amountString, "%", &savePtr);
 
   if (token != NULL) {
     quantityDest = malloc(sizeof(char) * strlen(token) + 1);
@@ -555,7 +1035,7 @@ char **parseAmountString(char *amountString) {
     return results;
   }
 
-  token = strtok(NULL, "%");
+  token = strtok_r(NULL, "%", &savePtr);
 
   if (token != NULL) {
     unitDest = malloc(sizeof(char) * strlen(token) + 1);
@@ -1,6 +1,7 @@
 
 #include "../include/LinkedListLib.h"
 
+#include "../include/StringBuilderLib.h"
 #include "assert.h"
 
 /** Function to initialize the list metadata head to the appropriate function
@@ -32,9 +33,71 @@ List* initializeList(char* (*printFunction)(void* toBePrinted),
   tmpList->compare = compareFunction;
   tmpList->printData = printFunction;
 
+  tmpList->arena = NULL;
+
+  return tmpList;
+}
+
+/** Function to initialize a list whose head and nodes are allocated from an
+ *arena. The data is owned by the arena as well, so the delete function is
+ *never called and nothing is freed when the list is cleared.
+ *@return pointer to the list head
+ *@param arena the arena that owns the list
+ *@param printFunction function pointer to print a single node of the list
+ *@param deleteFunction function pointer to delete a single piece of data from
+ *the list
+ *@param compareFunction function pointer to compare two nodes of the list in
+ *order to test for equality or order
+ **/
+List* initializeListInArena(Arena* arena,
+                            char* (*printFunction)(void* toBePrinted),
+                            void (*deleteFunction)(void* toBeDeleted),
+                            int (*compareFunction)(const void* first,
+                                                   const void* second)) {
+  assert(arena != NULL);
+  assert(printFunction != NULL);
+  assert(deleteFunction != NULL);
+  assert(compareFunction != NULL);
+
+  List* tmpList = arenaAlloc(arena, sizeof(List));
+
+  if (tmpList == NULL) {
+    return NULL;
+  }
+
+  tmpList->head = NULL;
+  tmpList->tail = NULL;
+
+  tmpList->length = 0;
+
+  tmpList->deleteData = deleteFunction;
+  tmpList->compare = compareFunction;
+  tmpList->printData = printFunction;
+
+  tmpList->arena = arena;
+
   return tmpList;
 }
 
+// makes a node in the list's arena if it has one, else on the heap
+static Node* initializeListNode(List* list, void* data) {
+  if (list->arena == NULL) {
+    return initializeNode(data);
+  }
+
+  Node* tmpNode = arenaAlloc(list->arena, sizeof(Node));
+
+  if (tmpNode == NULL) {
+    return NULL;
+  }
+
+  tmpNode->data = data;
+  tmpNode->previous = NULL;
+  tmpNode->next = NULL;
+
+  return tmpNode;
+}
+
 /** Deletes the entire linked list, freeing all memory.
  * uses the supplied function pointer to release allocated memory for the data
  *@pre 'List' type must exist and be used in order to keep track of the linked
@@ -44,7 +107,11 @@ List* initializeList(char* (*printFunction)(void* toBePrinted),
  **/
 void freeList(List* list) {
   clearList(list);
-  free(list);
+
+  // arena lists are released with their arena
+  if (list != NULL && list->arena == NULL) {
+    free(list);
+  }
 }
 
 /** Clears the list: frees the contents of the list - Node structs and data
@@ -67,6 +134,14 @@ void clearList(List* list) {
 
   Node* tmp;
 
+  // everything in an arena list is released with the arena
+  if (list->arena != NULL) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+    return;
+  }
+
   while (list->head != NULL) {
     list->deleteData(list->head->data);
     tmp = list->head;
@@ -119,7 +194,7 @@ void insertBack(List* list, void* toBeAdded) {
 
   (list->length)++;
 
-  Node* newNode = initializeNode(toBeAdded);
+  Node* newNode = initializeListNode(list, toBeAdded);
 
   if (list->head == NULL && list->tail == NULL) {
     list->head = newNode;
@@ -145,7 +220,7 @@ void insertFront(List* list, void* toBeAdded) {
 
   (list->length)++;
 
-  Node* newNode = initializeNode(toBeAdded);
+  Node* newNode = initializeListNode(list, toBeAdded);
 
   if (list->head == NULL && list->tail == NULL) {
     list->head = newNode;
@@ -210,7 +285,9 @@ void* deleteDataFromList(List* list, void* toBeDeleted) {
       }
 
       void* data = delNode->data;
-      free(delNode);
+      if (list->arena == NULL) {
+        free(delNode);
+      }
 
       (list->length)--;
 
@@ -267,7 +344,7 @@ void insertSorted(List* list, void* toBeAdded) {
       free(currDescr);
       free(newDescr);
 
-      Node* newNode = initializeNode(toBeAdded);
+      Node* newNode = initializeListNode(list, toBeAdded);
       newNode->next = currNode;
       newNode->previous = currNode->previous;
       currNode->previous->next = newNode;
@@ -294,47 +371,38 @@ after use).  on failure: NULL
  **/
 char* toString(List* list) {
   ListIterator iter = createIterator(list);
-  char* str;
-
-  str = (char*)malloc(sizeof(char));
-  strcpy(str, "");
+  StringBuilder builder;
+  initializeStringBuilder(&builder);
 
+  // every element is appended once, so this is linear in the output size
   void* elem;
   while ((elem = nextElement(&iter)) != NULL) {
     char* currDescr = list->printData(elem);
-    int newLen = strlen(str) + 50 + strlen(currDescr);
-    str = (char*)realloc(str, newLen);
-    strcat(str, "\n");
-    strcat(str, currDescr);
+    appendString(&builder, "\n");
+    appendString(&builder, currDescr);
 
     free(currDescr);
   }
 
-  return str;
+  return finishStringBuilder(&builder);
 }
 
 char* toStringDelim(List* list, char* delim) {
   ListIterator iter = createIterator(list);
-  char* str;
+  StringBuilder builder;
+  initializeStringBuilder(&builder);
   int i = 1;
-  str = (char*)malloc(sizeof(char));
-  strcpy(str, "");
 
   void* elem;
   while ((elem = nextElement(&iter)) != NULL) {
-    char* newDelim = malloc(strlen(delim) + 50);
-    sprintf(newDelim, "%s %d:\n", delim, i);
     char* currDescr = list->printData(elem);
-    int newLen = strlen(str) + 50 + strlen(currDescr) + strlen(delim);
-    str = (char*)realloc(str, newLen);
-    strcat(str, newDelim);
-    strcat(str, currDescr);
+    appendFormat(&builder, "%s %d:\n", delim, i);
+    appendString(&builder, currDescr);
     free(currDescr);
-    free(newDelim);
     i++;
   }
 
-  return str;
+  return finishStringBuilder(&builder);
 }
 
 ListIterator createIterator(List* list) {
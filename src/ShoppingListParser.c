@@ -2,60 +2,408 @@
 
 #include "../include/LinkedListLib.h"
 
+#include <ctype.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// shopping list files smaller than this are read, anything bigger is mapped
+#define SHOPPING_MAP_THRESHOLD (64 * 1024)
+
+// smallest buffer a shopping list file is read into
+#define SHOPPING_READ_SIZE 4096
+
+// the fewest slots a shopping index starts with
+#define SHOPPING_INDEX_MIN_CAPACITY 16
+
 // * * * * * * * * * * * * * * * * * * * *
 // ******  Functions Definitions  ********
 // * * * * * * * * * * * * * * * * * * * *
 
+// a shopping list file in memory, either on the heap or mapped in which case
+// mappedLength is the length to unmap - there is always one writable byte
+// after the end of the text
+typedef struct {
+  char *data;
+  size_t length;
+  size_t mappedLength;
+} ShoppingSource;
+
+// reads the whole file in blocks, growing the buffer until it fits
+static bool readShoppingSource(int fd, size_t sizeHint,
+                               ShoppingSource *source) {
+  size_t capacity = sizeHint + 1;
+
+  if (capacity < SHOPPING_READ_SIZE) {
+    capacity = SHOPPING_READ_SIZE;
+  }
+
+  source->data = malloc(capacity);
+  source->length = 0;
+  source->mappedLength = 0;
+
+  while (source->data != NULL) {
+    ssize_t count = read(fd, source->data + source->length,
+                         capacity - source->length - 1);
+
+    if (count == 0) {
+      return true;
+    }
+
+    if (count < 0) {
+      break;
+    }
+
+    source->length += count;
+
+    if (capacity - source->length == 1) {
+      capacity *= 2;
+      char *data = realloc(source->data, capacity);
+      if (data == NULL) {
+        break;
+      }
+      source->data = data;
+    }
+  }
+
+  free(source->data);
+  return false;
+}
+
+// maps a regular file of the given length, false if it can't be mapped - the
+// mapping is zero filled after the end of the file up to the end of its last
+// page, so the file can only be mapped when that leaves a byte to spare
+static bool mapShoppingSource(int fd, size_t length, ShoppingSource *source) {
+  long pageSize = sysconf(_SC_PAGESIZE);
+
+  if (pageSize <= 0 || length % pageSize == 0) {
+    return false;
+  }
+
+  // private and writable, the end of each line is marked in place
+  void *mapped =
+      mmap(NULL, length + 1, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  if (mapped == MAP_FAILED) {
+    return false;
+  }
+
+  source->data = mapped;
+  source->length = length;
+  source->mappedLength = length + 1;
+
+  return true;
+}
+
+static void releaseShoppingSource(ShoppingSource *source) {
+  if (source->mappedLength > 0) {
+    munmap(source->data, source->mappedLength);
+  } else {
+    free(source->data);
+  }
+}
+
+// adds one line to the shopping lists, a category or an item of the last one
+static void parseShoppingLine(List *shoppingLists, char *inputLine) {
+  // look for [ and
+  if (inputLine[0] == '[') {
+    // create a list from it
+    ShoppingList *tempSList = parseShoppingList(inputLine);
+    if (tempSList != NULL) {
+      insertBack(shoppingLists, tempSList);
+    }
+    return;
+  }
+
+  // get each input and add it to the list after that until found another
+  // [ and ] - items before the first category belong to no list
+  ShoppingItem *tempSItem = parseShoppingItem(inputLine);
+  ShoppingList *currentSList = getFromBack(shoppingLists);
+
+  if (tempSItem != NULL && currentSList != NULL) {
+    insertBack(currentSList->shoppingItems, tempSItem);
+  } else if (tempSItem != NULL) {
+    deleteShoppingItem(tempSItem);
+  }
+}
+
+// parses the shopping lists in a buffer, splitting it into lines in place -
+// the byte after the end of the text has to be writable
+static List *parseShoppingSource(char *data, size_t length) {
+  // initialize a list of shopping lists
+  List *shoppingLists = initializeList(shoppingListToString, deleteShoppingList,
+                                       compareShoppingList);
+
+  char *end = data + length;
+  char *inputLine = data;
+
+  while (inputLine < end) {
+    char *newline = memchr(inputLine, '\n', end - inputLine);
+    char *lineEnd = newline != NULL ? newline : end;
+    char *next = newline != NULL ? newline + 1 : end;
+
+    // the line ends before its line break
+    if (lineEnd > inputLine && lineEnd[-1] == '\r') {
+      lineEnd--;
+    }
+    *lineEnd = '\0';
+
+    // remove empty lines
+    if (lineEnd > inputLine) {
+      parseShoppingLine(shoppingLists, inputLine);
+    }
+
+    inputLine = next;
+  }
+
+  return shoppingLists;
+}
+
 // parse a shopping list file
 // does not use flex/bison just simple string manipulation techniques in C
+// the file is read or mapped whole and split into lines in place, so there
+// is no limit on the length of a line
 List *parseShoppingLists(char *fileName) {
-  int maxLineLength = 1024;
-
-  char *inputLine;
-
   if (fileName == NULL) {
     return NULL;
   }
 
-  FILE *file = fopen(fileName, "r");
+  int fd = open(fileName, O_RDONLY);
 
-  if (file == NULL) {
+  if (fd == -1) {
     printf("problem openning file\n");
     return NULL;
   }
 
-  // initialize a list of shopping lists
-  List *shoppingLists = initializeList(shoppingListToString, deleteShoppingList,
-                                       compareShoppingList);
+  struct stat info;
+  if (fstat(fd, &info) == -1) {
+    close(fd);
+    return NULL;
+  }
 
-  // start taking in lines lines of file
-  inputLine = malloc(sizeof(char) * maxLineLength);
+  // big regular files are mapped, anything else is read
+  ShoppingSource source;
+  bool loaded = false;
 
-  while (fgets(inputLine, maxLineLength, file) != NULL) {
-    // remove empty lines
-    if (inputLine[0] != 10 && inputLine[0] != 13) {
-      // look for [ and
-      if (inputLine[0] == '[') {
-        // create a list from it
-        ShoppingList *tempSList = parseShoppingList(inputLine);
-        insertBack(shoppingLists, tempSList);
-      } else {
-        // get each input and add it to the list after that until found another
-        // [ and ]
-        ShoppingItem *tempSItem = parseShoppingItem(inputLine);
-
-        if (tempSItem != NULL) {
-          ShoppingList *currentSList = getFromBack(shoppingLists);
-          insertBack(currentSList->shoppingItems, tempSItem);
-        }
+  if (S_ISREG(info.st_mode) && info.st_size >= SHOPPING_MAP_THRESHOLD) {
+    loaded = mapShoppingSource(fd, info.st_size, &source);
+  }
+
+  if (!loaded) {
+    loaded = readShoppingSource(
+        fd, S_ISREG(info.st_mode) ? (size_t)info.st_size : 0, &source);
+  }
+
+  close(fd);
+
+  if (!loaded) {
+    return NULL;
+  }
+
+  List *shoppingLists = parseShoppingSource(source.data, source.length);
+
+  releaseShoppingSource(&source);
+
+  return shoppingLists;
+}
+
+// parse the shopping lists in a buffer of the given length, it needs no NUL
+// terminator and is left as it is - returns NULL if malloc fails
+List *parseShoppingListsBuffer(const char *buffer, size_t length) {
+  if (buffer == NULL) {
+    return NULL;
+  }
+
+  // the lines are split in place, so they are split in a copy
+  char *source = malloc(length + 1);
+
+  if (source == NULL) {
+    return NULL;
+  }
+
+  memcpy(source, buffer, length);
+
+  List *shoppingLists = parseShoppingSource(source, length);
+
+  free(source);
+
+  return shoppingLists;
+}
+
+// * * * * * * * * * * * * * * * * * * * *
+// *****  Shopping Index Functions  ******
+// * * * * * * * * * * * * * * * * * * * *
+
+// finds a name without the whitespace around it
+static const char *trimShoppingKey(const char *text, size_t *length) {
+  const char *end = text + *length;
+
+  while (text < end && isspace((unsigned char)*text)) {
+    text++;
+  }
+
+  while (end > text && isspace((unsigned char)end[-1])) {
+    end--;
+  }
+
+  *length = end - text;
+
+  return text;
+}
+
+static unsigned char lowerShoppingChar(unsigned char c) {
+  return c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
+}
+
+// FNV-1a over the lower case bytes, lookups ignore ascii case
+static uint64_t hashShoppingKey(const char *key, size_t length) {
+  uint64_t hash = 14695981039346656037ULL;
+
+  for (size_t i = 0; i < length; i++) {
+    hash ^= lowerShoppingChar(key[i]);
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+static bool shoppingKeysEqual(const char *first, const char *second,
+                              size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    if (lowerShoppingChar(first[i]) != lowerShoppingChar(second[i])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// the slot holding the key, or the empty slot it would go in
+static ShoppingIndexEntry *probeShoppingIndex(ShoppingIndex *index,
+                                              const char *key, size_t length) {
+  size_t mask = index->capacity - 1;
+  size_t slot = hashShoppingKey(key, length) & mask;
+
+  while (true) {
+    ShoppingIndexEntry *entry = &index->entries[slot];
+
+    if (entry->key == NULL ||
+        (entry->keyLength == length &&
+         shoppingKeysEqual(entry->key, key, length))) {
+      return entry;
+    }
+
+    slot = (slot + 1) & mask;
+  }
+}
+
+// adds a name of the item, the first list and item to use a name keep it
+static void addShoppingKey(ShoppingIndex *index, const char *name,
+                           ShoppingList *list, ShoppingItem *item,
+                           size_t listPosition) {
+  size_t length = strlen(name);
+  const char *key = trimShoppingKey(name, &length);
+
+  if (length == 0) {
+    return;
+  }
+
+  ShoppingIndexEntry *entry = probeShoppingIndex(index, key, length);
+
+  if (entry->key == NULL) {
+    entry->key = key;
+    entry->keyLength = length;
+    entry->list = list;
+    entry->item = item;
+    entry->listPosition = listPosition;
+    index->count++;
+  }
+}
+
+// builds an index over every name and synonym in the shopping lists
+ShoppingIndex *createShoppingIndex(List *shoppingLists) {
+  if (shoppingLists == NULL) {
+    return NULL;
+  }
+
+  // count the names first so the table never has to grow
+  size_t names = 0;
+  ListIterator listIter = createIterator(shoppingLists);
+  ShoppingList *list;
+
+  while ((list = nextElement(&listIter)) != NULL) {
+    ListIterator itemIter = createIterator(list->shoppingItems);
+    ShoppingItem *item;
+
+    while ((item = nextElement(&itemIter)) != NULL) {
+      names++;
+      for (int i = 0; item->synonyms != NULL && item->synonyms[i] != NULL;
+           i++) {
+        names++;
       }
     }
   }
 
-  fclose(file);
-  free(inputLine);
+  ShoppingIndex *index = malloc(sizeof(ShoppingIndex));
 
-  return shoppingLists;
+  if (index == NULL) {
+    return NULL;
+  }
+
+  index->capacity = SHOPPING_INDEX_MIN_CAPACITY;
+  while (index->capacity < names * 2) {
+    index->capacity *= 2;
+  }
+
+  index->count = 0;
+  index->entries = calloc(index->capacity, sizeof(ShoppingIndexEntry));
+
+  if (index->entries == NULL) {
+    free(index);
+    return NULL;
+  }
+
+  listIter = createIterator(shoppingLists);
+
+  for (size_t position = 0; (list = nextElement(&listIter)) != NULL;
+       position++) {
+    ListIterator itemIter = createIterator(list->shoppingItems);
+    ShoppingItem *item;
+
+    while ((item = nextElement(&itemIter)) != NULL) {
+      addShoppingKey(index, item->name, list, item, position);
+      for (int i = 0; item->synonyms != NULL && item->synonyms[i] != NULL;
+           i++) {
+        addShoppingKey(index, item->synonyms[i], list, item, position);
+      }
+    }
+  }
+
+  return index;
+}
+
+void deleteShoppingIndex(ShoppingIndex *index) {
+  if (index == NULL) {
+    return;
+  }
+
+  free(index->entries);
+  free(index);
+}
+
+// finds the entry of a name or synonym, ignoring surrounding whitespace and
+// ascii case - returns NULL if no item has it
+ShoppingIndexEntry *findShoppingItem(ShoppingIndex *index, const char *name,
+                                     size_t length) {
+  if (index == NULL || name == NULL) {
+    return NULL;
+  }
+
+  const char *key = trimShoppingKey(name, &length);
+  ShoppingIndexEntry *entry = probeShoppingIndex(index, key, length);
+
+  return entry->key == NULL ? NULL : entry;
 }
 
 // * * * * * * * * * * * * * * * * * * * *
@@ -115,8 +463,8 @@ ShoppingList *parseShoppingList(char *inputLine) {
   // remove the [
   inputLine++;
 
-  // remove the ]
-  while (inputLine[i] != ']') {
+  // remove the ], the category runs to the end of the line without one
+  while (inputLine[i] != ']' && inputLine[i] != '\0') {
     i++;
   }
 
@@ -131,23 +479,21 @@ ShoppingList *parseShoppingList(char *inputLine) {
 // *****  Shopping Item Functions  *******
 // * * * * * * * * * * * * * * * * * * * *
 
+// an item, its synonym table and all of its text are allocated as one block
+// in that order, so freeing the item frees everything
 ShoppingItem *createShoppingItem(char *name) {
-  int loc = strcspn(name, "\r");
+  // the name ends at its line break, if it still has one
+  size_t length = strcspn(name, "\r\n");
 
-  if (loc != strlen(name)) {
-    name[loc] = 0;
-  }
-
-  loc = strcspn(name, "\n");
+  ShoppingItem *tempSItem = malloc(sizeof(ShoppingItem) + length + 1);
 
-  if (loc != strlen(name)) {
-    name[loc] = 0;
+  if (tempSItem == NULL) {
+    return NULL;
   }
 
-  ShoppingItem *tempSItem = malloc(sizeof(ShoppingItem));
-
-  tempSItem->name = malloc(strlen(name) + 1);
-  strcpy(tempSItem->name, name);
+  tempSItem->name = (char *)(tempSItem + 1);
+  memcpy(tempSItem->name, name, length);
+  tempSItem->name[length] = '\0';
 
   tempSItem->synonyms = NULL;
 
@@ -191,78 +537,77 @@ char *shoppingItemToString(void *data) {
 }
 
 void deleteShoppingItem(void *data) {
-  ShoppingItem *sItem = data;
-  free(sItem->name);
-
-  int i = 0;
-
-  if (sItem->synonyms != NULL) {
-    while (sItem->synonyms[i] != NULL) {
-      free(sItem->synonyms[i]);
-      i++;
-    }
-  }
-
-  free(sItem->synonyms);
-  free(sItem);
+  // the name and synonyms are in the same block as the item
+  free(data);
 }
 
 int compareShoppingItem(const void *first, const void *second) { return 0; }
 
+// the names of an item are separated by |, empty ones are skipped - the
+// line is read twice, once to size the item's block and once to fill it in
 ShoppingItem *parseShoppingItem(char *inputLine) {
   // check input
   if (inputLine == NULL || inputLine[0] == '\0' || inputLine[0] == '\n') {
     return NULL;
   }
 
-  // get the first string
-  int i = 0;
-  char *token;
-
-  token = strtok(inputLine, "|");
-
-  if (token == NULL) {
-    return NULL;
-  }
+  // the line ends at its line break, if it still has one
+  size_t length = strcspn(inputLine, "\r\n");
+  size_t names = 0;
+  size_t textSize = 0;
 
-  // create the item
-  ShoppingItem *tempSItem = createShoppingItem(token);
+  for (size_t start = 0; start < length;) {
+    char *bar = memchr(inputLine + start, '|', length - start);
+    size_t end = bar != NULL ? (size_t)(bar - inputLine) : length;
 
-  // get the first next synonym if there is any
-  token = strtok(NULL, "|");
+    if (end > start) {
+      names++;
+      textSize += end - start + 1;
+    }
 
-  // if there is none return the item as is
-  if (token == NULL) {
-    return tempSItem;
+    start = end + 1;
   }
 
-  // otherwise add the synonym and continue adding them
-  tempSItem->synonyms = malloc(sizeof(char *) * 2);
+  if (names == 0) {
+    return NULL;
+  }
 
-  tempSItem->synonyms[0] = malloc(sizeof(char) * strlen(token) + 1);
-  strcpy(tempSItem->synonyms[0], token);
-  tempSItem->synonyms[1] = NULL;
+  // the synonym table has a slot for each synonym and its NULL terminator,
+  // which together is one for each name
+  ShoppingItem *tempSItem =
+      malloc(sizeof(ShoppingItem) + sizeof(char *) * names + textSize);
 
-  i += 2;
+  if (tempSItem == NULL) {
+    return NULL;
+  }
 
-  // add the other synonyms, terminate with NULL
-  token = strtok(NULL, "|");
+  char **synonyms = (char **)(tempSItem + 1);
+  char *text = (char *)(synonyms + names);
+  size_t found = 0;
 
-  while (token != NULL) {
-    // reallocate to hold enough
-    tempSItem->synonyms =
-        realloc(tempSItem->synonyms, sizeof(char *) * (i + 1));
+  for (size_t start = 0; start < length;) {
+    char *bar = memchr(inputLine + start, '|', length - start);
+    size_t end = bar != NULL ? (size_t)(bar - inputLine) : length;
 
-    // add the new token
-    tempSItem->synonyms[i - 1] = malloc(sizeof(char) * strlen(token) + 1);
-    strcpy(tempSItem->synonyms[i - 1], token);
+    if (end > start) {
+      // the first name is the item's, the rest are its synonyms
+      if (found == 0) {
+        tempSItem->name = text;
+      } else {
+        synonyms[found - 1] = text;
+      }
+      found++;
 
-    // null terminate
-    tempSItem->synonyms[i] = NULL;
+      memcpy(text, inputLine + start, end - start);
+      text += end - start;
+      *text++ = '\0';
+    }
 
-    i++;
-    token = strtok(NULL, "|");
+    start = end + 1;
   }
 
+  synonyms[names - 1] = NULL;
+  tempSItem->synonyms = names > 1 ? synonyms : NULL;
+
   return tempSItem;
 }
@@ -0,0 +1,271 @@
+#include "../include/ShoppingPlan.h"
+
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// size of the first arena block for a plan
+#define PLAN_ARENA_SIZE 4096
+
+// the fewest slots the merge table starts with
+#define PLAN_TABLE_MIN_CAPACITY 16
+
+// a slot of the table the ingredients are merged with, it maps the key of a
+// line to its position in the plan
+typedef struct {
+  // NULL for an empty slot
+  const char *key;
+  size_t keyLength;
+  uint64_t hash;
+  size_t item;
+} PlanSlot;
+
+// a key being built, its buffer is reused for every ingredient
+typedef struct {
+  char *buffer;
+  size_t length;
+  size_t capacity;
+} PlanKey;
+
+// * * * * * * * * * * * * * * * * * * * *
+// *********  Helper Functions  **********
+// * * * * * * * * * * * * * * * * * * * *
+
+// finds the text without the whitespace around it, a NULL text is empty
+static const char *trimPlanText(const char *text, size_t *length) {
+  if (text == NULL) {
+    *length = 0;
+    return "";
+  }
+
+  const char *end = text + strlen(text);
+
+  while (text < end && isspace((unsigned char)*text)) {
+    text++;
+  }
+
+  while (end > text && isspace((unsigned char)end[-1])) {
+    end--;
+  }
+
+  *length = end - text;
+
+  return text;
+}
+
+// appends the text in lower case and a separator to the key
+static bool appendPlanKey(PlanKey *key, const char *text, size_t length) {
+  if (key->length + length + 1 > key->capacity) {
+    size_t capacity = (key->length + length + 1) * 2;
+    char *buffer = realloc(key->buffer, capacity);
+
+    if (buffer == NULL) {
+      return false;
+    }
+
+    key->buffer = buffer;
+    key->capacity = capacity;
+  }
+
+  for (size_t i = 0; i < length; i++) {
+    key->buffer[key->length++] = tolower((unsigned char)text[i]);
+  }
+
+  key->buffer[key->length++] = '\0';
+
+  return true;
+}
+
+// FNV-1a over the key
+static uint64_t hashPlanKey(const char *key, size_t length) {
+  uint64_t hash = 14695981039346656037ULL;
+
+  for (size_t i = 0; i < length; i++) {
+    hash ^= (unsigned char)key[i];
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+// orders the lines by list, then by first use
+static int comparePlanItems(const void *first, const void *second) {
+  const ShoppingPlanItem *firstItem = first;
+  const ShoppingPlanItem *secondItem = second;
+
+  if (firstItem->listPosition != secondItem->listPosition) {
+    return firstItem->listPosition < secondItem->listPosition ? -1 : 1;
+  }
+
+  if (firstItem->order != secondItem->order) {
+    return firstItem->order < secondItem->order ? -1 : 1;
+  }
+
+  return 0;
+}
+
+// * * * * * * * * * * * * * * * * * * * *
+// *********   Plan Functions   **********
+// * * * * * * * * * * * * * * * * * * * *
+
+// merges one ingredient into the plan, false if malloc fails
+static bool addPlanIngredient(ShoppingPlan *plan, PlanSlot *slots,
+                              size_t capacity, PlanKey *key,
+                              Direction *ingredient, ShoppingIndex *index) {
+  size_t nameLength, unitLength, textLength;
+  const char *name = trimPlanText(ingredient->value, &nameLength);
+  const char *unit = trimPlanText(ingredient->unit, &unitLength);
+  double quantity = directionQuantity(ingredient);
+  const char *text = "";
+
+  textLength = 0;
+  if (isnan(quantity)) {
+    text = trimPlanText(ingredient->quantityString, &textLength);
+  }
+
+  // ingredients that are on a shopping list go by the name of their item
+  ShoppingIndexEntry *entry = findShoppingItem(index, name, nameLength);
+
+  if (entry != NULL) {
+    name = trimPlanText(entry->item->name, &nameLength);
+  }
+
+  // the key is the name, the unit and the text of a quantity that isn't a
+  // number, so only quantities that can be added up are merged
+  key->length = 0;
+
+  if (!appendPlanKey(key, name, nameLength) ||
+      !appendPlanKey(key, unit, unitLength) ||
+      !appendPlanKey(key, isnan(quantity) ? "t" : "n", 1) ||
+      !appendPlanKey(key, text, textLength)) {
+    return false;
+  }
+
+  uint64_t hash = hashPlanKey(key->buffer, key->length);
+  size_t mask = capacity - 1;
+  PlanSlot *slot = &slots[hash & mask];
+
+  while (slot->key != NULL &&
+         (slot->hash != hash || slot->keyLength != key->length ||
+          memcmp(slot->key, key->buffer, key->length) != 0)) {
+    slot = &slots[(slot - slots + 1) & mask];
+  }
+
+  // an ingredient that is already on the plan only adds to it
+  if (slot->key != NULL) {
+    ShoppingPlanItem *item = vectorGet(&plan->items, slot->item);
+
+    if (!isnan(quantity)) {
+      item->quantity += quantity;
+    }
+
+    return true;
+  }
+
+  ShoppingPlanItem *item = vectorPush(&plan->items);
+  char *keyCopy = arenaAlloc(plan->arena, key->length);
+
+  if (item == NULL || keyCopy == NULL) {
+    return false;
+  }
+
+  memcpy(keyCopy, key->buffer, key->length);
+
+  slot->key = keyCopy;
+  slot->keyLength = key->length;
+  slot->hash = hash;
+  slot->item = vectorLength(&plan->items) - 1;
+
+  item->list = entry != NULL ? entry->list : NULL;
+  item->listPosition = entry != NULL ? entry->listPosition : SIZE_MAX;
+  item->name = arenaStrndup(plan->arena, name, nameLength);
+  item->unit = arenaStrndup(plan->arena, unit, unitLength);
+  item->quantity = quantity;
+  item->quantityText =
+      isnan(quantity) ? arenaStrndup(plan->arena, text, textLength) : NULL;
+  item->order = slot->item;
+
+  return item->name != NULL && item->unit != NULL &&
+         (item->quantityText != NULL || !isnan(quantity));
+}
+
+// merges the ingredients of the recipes by name, unit and kind of quantity
+// and groups them by the shopping list the index finds them on
+// the index may be NULL, then every line is on no list
+// returns NULL if malloc fails
+ShoppingPlan *createShoppingPlan(Recipe **recipes, size_t count,
+                                 ShoppingIndex *index) {
+  // count the ingredients first so the table never has to grow
+  size_t ingredients = 0;
+
+  for (size_t r = 0; r < count; r++) {
+    for (size_t i = 0; i < vectorLength(&recipes[r]->steps); i++) {
+      Step *step = vectorGet(&recipes[r]->steps, i);
+      ingredients += vectorLength(&step->ingredients);
+    }
+  }
+
+  size_t capacity = PLAN_TABLE_MIN_CAPACITY;
+  while (capacity < ingredients * 2) {
+    capacity *= 2;
+  }
+
+  Arena *arena = createArena(PLAN_ARENA_SIZE);
+  PlanSlot *slots = calloc(capacity, sizeof(PlanSlot));
+  ShoppingPlan *plan = arena != NULL ? arenaAlloc(arena, sizeof(ShoppingPlan))
+                                     : NULL;
+  PlanKey key = {NULL, 0, 0};
+
+  if (plan == NULL || slots == NULL) {
+    goto error;
+  }
+
+  plan->arena = arena;
+  initializeVector(&plan->items, arena, sizeof(ShoppingPlanItem), NULL);
+
+  for (size_t r = 0; r < count; r++) {
+    for (size_t i = 0; i < vectorLength(&recipes[r]->steps); i++) {
+      Step *step = vectorGet(&recipes[r]->steps, i);
+
+      for (size_t j = 0; j < vectorLength(&step->ingredients); j++) {
+        size_t *position = vectorGet(&step->ingredients, j);
+        Direction *ingredient = vectorGet(&step->directions, *position);
+
+        if (!addPlanIngredient(plan, slots, capacity, &key, ingredient,
+                               index)) {
+          goto error;
+        }
+      }
+    }
+  }
+
+  free(slots);
+  free(key.buffer);
+
+  // the lines are in order of first use, sorting by list groups them
+  if (vectorLength(&plan->items) > 0) {
+    qsort(plan->items.elements, vectorLength(&plan->items),
+          sizeof(ShoppingPlanItem), comparePlanItems);
+  }
+
+  return plan;
+
+error:
+  printf("error, malloc failed - createShoppingPlan\n");
+  free(slots);
+  free(key.buffer);
+  deleteArena(arena);
+  return NULL;
+}
+
+void deleteShoppingPlan(ShoppingPlan *plan) {
+  if (plan == NULL) {
+    return;
+  }
+
+  // the plan lives in its arena, so this frees everything at once
+  deleteArena(plan->arena);
+}
@@ -0,0 +1,127 @@
+#include "../include/StringBuilderLib.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// room made for the first append, enough for most single directions
+#define STRING_BUILDER_INITIAL_CAPACITY 256
+
+void initializeStringBuilder(StringBuilder* builder) {
+  builder->buffer = NULL;
+  builder->length = 0;
+  builder->capacity = 0;
+  builder->failed = false;
+}
+
+// makes sure there is room for extra more characters and the NUL, growing
+// the buffer to at least double its size
+static bool reserveStringBuilder(StringBuilder* builder, size_t extra) {
+  if (builder->failed) {
+    return false;
+  }
+
+  size_t needed = builder->length + extra + 1;
+
+  if (needed <= builder->capacity) {
+    return true;
+  }
+
+  size_t capacity = builder->capacity * 2;
+
+  if (capacity < STRING_BUILDER_INITIAL_CAPACITY) {
+    capacity = STRING_BUILDER_INITIAL_CAPACITY;
+  }
+
+  while (capacity < needed) {
+    capacity *= 2;
+  }
+
+  char* buffer = realloc(builder->buffer, capacity);
+
+  if (buffer == NULL) {
+    printf("error, malloc failed - reserveStringBuilder\n");
+    builder->failed = true;
+    return false;
+  }
+
+  builder->buffer = buffer;
+  builder->capacity = capacity;
+
+  return true;
+}
+
+void appendString(StringBuilder* builder, const char* string) {
+  size_t length = strlen(string);
+
+  if (!reserveStringBuilder(builder, length)) {
+    return;
+  }
+
+  memcpy(builder->buffer + builder->length, string, length + 1);
+  builder->length += length;
+}
+
+void appendBytes(StringBuilder* builder, const char* data, size_t length) {
+  if (!reserveStringBuilder(builder, length)) {
+    return;
+  }
+
+  memcpy(builder->buffer + builder->length, data, length);
+  builder->length += length;
+}
+
+void appendFormat(StringBuilder* builder, const char* format, ...) {
+  va_list args;
+
+  if (builder->failed) {
+    return;
+  }
+
+  // try to format straight into the room that is left
+  size_t room = builder->capacity - builder->length;
+  char* end = NULL;
+
+  if (builder->buffer != NULL) {
+    end = builder->buffer + builder->length;
+  }
+
+  va_start(args, format);
+  int length = vsnprintf(end, room, format, args);
+  va_end(args);
+
+  if (length < 0) {
+    return;
+  }
+
+  // it did not fit, so grow and format again
+  if ((size_t)length >= room) {
+    if (!reserveStringBuilder(builder, length)) {
+      return;
+    }
+
+    va_start(args, format);
+    vsnprintf(builder->buffer + builder->length, length + 1, format, args);
+    va_end(args);
+  }
+
+  builder->length += length;
+}
+
+char* finishStringBuilder(StringBuilder* builder) {
+  // an empty builder still gives an empty string
+  reserveStringBuilder(builder, 0);
+
+  if (builder->failed) {
+    free(builder->buffer);
+    initializeStringBuilder(builder);
+    return NULL;
+  }
+
+  char* result = builder->buffer;
+  result[builder->length] = '\0';
+  initializeStringBuilder(builder);
+
+  return result;
+}
@@ -0,0 +1,131 @@
+#include "../include/VectorLib.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// number of elements room is made for on the first push
+#define VECTOR_INITIAL_CAPACITY 8
+
+void initializeVector(Vector* vector, Arena* arena, size_t elementSize,
+                      void (*appendFunction)(StringBuilder* builder,
+                                             void* toBePrinted)) {
+  vector->elements = NULL;
+  vector->length = 0;
+  vector->capacity = 0;
+  vector->elementSize = elementSize;
+  vector->appendData = appendFunction;
+  vector->arena = arena;
+}
+
+void clearVector(Vector* vector) {
+  if (vector == NULL) {
+    return;
+  }
+
+  // arena storage is released with the arena
+  if (vector->arena == NULL) {
+    free(vector->elements);
+  }
+
+  vector->elements = NULL;
+  vector->length = 0;
+  vector->capacity = 0;
+}
+
+// doubles the room in the vector, arena vectors copy into a new block and leave
+// the old one to the arena
+static int growVector(Vector* vector) {
+  size_t capacity = vector->capacity * 2;
+  void* elements = NULL;
+
+  if (capacity == 0) {
+    capacity = VECTOR_INITIAL_CAPACITY;
+  }
+
+  if (vector->arena == NULL) {
+    elements = realloc(vector->elements, capacity * vector->elementSize);
+  } else {
+    elements = arenaAlloc(vector->arena, capacity * vector->elementSize);
+    if (elements != NULL && vector->length > 0) {
+      memcpy(elements, vector->elements, vector->length * vector->elementSize);
+    }
+  }
+
+  if (elements == NULL) {
+    printf("error, malloc failed - growVector\n");
+    return 0;
+  }
+
+  vector->elements = elements;
+  vector->capacity = capacity;
+
+  return 1;
+}
+
+void* vectorPush(Vector* vector) {
+  if (vector == NULL) {
+    return NULL;
+  }
+
+  if (vector->length == vector->capacity && !growVector(vector)) {
+    return NULL;
+  }
+
+  void* element =
+      (char*)vector->elements + vector->length * vector->elementSize;
+  memset(element, 0, vector->elementSize);
+  vector->length++;
+
+  return element;
+}
+
+void* vectorGet(Vector* vector, size_t index) {
+  if (vector == NULL || index >= vector->length) {
+    return NULL;
+  }
+
+  return (char*)vector->elements + index * vector->elementSize;
+}
+
+void* vectorBack(Vector* vector) {
+  if (vector == NULL || vector->length == 0) {
+    return NULL;
+  }
+
+  return vectorGet(vector, vector->length - 1);
+}
+
+size_t vectorLength(Vector* vector) { return vector->length; }
+
+void appendVector(StringBuilder* builder, Vector* vector) {
+  for (size_t i = 0; i < vector->length; i++) {
+    appendString(builder, "\n");
+    vector->appendData(builder, vectorGet(vector, i));
+  }
+}
+
+void appendVectorDelim(StringBuilder* builder, Vector* vector, char* delim) {
+  for (size_t i = 0; i < vector->length; i++) {
+    appendFormat(builder, "%s %zu:\n", delim, i + 1);
+    vector->appendData(builder, vectorGet(vector, i));
+  }
+}
+
+char* vectorToString(Vector* vector) {
+  StringBuilder builder;
+  initializeStringBuilder(&builder);
+
+  appendVector(&builder, vector);
+
+  return finishStringBuilder(&builder);
+}
+
+char* vectorToStringDelim(Vector* vector, char* delim) {
+  StringBuilder builder;
+  initializeStringBuilder(&builder);
+
+  appendVectorDelim(&builder, vector, delim);
+
+  return finishStringBuilder(&builder);
+}
@@ -1,5 +1,14 @@
+import json
+import math
+import mmap
+import os
+import pickle
+import struct
+import sys
+import tempfile
+import threading
 import unittest
-from typing import Dict, Tuple
+from typing import Dict, List, Tuple
 
 import cooklang
 import yaml
@@ -11,6 +20,25 @@ POSSIBLE_FIELDS = {
     "units",
 }
 
+# the canonical test cases, read once for every test that uses them
+with open("testing/tests.yaml") as tests_input_file:
+    CANONICAL_TESTS = yaml.safe_load(tests_input_file)["tests"]
+CANONICAL_SOURCES = [test["source"] for test in CANONICAL_TESTS.values()]
+
+
+def write_recipe_files(directory: str, sources: List[str]) -> List[str]:
+    """
+    Returns:
+        the paths of the files each source was written to, in order
+    """
+    paths = []
+    for i, source in enumerate(sources):
+        path = os.path.join(directory, str(i) + ".cook")
+        with open(path, "w") as recipe_file:
+            recipe_file.write(source)
+        paths.append(path)
+    return paths
+
 
 def pretty_print_result(result: Dict) -> None:
     j = 0
@@ -188,18 +216,14 @@ class TestTestingProcess(unittest.TestCase):
 
 class TestCanonical(unittest.TestCase):
     def test_canonical(self) -> None:
-        # parse input test file and get each test
-        with open("testing/tests.yaml") as tests_input_file:
-            tests_input = yaml.safe_load(tests_input_file)
-
         passed = 0
         total = 0
         unpassed = []
 
         # for each test found, put the test in the file
-        for test in tests_input["tests"]:
-            expected_result = tests_input["tests"][test]["result"]
-            r, actual_result = test_parsing(tests_input["tests"][test]["source"], expected_result)
+        for test in CANONICAL_TESTS:
+            expected_result = CANONICAL_TESTS[test]["result"]
+            r, actual_result = test_parsing(CANONICAL_TESTS[test]["source"], expected_result)
 
             if r:
                 passed += 1
@@ -218,5 +242,490 @@ class TestCanonical(unittest.TestCase):
         self.assertEqual(unpassed, [])
 
 
+class TestScanner(unittest.TestCase):
+    def test_plain_runs(self) -> None:
+        # plain text next to characters the fast path leaves to the DFA
+        source = "stir-fry the [onions] gently, then add \u00e9 and @salt{1%tsp}\n"
+        steps = cooklang.parseRecipe(source)["steps"]
+        self.assertEqual(steps[0][0], {"type": "text", "value": "stir-fry the [onions] gently, then add \u00e9 and "})
+
+        steps = cooklang.parseRecipe("a  @salt{}\nTwo words\t#pot{}\n")["steps"]
+        self.assertEqual(steps[0][0], {"type": "text", "value": "a  "})
+        self.assertEqual(steps[1][0], {"type": "text", "value": "Two words\t"})
+
+
+class TestRecipeType(unittest.TestCase):
+    def test_to_dict(self) -> None:
+        for source in CANONICAL_SOURCES:
+            recipe = cooklang.Recipe(source)
+            self.assertEqual(recipe.to_dict(), cooklang.parseRecipe(source))
+
+        with self.assertRaises(TypeError):
+            cooklang.Recipe(None)
+
+    def test_lazy(self) -> None:
+        for source in CANONICAL_SOURCES:
+            expected = cooklang.parseRecipe(source)
+            recipe = cooklang.parseRecipe(source, lazy=True)
+
+            self.assertIsInstance(recipe, cooklang.Recipe)
+            self.assertEqual(recipe.metadata, expected["metadata"])
+            self.assertEqual(recipe.ingredients, expected["ingredients"])
+            self.assertEqual(recipe.cookware, expected["cookware"])
+            self.assertEqual(recipe.steps, expected["steps"])
+
+            # each part is only built once
+            self.assertIs(recipe.steps, recipe.steps)
+
+    def test_shared_directions(self) -> None:
+        # like in the dict, the ingredients and cookware are the objects in
+        # the steps, whichever part is read first
+        source = "Add @salt{1%g} to the #pot{}.\nStir in @pepper{}.\n"
+
+        for first in ("ingredients", "steps"):
+            recipe = cooklang.Recipe(source)
+            getattr(recipe, first)
+            expected = recipe.to_dict()
+
+            self.assertIs(recipe.ingredients[0], recipe.steps[0][1])
+            self.assertIs(recipe.cookware[0], recipe.steps[0][3])
+            self.assertIs(recipe.ingredients[1], recipe.steps[1][1])
+            self.assertIs(expected["ingredients"][0], expected["steps"][0][1])
+
+            recipe.steps[0][1]["name"] = "sea salt"
+            self.assertEqual(recipe.ingredients[0]["name"], "sea salt")
+
+    def test_pickle(self) -> None:
+        for source in CANONICAL_SOURCES:
+            recipe = cooklang.Recipe(source)
+            copy = pickle.loads(pickle.dumps(recipe))
+
+            self.assertIsInstance(copy, cooklang.Recipe)
+            self.assertEqual(copy.to_dict(), recipe.to_dict())
+            self.assertEqual(cooklang.Recipe.from_bytes(recipe.to_bytes()).steps, recipe.steps)
+
+        data = cooklang.Recipe(">> servings: 2\nAdd @salt{1%tsp}.\n").to_bytes()
+        for bad in (b"", b"recipe", data[:-1], data + b"\0"):
+            with self.assertRaises(ValueError):
+                cooklang.Recipe.from_bytes(bad)
+
+    def test_corrupted_bytes(self) -> None:
+        header = b"CKR\x01" + struct.pack("<II", 0, 1) + struct.pack("<I", 1)
+        quantity = struct.pack("<d", -1.0)
+
+        # only a timer can be without a name, and unknown flags are rejected
+        for kind in range(3):
+            with self.assertRaises(ValueError):
+                cooklang.Recipe.from_bytes(header + bytes([kind, 0]) + quantity)
+        with self.assertRaises(ValueError):
+            cooklang.Recipe.from_bytes(header + b"\x03\x08" + quantity)
+        timer = cooklang.Recipe.from_bytes(header + b"\x03\x00" + quantity)
+        self.assertEqual(timer.steps, [[{"type": "timer", "name": "", "quantity": "", "units": ""}]])
+
+        # every single byte change either fails cleanly or gives a recipe,
+        # text that is no longer UTF-8 fails when it is read
+        data = cooklang.Recipe(">> servings: 2\nAdd @salt{1%tsp} to the #pot{} for ~{2%min}.\n").to_bytes()
+        for i in range(len(data)):
+            for value in (0, 1, 3, 0x7F, 0xFF):
+                corrupted = data[:i] + bytes([value]) + data[i + 1 :]
+                try:
+                    cooklang.Recipe.from_bytes(corrupted).to_dict()
+                except ValueError:
+                    pass
+
+
+class TestArguments(unittest.TestCase):
+    def test_parse_recipe_arguments(self) -> None:
+        expected = cooklang.parseRecipe("Add @salt{}\n")
+        self.assertEqual(cooklang.parseRecipe(source="Add @salt{}\n"), expected)
+        self.assertEqual(cooklang.parseRecipe("Add @salt{}\n", lazy=False), expected)
+
+        with self.assertRaises(TypeError):
+            cooklang.parseRecipe()
+        with self.assertRaises(TypeError):
+            cooklang.parseRecipe("a", source="b")
+        with self.assertRaises(TypeError):
+            cooklang.parseRecipe("a", unknown=True)
+        with self.assertRaises(ValueError):
+            cooklang.parseRecipe("a\0b")
+
+    def test_print_recipe(self) -> None:
+        source = ">> servings: 2\nAdd @salt{1%g} to the #pot{} for ~{2%min}.\n"
+
+        def printed(recipe) -> bytes:
+            sys.stdout.flush()
+            saved = os.dup(1)
+            with tempfile.TemporaryFile() as output:
+                os.dup2(output.fileno(), 1)
+                try:
+                    cooklang.printRecipe(recipe)
+                finally:
+                    os.dup2(saved, 1)
+                    os.close(saved)
+                output.seek(0)
+                return output.read()
+
+        expected = printed(cooklang.parseRecipe(source))
+        self.assertIn(b"  - salt, 1.000 g\n", expected)
+        self.assertEqual(printed(cooklang.parseRecipe(source, lazy=True)), expected)
+        self.assertEqual(printed(cooklang.Recipe(source)), expected)
+
+        for bad in (None, source, [source]):
+            with self.assertRaises(TypeError):
+                cooklang.printRecipe(bad)
+
+    def test_buffers(self) -> None:
+        source = "Add @salt{1%tsp} and a pinch of caf\u00e9 \u2014 stir\n"
+        expected = cooklang.parseRecipe(source)
+        encoded = source.encode()
+
+        for buffer in (encoded, bytearray(encoded), memoryview(encoded)):
+            self.assertEqual(cooklang.parseRecipe(buffer), expected)
+            self.assertEqual(cooklang.Recipe(buffer).to_dict(), expected)
+
+        # no NUL at the end of the bytes is needed
+        self.assertEqual(cooklang.parseRecipe(memoryview(encoded + b"trailing")[: len(encoded)]), expected)
+        self.assertEqual(cooklang.parse_many([encoded, source, bytearray(encoded)]), [expected] * 3)
+
+        with tempfile.TemporaryFile() as recipe_file:
+            recipe_file.write(encoded)
+            recipe_file.flush()
+            with mmap.mmap(recipe_file.fileno(), 0, access=mmap.ACCESS_READ) as mapped:
+                self.assertEqual(cooklang.parseRecipe(mapped), expected)
+
+        with self.assertRaises(TypeError):
+            cooklang.parseRecipe(42)
+        with self.assertRaises(BufferError):
+            cooklang.parseRecipe(memoryview(encoded)[::2])
+
+    def test_interned_keys(self) -> None:
+        recipe = cooklang.parseRecipe("Add @salt{1%tsp} to the #pot{}\n")
+        for direction in recipe["steps"][0]:
+            for key, value in direction.items():
+                self.assertIs(key, sys.intern(key))
+            self.assertIs(direction["type"], sys.intern(direction["type"]))
+
+
+class TestIngredientColumns(unittest.TestCase):
+    def test_matches_ingredients(self) -> None:
+        recipes = cooklang.parse_many(CANONICAL_SOURCES, lazy=True)
+        columns = cooklang.ingredient_columns(recipes)
+
+        rows = []
+        for index, recipe in enumerate(recipes):
+            rows += [(index, ingredient) for ingredient in recipe.ingredients]
+
+        self.assertEqual(list(columns["recipe"]), [index for index, _ in rows])
+        self.assertEqual(len(columns["name_offsets"]), len(rows) + 1)
+
+        for row, (_, ingredient) in enumerate(rows):
+            names = columns["names"][columns["name_offsets"][row] : columns["name_offsets"][row + 1]]
+            units = columns["units"][columns["unit_offsets"][row] : columns["unit_offsets"][row + 1]]
+            self.assertEqual(names.decode(), ingredient["name"])
+            self.assertEqual(units.decode(), ingredient["units"])
+
+            try:
+                expected = float(ingredient["quantity"])
+            except ValueError:
+                expected = math.nan
+
+            if math.isfinite(expected):
+                self.assertEqual(columns["quantity"][row], expected)
+            else:
+                self.assertTrue(math.isnan(columns["quantity"][row]))
+
+    def test_quantities(self) -> None:
+        # quantities that don't stand for a finite number are NaN, the same
+        # as on a shopping plan
+        recipe = cooklang.Recipe("Add @salt{2%g}, @pepper{1e999%g}, @oil{inf%ml} and @sugar{some}\n")
+        quantities = cooklang.ingredient_columns([recipe])["quantity"]
+        self.assertEqual(quantities[0], 2)
+        self.assertTrue(all(math.isnan(quantity) for quantity in quantities[1:]))
+
+    def test_arguments(self) -> None:
+        columns = cooklang.ingredient_columns([])
+        self.assertEqual(list(columns["name_offsets"]), [0])
+        self.assertEqual(columns["names"], b"")
+
+        with self.assertRaises(TypeError):
+            cooklang.ingredient_columns([cooklang.parseRecipe("Add @salt{}\n")])
+
+
+class TestShoppingList(unittest.TestCase):
+    def test_items(self) -> None:
+        with tempfile.TemporaryDirectory() as directory:
+            path = os.path.join(directory, "aisle.conf")
+            with open(path, "w") as aisle_file:
+                aisle_file.write("[fruit]\napple|pink lady\nbanana\n\n[dairy]\nmilk|semi skimmed|whole\n")
+
+            lists = cooklang.parseShoppingList(path)
+            self.assertEqual([shopping_list["category"] for shopping_list in lists], ["fruit", "dairy"])
+            self.assertEqual([item["name"] for item in lists[0]["items"]], ["apple", "banana"])
+
+            # every item starts from its own first synonym
+            self.assertEqual([item["synonyms"] for item in lists[1]["items"]], [["semi skimmed", "whole"]])
+
+            with self.assertRaises(OSError):
+                cooklang.parseShoppingList(os.path.join(directory, "missing.conf"))
+
+    def test_buffers(self) -> None:
+        text = "[fruit]\napple|pink lady\nbanana\n\n[dairy]\nmilk|semi skimmed|whole"
+        with tempfile.TemporaryDirectory() as directory:
+            path = os.path.join(directory, "aisle.conf")
+            with open(path, "w") as aisle_file:
+                aisle_file.write(text)
+            expected = cooklang.parseShoppingList(path)
+
+        data = bytearray(text.encode())
+        for source in (text, text.encode(), data, memoryview(data)):
+            self.assertEqual(cooklang.parse_shopping_list_buffer(source), expected)
+            self.assertEqual(cooklang.ShoppingIndex.from_buffer(source).find("whole"), ("dairy", "milk"))
+
+        # the buffer is left as it was
+        self.assertEqual(data, text.encode())
+        self.assertEqual(cooklang.parse_shopping_list_buffer(b""), [])
+
+        with self.assertRaises(TypeError):
+            cooklang.parse_shopping_list_buffer(None)
+
+    def test_empty_names(self) -> None:
+        # empty names between separators are skipped
+        with tempfile.TemporaryDirectory() as directory:
+            path = os.path.join(directory, "aisle.conf")
+            with open(path, "w") as aisle_file:
+                aisle_file.write("[fruit]\n|apple||pink lady|\n||\nbanana|\n")
+
+            items = cooklang.parseShoppingList(path)[0]["items"]
+            self.assertEqual(items, [{"name": "apple", "synonyms": ["pink lady"]}, {"name": "banana", "synonyms": []}])
+
+    def test_long_lines(self) -> None:
+        # lines of any length, windows line endings, no final line break and
+        # files big enough to be mapped
+        synonyms = ["synonym %d" % i for i in range(20000)]
+        text = "[pantry]\r\nrice|" + "|".join(synonyms) + "\r\n\r\n[dairy]\r\nmilk"
+        with tempfile.TemporaryDirectory() as directory:
+            for size in (len(text), 1 << 18):
+                path = os.path.join(directory, str(size) + ".conf")
+                with open(path, "w", newline="") as aisle_file:
+                    aisle_file.write(text + "|x" * ((size - len(text)) // 2))
+
+                lists = cooklang.parseShoppingList(path)
+                self.assertEqual([shopping_list["category"] for shopping_list in lists], ["pantry", "dairy"])
+                self.assertEqual(lists[0]["items"][0]["synonyms"], synonyms)
+                self.assertEqual(lists[1]["items"][0]["name"], "milk")
+
+    def test_index(self) -> None:
+        with tempfile.TemporaryDirectory() as directory:
+            path = os.path.join(directory, "aisle.conf")
+            with open(path, "w") as aisle_file:
+                aisle_file.write("[fruit]\napple|pink lady\nbanana\n\n[dairy]\nmilk|semi skimmed|whole\nApple\n")
+
+            index = cooklang.ShoppingIndex(path)
+            self.assertEqual(len(index), 6)
+            self.assertEqual(index.find("banana"), ("fruit", "banana"))
+            self.assertEqual(index.find(" Pink Lady "), ("fruit", "apple"))
+            self.assertEqual(index.find("whole"), ("dairy", "milk"))
+            self.assertEqual(index.find("APPLE"), ("fruit", "apple"))
+            self.assertIsNone(index.find("bread"))
+            self.assertIsNone(index.find(""))
+
+            with self.assertRaises(OSError):
+                cooklang.ShoppingIndex(os.path.join(directory, "missing.conf"))
+
+    def test_build_shopping_list(self) -> None:
+        with tempfile.TemporaryDirectory() as directory:
+            path = os.path.join(directory, "aisle.conf")
+            with open(path, "w") as aisle_file:
+                aisle_file.write("[fruit]\napple|pink lady\nbanana\n\n[dairy]\nmilk|semi skimmed|whole\n")
+            index = cooklang.ShoppingIndex(path)
+
+        recipes = [
+            cooklang.Recipe("Add @milk{200%ml}, @Pink Lady{2}, @salt and @flour{1/2%cup} to the bowl.\n"),
+            cooklang.Recipe("Add @whole{100%ML}, @apple{1}, @salt and @flour{some%cup} to the bowl.\n"),
+        ]
+
+        self.assertEqual(
+            cooklang.build_shopping_list(recipes, index),
+            [
+                {"category": "fruit", "items": [{"name": "apple", "quantity": 3.0, "units": ""}]},
+                {"category": "dairy", "items": [{"name": "milk", "quantity": 300.0, "units": "ml"}]},
+                {
+                    "category": None,
+                    "items": [
+                        {"name": "salt", "quantity": "some", "units": ""},
+                        {"name": "flour", "quantity": 0.5, "units": "cup"},
+                        {"name": "flour", "quantity": "some", "units": "cup"},
+                    ],
+                },
+            ],
+        )
+
+        # without an index nothing is on a list, and only equal names merge
+        plan = cooklang.build_shopping_list(recipes)
+        self.assertEqual([group["category"] for group in plan], [None])
+        self.assertEqual(len(plan[0]["items"]), 7)
+        self.assertEqual(cooklang.build_shopping_list([], index), [])
+
+        with self.assertRaises(TypeError):
+            cooklang.build_shopping_list([{}], index)
+        with self.assertRaises(TypeError):
+            cooklang.build_shopping_list(recipes, path)
+
+
+class TestParseToJsonBytes(unittest.TestCase):
+    def test_matches_json_dumps(self) -> None:
+        sources = list(CANONICAL_SOURCES)
+        # escapes, non ascii text and a repeated metadata identifier
+        sources.append('>> a: 1\n>> b: "q\\\\"\n>> a: 2\nAdd @s\u00e1lt{1%tsp}\tand #\x01pot{}.\n')
+
+        for source in sources:
+            expected = json.dumps(cooklang.parseRecipe(source), ensure_ascii=False, separators=(",", ":"))
+            self.assertEqual(cooklang.parse_to_json_bytes(source), expected.encode())
+            self.assertEqual(cooklang.parse_to_json_bytes(source.encode()), expected.encode())
+
+    def test_many_metadata(self) -> None:
+        # repeated identifiers keep their first place and take their last
+        # value, the same as in a dict
+        lines = [">> key%d: value%d\n" % (i % 997, i) for i in range(20000)]
+        lines += [">> single%d: %d\n" % (i, i) for i in range(3000)]
+        source = "".join(lines) + "Add @salt{}\n"
+
+        expected = json.dumps(cooklang.parseRecipe(source), ensure_ascii=False, separators=(",", ":"))
+        self.assertEqual(cooklang.parse_to_json_bytes(source), expected.encode())
+
+    def test_invalid_utf8(self) -> None:
+        # text that isn't UTF-8 fails in both, unless it is left out of the
+        # recipe like a comment is
+        for source in (b"Add caf\xe9\n", b">> title: \xff\n", b"Add @s\xc3{}\n", b"Add \xed\xa0\x80\n"):
+            with self.assertRaises(UnicodeDecodeError):
+                cooklang.parseRecipe(source)
+            with self.assertRaises(UnicodeDecodeError):
+                cooklang.parse_to_json_bytes(source)
+
+        source = b"-- caf\xe9\nAdd salt\n"
+        expected = json.dumps(cooklang.parseRecipe(source), ensure_ascii=False, separators=(",", ":"))
+        self.assertEqual(cooklang.parse_to_json_bytes(source), expected.encode())
+
+
+class TestParseRecipeFile(unittest.TestCase):
+    def test_matches_parse_recipe(self) -> None:
+        with tempfile.TemporaryDirectory() as directory:
+            paths = write_recipe_files(directory, CANONICAL_SOURCES)
+
+            for path, source in zip(paths, CANONICAL_SOURCES):
+                expected = cooklang.parseRecipe(source)
+                self.assertEqual(cooklang.parseRecipeFile(path), expected)
+                self.assertEqual(cooklang.parseRecipeFile(path.encode(), lazy=True).steps, expected["steps"])
+
+            with self.assertRaises(FileNotFoundError):
+                cooklang.parseRecipeFile(os.path.join(directory, "missing.cook"))
+
+
+class TestModuleState(unittest.TestCase):
+    def test_recipe_type(self) -> None:
+        recipe = cooklang.Recipe("Add @salt{1%tsp}.\n")
+        self.assertIs(type(recipe), cooklang.Recipe)
+        self.assertEqual(type(recipe).__module__, "cooklang")
+        with self.assertRaises(TypeError):
+            type(cooklang.iter_parse([]))()
+
+    def test_threads(self) -> None:
+        expected = [cooklang.parseRecipe(source) for source in CANONICAL_SOURCES]
+
+        def parse_all() -> None:
+            for _ in range(20):
+                self.assertEqual([cooklang.parseRecipe(source) for source in CANONICAL_SOURCES], expected)
+
+        threads = [threading.Thread(target=parse_all) for _ in range(4)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+
+class TestIterParse(unittest.TestCase):
+    def setUp(self) -> None:
+        self.sources = CANONICAL_SOURCES
+        self.directory = tempfile.TemporaryDirectory()
+        self.paths = write_recipe_files(self.directory.name, self.sources * 4)
+
+    def tearDown(self) -> None:
+        self.directory.cleanup()
+
+    def test_ordered(self) -> None:
+        results = list(cooklang.iter_parse(self.paths, workers=3, ordered=True))
+        self.assertEqual([path for path, _ in results], self.paths)
+        self.assertEqual([recipe for _, recipe in results], [cooklang.parseRecipe(s) for s in self.sources * 4])
+
+    def test_unordered(self) -> None:
+        results = dict(cooklang.iter_parse(self.paths, workers=4))
+        self.assertEqual(sorted(results), sorted(self.paths))
+        for path, recipe in results.items():
+            self.assertEqual(recipe, cooklang.parseRecipeFile(path))
+
+        lazy = list(cooklang.iter_parse(self.paths, lazy=True))
+        self.assertTrue(all(isinstance(recipe, cooklang.Recipe) for _, recipe in lazy))
+        self.assertEqual(list(cooklang.iter_parse([])), [])
+
+    def test_stops_early(self) -> None:
+        # dropping the iterator part way has to stop and join the workers
+        iterator = cooklang.iter_parse(self.paths, workers=2)
+        next(iterator)
+        del iterator
+
+        iterator = cooklang.iter_parse([os.path.join(self.directory.name, "missing.cook")])
+        with self.assertRaises(FileNotFoundError):
+            next(iterator)
+
+
+class TestParseMany(unittest.TestCase):
+    def setUp(self) -> None:
+        self.sources = CANONICAL_SOURCES
+
+    def test_matches_parse_recipe(self) -> None:
+        expected = [cooklang.parseRecipe(source) for source in self.sources]
+        self.assertEqual(cooklang.parse_many(self.sources, workers=4), expected)
+        self.assertEqual(cooklang.parse_many(self.sources, workers=1), expected)
+        self.assertEqual(cooklang.parse_many([]), [])
+
+    def test_paths(self) -> None:
+        with tempfile.TemporaryDirectory() as directory:
+            paths = write_recipe_files(directory, self.sources)
+
+            expected = [cooklang.parseRecipe(source) for source in self.sources]
+            self.assertEqual(cooklang.parse_many(paths, paths=True), expected)
+
+            # a missing file fails the same way in every function that reads
+            # files
+            missing = os.path.join(directory, "missing.cook")
+            with self.assertRaises(FileNotFoundError) as context:
+                cooklang.parse_many(paths + [missing], paths=True)
+            self.assertEqual(context.exception.filename, missing)
+            with self.assertRaises(FileNotFoundError):
+                cooklang.parseRecipeFile(missing)
+            with self.assertRaises(FileNotFoundError):
+                list(cooklang.iter_parse([missing]))
+
+    def test_long_file(self) -> None:
+        # longer than a single read, the whole file still has to be one buffer
+        source = "\n".join(self.sources * 50) + "\n"
+        with tempfile.TemporaryDirectory() as directory:
+            (path,) = write_recipe_files(directory, [source])
+
+            expected = cooklang.parseRecipe(source)
+            self.assertEqual(cooklang.parse_many([path], paths=True), [expected])
+
+    def test_mapped_files(self) -> None:
+        # big enough to be mapped, with and without room after the last page
+        # for the padding the scanner needs
+        with tempfile.TemporaryDirectory() as directory:
+            for size in (1 << 17, (1 << 17) + 100, (1 << 17) - 1):
+                source = ("Add @salt{1%tsp} and stir.\n" * (size // 28 + 1))[: size - 1] + "\n"
+                (path,) = write_recipe_files(directory, [source])
+
+                expected = cooklang.parseRecipe(source)
+                self.assertEqual(cooklang.parse_many([path], paths=True), [expected])
+
+
 if __name__ == "__main__":
     unittest.main()